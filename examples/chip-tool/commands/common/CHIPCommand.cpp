@@ -165,6 +165,9 @@ CHIP_ERROR CHIPCommand::MaybeSetUpStack()
     }
     ReturnLogErrorOnFailure(DeviceControllerFactory::GetInstance().Init(factoryInitParams));
 
+    // Process the CASE signature generation and verification of concurrent session establishments in parallel.
+    ReturnLogErrorOnFailure(chip::DeviceLayer::PlatformMgr().StartBackgroundEventLoopTask());
+
     auto systemState = chip::Controller::DeviceControllerFactory::GetInstance().GetSystemState();
     VerifyOrReturnError(nullptr != systemState, CHIP_ERROR_INCORRECT_STATE);
 
@@ -238,12 +241,21 @@ CHIP_ERROR CHIPCommand::EnsureCommissionerForIdentity(std::string identity)
 {
     chip::NodeId nodeId;
     ReturnErrorOnFailure(GetIdentityNodeId(identity, &nodeId));
-    CommissionerIdentity lookupKey{ identity, nodeId };
+    return EnsureCommissionerForIdentity(identity, nodeId);
+}
+
+CHIP_ERROR CHIPCommand::EnsureCommissionerForIdentity(std::string identity, chip::NodeId localNodeId)
+{
+    CommissionerIdentity lookupKey{ identity, localNodeId };
     if (mCommissioners.find(lookupKey) != mCommissioners.end())
     {
         return CHIP_NO_ERROR;
     }
 
+    chip::NodeId identityNodeId;
+    ReturnErrorOnFailure(GetIdentityNodeId(identity, &identityNodeId));
+    lookupKey.mIsAdditionalController = (localNodeId != identityNodeId);
+
     // Need to initialize the commissioner.
     chip::FabricId fabricId;
     if (identity == kIdentityAlpha)
@@ -466,9 +478,62 @@ chip::Controller::DeviceCommissioner & CHIPCommand::GetCommissioner(std::string
     return *item->second;
 }
 
+chip::Controller::DeviceCommissioner & CHIPCommand::GetCommissioner(std::string identity, chip::NodeId localNodeId)
+{
+    VerifyOrDie(EnsureCommissionerForIdentity(identity, localNodeId) == CHIP_NO_ERROR);
+
+    CommissionerIdentity lookupKey{ identity, localNodeId };
+    auto item = mCommissioners.find(lookupKey);
+    VerifyOrDie(item != mCommissioners.end());
+    return *item->second;
+}
+
+CHIP_ERROR CHIPCommand::EnsureCommissionerAdminCAT(std::string identity, chip::CASEAuthTag & adminCAT)
+{
+    VerifyOrReturnError(identity != kIdentityNull, CHIP_ERROR_INVALID_ARGUMENT);
+    ChipDeviceCommissioner & commissioner = GetCommissioner(identity);
+
+    ReturnLogErrorOnFailure(mCommissionerStorage.Init(identity.c_str(), GetStorageDirectory().ValueOr(nullptr)));
+    chip::CATValues cats = mCommissionerStorage.GetCommissionerCATs();
+    for (auto cat : cats.values)
+    {
+        if (cat != chip::kUndefinedCAT)
+        {
+            adminCAT = cat;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    adminCAT       = chip::GetAdminCATWithVersion(1);
+    cats.values[0] = adminCAT;
+    ReturnLogErrorOnFailure(mCommissionerStorage.SetCommissionerCATs(cats));
+    ReturnLogErrorOnFailure(mCredIssuerCmds->InitializeCredentialsIssuer(mCommissionerStorage));
+
+    uint8_t rcac[chip::Controller::kMaxCHIPDERCertLength];
+    uint8_t icac[chip::Controller::kMaxCHIPDERCertLength];
+    uint8_t noc[chip::Controller::kMaxCHIPDERCertLength];
+    chip::MutableByteSpan rcacSpan(rcac);
+    chip::MutableByteSpan icacSpan(icac);
+    chip::MutableByteSpan nocSpan(noc);
+
+    chip::Crypto::P256Keypair ephemeralKey;
+    ReturnLogErrorOnFailure(ephemeralKey.Initialize(chip::Crypto::ECPKeyTarget::ECDSA));
+    ReturnLogErrorOnFailure(mCredIssuerCmds->GenerateControllerNOCChain(commissioner.GetNodeId(), commissioner.GetFabricId(), cats,
+                                                                        ephemeralKey, rcacSpan, icacSpan, nocSpan));
+    return commissioner.UpdateControllerNOCChain(nocSpan, icacSpan, &ephemeralKey, /* operationalKeypairExternalOwned = */ false);
+}
+
 void CHIPCommand::ShutdownCommissioner(const CommissionerIdentity & key)
 {
-    mCommissioners[key].get()->Shutdown();
+    ChipDeviceCommissioner * commissioner = mCommissioners[key].get();
+    chip::FabricIndex fabricIndex         = commissioner->GetFabricIndex();
+    commissioner->Shutdown();
+
+    // Its fabric table entry was deleted along with it.
+    if (key.mIsAdditionalController && fabricIndex != chip::kUndefinedFabricIndex)
+    {
+        RETURN_SAFELY_IGNORED sGroupDataProvider.RemoveFabric(fabricIndex);
+    }
 }
 
 CHIP_ERROR CHIPCommand::InitializeCommissioner(CommissionerIdentity & identity, chip::FabricId fabricId)
@@ -520,6 +585,8 @@ CHIP_ERROR CHIPCommand::InitializeCommissioner(CommissionerIdentity & identity,
         commissionerParams.controllerNOC                = nocSpan;
         commissionerParams.permitMultiControllerFabrics = true;
         commissionerParams.enableServerInteractions     = NeedsOperationalAdvertising();
+        // Only the commissioner of the identity is kept in storage for the next runs.
+        commissionerParams.deleteFromFabricTableOnShutdown = identity.mIsAdditionalController;
     }
 
     // TODO: Initialize IPK epoch key in ExampleOperationalCredentials issuer rather than relying on DefaultIpkValue
@@ -545,7 +612,10 @@ CHIP_ERROR CHIPCommand::InitializeCommissioner(CommissionerIdentity & identity,
             chip::Credentials::SetSingleIpkEpochKey(&sGroupDataProvider, fabricIndex, defaultIpk, compressed_fabric_id_span));
     }
 
-    ReturnErrorOnFailure(CHIPCommand::sICDClientStorage.UpdateFabricList(commissioner->GetFabricIndex()));
+    if (!identity.mIsAdditionalController)
+    {
+        ReturnErrorOnFailure(CHIPCommand::sICDClientStorage.UpdateFabricList(commissioner->GetFabricIndex()));
+    }
 
     mCommissioners[identity] = std::move(commissioner);
 
@@ -185,6 +185,15 @@ protected:
 
     ChipDeviceCommissioner & GetCommissioner(std::string identity);
 
+    // This method returns another commissioner of the fabric of the given identity, running under the given
+    // controller node id. It is initialized on first use.
+    ChipDeviceCommissioner & GetCommissioner(std::string identity, chip::NodeId localNodeId);
+
+    // This method makes sure the controllers of the given identity carry a CASE Authenticated Tag, and returns it.
+    // An identity without one is given the administrator CAT: it is stored with the identity, and the NOC of its
+    // commissioner is reissued with it.
+    CHIP_ERROR EnsureCommissionerAdminCAT(std::string identity, chip::CASEAuthTag & adminCAT);
+
     chip::Optional<int32_t> mInterfaceId;
 
 private:
@@ -192,6 +201,7 @@ private:
     void MaybeTearDownStack();
 
     CHIP_ERROR EnsureCommissionerForIdentity(std::string identity);
+    CHIP_ERROR EnsureCommissionerForIdentity(std::string identity, chip::NodeId localNodeId);
 
     // Commissioners are keyed by name and local node id.
     struct CommissionerIdentity
@@ -209,6 +219,9 @@ private:
         size_t mRCACLen;
         size_t mICACLen;
         size_t mNOCLen;
+
+        // Other commissioners of the fabric of the identity than its own are deleted from storage when shut down.
+        bool mIsAdditionalController = false;
     };
 
     // InitializeCommissioner uses various members, so can't be static.  This is
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "commands/common/Commands.h"
+#include "commands/pairing/CommissioningPipelineCommand.h"
 #include "commands/pairing/GetCommissionerNodeIdCommand.h"
 #include "commands/pairing/GetCommissionerRootCertificateCommand.h"
 #include "commands/pairing/IssueNOCChainCommand.h"
@@ -258,6 +259,7 @@ void registerCommandsPairing(Commands & commands, CredentialIssuerCommands * cre
         make_unique<PairCodeWifi>(credsIssuerConfig),
         make_unique<PairCodeThread>(credsIssuerConfig),
         make_unique<PairCodeWiFiThread>(credsIssuerConfig),
+        make_unique<CommissioningPipelineCommand>(credsIssuerConfig),
         make_unique<PairBleWiFi>(credsIssuerConfig),
         make_unique<PairBleThread>(credsIssuerConfig),
         make_unique<PairNfcThread>(credsIssuerConfig),
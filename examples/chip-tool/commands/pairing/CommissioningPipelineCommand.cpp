@@ -0,0 +1,140 @@
+/*
+ *   Copyright (c) 2025 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "CommissioningPipelineCommand.h"
+
+#include <controller/CHIPDeviceControllerFactory.h>
+#include <system/SystemClock.h>
+
+#include <sstream>
+
+using namespace ::chip;
+using namespace ::chip::Controller;
+
+CHIP_ERROR CommissioningPipelineCommand::RunCommand()
+{
+    mSetUpCodes.clear();
+    std::stringstream payloads(mPayloads);
+    std::string setUpCode;
+    while (std::getline(payloads, setUpCode, ','))
+    {
+        if (!setUpCode.empty())
+        {
+            mSetUpCodes.push_back(setUpCode);
+        }
+    }
+    VerifyOrReturnError(!mSetUpCodes.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mSetUpCodes.size() <= CHIP_CONFIG_COMMISSIONING_PIPELINE_QUEUE_SIZE, CHIP_ERROR_INVALID_ARGUMENT,
+                        ChipLogError(chipTool, "At most %u devices can be commissioned at once",
+                                     static_cast<unsigned>(CHIP_CONFIG_COMMISSIONING_PIPELINE_QUEUE_SIZE)));
+
+    // Each lane needs Administer privilege on the devices to complete their commissioning, and the identity needs it to
+    // manage them afterwards: the devices grant it to a CAT all the controllers of the identity carry.
+    CASEAuthTag adminCAT;
+    ReturnErrorOnFailure(EnsureCommissionerAdminCAT(GetIdentity(), adminCAT));
+
+    // The first lane is the commissioner of the current identity, the others run under the following controller node IDs.
+    DeviceCommissioner & commissioner = CurrentCommissioner();
+
+    CommissioningPipeline::InitParams params;
+    params.systemLayer                    = DeviceControllerFactory::GetInstance().GetSystemState()->SystemLayer();
+    params.operationalCredentialsDelegate = commissioner.GetOperationalCredentialsDelegate();
+    params.deviceAttestationVerifier      = commissioner.GetDeviceAttestationVerifier();
+    params.delegate                       = this;
+    params.maxConcurrentNOCChainRequests  = mNOCChainConcurrency.ValueOr(1);
+    params.maxConcurrentAttestationChecks = mAttestationConcurrency.ValueOr(1);
+    params.discoveryType                  = DiscoveryType::kDiscoveryNetworkOnly;
+    params.adminSubject                   = NodeIdFromCASEAuthTag(adminCAT);
+    ReturnErrorOnFailure(mPipeline.Init(params));
+
+    // Queue all the devices before adding the lanes, so that the pipeline does not go idle before the last one.
+    for (size_t i = 0; i < mSetUpCodes.size(); i++)
+    {
+        ReturnErrorOnFailure(mPipeline.Enqueue(mNodeId + i, mSetUpCodes[i].c_str()));
+    }
+
+    mCommissionedCount = 0;
+    mFailedCount       = 0;
+    mFirstError        = CHIP_NO_ERROR;
+    mStartTime         = System::SystemClock().GetMonotonicTimestamp();
+    for (uint8_t i = 0; i < mLanes.ValueOr(4); i++)
+    {
+        ReturnErrorOnFailure(mPipeline.AddLane(GetCommissioner(GetIdentity(), commissioner.GetNodeId() + i)));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningPipelineCommand::Shutdown()
+{
+    // The lanes are shut down with the stack, after this command.
+    mPipeline.Shutdown();
+    CHIPCommand::Shutdown();
+}
+
+void CommissioningPipelineCommand::OnDeviceCommissioned(NodeId nodeId, CHIP_ERROR error)
+{
+    if (error == CHIP_NO_ERROR)
+    {
+        mCommissionedCount++;
+        ChipLogProgress(chipTool, "Device 0x" ChipLogFormatX64 " commissioned", ChipLogValueX64(nodeId));
+        return;
+    }
+
+    mFailedCount++;
+    if (mFirstError == CHIP_NO_ERROR)
+    {
+        mFirstError = error;
+    }
+    ChipLogError(chipTool, "Device 0x" ChipLogFormatX64 " commissioning failed: %" CHIP_ERROR_FORMAT, ChipLogValueX64(nodeId),
+                 error.Format());
+}
+
+void CommissioningPipelineCommand::OnPipelineIdle()
+{
+    LogStatistics();
+    SetCommandExitStatus(mFirstError);
+}
+
+void CommissioningPipelineCommand::LogStatistics()
+{
+    auto elapsed = std::chrono::duration_cast<System::Clock::Milliseconds64>(System::SystemClock().GetMonotonicTimestamp() -
+                                                                             mStartTime);
+    ChipLogProgress(chipTool, "Commissioned %u of %u devices in %" PRIu64 " ms (%u failed)",
+                    static_cast<unsigned>(mCommissionedCount), static_cast<unsigned>(mSetUpCodes.size()), elapsed.count(),
+                    static_cast<unsigned>(mFailedCount));
+
+    const auto & device = mPipeline.GetDeviceStatistics();
+    if (device.count > 0)
+    {
+        ChipLogProgress(chipTool, "  %-36s average %" PRIu64 " ms, max %" PRIu64 " ms", "Device",
+                        device.totalTime.count() / device.count, device.maxTime.count());
+    }
+
+    for (uint8_t stage = CommissioningStage::kSecurePairing; stage <= CommissioningStage::kCleanup; stage++)
+    {
+        const auto & statistics = mPipeline.GetStageStatistics(static_cast<CommissioningStage>(stage));
+        if (statistics.count == 0)
+        {
+            continue;
+        }
+        ChipLogProgress(chipTool, "  %-36s count %u, average %" PRIu64 " ms, max %" PRIu64 " ms",
+                        StageToString(static_cast<CommissioningStage>(stage)), static_cast<unsigned>(statistics.count),
+                        statistics.totalTime.count() / statistics.count, statistics.maxTime.count());
+    }
+}
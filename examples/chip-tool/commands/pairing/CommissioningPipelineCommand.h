@@ -0,0 +1,71 @@
+/*
+ *   Copyright (c) 2025 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "../common/CHIPCommand.h"
+
+#include <controller/CommissioningPipeline.h>
+
+#include <string>
+#include <vector>
+
+// Commissions a list of devices with a CommissioningPipeline, and reports how long each commissioning stage took.
+class CommissioningPipelineCommand : public CHIPCommand, public chip::Controller::CommissioningPipeline::Delegate
+{
+public:
+    CommissioningPipelineCommand(CredentialIssuerCommands * credIssuerCommands) :
+        CHIPCommand("code-pipeline", credIssuerCommands)
+    {
+        AddArgument("node-id", 0, UINT64_MAX, &mNodeId, "Node ID of the first device, the next ones get the following node IDs.");
+        AddArgument("payloads", &mPayloads, "Comma-separated list of setup codes (QR codes or manual pairing codes).");
+        AddArgument("lanes", 1, CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES, &mLanes,
+                    "Number of devices commissioned at once. Defaults to 4.");
+        AddArgument("noc-chain-concurrency", 1, CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES, &mNOCChainConcurrency,
+                    "Number of NOC chains issued at once. Defaults to 1.");
+        AddArgument("attestation-concurrency", 1, CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES, &mAttestationConcurrency,
+                    "Number of device attestations verified at once. Defaults to 1.");
+        AddArgument("timeout", 0, UINT16_MAX, &mTimeout, "Time, in seconds, before this command is considered to have timed out.");
+    }
+
+    /////////// CHIPCommand Interface /////////
+    CHIP_ERROR RunCommand() override;
+    chip::System::Clock::Timeout GetWaitDuration() const override { return chip::System::Clock::Seconds16(mTimeout.ValueOr(600)); }
+    void Shutdown() override;
+
+    /////////// CommissioningPipeline::Delegate Interface /////////
+    void OnDeviceCommissioned(chip::NodeId nodeId, CHIP_ERROR error) override;
+    void OnPipelineIdle() override;
+
+private:
+    void LogStatistics();
+
+    chip::NodeId mNodeId;
+    char * mPayloads;
+    chip::Optional<uint8_t> mLanes;
+    chip::Optional<uint8_t> mNOCChainConcurrency;
+    chip::Optional<uint8_t> mAttestationConcurrency;
+    chip::Optional<uint16_t> mTimeout;
+
+    chip::Controller::CommissioningPipeline mPipeline;
+    std::vector<std::string> mSetUpCodes;
+    size_t mCommissionedCount = 0;
+    size_t mFailedCount       = 0;
+    CHIP_ERROR mFirstError    = CHIP_NO_ERROR;
+    chip::System::Clock::Timestamp mStartTime;
+};
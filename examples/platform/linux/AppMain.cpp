@@ -618,6 +618,10 @@ int ChipLinuxAppInit(int argc, char * const argv[], OptionSet * customOptions,
     err = DeviceLayer::PlatformMgr().InitChipStack();
     SuccessOrExit(err);
 
+    // Process the CASE signature generation and verification of concurrent session establishments in parallel.
+    err = DeviceLayer::PlatformMgr().StartBackgroundEventLoopTask();
+    SuccessOrExit(err);
+
     // Init the commissionable data provider based on command line options
     // to handle custom verifiers, discriminators, etc.
     err = chip::examples::InitCommissionableDataProvider(gCommissionableDataProvider, LinuxDeviceOptions::GetInstance());
@@ -1054,6 +1058,8 @@ void ChipLinuxAppMainLoop(chip::ServerInitParams & initParams, AppMainLoopImplem
     }
     gMainLoopImplementation = nullptr;
 
+    TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().StopBackgroundEventLoopTask();
+
     ApplicationShutdown();
 
 #if defined(ENABLE_CHIP_SHELL)
@@ -0,0 +1,107 @@
+#!/usr/bin/env -S python3 -B
+
+# Copyright (c) 2025 Project CHIP Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Commissions a batch of all-clusters-app instances running on this host with
+# `chip-tool pairing code-pipeline`, which reports the total commissioning time
+# and how long each commissioning stage took.
+
+import argparse
+import logging
+import os
+import shutil
+import signal
+import subprocess
+import sys
+import tempfile
+import time
+
+log = logging.getLogger(__name__)
+
+DEFAULT_CHIP_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..'))
+
+DEFAULT_ALL_CLUSTERS = os.path.join(DEFAULT_CHIP_ROOT, 'out', 'linux-x64-all-clusters-no-ble', 'chip-all-clusters-app')
+DEFAULT_CHIP_TOOL = os.path.join(DEFAULT_CHIP_ROOT, 'out', 'linux-x64-chip-tool-no-ble', 'chip-tool')
+
+sys.path.append(os.path.join(DEFAULT_CHIP_ROOT, 'src', 'setup_payload', 'python'))
+from SetupPayload import SetupPayload  # noqa: E402 isort:skip
+
+PASSCODE = 20202021
+FIRST_DISCRIMINATOR = 3000
+FIRST_SECURED_PORT = 5600
+FIRST_UNSECURED_PORT = 5800
+
+
+def start_apps(app_path: str, count: int, storage_dir: str):
+    apps = []
+    for i in range(count):
+        # Each instance advertises its own discriminator, and listens on its own ports.
+        cmd = [app_path,
+               '--discriminator', str(FIRST_DISCRIMINATOR + i),
+               '--passcode', str(PASSCODE),
+               '--secured-device-port', str(FIRST_SECURED_PORT + i),
+               '--unsecured-commissioner-port', str(FIRST_UNSECURED_PORT + i),
+               '--KVS', os.path.join(storage_dir, 'kvs{}'.format(i))]
+        apps.append(subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL))
+    return apps
+
+
+def stop_apps(apps):
+    for app in apps:
+        app.send_signal(signal.SIGINT.value)
+    for app in apps:
+        app.wait()
+
+
+def main():
+    parser = argparse.ArgumentParser('Commissioning pipeline benchmark', formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+    parser.add_argument('--all-clusters', default=DEFAULT_ALL_CLUSTERS, help="All clusters application.")
+    parser.add_argument('--chip-tool', default=DEFAULT_CHIP_TOOL, help="chip-tool application.")
+    parser.add_argument('--devices', type=int, default=50, help="Number of devices to commission.")
+    parser.add_argument('--lanes', type=int, default=4, help="Number of devices commissioned at once.")
+    parser.add_argument('--noc-chain-concurrency', type=int, default=1, help="Number of NOC chains issued at once.")
+    parser.add_argument('--attestation-concurrency', type=int, default=1, help="Number of attestations verified at once.")
+    parser.add_argument('--first-node-id', type=int, default=1000, help="Node ID of the first device.")
+    parser.add_argument('--startup-delay', type=float, default=5, help="Seconds to wait for the devices to advertise.")
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO)
+
+    for path in (args.all_clusters, args.chip_tool):
+        if not os.path.exists(path):
+            log.error("'%s' not found", path)
+            return 1
+
+    storage_dir = tempfile.mkdtemp(prefix='commissioning-pipeline-')
+    apps = start_apps(args.all_clusters, args.devices, storage_dir)
+    try:
+        time.sleep(args.startup_delay)
+
+        # QR codes carry the full discriminator: manual codes would not tell the devices apart.
+        payloads = [SetupPayload(FIRST_DISCRIMINATOR + i, PASSCODE).generate_qrcode() for i in range(args.devices)]
+        cmd = [args.chip_tool, 'pairing', 'code-pipeline', str(args.first_node_id), ','.join(payloads),
+               '--lanes', str(args.lanes),
+               '--noc-chain-concurrency', str(args.noc_chain_concurrency),
+               '--attestation-concurrency', str(args.attestation_concurrency),
+               '--storage-directory', storage_dir]
+        log.info("Commissioning %d devices with %d lanes", args.devices, args.lanes)
+        return subprocess.call(cmd)
+    finally:
+        stop_apps(apps)
+        shutil.rmtree(storage_dir, ignore_errors=True)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -25,6 +25,13 @@
 
 #include <lib/core/Global.h>
 
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+#include <lib/support/CHIPMem.h>
+#include <lib/support/ScopedBuffer.h>
+
+#include <algorithm>
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+
 namespace chip {
 namespace Access {
 
@@ -70,6 +77,23 @@ bool CheckRequestPrivilegeAgainstEntryPrivilege(Privilege requestPrivilege, Priv
     return false;
 }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+// Set of request privileges (as Privilege bits) granted by an entry privilege.
+uint8_t GetGrantedPrivileges(Privilege entryPrivilege)
+{
+    uint8_t granted = 0;
+    for (Privilege privilege :
+         { Privilege::kView, Privilege::kProxyView, Privilege::kOperate, Privilege::kManage, Privilege::kAdminister })
+    {
+        if (CheckRequestPrivilegeAgainstEntryPrivilege(privilege, entryPrivilege))
+        {
+            granted = static_cast<uint8_t>(granted | to_underlying(privilege));
+        }
+    }
+    return granted;
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+
 constexpr bool IsValidCaseNodeId(NodeId aNodeId)
 {
     if (IsOperationalNodeId(aNodeId))
@@ -197,6 +221,259 @@ char GetRequestTypeStringForLogging(RequestType requestType)
 Global<AccessControl::Entry::Delegate> AccessControl::Entry::mDefaultDelegate;
 Global<AccessControl::EntryIterator::Delegate> AccessControl::EntryIterator::mDefaultDelegate;
 
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+
+/**
+ * Compiled form of the access control entries of one fabric.
+ *
+ * Each entry becomes a rule holding its auth mode and the set of request privileges it
+ * grants. Node ID and group subjects are kept sorted so the rules of a subject are found
+ * by binary search, CAT subjects (which also match newer CAT versions) are kept apart,
+ * and rules without subjects are listed separately. The targets of a rule are contiguous,
+ * with device type targets (which need the DeviceTypeResolver) last.
+ */
+class AccessControl::CompiledFabric
+{
+public:
+    explicit CompiledFabric(FabricIndex fabricIndex) : mFabricIndex(fabricIndex) {}
+
+    FabricIndex GetFabricIndex() const { return mFabricIndex; }
+
+    CHIP_ERROR Compile(const AccessControl & accessControl);
+
+    /**
+     * Whether any rule allows the access. `resolvedDeviceType` is set if the outcome depended
+     * on the DeviceTypeResolver.
+     */
+    bool Allows(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                DeviceTypeResolver & deviceTypeResolver, bool & resolvedDeviceType) const;
+
+private:
+    struct Rule
+    {
+        AuthMode authMode;
+        uint8_t privileges; // Granted request privileges, as Privilege bits
+        uint16_t firstTarget;
+        uint16_t targetCount; // No targets means all targets
+    };
+
+    struct Subject
+    {
+        NodeId subject;
+        uint16_t rule;
+
+        bool operator<(const Subject & other) const { return subject < other.subject; }
+    };
+
+    bool RuleAllows(uint16_t rule, const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                    uint8_t requestPrivilege, DeviceTypeResolver & deviceTypeResolver, bool & resolvedDeviceType) const;
+
+    FabricIndex mFabricIndex;
+
+    Platform::ScopedMemoryBuffer<Rule> mRules;
+    Platform::ScopedMemoryBuffer<Subject> mSubjects; // Node ID and group subjects, sorted
+    Platform::ScopedMemoryBuffer<Subject> mCats;
+    Platform::ScopedMemoryBuffer<uint16_t> mAnySubjectRules;
+    Platform::ScopedMemoryBuffer<Entry::Target> mTargets;
+    uint16_t mRuleCount           = 0;
+    uint16_t mSubjectCount        = 0;
+    uint16_t mCatCount            = 0;
+    uint16_t mAnySubjectRuleCount = 0;
+    uint16_t mTargetCount         = 0;
+};
+
+CHIP_ERROR AccessControl::CompiledFabric::Compile(const AccessControl & accessControl)
+{
+    size_t ruleCount    = 0;
+    size_t subjectCount = 0;
+    size_t catCount     = 0;
+    size_t anyCount     = 0;
+    size_t targetCount  = 0;
+
+    // First pass: validate entries the same way CheckACL does, and size the tables.
+    {
+        EntryIterator iterator;
+        ReturnErrorOnFailure(accessControl.Entries(iterator, &mFabricIndex));
+
+        Entry entry;
+        while (iterator.Next(entry) == CHIP_NO_ERROR)
+        {
+            AuthMode authMode = AuthMode::kNone;
+            ReturnErrorOnFailure(entry.GetAuthMode(authMode));
+            VerifyOrReturnError(authMode == AuthMode::kCase || authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+
+            Privilege privilege = Privilege::kView;
+            ReturnErrorOnFailure(entry.GetPrivilege(privilege));
+
+            size_t count = 0;
+            ReturnErrorOnFailure(entry.GetSubjectCount(count));
+            anyCount += (count == 0) ? 1 : 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                NodeId subject = kUndefinedNodeId;
+                ReturnErrorOnFailure(entry.GetSubject(i, subject));
+                if (IsOperationalNodeId(subject) || IsCASEAuthTag(subject))
+                {
+                    VerifyOrReturnError(authMode == AuthMode::kCase, CHIP_ERROR_INCORRECT_STATE);
+                }
+                else
+                {
+                    VerifyOrReturnError(IsGroupId(subject) && authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+                }
+                (IsCASEAuthTag(subject) ? catCount : subjectCount)++;
+            }
+
+            ReturnErrorOnFailure(entry.GetTargetCount(count));
+            targetCount += count;
+            ruleCount++;
+        }
+    }
+
+    VerifyOrReturnError(ruleCount <= UINT16_MAX && targetCount <= UINT16_MAX, CHIP_ERROR_NO_MEMORY);
+
+    // Zero sized tables are still allocated (with one element) so that a null buffer always means out of memory.
+    VerifyOrReturnError(mRules.Calloc(std::max<size_t>(ruleCount, 1)), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mSubjects.Calloc(std::max<size_t>(subjectCount, 1)), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mCats.Calloc(std::max<size_t>(catCount, 1)), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mAnySubjectRules.Calloc(std::max<size_t>(anyCount, 1)), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mTargets.Calloc(std::max<size_t>(targetCount, 1)), CHIP_ERROR_NO_MEMORY);
+
+    // Second pass: fill the tables.
+    EntryIterator iterator;
+    ReturnErrorOnFailure(accessControl.Entries(iterator, &mFabricIndex));
+
+    Entry entry;
+    while (iterator.Next(entry) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(mRuleCount < ruleCount, CHIP_ERROR_INCORRECT_STATE);
+        Rule & rule = mRules[mRuleCount];
+
+        Privilege privilege = Privilege::kView;
+        ReturnErrorOnFailure(entry.GetAuthMode(rule.authMode));
+        ReturnErrorOnFailure(entry.GetPrivilege(privilege));
+        rule.privileges = GetGrantedPrivileges(privilege);
+
+        size_t count = 0;
+        ReturnErrorOnFailure(entry.GetSubjectCount(count));
+        if (count == 0)
+        {
+            VerifyOrReturnError(mAnySubjectRuleCount < anyCount, CHIP_ERROR_INCORRECT_STATE);
+            mAnySubjectRules[mAnySubjectRuleCount++] = mRuleCount;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            NodeId subject = kUndefinedNodeId;
+            ReturnErrorOnFailure(entry.GetSubject(i, subject));
+            if (IsCASEAuthTag(subject))
+            {
+                VerifyOrReturnError(mCatCount < catCount, CHIP_ERROR_INCORRECT_STATE);
+                mCats[mCatCount++] = { subject, mRuleCount };
+            }
+            else
+            {
+                VerifyOrReturnError(mSubjectCount < subjectCount, CHIP_ERROR_INCORRECT_STATE);
+                mSubjects[mSubjectCount++] = { subject, mRuleCount };
+            }
+        }
+
+        ReturnErrorOnFailure(entry.GetTargetCount(count));
+        VerifyOrReturnError(count <= targetCount - mTargetCount, CHIP_ERROR_INCORRECT_STATE);
+        rule.firstTarget = mTargetCount;
+        rule.targetCount = static_cast<uint16_t>(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            ReturnErrorOnFailure(entry.GetTarget(i, mTargets[mTargetCount++]));
+        }
+        std::stable_partition(&mTargets[rule.firstTarget], &mTargets[mTargetCount],
+                              [](const Entry::Target & target) { return !(target.flags & Entry::Target::kDeviceType); });
+
+        mRuleCount++;
+    }
+
+    std::sort(&mSubjects[0], &mSubjects[0] + mSubjectCount);
+    return CHIP_NO_ERROR;
+}
+
+bool AccessControl::CompiledFabric::RuleAllows(uint16_t ruleIndex, const SubjectDescriptor & subjectDescriptor,
+                                               const RequestPath & requestPath, uint8_t requestPrivilege,
+                                               DeviceTypeResolver & deviceTypeResolver, bool & resolvedDeviceType) const
+{
+    const Rule & rule = mRules[ruleIndex];
+    if (rule.authMode != subjectDescriptor.authMode || (rule.privileges & requestPrivilege) == 0)
+    {
+        return false;
+    }
+    if (rule.targetCount == 0)
+    {
+        return true;
+    }
+
+    for (const Entry::Target * target = &mTargets[rule.firstTarget]; target != &mTargets[rule.firstTarget] + rule.targetCount;
+         ++target)
+    {
+        if ((target->flags & Entry::Target::kCluster) && target->cluster != requestPath.cluster)
+        {
+            continue;
+        }
+        if ((target->flags & Entry::Target::kEndpoint) && target->endpoint != requestPath.endpoint)
+        {
+            continue;
+        }
+        if (target->flags & Entry::Target::kDeviceType)
+        {
+            resolvedDeviceType = true;
+            if (!deviceTypeResolver.IsDeviceTypeOnEndpoint(target->deviceType, requestPath.endpoint))
+            {
+                continue;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+bool AccessControl::CompiledFabric::Allows(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                           Privilege requestPrivilege, DeviceTypeResolver & deviceTypeResolver,
+                                           bool & resolvedDeviceType) const
+{
+    const uint8_t privilege = to_underlying(requestPrivilege);
+
+    for (uint16_t i = 0; i < mAnySubjectRuleCount; ++i)
+    {
+        if (RuleAllows(mAnySubjectRules[i], subjectDescriptor, requestPath, privilege, deviceTypeResolver, resolvedDeviceType))
+        {
+            return true;
+        }
+    }
+
+    const Subject * begin = &mSubjects[0];
+    const Subject * end   = begin + mSubjectCount;
+    for (const Subject * it = std::lower_bound(begin, end, Subject{ subjectDescriptor.subject, 0 });
+         it != end && it->subject == subjectDescriptor.subject; ++it)
+    {
+        if (RuleAllows(it->rule, subjectDescriptor, requestPath, privilege, deviceTypeResolver, resolvedDeviceType))
+        {
+            return true;
+        }
+    }
+
+    if (subjectDescriptor.authMode == AuthMode::kCase)
+    {
+        for (uint16_t i = 0; i < mCatCount; ++i)
+        {
+            if (subjectDescriptor.cats.CheckSubjectAgainstCATs(mCats[i].subject) &&
+                RuleAllows(mCats[i].rule, subjectDescriptor, requestPath, privilege, deviceTypeResolver, resolvedDeviceType))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+
 CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeResolver & deviceTypeResolver)
 {
     VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
@@ -204,6 +481,7 @@ CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeRes
     ChipLogProgress(DataManagement, "AccessControl: initializing");
 
     VerifyOrReturnError(delegate != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    InvalidateCompiledEntries(nullptr);
     CHIP_ERROR retval = delegate->Init();
     if (retval == CHIP_NO_ERROR)
     {
@@ -218,6 +496,7 @@ void AccessControl::Finish()
 {
     VerifyOrReturn(IsInitialized());
     ChipLogProgress(DataManagement, "AccessControl: finishing");
+    InvalidateCompiledEntries(nullptr);
     mDelegate->Finish();
     mDelegate = nullptr;
 }
@@ -237,6 +516,7 @@ CHIP_ERROR AccessControl::CreateEntry(const SubjectDescriptor * subjectDescripto
     VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
 
     size_t i = 0;
+    InvalidateCompiledEntries(&fabric);
     ReturnErrorOnFailure(mDelegate->CreateEntry(&i, entry, &fabric));
 
     if (index)
@@ -253,6 +533,7 @@ CHIP_ERROR AccessControl::UpdateEntry(const SubjectDescriptor * subjectDescripto
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
+    InvalidateCompiledEntries(&fabric);
     ReturnErrorOnFailure(mDelegate->UpdateEntry(index, entry, &fabric));
     NotifyEntryChanged(subjectDescriptor, fabric, index, &entry, EntryListener::ChangeType::kUpdated);
     return CHIP_NO_ERROR;
@@ -267,6 +548,7 @@ CHIP_ERROR AccessControl::DeleteEntry(const SubjectDescriptor * subjectDescripto
     {
         p = &entry;
     }
+    InvalidateCompiledEntries(&fabric);
     ReturnErrorOnFailure(mDelegate->DeleteEntry(index, &fabric));
     if (p && p->HasDefaultDelegate())
     {
@@ -401,6 +683,26 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
         return CHIP_NO_ERROR;
     }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+    {
+        bool allowed = false;
+        if (CheckCompiled(subjectDescriptor, requestPath, requestPrivilege, allowed))
+        {
+            if (!allowed)
+            {
+                ChipLogProgress(DataManagement, "AccessControl: denied");
+                return CHIP_ERROR_ACCESS_DENIED;
+            }
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            ChipLogProgress(DataManagement, "AccessControl: allowed");
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            return CHIP_NO_ERROR;
+        }
+        // The entries of this fabric could not be compiled: check them one by one below, which
+        // also reports the same errors as before.
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
@@ -515,6 +817,108 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
     return CHIP_ERROR_ACCESS_DENIED;
 }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+void AccessControl::SetCompiledEntriesEnabled(bool enabled)
+{
+    mCompiledEntriesEnabled = enabled;
+    InvalidateCompiledEntries(nullptr);
+}
+
+bool AccessControl::CheckCompiled(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                  Privilege requestPrivilege, bool & allowed)
+{
+    VerifyOrReturnValue(mCompiledEntriesEnabled && subjectDescriptor.fabricIndex != kUndefinedFabricIndex, false);
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    const size_t slot = (subjectDescriptor.subject ^ (subjectDescriptor.subject >> 32) ^ requestPath.cluster ^
+                         (static_cast<uint32_t>(requestPath.endpoint) << 8) ^ to_underlying(requestPrivilege)) %
+        MATTER_ARRAY_SIZE(mDecisionCache);
+    CachedDecision & cached = mDecisionCache[slot];
+    if (cached.fabricIndex == subjectDescriptor.fabricIndex && cached.authMode == subjectDescriptor.authMode &&
+        cached.subject == subjectDescriptor.subject && cached.cats.values == subjectDescriptor.cats.values &&
+        cached.cluster == requestPath.cluster && cached.endpoint == requestPath.endpoint && cached.privilege == requestPrivilege)
+    {
+        allowed = cached.allowed;
+        return true;
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
+    CompiledFabric * compiled = nullptr;
+    CompiledFabric ** freeSlot = nullptr;
+    for (auto & fabric : mCompiledFabrics)
+    {
+        if (fabric == nullptr)
+        {
+            freeSlot = (freeSlot == nullptr) ? &fabric : freeSlot;
+        }
+        else if (fabric->GetFabricIndex() == subjectDescriptor.fabricIndex)
+        {
+            compiled = fabric;
+            break;
+        }
+    }
+
+    if (compiled == nullptr)
+    {
+        VerifyOrReturnValue(freeSlot != nullptr, false);
+        compiled = Platform::New<CompiledFabric>(subjectDescriptor.fabricIndex);
+        VerifyOrReturnValue(compiled != nullptr, false);
+
+        CHIP_ERROR err = compiled->Compile(*this);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogDetail(DataManagement, "AccessControl: not compiling entries of fabric %u: %" CHIP_ERROR_FORMAT,
+                          subjectDescriptor.fabricIndex, err.Format());
+            Platform::Delete(compiled);
+            return false;
+        }
+        *freeSlot = compiled;
+    }
+
+    bool resolvedDeviceType = false;
+    allowed = compiled->Allows(subjectDescriptor, requestPath, requestPrivilege, *mDeviceTypeResolver, resolvedDeviceType);
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    // Endpoints can come and go, so decisions involving device types are always re-evaluated.
+    if (!resolvedDeviceType)
+    {
+        cached.fabricIndex = subjectDescriptor.fabricIndex;
+        cached.authMode    = subjectDescriptor.authMode;
+        cached.privilege   = requestPrivilege;
+        cached.allowed     = allowed;
+        cached.endpoint    = requestPath.endpoint;
+        cached.cluster     = requestPath.cluster;
+        cached.subject     = subjectDescriptor.subject;
+        cached.cats        = subjectDescriptor.cats;
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
+    return true;
+}
+
+void AccessControl::InvalidateCompiledEntries(const FabricIndex * fabricIndex)
+{
+    for (auto & fabric : mCompiledFabrics)
+    {
+        if (fabric != nullptr && (fabricIndex == nullptr || fabric->GetFabricIndex() == *fabricIndex))
+        {
+            Platform::Delete(fabric);
+            fabric = nullptr;
+        }
+    }
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    for (auto & cached : mDecisionCache)
+    {
+        if (fabricIndex == nullptr || cached.fabricIndex == *fabricIndex)
+        {
+            cached.fabricIndex = kUndefinedFabricIndex;
+        }
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
 CHIP_ERROR AccessControl::CheckARL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
                                    Privilege requestPrivilege)
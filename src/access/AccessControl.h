@@ -418,6 +418,7 @@ public:
 
     ~AccessControl()
     {
+        InvalidateCompiledEntries(nullptr);
         // Never-initialized AccessControl instances will not have the delegate set.
         if (IsInitialized())
         {
@@ -510,6 +511,7 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateCompiledEntries(nullptr);
         return mDelegate->CreateEntry(index, entry, fabricIndex);
     }
 
@@ -560,6 +562,8 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        // The entry may move to another fabric
+        InvalidateCompiledEntries(nullptr);
         return mDelegate->UpdateEntry(index, entry, fabricIndex);
     }
 
@@ -581,6 +585,7 @@ public:
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateCompiledEntries(fabricIndex);
         return mDelegate->DeleteEntry(index, fabricIndex);
     }
 
@@ -669,6 +674,14 @@ public:
      */
     CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+    /**
+     * Enable or disable the use of compiled entries (and the decision cache) by Check.
+     * Enabled by default. When disabled, every check iterates the entries of the fabric.
+     */
+    void SetCompiledEntriesEnabled(bool enabled);
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+
 #if CHIP_ACCESS_CONTROL_DUMP_ENABLED
     CHIP_ERROR Dump(const Entry & entry);
 #endif
@@ -676,6 +689,25 @@ public:
 private:
     bool IsInitialized() const { return (mDelegate != nullptr); }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+    class CompiledFabric;
+
+    /**
+     * Check access against the compiled entries of the subject's fabric, compiling them first if needed.
+     *
+     * @retval false if the fabric's entries could not be compiled, in which case `allowed` is not set.
+     */
+    bool CheckCompiled(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                       bool & allowed);
+
+    /**
+     * Drop the compiled entries (and cached decisions) of a fabric, or of all fabrics if `fabricIndex` is null.
+     */
+    void InvalidateCompiledEntries(const FabricIndex * fabricIndex);
+#else
+    void InvalidateCompiledEntries(const FabricIndex * fabricIndex) {}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+
     void NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
                             EntryListener::ChangeType changeType);
 
@@ -702,6 +734,27 @@ private:
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     AccessRestrictionProvider * mAccessRestrictionProvider;
 #endif
+
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+    bool mCompiledEntriesEnabled = true;
+    // Compiled entries by fabric, allocated on first check after a change and released in Finish()
+    CompiledFabric * mCompiledFabrics[CHIP_CONFIG_MAX_FABRICS] = {};
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    struct CachedDecision
+    {
+        FabricIndex fabricIndex = kUndefinedFabricIndex; // kUndefinedFabricIndex if unused
+        AuthMode authMode       = AuthMode::kNone;
+        Privilege privilege     = Privilege::kView;
+        bool allowed            = false;
+        EndpointId endpoint     = kInvalidEndpointId;
+        ClusterId cluster       = kInvalidClusterId;
+        NodeId subject          = kUndefinedNodeId;
+        CATValues cats;
+    };
+    CachedDecision mDecisionCache[CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE];
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
 };
 
 /**
@@ -23,7 +23,9 @@
 
 #include <lib/core/CHIPCore.h>
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
+#include <system/SystemClock.h>
 
 namespace chip {
 namespace Access {
@@ -1085,6 +1087,7 @@ public: // protected
     void SetUp() override { ASSERT_EQ(ClearAccessControl(accessControl), CHIP_NO_ERROR); }
     static void SetUpTestSuite()
     {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
         AccessControl::Delegate * delegate = Examples::GetAccessControlDelegate();
         SetAccessControl(accessControl);
         SuccessOrDie(GetAccessControl().Init(delegate, testDeviceTypeResolver));
@@ -1093,6 +1096,7 @@ public: // protected
     {
         GetAccessControl().Finish();
         ResetAccessControlToDefault();
+        chip::Platform::MemoryShutdown();
     }
 };
 
@@ -1761,6 +1765,134 @@ TEST_F(TestAccessControl, TestCheck)
     }
 }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+TEST_F(TestAccessControl, TestCheckCompiled)
+{
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, entryData1, entryData1Count));
+
+    // Compiled entries (checked twice, so cached decisions are also used) must agree with the entry scan.
+    for (bool compiled : { false, true, true })
+    {
+        accessControl.SetCompiledEntriesEnabled(compiled);
+        for (const auto & checkData : checkData1)
+        {
+            CHIP_ERROR expectedResult = checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+            auto requestPath          = checkData.requestPath;
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+            requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+            EXPECT_EQ(accessControl.Check(checkData.subjectDescriptor, requestPath, checkData.privilege), expectedResult);
+        }
+    }
+
+    // Changes to the entries must be seen by the next check.
+    const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId3 };
+    RequestPath requestPath                   = { .cluster = kOnOffCluster, .endpoint = 1 };
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+    requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_NO_ERROR);
+
+    {
+        EntryData data   = entryData1[0];
+        data.subjects[0] = kOperationalNodeId4;
+        Entry entry;
+        EXPECT_SUCCESS(accessControl.PrepareEntry(entry));
+        EXPECT_SUCCESS(LoadEntry(entry, data));
+        EXPECT_SUCCESS(accessControl.UpdateEntry(nullptr, 1, 0, entry));
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_ERROR_ACCESS_DENIED);
+
+    {
+        Entry entry;
+        EXPECT_SUCCESS(accessControl.PrepareEntry(entry));
+        EXPECT_SUCCESS(LoadEntry(entry, entryData1[0]));
+        EXPECT_SUCCESS(accessControl.UpdateEntry(nullptr, 1, 0, entry));
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_NO_ERROR);
+
+    EXPECT_SUCCESS(accessControl.DeleteEntry(nullptr, 1, 0));
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_ERROR_ACCESS_DENIED);
+
+    {
+        Entry entry;
+        EXPECT_SUCCESS(accessControl.PrepareEntry(entry));
+        EXPECT_SUCCESS(LoadEntry(entry, entryData1[0]));
+        EXPECT_SUCCESS(accessControl.CreateEntry(nullptr, 1, nullptr, entry));
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_NO_ERROR);
+
+    // The non-notifying variants must invalidate too.
+    EXPECT_SUCCESS(accessControl.DeleteAllEntriesForFabric(1));
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_ERROR_ACCESS_DENIED);
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+
+TEST_F(TestAccessControl, TestCheckBenchmark)
+{
+    // Entries per fabric; the subject being checked is only granted access by the last entry.
+    constexpr size_t kEntryCounts[] = { 1, 4, 20 };
+    constexpr size_t kSamples       = 20;
+
+    for (size_t entryCount : kEntryCounts)
+    {
+        ASSERT_EQ(ClearAccessControl(accessControl), CHIP_NO_ERROR);
+        for (size_t i = 0; i < entryCount; ++i)
+        {
+            const bool last = (i + 1 == entryCount);
+            Entry entry;
+            ASSERT_EQ(accessControl.PrepareEntry(entry), CHIP_NO_ERROR);
+            ASSERT_EQ(entry.SetFabricIndex(1), CHIP_NO_ERROR);
+            ASSERT_EQ(entry.SetAuthMode(AuthMode::kCase), CHIP_NO_ERROR);
+            ASSERT_EQ(entry.SetPrivilege(last ? Privilege::kOperate : Privilege::kAdminister), CHIP_NO_ERROR);
+            ASSERT_EQ(entry.AddSubject(nullptr, last ? kOperationalNodeId1 : kOperationalNodeId2 + i), CHIP_NO_ERROR);
+            ASSERT_EQ(entry.AddTarget(nullptr, { .flags = Target::kCluster, .cluster = kLevelControlCluster }), CHIP_NO_ERROR);
+            ASSERT_EQ(entry.AddTarget(nullptr, { .flags = Target::kCluster, .cluster = kOnOffCluster }), CHIP_NO_ERROR);
+            ASSERT_EQ(accessControl.CreateEntry(nullptr, entry), CHIP_NO_ERROR);
+        }
+
+        // A read interaction touching every attribute of a few clusters on a few endpoints.
+        const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1,
+                                                      .authMode    = AuthMode::kCase,
+                                                      .subject     = kOperationalNodeId1 };
+        auto measure                              = [&]() {
+            System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+            for (size_t sample = 0; sample < kSamples; ++sample)
+            {
+                for (EndpointId endpoint = 0; endpoint < 4; ++endpoint)
+                {
+                    for (ClusterId cluster : { kOnOffCluster, kLevelControlCluster, kColorControlCluster })
+                    {
+                        RequestPath requestPath = { .cluster = cluster, .endpoint = endpoint };
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+                        requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+                        for (int attribute = 0; attribute < 8; ++attribute)
+                        {
+                            EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView),
+                                      cluster == kColorControlCluster ? CHIP_ERROR_ACCESS_DENIED : CHIP_NO_ERROR);
+                        }
+                    }
+                }
+            }
+            return (System::SystemClock().GetMonotonicMicroseconds64() - start).count();
+        };
+
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+        accessControl.SetCompiledEntriesEnabled(false);
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+        uint64_t scan_us = measure();
+#if CHIP_CONFIG_ACCESS_CONTROL_INDEX
+        accessControl.SetCompiledEntriesEnabled(true);
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+        uint64_t compiled_us = measure();
+
+        ChipLogProgress(Test, "ACL check with %u entries per fabric: entry scan %u us, compiled %u us (%u checks)",
+                        static_cast<unsigned>(entryCount), static_cast<unsigned>(scan_us), static_cast<unsigned>(compiled_us),
+                        static_cast<unsigned>(kSamples * 4 * 3 * 8));
+    }
+}
+
 TEST_F(TestAccessControl, TestCreateReadEntry)
 {
     for (size_t i = 0; i < entryData1Count; ++i)
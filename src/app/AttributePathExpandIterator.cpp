@@ -17,7 +17,6 @@
 #include <app/AttributePathExpandIterator.h>
 
 #include <app/GlobalAttributes.h>
-#include <app/data-model-provider/MetadataLookup.h>
 #include <app/data-model-provider/MetadataTypes.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/CodeUtils.h>
@@ -34,6 +33,57 @@ AttributePathExpandIterator::AttributePathExpandIterator(DataModel::Provider * d
     mDataModelProvider(dataModel), mPosition(position)
 {}
 
+void AttributePathExpandIterator::UpdateSnapshot()
+{
+    DataModel::MetadataSnapshot * snapshot = mDataModelProvider->GetMetadataSnapshot();
+    if ((snapshot != nullptr) && (snapshot->EnsureBuilt() != CHIP_NO_ERROR))
+    {
+        // Fall back to reading metadata from the provider
+        snapshot = nullptr;
+    }
+
+    const uint32_t generation = (snapshot != nullptr) ? snapshot->Generation() : 0;
+    VerifyOrReturn((snapshot != mSnapshot) || (generation != mSnapshotGeneration));
+
+    mSnapshot           = snapshot;
+    mSnapshotGeneration = generation;
+    mEndpointIndex      = kInvalidIndex;
+    mClusterIndex       = kInvalidIndex;
+    mAttributeIndex     = kInvalidIndex;
+}
+
+void AttributePathExpandIterator::LoadEndpoints()
+{
+    if (mSnapshot != nullptr)
+    {
+        mEndpoints = mSnapshot->Endpoints();
+        return;
+    }
+    mEndpointBuffer = mDataModelProvider->EndpointsIgnoreError();
+    mEndpoints      = mEndpointBuffer;
+}
+
+void AttributePathExpandIterator::LoadClusters()
+{
+    if (mSnapshot != nullptr)
+    {
+        mClusterIds = mSnapshot->ServerClusters(mPosition.mOutputPath.mEndpointId);
+        return;
+    }
+    mClusterBuffer = mDataModelProvider->ServerClustersIgnoreError(mPosition.mOutputPath.mEndpointId);
+}
+
+void AttributePathExpandIterator::LoadAttributes()
+{
+    if (mSnapshot != nullptr)
+    {
+        mAttributes = mSnapshot->Attributes(mPosition.mOutputPath);
+        return;
+    }
+    mAttributeBuffer = mDataModelProvider->AttributesIgnoreError(mPosition.mOutputPath);
+    mAttributes      = mAttributeBuffer;
+}
+
 bool AttributePathExpandIterator::AdvanceOutputPath(std::optional<DataModel::AttributeEntry> * entry)
 {
     /// Output path invariants
@@ -95,6 +145,8 @@ bool AttributePathExpandIterator::AdvanceOutputPath(std::optional<DataModel::Att
 
 bool AttributePathExpandIterator::Next(ConcreteAttributePath & path, std::optional<DataModel::AttributeEntry> * entry)
 {
+    UpdateSnapshot();
+
     while (mPosition.mAttributePath != nullptr)
     {
         if (AdvanceOutputPath(entry))
@@ -122,7 +174,7 @@ std::optional<AttributeId> AttributePathExpandIterator::NextAttribute(std::optio
     if (mAttributeIndex == kInvalidIndex)
     {
         // start a new iteration of attributes on the current cluster path.
-        mAttributes = mDataModelProvider->AttributesIgnoreError(mPosition.mOutputPath);
+        LoadAttributes();
 
         if (mPosition.mOutputPath.mAttributeId != kInvalidAttributeId)
         {
@@ -144,20 +196,20 @@ std::optional<AttributeId> AttributePathExpandIterator::NextAttribute(std::optio
             //
             // For wildcard expansion, we validate that this is a valid attribute for the given
             // cluster on the given endpoint. If not a wildcard expansion, return it as-is.
-            DataModel::AttributeFinder finder(mDataModelProvider);
-
-            const ConcreteAttributePath attributePath(mPosition.mOutputPath.mEndpointId, mPosition.mOutputPath.mClusterId,
-                                                      mPosition.mAttributePath->mValue.mAttributeId);
-            std::optional<DataModel::AttributeEntry> foundEntry = finder.Find(attributePath);
-
-            // if the entry is valid, we can just return it
-            if (foundEntry.has_value())
+            //
+            // mAttributes was just loaded for the current cluster, so look the attribute up there.
+            const AttributeId attributeId = mPosition.mAttributePath->mValue.mAttributeId;
+            for (const DataModel::AttributeEntry & foundEntry : mAttributes)
             {
-                if (entry)
+                // if the entry is valid, we can just return it
+                if (foundEntry.attributeId == attributeId)
                 {
-                    entry->emplace(*foundEntry);
+                    if (entry)
+                    {
+                        entry->emplace(foundEntry);
+                    }
+                    return attributeId;
                 }
-                return mPosition.mAttributePath->mValue.mAttributeId;
             }
 
             // if the entry is invalid and we are wildcard-expanding, this is not a valid value so
@@ -214,13 +266,13 @@ std::optional<ClusterId> AttributePathExpandIterator::NextClusterId()
     if (mClusterIndex == kInvalidIndex)
     {
         // start a new iteration on the current endpoint
-        mClusters = mDataModelProvider->ServerClustersIgnoreError(mPosition.mOutputPath.mEndpointId);
+        LoadClusters();
 
         if (mPosition.mOutputPath.mClusterId != kInvalidClusterId)
         {
             // Position on the correct cluster if we have a start point
             mClusterIndex = 0;
-            while ((mClusterIndex < mClusters.size()) && (mClusters[mClusterIndex].clusterId != mPosition.mOutputPath.mClusterId))
+            while ((mClusterIndex < ClusterCount()) && (ClusterIdAt(mClusterIndex) != mPosition.mOutputPath.mClusterId))
             {
                 mClusterIndex++;
             }
@@ -241,9 +293,9 @@ std::optional<ClusterId> AttributePathExpandIterator::NextClusterId()
                 const ClusterId clusterId = mPosition.mAttributePath->mValue.mClusterId;
 
                 bool found = false;
-                for (auto & entry : mClusters)
+                for (size_t i = 0; i < ClusterCount(); i++)
                 {
-                    if (entry.clusterId == clusterId)
+                    if (ClusterIdAt(i) == clusterId)
                     {
                         found = true;
                         break;
@@ -266,9 +318,9 @@ std::optional<ClusterId> AttributePathExpandIterator::NextClusterId()
     }
 
     VerifyOrReturnValue(mPosition.mAttributePath->mValue.HasWildcardClusterId(), std::nullopt);
-    VerifyOrReturnValue(mClusterIndex < mClusters.size(), std::nullopt);
+    VerifyOrReturnValue(mClusterIndex < ClusterCount(), std::nullopt);
 
-    return mClusters[mClusterIndex].clusterId;
+    return ClusterIdAt(mClusterIndex);
 }
 
 std::optional<EndpointId> AttributePathExpandIterator::NextEndpointId()
@@ -276,7 +328,7 @@ std::optional<EndpointId> AttributePathExpandIterator::NextEndpointId()
     if (mEndpointIndex == kInvalidIndex)
     {
         // index is missing, have to start a new iteration
-        mEndpoints = mDataModelProvider->EndpointsIgnoreError();
+        LoadEndpoints();
 
         if (mPosition.mOutputPath.mEndpointId != kInvalidEndpointId)
         {
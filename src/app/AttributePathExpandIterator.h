@@ -19,6 +19,7 @@
 
 #include <app/AttributePathParams.h>
 #include <app/ConcreteAttributePath.h>
+#include <app/data-model-provider/MetadataSnapshot.h>
 #include <app/data-model-provider/MetadataTypes.h>
 #include <app/data-model-provider/Provider.h>
 #include <lib/core/DataModelTypes.h>
@@ -137,15 +138,39 @@ private:
     DataModel::Provider * mDataModelProvider;
     Position & mPosition;
 
-    ReadOnlyBuffer<DataModel::EndpointEntry> mEndpoints; // all endpoints
+    // Metadata snapshot of the provider, if it keeps one. The spans below point into it for as long as
+    // its generation is mSnapshotGeneration, so that iterating requires no allocation.
+    DataModel::MetadataSnapshot * mSnapshot = nullptr;
+    uint32_t mSnapshotGeneration            = 0;
+
+    // Storage for the spans below when the provider has no snapshot.
+    ReadOnlyBuffer<DataModel::EndpointEntry> mEndpointBuffer;
+    ReadOnlyBuffer<DataModel::ServerClusterEntry> mClusterBuffer;
+    ReadOnlyBuffer<DataModel::AttributeEntry> mAttributeBuffer;
+
+    Span<const DataModel::EndpointEntry> mEndpoints; // all endpoints
     size_t mEndpointIndex = kInvalidIndex;
 
-    ReadOnlyBuffer<DataModel::ServerClusterEntry> mClusters; // all clusters ON THE CURRENT endpoint
+    Span<const ClusterId> mClusterIds; // all clusters ON THE CURRENT endpoint (from the snapshot only)
     size_t mClusterIndex = kInvalidIndex;
 
-    ReadOnlyBuffer<DataModel::AttributeEntry> mAttributes; // all attributes ON THE CURRENT cluster
+    Span<const DataModel::AttributeEntry> mAttributes; // all attributes ON THE CURRENT cluster
     size_t mAttributeIndex = kInvalidIndex;
 
+    /// Picks up the current metadata snapshot of the provider. Indexes are reset if the snapshot changed since
+    /// the last call, so that metadata is loaded again and positioned on the ids of mOutputPath.
+    void UpdateSnapshot();
+
+    void LoadEndpoints();
+    void LoadClusters();
+    void LoadAttributes();
+
+    size_t ClusterCount() const { return (mSnapshot != nullptr) ? mClusterIds.size() : mClusterBuffer.size(); }
+    ClusterId ClusterIdAt(size_t index) const
+    {
+        return (mSnapshot != nullptr) ? mClusterIds[index] : mClusterBuffer[index].clusterId;
+    }
+
     /// Move to the next endpoint/cluster/attribute triplet that is valid given
     /// the current mOutputPath and mpAttributePath.
     ///
@@ -49,8 +49,8 @@ uint32_t SizeOfStatusIB(const StatusIB & aStatus)
 
 } // anonymous namespace
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
 {
     Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
     TLV::TLVReader reader;
@@ -65,9 +65,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVR
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
-                                                                 const StatusIB & aStatus)
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::UpdateCache(const ConcreteDataAttributePath & aPath,
+                                                                                 TLV::TLVReader * apData, const StatusIB & aStatus)
 {
     AttributeState state;
     bool endpointIsNew = false;
@@ -82,23 +82,50 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         endpointIsNew = true;
     }
 
+    // With flat storage, the payload currently cached for the path is overwritten or released by the new state.
+    detail::PayloadArena::Slice previousData;
+    bool hasPreviousData = false;
+    if constexpr (CanEnableDataCaching && UseFlatStorage)
+    {
+        CHIP_ERROR err;
+        auto previousState = GetAttributeState(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId, err);
+        if (err == CHIP_NO_ERROR && previousState->template Is<AttributeData>())
+        {
+            previousData    = previousState->template Get<AttributeData>();
+            hasPreviousData = true;
+        }
+    }
+
     if (apData)
     {
         uint32_t elementSize = 0;
-        ReturnErrorOnFailure(GetElementTLVSize(apData, elementSize));
+        if (!(UseFlatStorage && mCacheData))
+        {
+            // Flat storage measures the element while copying it.
+            ReturnErrorOnFailure(GetElementTLVSize(apData, elementSize));
+        }
 
         if constexpr (CanEnableDataCaching)
         {
             if (mCacheData)
             {
-                Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-                backingBuffer.Calloc(elementSize);
-                VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-                TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
-                ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
-                ReturnErrorOnFailure(writer.Finalize(backingBuffer));
-
-                state.template Set<AttributeData>(std::move(backingBuffer));
+                if constexpr (UseFlatStorage)
+                {
+                    AttributeData data;
+                    ReturnErrorOnFailure(mPayloads.Store(*apData, hasPreviousData ? &previousData : nullptr, data));
+                    state.template Set<AttributeData>(data);
+                }
+                else
+                {
+                    Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
+                    backingBuffer.Calloc(elementSize);
+                    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+                    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
+                    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
+                    ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+
+                    state.template Set<AttributeData>(std::move(backingBuffer));
+                }
             }
             else
             {
@@ -146,6 +173,10 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         {
             if (mCacheData)
             {
+                if (hasPreviousData)
+                {
+                    mPayloads.Release(previousData);
+                }
                 state.template Set<StatusIB>(aStatus);
             }
             else
@@ -172,15 +203,25 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
 
     if (mCacheData)
     {
-        mChangedAttributeSet.insert(aPath);
+        if constexpr (UseFlatStorage)
+        {
+            // Sorted and deduplicated once the report ends.
+            mChangedAttributeSet.push_back(aPath);
+        }
+        else
+        {
+            mChangedAttributeSet.insert(aPath);
+        }
     }
 
+    CompactPayloadsIfNeeded();
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const EventHeader & aEventHeader, TLV::TLVReader * apData,
-                                                                      const StatusIB * apStatus)
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::UpdateEventCache(const EventHeader & aEventHeader,
+                                                                                      TLV::TLVReader * apData,
+                                                                                      const StatusIB * apStatus)
 {
     if (apData)
     {
@@ -227,8 +268,8 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const Even
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+void ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::OnReportBegin()
 {
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     mChangedAttributeSet.clear();
@@ -236,8 +277,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
     mCallback.OnReportBegin();
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+void ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::CommitPendingDataVersion()
 {
     if (!mLastReportDataPath.IsValidConcreteClusterPath())
     {
@@ -252,13 +293,20 @@ void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
     }
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+void ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::OnReportEnd()
 {
     CommitPendingDataVersion();
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     std::set<std::tuple<EndpointId, ClusterId>> changedClusters;
 
+    if constexpr (UseFlatStorage)
+    {
+        std::sort(mChangedAttributeSet.begin(), mChangedAttributeSet.end());
+        mChangedAttributeSet.erase(std::unique(mChangedAttributeSet.begin(), mChangedAttributeSet.end()),
+                                   mChangedAttributeSet.end());
+    }
+
     //
     // Add the EndpointId and ClusterId into a set so that we only
     // convey unique combinations in the subsequent OnClusterChanged callback.
@@ -282,35 +330,45 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
     mCallback.OnReportEnd();
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<true>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::Get(const ConcreteAttributePath & path,
+                                                                          TLV::TLVReader & reader) const
 {
-    CHIP_ERROR err;
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
-
-    if (attributeState->template Is<StatusIB>())
+    if constexpr (CanEnableDataCaching)
     {
-        return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
-    }
+        CHIP_ERROR err;
+        auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
+        ReturnErrorOnFailure(err);
+
+        if (attributeState->template Is<StatusIB>())
+        {
+            return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
+        }
+
+        if (!attributeState->template Is<AttributeData>())
+        {
+            return CHIP_ERROR_KEY_NOT_FOUND;
+        }
 
-    if (!attributeState->template Is<AttributeData>())
+        if constexpr (UseFlatStorage)
+        {
+            reader.Init(mPayloads.Get(attributeState->template Get<AttributeData>()));
+        }
+        else
+        {
+            reader.Init(attributeState->template Get<AttributeData>().Get(),
+                        attributeState->template Get<AttributeData>().AllocatedSize());
+        }
+        return reader.Next();
+    }
+    else
     {
         return CHIP_ERROR_KEY_NOT_FOUND;
     }
-
-    reader.Init(attributeState->template Get<AttributeData>().Get(), attributeState->template Get<AttributeData>().AllocatedSize());
-    return reader.Next();
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<false>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
-{
-    return CHIP_ERROR_KEY_NOT_FOUND;
-}
-
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
 {
     CHIP_ERROR err;
 
@@ -326,9 +384,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::Get(EventNumber eventNumber
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::EndpointState *
-ClusterStateCacheT<CanEnableDataCaching>::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+const typename ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::EndpointState *
+ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
 {
     auto endpointIter = mCache.find(endpointId);
     if (endpointIter == mCache.end())
@@ -341,9 +399,10 @@ ClusterStateCacheT<CanEnableDataCaching>::GetEndpointState(EndpointId endpointId
     return &endpointIter->second;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::ClusterState *
-ClusterStateCacheT<CanEnableDataCaching>::GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+const typename ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::ClusterState *
+ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::GetClusterState(EndpointId endpointId, ClusterId clusterId,
+                                                                          CHIP_ERROR & err) const
 {
     auto endpointState = GetEndpointState(endpointId, err);
     if (err != CHIP_NO_ERROR)
@@ -362,10 +421,10 @@ ClusterStateCacheT<CanEnableDataCaching>::GetClusterState(EndpointId endpointId,
     return &clusterState->second;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::AttributeState *
-ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
-                                                            CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+const typename ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::AttributeState *
+ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::GetAttributeState(EndpointId endpointId, ClusterId clusterId,
+                                                                            AttributeId attributeId, CHIP_ERROR & err) const
 {
     auto clusterState = GetClusterState(endpointId, clusterId, err);
     if (err != CHIP_NO_ERROR)
@@ -384,9 +443,9 @@ ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(EndpointId endpointI
     return &attributeState->second;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::EventData *
-ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+const typename ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::EventData *
+ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
 {
     EventData compareKey;
 
@@ -402,9 +461,9 @@ ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber,
     return &(*eventData);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
-                                                               const StatusIB & aStatus)
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+void ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::OnAttributeData(const ConcreteDataAttributePath & aPath,
+                                                                               TLV::TLVReader * apData, const StatusIB & aStatus)
 {
     //
     // Since the cache itself is a ReadClient::Callback, it may be incorrectly passed in directly when registering with the
@@ -434,9 +493,9 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnAttributeData(const ConcreteDat
     mCallback.OnAttributeData(aPath, apData ? &dataSnapshot : nullptr, aStatus);
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetVersion(const ConcreteClusterPath & aPath,
-                                                                Optional<DataVersion> & aVersion) const
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::GetVersion(const ConcreteClusterPath & aPath,
+                                                                                Optional<DataVersion> & aVersion) const
 {
     VerifyOrReturnError(aPath.IsValidConcreteClusterPath(), CHIP_ERROR_INVALID_ARGUMENT);
     CHIP_ERROR err;
@@ -446,9 +505,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetVersion(const ConcreteCl
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData,
-                                                           const StatusIB * apStatus)
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+void ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::OnEventData(const EventHeader & aEventHeader,
+                                                                           TLV::TLVReader * apData, const StatusIB * apStatus)
 {
     VerifyOrDie(apData != nullptr || apStatus != nullptr);
 
@@ -462,31 +521,34 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnEventData(const EventHeader & a
     mCallback.OnEventData(aEventHeader, apData ? &dataSnapshot : nullptr, apStatus);
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<true>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::GetStatus(const ConcreteAttributePath & path,
+                                                                                StatusIB & status) const
 {
-    CHIP_ERROR err;
+    if constexpr (CanEnableDataCaching)
+    {
+        CHIP_ERROR err;
 
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
+        auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
+        ReturnErrorOnFailure(err);
 
-    if (!attributeState->template Is<StatusIB>())
+        if (!attributeState->template Is<StatusIB>())
+        {
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+
+        status = attributeState->template Get<StatusIB>();
+        return CHIP_NO_ERROR;
+    }
+    else
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-
-    status = attributeState->template Get<StatusIB>();
-    return CHIP_NO_ERROR;
-}
-
-template <>
-CHIP_ERROR ClusterStateCacheT<false>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
-{
-    return CHIP_ERROR_INVALID_ARGUMENT;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEventPath & path, StatusIB & status) const
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::GetStatus(const ConcreteEventPath & path,
+                                                                                StatusIB & status) const
 {
     auto statusIter = mEventStatusCache.find(path);
     if (statusIter == mEventStatusCache.end())
@@ -498,8 +560,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEve
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+void ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::GetSortedFilters(
+    std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
 {
     for (auto const & endpointIter : mCache)
     {
@@ -526,6 +589,11 @@ void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std:
                     {
                         clusterSize += attributeIter.second.template Get<uint32_t>();
                     }
+                    else if constexpr (UseFlatStorage)
+                    {
+                        VerifyOrDie(attributeIter.second.template Is<AttributeData>());
+                        clusterSize += attributeIter.second.template Get<AttributeData>().mLength;
+                    }
                     else
                     {
                         VerifyOrDie(attributeIter.second.template Is<AttributeData>());
@@ -565,8 +633,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std:
               });
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::OnUpdateDataVersionFilterList(
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::OnUpdateDataVersionFilterList(
     DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder, const Span<AttributePathParams> & aAttributePaths,
     bool & aEncodedDataVersionList)
 {
@@ -640,14 +708,25 @@ exit:
     return err;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(EndpointId endpointId)
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+void ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::ClearAttributes(EndpointId endpointId)
 {
+    if constexpr (CanEnableDataCaching && UseFlatStorage)
+    {
+        auto endpointIter = mCache.find(endpointId);
+        VerifyOrReturn(endpointIter != mCache.end());
+        for (auto & clusterIter : endpointIter->second)
+        {
+            ReleasePayloads(clusterIter.second);
+        }
+    }
+
     mCache.erase(endpointId);
+    CompactPayloadsIfNeeded();
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(const ConcreteClusterPath & cluster)
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+void ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::ClearAttributes(const ConcreteClusterPath & cluster)
 {
     // Can't use GetEndpointState here, since that only handles const things.
     auto endpointIter = mCache.find(cluster.mEndpointId);
@@ -657,11 +736,19 @@ void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(const ConcreteClu
     }
 
     auto & endpointState = endpointIter->second;
+    if constexpr (CanEnableDataCaching && UseFlatStorage)
+    {
+        auto clusterIter = endpointState.find(cluster.mClusterId);
+        VerifyOrReturn(clusterIter != endpointState.end());
+        ReleasePayloads(clusterIter->second);
+    }
+
     endpointState.erase(cluster.mClusterId);
+    CompactPayloadsIfNeeded();
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttribute(const ConcreteAttributePath & attribute)
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+void ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::ClearAttribute(const ConcreteAttributePath & attribute)
 {
     // Can't use GetClusterState here, since that only handles const things.
     auto endpointIter = mCache.find(attribute.mEndpointId);
@@ -678,11 +765,61 @@ void ClusterStateCacheT<CanEnableDataCaching>::ClearAttribute(const ConcreteAttr
     }
 
     auto & clusterState = clusterIter->second;
+    if constexpr (CanEnableDataCaching && UseFlatStorage)
+    {
+        auto attributeIter = clusterState.mAttributes.find(attribute.mAttributeId);
+        VerifyOrReturn(attributeIter != clusterState.mAttributes.end());
+        if (attributeIter->second.template Is<AttributeData>())
+        {
+            mPayloads.Release(attributeIter->second.template Get<AttributeData>());
+        }
+    }
+
     clusterState.mAttributes.erase(attribute.mAttributeId);
+    CompactPayloadsIfNeeded();
+}
+
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+void ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::ReleasePayloads(const ClusterState & clusterState)
+{
+    if constexpr (CanEnableDataCaching && UseFlatStorage)
+    {
+        for (auto & attributeIter : clusterState.mAttributes)
+        {
+            if (attributeIter.second.template Is<AttributeData>())
+            {
+                mPayloads.Release(attributeIter.second.template Get<AttributeData>());
+            }
+        }
+    }
+}
+
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+void ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::CompactPayloadsIfNeeded()
+{
+    if constexpr (CanEnableDataCaching && UseFlatStorage)
+    {
+        VerifyOrReturn(mPayloads.NeedsCompaction());
+        LogErrorOnFailure(mPayloads.Compact([this](auto && function) {
+            for (auto & endpointIter : mCache)
+            {
+                for (auto & clusterIter : endpointIter.second)
+                {
+                    for (auto & attributeIter : clusterIter.second.mAttributes)
+                    {
+                        if (attributeIter.second.template Is<AttributeData>())
+                        {
+                            function(attributeIter.second.template Get<AttributeData>());
+                        }
+                    }
+                }
+            }
+        }));
+    }
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(ConcreteClusterPath & aPath)
+template <bool CanEnableDataCaching, bool UseFlatStorage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, UseFlatStorage>::GetLastReportDataPath(ConcreteClusterPath & aPath)
 {
     if (mLastReportDataPath.IsValidConcreteClusterPath())
     {
@@ -693,8 +830,10 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(Concr
 }
 
 // Ensure that our out-of-line template methods actually get compiled.
-template class ClusterStateCacheT<true>;
-template class ClusterStateCacheT<false>;
+template class ClusterStateCacheT<true, false>;
+template class ClusterStateCacheT<false, false>;
+template class ClusterStateCacheT<true, true>;
+template class ClusterStateCacheT<false, true>;
 
 } // namespace app
 } // namespace chip
@@ -24,10 +24,12 @@
 #include <app/AppConfig.h>
 #include <app/AttributePathParams.h>
 #include <app/BufferedReadCallback.h>
+#include <app/ClusterStateCacheStorage.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/ReadClient.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/support/Variant.h>
 #include <list>
 #include <map>
@@ -62,12 +64,16 @@ namespace app {
  * through to a registered callback. In addition, it provides its own enhancements to the base ReadClient::Callback
  * to make it easier to know what has changed in the cache.
  *
+ * The cached state is kept either in std::map nodes, with a separate allocation for the data of each attribute, or
+ * (if UseFlatStorage is true, see CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE) in sorted vectors, with the data of all
+ * attributes packed in a single buffer which is compacted as data gets replaced or cleared.
+ *
  * **NOTE**
  * 1. This already includes the BufferedReadCallback, so there is no need to add that to the ReadClient callback chain.
  * 2. The same cache cannot be used by multiple subscribe/read interactions at the same time.
  *
  */
-template <bool CanEnableDataCaching>
+template <bool CanEnableDataCaching, bool UseFlatStorage = CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE>
 class ClusterStateCacheT : protected ReadClient::Callback
 {
 public:
@@ -142,8 +148,8 @@ public:
      *
      * For some types of attributes, the value for the attribute is directly backed by the underlying TLV buffer
      * and has pointers into that buffer. (e.g octet strings, char strings and lists).  This buffer only remains
-     * valid until the cached value for that path is updated, so it must not be held
-     * across any async call boundaries.
+     * valid until the cached value for that path is updated (with flat storage, until any cached attribute is
+     * updated or cleared), so it must not be held across any async call boundaries.
      *
      * The template parameter AttributeObjectTypeT is generally expected to be a
      * ClusterName::Attributes::AttributeName::DecodableType, but any
@@ -214,8 +220,8 @@ public:
      *
      * For some types of attributes, the value for the attribute is directly backed by the underlying TLV buffer
      * and has pointers into that buffer. (e.g octet strings, char strings and lists).  This buffer only remains
-     * valid until the cached value for that path is updated, so it must not be held
-     * across any async call boundaries.
+     * valid until the cached value for that path is updated (with flat storage, until any cached attribute is
+     * updated or cleared), so it must not be held across any async call boundaries.
      *
      * The template parameter ClusterObjectT is generally expected to be a
      * ClusterName::Attributes::DecodableType, but any
@@ -466,7 +472,7 @@ public:
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
     {
         auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
+        if (endpointIter != mCache.end())
         {
             for (auto & clusterIter : endpointIter->second)
             {
@@ -590,8 +596,15 @@ private:
     // The data for a single attribute is not going to be gigabytes in size, so
     // using uint32_t for the size is fine; on 64-bit systems this can save
     // quite a bit of space.
-    using AttributeData  = Platform::ScopedMemoryBufferWithSize<uint8_t>;
+    //
+    // With flat storage, the data is a slice of mPayloads.
+    using AttributeData =
+        std::conditional_t<UseFlatStorage, detail::PayloadArena::Slice, Platform::ScopedMemoryBufferWithSize<uint8_t>>;
     using AttributeState = std::conditional_t<CanEnableDataCaching, Variant<StatusIB, AttributeData, uint32_t>, uint32_t>;
+
+    template <typename Key, typename Value>
+    using Map = std::conditional_t<UseFlatStorage, detail::FlatMap<Key, Value>, std::map<Key, Value>>;
+
     // mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
     //
     // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
@@ -599,12 +612,27 @@ private:
     // and we must not be in the middle of receiving reports for that cluster.
     struct ClusterState
     {
-        std::map<AttributeId, AttributeState> mAttributes;
+        ClusterState() = default;
+
+        // Moves must not throw for the vectors of flat storage to move rather than copy cluster states as they grow.
+        ClusterState(ClusterState && other) noexcept :
+            mAttributes(std::move(other.mAttributes)), mPendingDataVersion(other.mPendingDataVersion),
+            mCommittedDataVersion(other.mCommittedDataVersion)
+        {}
+        ClusterState & operator=(ClusterState && other) noexcept
+        {
+            mAttributes           = std::move(other.mAttributes);
+            mPendingDataVersion   = other.mPendingDataVersion;
+            mCommittedDataVersion = other.mCommittedDataVersion;
+            return *this;
+        }
+
+        Map<AttributeId, AttributeState> mAttributes;
         Optional<DataVersion> mPendingDataVersion;
         Optional<DataVersion> mCommittedDataVersion;
     };
-    using EndpointState = std::map<ClusterId, ClusterState>;
-    using NodeState     = std::map<EndpointId, EndpointState>;
+    using EndpointState = Map<ClusterId, ClusterState>;
+    using NodeState     = Map<EndpointId, EndpointState>;
 
     struct Comparator
     {
@@ -717,9 +745,16 @@ private:
 
     CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize);
 
+    // Flat storage bookkeeping: account for the payloads of a cluster being removed, and reclaim the space of removed
+    // payloads once it is worth it.
+    void ReleasePayloads(const ClusterState & clusterState);
+    void CompactPayloadsIfNeeded();
+
     Callback & mCallback;
     NodeState mCache;
-    std::set<ConcreteAttributePath> mChangedAttributeSet;
+    detail::PayloadArena mPayloads; // Only used with flat storage
+    // With flat storage, appended to during a report and sorted once it ends.
+    std::conditional_t<UseFlatStorage, std::vector<ConcreteAttributePath>, std::set<ConcreteAttributePath>> mChangedAttributeSet;
     std::set<AttributePathParams, Comparator> mRequestPathSet; // wildcard attribute request path only
     std::vector<EndpointId> mAddedEndpoints;
 
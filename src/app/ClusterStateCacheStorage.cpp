@@ -0,0 +1,102 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ClusterStateCacheStorage.h>
+
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+namespace detail {
+
+CHIP_ERROR PayloadArena::Reserve(size_t length)
+{
+    size_t capacity = mBuffer.AllocatedSize();
+    if (capacity - mUsedBytes >= length)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    size_t newCapacity = (capacity < kInitialCapacity) ? kInitialCapacity : capacity;
+    while (newCapacity - mUsedBytes < length)
+    {
+        VerifyOrReturnError(newCapacity <= UINT32_MAX / 2, CHIP_ERROR_NO_MEMORY);
+        newCapacity *= 2;
+    }
+
+    Platform::ScopedMemoryBufferWithSize<uint8_t> buffer;
+    VerifyOrReturnError(buffer.Alloc(newCapacity).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    if (mUsedBytes > 0)
+    {
+        memcpy(buffer.Get(), mBuffer.Get(), mUsedBytes);
+    }
+    mBuffer = std::move(buffer);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PayloadArena::Store(const TLV::TLVReader & reader, const Slice * previous, Slice & slice)
+{
+    // The encoded size is only known once written, so write at the end of the buffer, growing it until the element fits.
+    size_t available = kInitialCapacity;
+    uint32_t length  = 0;
+    while (true)
+    {
+        ReturnErrorOnFailure(Reserve(available));
+        available = mBuffer.AllocatedSize() - mUsedBytes;
+
+        TLV::TLVReader element;
+        element.Init(reader);
+        TLV::TLVWriter writer;
+        writer.Init(mBuffer.Get() + mUsedBytes, available);
+        CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), element);
+        if (err == CHIP_NO_ERROR)
+        {
+            length = writer.GetLengthWritten();
+            break;
+        }
+        VerifyOrReturnError(err == CHIP_ERROR_BUFFER_TOO_SMALL || err == CHIP_ERROR_NO_MEMORY, err);
+        VerifyOrReturnError(available <= UINT32_MAX / 2, CHIP_ERROR_NO_MEMORY);
+        available *= 2;
+    }
+
+    if (previous != nullptr && length <= previous->mLength)
+    {
+        // Reuse the bytes of the previous payload rather than growing the buffer.
+        memcpy(mBuffer.Get() + previous->mOffset, mBuffer.Get() + mUsedBytes, length);
+        mUnusedBytes += previous->mLength - length;
+        slice.mOffset = previous->mOffset;
+        slice.mLength = length;
+        return CHIP_NO_ERROR;
+    }
+
+    if (previous != nullptr)
+    {
+        Release(*previous);
+    }
+    slice.mOffset = mUsedBytes;
+    slice.mLength = length;
+    mUsedBytes += length;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace detail
+} // namespace app
+} // namespace chip
@@ -0,0 +1,203 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *   Containers backing the flat storage mode of ClusterStateCacheT.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLVReader.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+
+#include <algorithm>
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace chip {
+namespace app {
+namespace detail {
+
+/**
+ * Map kept as a vector of key/value pairs sorted by key, with the subset of the std::map API used by the cluster state
+ * cache.
+ *
+ * Lookups are binary searches over contiguous memory and the whole map takes a single allocation. Insertions are linear
+ * in the number of entries after the insertion point, which is free for the usual case of entries arriving in increasing
+ * key order. Any insertion or removal invalidates the references to the values of the map.
+ */
+template <typename Key, typename Value>
+class FlatMap
+{
+public:
+    using value_type     = std::pair<Key, Value>;
+    using iterator       = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    iterator begin() { return mEntries.begin(); }
+    iterator end() { return mEntries.end(); }
+    const_iterator begin() const { return mEntries.begin(); }
+    const_iterator end() const { return mEntries.end(); }
+
+    bool empty() const { return mEntries.empty(); }
+    size_t size() const { return mEntries.size(); }
+
+    iterator find(const Key & key)
+    {
+        auto iter = LowerBound(key);
+        return (iter != mEntries.end() && iter->first == key) ? iter : mEntries.end();
+    }
+
+    const_iterator find(const Key & key) const
+    {
+        auto iter = LowerBound(key);
+        return (iter != mEntries.end() && iter->first == key) ? iter : mEntries.end();
+    }
+
+    Value & operator[](const Key & key)
+    {
+        if (mEntries.empty() || mEntries.back().first < key)
+        {
+            mEntries.emplace_back(key, Value());
+            return mEntries.back().second;
+        }
+
+        auto iter = LowerBound(key);
+        if (iter->first != key)
+        {
+            iter = mEntries.emplace(iter, key, Value());
+        }
+        return iter->second;
+    }
+
+    size_t erase(const Key & key)
+    {
+        auto iter = find(key);
+        if (iter == mEntries.end())
+        {
+            return 0;
+        }
+        mEntries.erase(iter);
+        return 1;
+    }
+
+private:
+    static bool KeyLess(const value_type & entry, const Key & key) { return entry.first < key; }
+
+    iterator LowerBound(const Key & key) { return std::lower_bound(mEntries.begin(), mEntries.end(), key, KeyLess); }
+    const_iterator LowerBound(const Key & key) const
+    {
+        return std::lower_bound(mEntries.begin(), mEntries.end(), key, KeyLess);
+    }
+
+    std::vector<value_type> mEntries;
+};
+
+/**
+ * Single growable buffer holding the TLV payloads of the cached attributes back to back.
+ *
+ * Payloads are referenced by Slice (offset and length) rather than by pointer, so the buffer can be reallocated and
+ * compacted. Released or shrunk payloads leave unused bytes behind, which Compact() reclaims once they make up a large
+ * enough part of the buffer.
+ */
+class PayloadArena
+{
+public:
+    struct Slice
+    {
+        uint32_t mOffset = 0;
+        uint32_t mLength = 0;
+    };
+
+    /**
+     * Copy the TLV element `reader` is positioned on, with an anonymous tag, and set `slice` to its location.
+     *
+     * The element overwrites the payload of `previous` if it is not null and large enough; otherwise `previous` is
+     * released and the element is appended.
+     */
+    CHIP_ERROR Store(const TLV::TLVReader & reader, const Slice * previous, Slice & slice);
+
+    void Release(const Slice & slice) { mUnusedBytes += slice.mLength; }
+
+    ByteSpan Get(const Slice & slice) const { return ByteSpan(mBuffer.Get() + slice.mOffset, slice.mLength); }
+
+    /// Whether enough of the buffer is unused for Compact() to be worth its copy.
+    bool NeedsCompaction() const { return mUnusedBytes >= kMinCompactionBytes && mUnusedBytes >= mUsedBytes / 2; }
+
+    /**
+     * Move the live payloads back to back into a new buffer sized for them. `forEachSlice(function)` must call
+     * `function(Slice & slice)` for every live slice, and will be called twice.
+     */
+    template <typename ForEachSlice>
+    CHIP_ERROR Compact(ForEachSlice && forEachSlice)
+    {
+        size_t liveBytes = 0;
+        forEachSlice([&liveBytes](Slice & slice) { liveBytes += slice.mLength; });
+
+        Platform::ScopedMemoryBufferWithSize<uint8_t> buffer;
+        if (liveBytes > 0)
+        {
+            VerifyOrReturnError(buffer.Alloc(liveBytes).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+        }
+
+        uint32_t offset = 0;
+        forEachSlice([&](Slice & slice) {
+            memcpy(buffer.Get() + offset, mBuffer.Get() + slice.mOffset, slice.mLength);
+            slice.mOffset = offset;
+            offset += slice.mLength;
+        });
+
+        mBuffer      = std::move(buffer);
+        mUsedBytes   = offset;
+        mUnusedBytes = 0;
+        return CHIP_NO_ERROR;
+    }
+
+    void Clear()
+    {
+        mBuffer.Free();
+        mUsedBytes   = 0;
+        mUnusedBytes = 0;
+    }
+
+    /// Size of the buffer, including the bytes not used yet.
+    size_t Capacity() const { return mBuffer.AllocatedSize(); }
+
+    /// Number of bytes of the buffer taken by live payloads.
+    size_t LiveBytes() const { return mUsedBytes - mUnusedBytes; }
+
+private:
+    static constexpr size_t kInitialCapacity   = 1024;
+    static constexpr size_t kMinCompactionBytes = 4096;
+
+    // Make room for `length` more bytes after the used ones.
+    CHIP_ERROR Reserve(size_t length);
+
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mBuffer;
+    uint32_t mUsedBytes   = 0; // Bytes up to the end of the last payload
+    uint32_t mUnusedBytes = 0; // Bytes of the released and shrunk payloads within mUsedBytes
+};
+
+} // namespace detail
+} // namespace app
+} // namespace chip
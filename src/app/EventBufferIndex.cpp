@@ -0,0 +1,101 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/EventBufferIndex.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+// Fibonacci hashing of an id to one of the 64 bits of a block bitmap.
+uint64_t BitmapBit(uint32_t id)
+{
+    return 1ull << ((static_cast<uint64_t>(id) * 0x9E3779B97F4A7C15ull) >> 58);
+}
+
+} // namespace
+
+bool EventBufferIndex::Block::MayContain(const EventPathParams & path) const
+{
+    VerifyOrReturnValue(path.HasWildcardEndpointId() || (mEndpoints & BitmapBit(path.mEndpointId)) != 0, false);
+    VerifyOrReturnValue(path.HasWildcardClusterId() || (mClusters & BitmapBit(path.mClusterId)) != 0, false);
+    return true;
+}
+
+void EventBufferIndex::Reset(uint32_t bufferLength)
+{
+    mFirstBlock  = 0;
+    mBlockCount  = 0;
+    mLength      = 0;
+    mBlockLength = bufferLength / kTargetBlocks;
+    if (mBlockLength == 0)
+    {
+        mBlockLength = 1;
+    }
+}
+
+void EventBufferIndex::Append(EventNumber eventNumber, uint32_t length, EndpointId endpoint, ClusterId cluster)
+{
+    Block * block = nullptr;
+    if (mBlockCount > 0)
+    {
+        block = &mBlocks[(mFirstBlock + mBlockCount - 1) % kMaxBlocks];
+    }
+
+    // Start a new block once the newest one is long enough. Should the buffer hold more events than expected (e.g. if it
+    // was not sized through Reset), keep growing the newest block rather than failing.
+    if (block == nullptr || (block->mLength >= mBlockLength && mBlockCount < kMaxBlocks))
+    {
+        block  = &mBlocks[(mFirstBlock + mBlockCount) % kMaxBlocks];
+        *block = Block{};
+        mBlockCount++;
+    }
+
+    block->mLastEventNumber = eventNumber;
+    block->mLength += length;
+    block->mEventCount++;
+    block->mEndpoints |= BitmapBit(endpoint);
+    block->mClusters |= BitmapBit(cluster);
+    mLength += length;
+}
+
+void EventBufferIndex::RemoveHead(uint32_t length)
+{
+    VerifyOrReturn(mBlockCount > 0);
+
+    Block & block = mBlocks[mFirstBlock];
+    // A length larger than the block means the index is out of sync with the buffer, which the owner notices through
+    // GetLength(); keep the accounting non-negative.
+    length = (length < block.mLength) ? length : block.mLength;
+    block.mLength -= length;
+    block.mEventCount--;
+    mLength -= length;
+
+    if (block.mEventCount == 0)
+    {
+        mLength -= block.mLength;
+        mFirstBlock = (mFirstBlock + 1) % kMaxBlocks;
+        mBlockCount--;
+    }
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/EventPathParams.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/Iterators.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Side index of the events held by a CircularEventBuffer.
+ *
+ * The events of the buffer, oldest first, are grouped in consecutive blocks of roughly
+ * 1/CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS of the buffer size. Each block records its length in bytes, the number of
+ * its newest event and bitmaps of the endpoints and clusters of its events, which is enough to skip over a whole block
+ * when fetching events without decoding any of them.
+ *
+ * The index must be told about every event appended to or removed from the buffer. The owner detects a desynchronized
+ * index by comparing GetLength() with the length of the buffer, and rebuilds it by replaying the buffer content.
+ */
+class EventBufferIndex
+{
+public:
+    struct Block
+    {
+        EventNumber mLastEventNumber; // Number of the newest event of the block
+        uint32_t mLength;             // Length in bytes of the events of the block
+        uint32_t mEventCount;
+        uint64_t mEndpoints; // Bitmaps of the hashed endpoint and cluster ids of the events of the block,
+        uint64_t mClusters;  // which may have false positives once events are removed
+
+        /**
+         * Returns false if the block is known to hold no event matching `path`.
+         */
+        bool MayContain(const EventPathParams & path) const;
+    };
+
+    /**
+     * Remove all the events and size blocks for a buffer of `bufferLength` bytes.
+     */
+    void Reset(uint32_t bufferLength);
+
+    /**
+     * Record an event of `length` bytes appended to the buffer.
+     */
+    void Append(EventNumber eventNumber, uint32_t length, EndpointId endpoint, ClusterId cluster);
+
+    /**
+     * Record the removal of the oldest event of the buffer, which is `length` bytes long.
+     */
+    void RemoveHead(uint32_t length);
+
+    /// Total length in bytes of the indexed events.
+    uint32_t GetLength() const { return mLength; }
+
+    size_t GetBlockCount() const { return mBlockCount; }
+
+    /**
+     * Calls `function(const Block & block)` for every block, oldest first, until it returns Loop::Break.
+     */
+    template <typename Function>
+    Loop ForEachBlock(Function && function) const
+    {
+        for (size_t i = 0; i < mBlockCount; ++i)
+        {
+            if (function(mBlocks[(mFirstBlock + i) % kMaxBlocks]) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+private:
+    // Block lengths are at least mBlockLength bytes but for the oldest one, which may have been partly removed, and the
+    // newest one, which is still being filled.
+    static constexpr uint32_t kTargetBlocks = (CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0) ? CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS : 1;
+    static constexpr size_t kMaxBlocks      = kTargetBlocks + 2;
+
+    Block mBlocks[kMaxBlocks];
+    size_t mFirstBlock    = 0;
+    size_t mBlockCount    = 0;
+    uint32_t mBlockLength = 1;
+    uint32_t mLength      = 0;
+};
+
+} // namespace app
+} // namespace chip
@@ -25,6 +25,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
 
@@ -57,6 +58,69 @@ public:
     virtual ~CircularEventReader() = default;
 };
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+/**
+ * @brief
+ *   A read-only TLVBackingStore over aLength bytes of a CircularEventBuffer, starting aOffset bytes after its head.
+ */
+class CircularEventBufferRange : public TLV::TLVBackingStore
+{
+public:
+    CircularEventBufferRange(const CircularEventBuffer & aBuffer, uint32_t aOffset, uint32_t aLength) :
+        mBuffer(aBuffer), mOffset(aOffset), mLength(aLength)
+    {}
+
+    CHIP_ERROR OnInit(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        aBufStart = nullptr;
+        return GetNextBuffer(aReader, aBufStart, aBufLen);
+    }
+
+    CHIP_ERROR GetNextBuffer(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        // The range is made of at most two contiguous chunks: up to the end of the storage, then from its start.
+        const uint8_t * queue = mBuffer.GetQueue();
+        const uint32_t size   = mBuffer.GetTotalDataLength();
+        if (aBufStart == nullptr)
+        {
+            const uint32_t start = (static_cast<uint32_t>(mBuffer.QueueHead() - queue) + mOffset) % size;
+            aBufStart            = queue + start;
+            aBufLen              = std::min(mLength, size - start);
+            mFirstChunkLength    = aBufLen;
+        }
+        else if (aBufStart == queue + size)
+        {
+            aBufStart = queue;
+            aBufLen   = mLength - mFirstChunkLength;
+        }
+        else
+        {
+            aBufLen = 0;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnInit(TLVWriter & aWriter, uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR GetNewBuffer(TLVWriter & aWriter, uint8_t *& aBufStart, uint32_t & aBufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & aWriter, uint8_t * aBufStart, uint32_t aBufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const CircularEventBuffer & mBuffer;
+    const uint32_t mOffset;
+    const uint32_t mLength;
+    uint32_t mFirstChunkLength = 0;
+};
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+
 EventManagement & EventManagement::GetInstance()
 {
     return sInstance;
@@ -135,6 +199,10 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
     CircularEventBuffer backup = *nextBuffer;
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    EventEnvelopeContext event;
+    bool eventIndexed = false;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
 
     // Set up the next buffer s.t. it fails if needs to evict an element
     nextBuffer->mProcessEvictedElement = AlwaysFail;
@@ -147,12 +215,26 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = reader.Next();
     SuccessOrExit(err);
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    // An event which cannot be decoded is still copied; the next buffer index will be rebuilt as it misses it.
+    eventIndexed = (ReadEventEnvelope(reader, event) == CHIP_NO_ERROR);
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+
     err = writer.CopyElement(reader);
     SuccessOrExit(err);
 
     err = writer.Finalize();
     SuccessOrExit(err);
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    // The caller evicts the head event right after it got copied.
+    if (eventIndexed)
+    {
+        nextBuffer->GetIndex().Append(event.mEventNumber, writer.GetLengthWritten(), event.mEndpointId, event.mClusterId);
+    }
+    apEventBuffer->GetIndex().RemoveHead(writer.GetLengthWritten());
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+
     ChipLogDetail(EventLogging, "Copy Event to next buffer with priority %u", static_cast<unsigned>(nextBuffer->GetPriority()));
 exit:
     if (err != CHIP_NO_ERROR)
@@ -469,6 +551,9 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     SuccessOrExit(err);
 
     mBytesWritten += writer.GetLengthWritten();
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    mpEventBuffer->GetIndex().Append(mLastEventNumber, writer.GetLengthWritten(), opts.mPath.mEndpointId, opts.mPath.mClusterId);
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -589,8 +674,7 @@ bool EventManagement::IncludeEventInReport(EventLoadOutContext * eventLoadOutCon
     return true;
 }
 
-CHIP_ERROR EventManagement::EventIterator(const TLVReader & aReader, size_t aDepth, EventLoadOutContext * apEventLoadOutContext,
-                                          EventEnvelopeContext * event, bool & encodeEvent)
+CHIP_ERROR EventManagement::ReadEventEnvelope(const TLVReader & aReader, EventEnvelopeContext & aEvent)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     TLVReader innerReader;
@@ -598,14 +682,13 @@ CHIP_ERROR EventManagement::EventIterator(const TLVReader & aReader, size_t aDep
     TLVType tlvType1;
 
     innerReader.Init(aReader);
-    VerifyOrDie(event != nullptr);
     ReturnErrorOnFailure(innerReader.EnterContainer(tlvType));
     ReturnErrorOnFailure(innerReader.Next());
 
     ReturnErrorOnFailure(innerReader.EnterContainer(tlvType1));
-    err = TLV::Utilities::Iterate(innerReader, FetchEventParameters, event, false /*recurse*/);
+    err = TLV::Utilities::Iterate(innerReader, FetchEventParameters, &aEvent, false /*recurse*/);
 
-    if (event->mFieldsToRead != kRequiredEventField)
+    if (aEvent.mFieldsToRead != kRequiredEventField)
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
@@ -614,7 +697,14 @@ CHIP_ERROR EventManagement::EventIterator(const TLVReader & aReader, size_t aDep
     {
         err = CHIP_NO_ERROR;
     }
-    ReturnErrorOnFailure(err);
+    return err;
+}
+
+CHIP_ERROR EventManagement::EventIterator(const TLVReader & aReader, size_t aDepth, EventLoadOutContext * apEventLoadOutContext,
+                                          EventEnvelopeContext * event, bool & encodeEvent)
+{
+    VerifyOrDie(event != nullptr);
+    ReturnErrorOnFailure(ReadEventEnvelope(aReader, *event));
 
     apEventLoadOutContext->mCurrentTime        = event->mCurrentTime;
     apEventLoadOutContext->mCurrentEventNumber = event->mEventNumber;
@@ -666,10 +756,19 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
-    SuccessOrExit(err);
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    if (mEventIndexEnabled)
+    {
+        err = FetchIndexedEventsSince(context);
+    }
+    else
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    {
+        err = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
+        SuccessOrExit(err);
 
-    err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
+        err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
+    }
     if (err == CHIP_END_OF_TLV)
     {
         err = CHIP_NO_ERROR;
@@ -690,6 +789,90 @@ exit:
     return err;
 }
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+CHIP_ERROR EventManagement::FetchIndexedEventsSince(EventLoadOutContext & aContext) const
+{
+    // Like GetEventReader, go from the buffer holding the oldest events to the one holding the newest.
+    for (CircularEventBuffer * buffer = GetPriorityBuffer(PriorityLevel::Critical); buffer != nullptr;
+         buffer                       = buffer->GetPreviousCircularEventBuffer())
+    {
+        if (buffer->GetIndex().GetLength() != buffer->DataLength())
+        {
+            RebuildEventIndex(*buffer);
+        }
+        if (buffer->GetIndex().GetLength() != buffer->DataLength())
+        {
+            ReturnErrorOnFailure(CopyEventsInRange(*buffer, 0, buffer->DataLength(), aContext));
+            continue;
+        }
+
+        // Copy the events of consecutive blocks which may hold events to report in one go, skip the other blocks.
+        CHIP_ERROR err  = CHIP_NO_ERROR;
+        uint32_t offset = 0;
+        uint32_t length = 0;
+        buffer->GetIndex().ForEachBlock([&](const EventBufferIndex::Block & block) {
+            bool mayReport = (block.mLastEventNumber >= aContext.mStartingEventNumber);
+            if (mayReport)
+            {
+                mayReport = false;
+                for (auto * path = aContext.mpInterestedEventPaths; path != nullptr && !mayReport; path = path->mpNext)
+                {
+                    mayReport = block.MayContain(path->mValue);
+                }
+            }
+            if (mayReport)
+            {
+                length += block.mLength;
+                return Loop::Continue;
+            }
+
+            err = CopyEventsInRange(*buffer, offset, length, aContext);
+            VerifyOrReturnValue(err == CHIP_NO_ERROR, Loop::Break);
+            // Same as if all the events of the block had been iterated and filtered out.
+            aContext.mCurrentEventNumber = block.mLastEventNumber;
+            offset += length + block.mLength;
+            length = 0;
+            return Loop::Continue;
+        });
+        ReturnErrorOnFailure(err);
+        ReturnErrorOnFailure(CopyEventsInRange(*buffer, offset, length, aContext));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EventManagement::CopyEventsInRange(const CircularEventBuffer & aBuffer, uint32_t aOffset, uint32_t aLength,
+                                               EventLoadOutContext & aContext)
+{
+    VerifyOrReturnError(aLength > 0, CHIP_NO_ERROR);
+
+    CircularEventBufferRange range(aBuffer, aOffset, aLength);
+    TLVReader reader;
+    ReturnErrorOnFailure(reader.Init(range, aLength));
+
+    CHIP_ERROR err = TLV::Utilities::Iterate(reader, CopyEventsSince, &aContext, false /*recurse*/);
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+void EventManagement::RebuildEventIndex(CircularEventBuffer & aBuffer)
+{
+    EventBufferIndex & index = aBuffer.GetIndex();
+    CircularTLVReader reader;
+    uint32_t eventStart = 0;
+
+    ChipLogDetail(EventLogging, "Rebuilding index of event buffer with priority %u", static_cast<unsigned>(aBuffer.GetPriority()));
+    index.Reset(aBuffer.GetTotalDataLength());
+    reader.Init(aBuffer);
+    while (reader.Next() == CHIP_NO_ERROR)
+    {
+        EventEnvelopeContext event;
+        VerifyOrReturn(ReadEventEnvelope(reader, event) == CHIP_NO_ERROR);
+        VerifyOrReturn(reader.Skip() == CHIP_NO_ERROR);
+        index.Append(event.mEventNumber, reader.GetLengthRead() - eventStart, event.mEndpointId, event.mClusterId);
+        eventStart = reader.GetLengthRead();
+    }
+}
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+
 CHIP_ERROR EventManagement::FabricRemovedCB(const TLV::TLVReader & aReader, size_t aDepth, void * apContext)
 {
     // the function does not actually remove the event, instead, it sets the fabric index to an invalid value.
@@ -850,6 +1033,9 @@ CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAp
                         static_cast<unsigned>(eventBuffer->GetPriority()), ChipLogValueX64(context.mEventNumber),
                         static_cast<unsigned>(imp));
         ctx->mSpaceNeededForMovedEvent = 0;
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+        eventBuffer->GetIndex().RemoveHead(aReader.GetLengthRead());
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
         return CHIP_NO_ERROR;
     }
 
@@ -882,6 +1068,9 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
     mpPrev    = apPrev;
     mpNext    = apNext;
     mPriority = aPriorityLevel;
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    mIndex.Reset(aBufferLength);
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
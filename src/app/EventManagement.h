@@ -28,6 +28,7 @@
 
 #include "EventLoggingDelegate.h"
 #include <access/SubjectDescriptor.h>
+#include <app/EventBufferIndex.h>
 #include <app/EventLoggingTypes.h>
 #include <app/EventReporter.h>
 #include <app/MessageDef/EventDataIB.h>
@@ -130,6 +131,10 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    EventBufferIndex & GetIndex() { return mIndex; }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+
     ~CircularEventBuffer() override = default;
 
 private:
@@ -141,6 +146,10 @@ private:
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    EventBufferIndex mIndex; ///< Summary of the events of the buffer, used to skip them without decoding them
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+
     CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
 };
 
@@ -367,6 +376,15 @@ public:
     CHIP_ERROR FetchEventsSince(chip::TLV::TLVWriter & aWriter, const SingleLinkedListNode<EventPathParams> * apEventPathList,
                                 EventNumber & aEventMin, size_t & aEventCount,
                                 const Access::SubjectDescriptor & aSubjectDescriptor);
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    /**
+     * @brief
+     *   Select whether FetchEventsSince uses the event buffer indexes to skip the events which cannot be included in the
+     *   report, or decodes every event of the log. The indexes are kept up to date either way. Enabled by default.
+     */
+    void SetEventIndexEnabled(bool aEnabled) { mEventIndexEnabled = aEnabled; }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
     /**
      * @brief brief Iterate all events and invalidate the fabric-sensitive events whose associated fabric has the given fabric
      * index.
@@ -517,6 +535,29 @@ private:
     static CHIP_ERROR EventIterator(const TLV::TLVReader & aReader, size_t aDepth, EventLoadOutContext * apEventLoadOutContext,
                                     EventEnvelopeContext * event, bool & encodeEvent);
 
+    /**
+     * @brief Decode the envelope (path, number, priority, timestamp and fabric) of the event aReader is positioned on.
+     */
+    static CHIP_ERROR ReadEventEnvelope(const TLV::TLVReader & aReader, EventEnvelopeContext & aEvent);
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    /**
+     * @brief Implementation of FetchEventsSince which only decodes the index blocks that may hold events to report.
+     */
+    CHIP_ERROR FetchIndexedEventsSince(EventLoadOutContext & aContext) const;
+
+    /**
+     * @brief Copy the events stored in aLength bytes of aBuffer starting aOffset bytes after its head, see CopyEventsSince.
+     */
+    static CHIP_ERROR CopyEventsInRange(const CircularEventBuffer & aBuffer, uint32_t aOffset, uint32_t aLength,
+                                        EventLoadOutContext & aContext);
+
+    /**
+     * @brief Reindex all the events of aBuffer, for when its index got out of sync.
+     */
+    static void RebuildEventIndex(CircularEventBuffer & aBuffer);
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+
     /**
      * @brief Internal iterator function used to fetch event into EventEnvelopeContext, then EventIterator would filter event
      * based upon EventEnvelopeContext
@@ -579,6 +620,10 @@ private:
     System::Clock::Milliseconds64 mMonotonicStartupTime{};
 
     EventReporter * mpEventReporter = nullptr;
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+    bool mEventIndexEnabled = true;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
 };
 
 } // namespace app
@@ -39,6 +39,7 @@
 #include <app/data-model-provider/MetadataTypes.h>
 #include <app/data-model-provider/OperationTypes.h>
 #include <app/data-model/List.h>
+#include <app/reporting/reporting.h>
 #include <app/util/IMClusterCommandHandler.h>
 #include <app/util/af-types.h>
 #include <app/util/endpoint-config-api.h>
@@ -209,8 +210,15 @@ CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeM
     TEMPORARY_RETURN_IGNORED mReportingEngine.Init((eventManagement != nullptr) ? eventManagement
                                                                                 : &EventManagement::GetInstance());
 
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    ReturnErrorOnFailure(mSubscriptionResumptionScheduler.Init(mpExchangeMgr->GetSessionManager()->SystemLayer(), this));
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
     StatusIB::RegisterErrorFormatter();
 
+    // Changes queued from other threads before a restart lost their flush along with the System Layer's work queue.
+    MatterReportingClearPendingAttributeChanges();
+
     mState = State::kInitialized;
     return CHIP_NO_ERROR;
 }
@@ -220,6 +228,9 @@ void InteractionModelEngine::Shutdown()
     VerifyOrReturn(State::kUninitialized != mState);
 
     mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(ResumeSubscriptionsTimerCallback, this);
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    mSubscriptionResumptionScheduler.Shutdown();
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 
     // TODO: individual object clears the entire command handler interface registry.
     //       This may not be expected as IME does NOT own the command handler interface registry.
@@ -276,6 +287,7 @@ void InteractionModelEngine::Shutdown()
     }
 
     mReportingEngine.Shutdown();
+    MatterReportingClearPendingAttributeChanges();
     mAttributePathPool.ReleaseAll();
     mEventPathPool.ReleaseAll();
     mDataVersionFilterPool.ReleaseAll();
@@ -2082,6 +2094,14 @@ void InteractionModelEngine::OnFabricRemoved(const FabricTable & fabricTable, Fa
         }
     }
 
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+    // The subscriptions of the fabric waiting for their turn to be resumed are gone with it.
+    for (size_t count = mSubscriptionResumptionScheduler.CancelFabric(fabricIndex); count > 0; count--)
+    {
+        DecrementNumSubscriptionsToResume();
+    }
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
+
     // Applications may hold references to CommandHandlerImpl instances for async command processing.
     // Therefore we can't forcible destroy CommandHandlers here.  Their exchanges will get closed by
     // the fabric removal, though, so they will fail when they try to actually send their command response
@@ -2163,6 +2183,14 @@ void InteractionModelEngine::ResumeSubscriptionsTimerCallback(System::Layer * ap
             continue;
         }
 
+        // A retry may come while the previous attempt is still waiting for its turn.
+        if (imEngine->mSubscriptionResumptionScheduler.IsScheduled(
+                ScopedNodeId(subscriptionInfo.mNodeId, subscriptionInfo.mFabricIndex), subscriptionInfo.mSubscriptionId))
+        {
+            ChipLogProgress(InteractionModel, "Skip resuming scheduled subscriptionId %" PRIu32, subscriptionInfo.mSubscriptionId);
+            continue;
+        }
+
         auto subscriptionResumptionSessionEstablisher = Platform::MakeUnique<SubscriptionResumptionSessionEstablisher>();
         if (subscriptionResumptionSessionEstablisher == nullptr)
         {
@@ -2170,13 +2198,13 @@ void InteractionModelEngine::ResumeSubscriptionsTimerCallback(System::Layer * ap
             return;
         }
 
-        if (subscriptionResumptionSessionEstablisher->ResumeSubscription(*imEngine->mpCASESessionMgr, subscriptionInfo) !=
-            CHIP_NO_ERROR)
+        if (subscriptionResumptionSessionEstablisher->Init(*imEngine->mpCASESessionMgr, subscriptionInfo) != CHIP_NO_ERROR)
         {
             ChipLogProgress(InteractionModel, "Failed to ResumeSubscription 0x%" PRIx32, subscriptionInfo.mSubscriptionId);
             return;
         }
-        subscriptionResumptionSessionEstablisher.release();
+        // The scheduler starts the resumptions once they are all queued, peer by peer.
+        imEngine->mSubscriptionResumptionScheduler.Enqueue(subscriptionResumptionSessionEstablisher.release());
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
         resumedSubscriptions = true;
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
@@ -2244,6 +2272,23 @@ bool InteractionModelEngine::HasSubscriptionsToResume()
 }
 #endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
 
+bool InteractionModelEngine::CanSendPrimingReports()
+{
+    // The priming reports of the resumed subscriptions go out like any other report: wait for the reports in flight to
+    // release their buffers before resuming more subscriptions.
+    VerifyOrReturnValue(mReportingEngine.GetNumReportsInFlight() < CHIP_IM_MAX_REPORTS_IN_FLIGHT, false);
+
+    size_t numPriming = 0;
+    mReadHandlers.ForEachActiveObject([&numPriming](ReadHandler * handler) {
+        if (handler->IsPriming())
+        {
+            numPriming++;
+        }
+        return Loop::Continue;
+    });
+    return numPriming < CHIP_IM_MAX_REPORTS_IN_FLIGHT;
+}
+
 #if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS
 void InteractionModelEngine::DecrementNumSubscriptionsToResume()
 {
@@ -43,6 +43,7 @@
 #include <app/ReadClient.h>
 #include <app/ReadHandler.h>
 #include <app/StatusResponse.h>
+#include <app/SubscriptionResumptionScheduler.h>
 #include <app/SubscriptionResumptionSessionEstablisher.h>
 #include <app/SubscriptionStats.h>
 #include <app/SubscriptionsInfoProvider.h>
@@ -95,7 +96,8 @@ class InteractionModelEngine : public Messaging::UnsolicitedMessageHandler,
                                public SubscriptionsInfoProvider,
                                public TimedHandlerDelegate,
                                public WriteHandlerDelegate,
-                               public DeviceLoadStatusProvider
+                               public DeviceLoadStatusProvider,
+                               private SubscriptionResumptionScheduler::Delegate
 {
 public:
     /**
@@ -453,6 +455,9 @@ private:
 
     void TryToResumeSubscriptions();
 
+    // SubscriptionResumptionScheduler::Delegate
+    bool CanSendPrimingReports() override;
+
     ReadHandler::ApplicationCallback * GetAppCallback() override { return mpReadHandlerApplicationCallback; }
 
     InteractionModelEngine * GetInteractionModelEngine() override { return this; }
@@ -725,6 +730,8 @@ private:
      * by ComputeTimeSecondsTillNextSubscriptionResumption.
      */
     int8_t mNumOfSubscriptionsToResume = 0;
+    // Starts the resumptions queued by ResumeSubscriptionsTimerCallback a few peers at a time.
+    SubscriptionResumptionScheduler mSubscriptionResumptionScheduler;
 #if CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION
     bool HasSubscriptionsToResume();
     uint32_t ComputeTimeSecondsTillNextSubscriptionResumption();
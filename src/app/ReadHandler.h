@@ -39,6 +39,7 @@
 #include <app/OperationalSessionSetup.h>
 #include <app/SubscriptionResumptionSessionEstablisher.h>
 #include <app/SubscriptionResumptionStorage.h>
+#include <app/reporting/ReportPacer.h>
 #include <lib/core/CHIPCallback.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/TLVDebug.h>
@@ -254,6 +255,12 @@ public:
      */
     inline uint16_t GetSubscriberRequestedMaxInterval() const { return mSubscriberRequestedMaxInterval; }
 
+    /**
+     * @brief Returns the report latency metrics of this ReadHandler: how many reports and chunks it sent, and how long its
+     *        reports waited from the handler becoming reportable until their last chunk was sent.
+     */
+    const reporting::ReportPacer::LatencyStats & GetReportLatencyStats() const { return mReportPacer.GetLatencyStats(); }
+
     CHIP_ERROR SetMinReportingIntervalForTests(uint16_t aMinInterval)
     {
         VerifyOrReturnError(IsIdle(), CHIP_ERROR_INCORRECT_STATE);
@@ -456,6 +463,7 @@ private:
     const AttributeEncodeState & GetAttributeEncodeState() const { return mAttributeEncoderState; }
     void SetAttributeEncodeState(const AttributeEncodeState & aState) { mAttributeEncoderState = aState; }
     uint32_t GetLastWrittenEventsBytes() const { return mLastWrittenEventsBytes; }
+    reporting::ReportPacer & GetReportPacer() { return mReportPacer; }
 
     // Returns the number of interested paths, including wildcard and concrete paths.
     size_t GetAttributePathCount() const { return mpAttributePathList == nullptr ? 0 : mpAttributePathList->Count(); };
@@ -604,6 +612,9 @@ private:
     // The size of AttributeEncoderState is 2 bytes for now.
     AttributeEncodeState mAttributeEncoderState;
 
+    // Cost and latency of the reports sent by this handler, used by the reporting engine to order reportable handlers.
+    reporting::ReportPacer mReportPacer;
+
     uint16_t mMinIntervalFloorSeconds        = 0;
     uint16_t mMaxInterval                    = 0;
     uint16_t mSubscriberRequestedMaxInterval = 0;
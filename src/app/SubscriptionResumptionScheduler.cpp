@@ -0,0 +1,211 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/SubscriptionResumptionScheduler.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+
+SubscriptionResumptionScheduler::Resumption::~Resumption()
+{
+    if (mScheduler != nullptr)
+    {
+        mScheduler->OnResumptionDone(*this);
+    }
+}
+
+CHIP_ERROR SubscriptionResumptionScheduler::Init(System::Layer * systemLayer, Delegate * delegate, uint8_t maxConcurrentPeers)
+{
+    VerifyOrReturnError(systemLayer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(delegate != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(maxConcurrentPeers > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mSystemLayer        = systemLayer;
+    mDelegate           = delegate;
+    mMaxConcurrentPeers = maxConcurrentPeers;
+    return CHIP_NO_ERROR;
+}
+
+void SubscriptionResumptionScheduler::Shutdown()
+{
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(OnStartTimer, this);
+    }
+
+    while (!mQueued.Empty())
+    {
+        Resumption & resumption = *mQueued.begin();
+        mQueued.Remove(&resumption);
+        resumption.mScheduler = nullptr;
+        Platform::Delete(&resumption);
+    }
+
+    // The started resumptions are waiting on their CASE session: they are left to delete themselves.
+    while (!mStarted.Empty())
+    {
+        Resumption & resumption = *mStarted.begin();
+        mStarted.Remove(&resumption);
+        resumption.mScheduler = nullptr;
+    }
+
+    mSystemLayer = nullptr;
+    mDelegate    = nullptr;
+}
+
+void SubscriptionResumptionScheduler::Enqueue(Resumption * resumption)
+{
+    VerifyOrDie(resumption != nullptr && mSystemLayer != nullptr);
+
+    const ScopedNodeId peer = resumption->GetPeer();
+    auto position           = mQueued.begin();
+    while (position != mQueued.end() && !(peer < position->GetPeer()))
+    {
+        ++position;
+    }
+    mQueued.InsertBefore(position, resumption);
+    resumption->mScheduler = this;
+
+    ScheduleStart(System::Clock::kZero);
+}
+
+size_t SubscriptionResumptionScheduler::CancelFabric(FabricIndex fabricIndex)
+{
+    size_t count = 0;
+    for (auto it = mQueued.begin(); it != mQueued.end();)
+    {
+        Resumption & resumption = *it;
+        ++it;
+        if (resumption.GetPeer().GetFabricIndex() == fabricIndex)
+        {
+            mQueued.Remove(&resumption);
+            resumption.mScheduler = nullptr;
+            Platform::Delete(&resumption);
+            count++;
+        }
+    }
+    return count;
+}
+
+bool SubscriptionResumptionScheduler::IsScheduled(const ScopedNodeId & peer, SubscriptionId subscriptionId) const
+{
+    for (const auto * list : { &mQueued, &mStarted })
+    {
+        for (const auto & resumption : *list)
+        {
+            if (resumption.GetSubscriptionId() == subscriptionId && resumption.GetPeer() == peer)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+size_t SubscriptionResumptionScheduler::GetQueuedCount() const
+{
+    size_t count = 0;
+    for (auto it = mQueued.begin(); it != mQueued.end(); ++it)
+    {
+        count++;
+    }
+    return count;
+}
+
+size_t SubscriptionResumptionScheduler::GetActivePeerCount() const
+{
+    // Only a few peers are resumed at once: count the first started resumption of each of them.
+    size_t count = 0;
+    for (auto it = mStarted.begin(); it != mStarted.end(); ++it)
+    {
+        const ScopedNodeId peer = it->GetPeer();
+        auto previous           = mStarted.begin();
+        while (previous != it && previous->GetPeer() != peer)
+        {
+            ++previous;
+        }
+        if (previous == it)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+void SubscriptionResumptionScheduler::OnStartTimer(System::Layer * systemLayer, void * context)
+{
+    static_cast<SubscriptionResumptionScheduler *>(context)->StartNextPeers();
+}
+
+void SubscriptionResumptionScheduler::ScheduleStart(System::Clock::Timeout delay)
+{
+    CHIP_ERROR err = mSystemLayer->StartTimer(delay, OnStartTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(InteractionModel, "Failed to schedule subscription resumption: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void SubscriptionResumptionScheduler::StartNextPeers()
+{
+    while (!mQueued.Empty() && GetActivePeerCount() < mMaxConcurrentPeers)
+    {
+        if (!mDelegate->CanSendPrimingReports())
+        {
+            ScheduleStart(kPacingInterval);
+            return;
+        }
+
+        // Start all the resumptions of the first peer in line, so that they share the session established with it. A
+        // resumption may complete within Start(), so it is moved to the started ones first and not touched afterwards.
+        const ScopedNodeId peer = mQueued.begin()->GetPeer();
+        ChipLogProgress(InteractionModel, "Resuming subscriptions of " ChipLogFormatScopedNodeId, ChipLogValueScopedNodeId(peer));
+        while (!mQueued.Empty() && mQueued.begin()->GetPeer() == peer)
+        {
+            Resumption & resumption = *mQueued.begin();
+            mQueued.Remove(&resumption);
+            mStarted.PushBack(&resumption);
+            resumption.Start();
+        }
+    }
+}
+
+void SubscriptionResumptionScheduler::OnResumptionDone(Resumption & resumption)
+{
+    if (mStarted.Contains(&resumption))
+    {
+        mStarted.Remove(&resumption);
+    }
+    else if (mQueued.Contains(&resumption))
+    {
+        mQueued.Remove(&resumption);
+    }
+
+    // Not right away: the resumption may be completing within StartNextPeers().
+    if (!mQueued.Empty())
+    {
+        ScheduleStart(System::Clock::kZero);
+    }
+}
+
+} // namespace app
+} // namespace chip
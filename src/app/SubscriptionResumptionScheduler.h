@@ -0,0 +1,129 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/ScopedNodeId.h>
+#include <lib/support/IntrusiveList.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Paces the resumption of the persisted subscriptions.
+ *
+ * The resumptions are queued by peer, ordered by fabric index and then by node id, and started peer by peer: all the
+ * subscriptions of a peer are started together, so that they share the CASE session established with it. At most
+ * maxConcurrentPeers peers are resumed at the same time, and the next peer in line is only started once the delegate
+ * tells that the priming reports of the resumed subscriptions left enough buffers for its own.
+ *
+ * Must be used on the Matter thread.
+ */
+class SubscriptionResumptionScheduler
+{
+public:
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /**
+         * Whether there are enough report buffers left for the priming reports of the subscriptions of another peer.
+         */
+        virtual bool CanSendPrimingReports() = 0;
+    };
+
+    /**
+     * A subscription queued for resumption, owned by the scheduler until started. Once started, it deletes itself when
+     * done, whether the subscription was resumed or not, which lets the next peer in line start.
+     */
+    class Resumption : public IntrusiveListNodeBase<>
+    {
+    public:
+        virtual ~Resumption();
+
+        virtual ScopedNodeId GetPeer() const            = 0;
+        virtual SubscriptionId GetSubscriptionId() const = 0;
+
+        /**
+         * Start resuming the subscription. May complete, and delete the resumption, before returning.
+         */
+        virtual void Start() = 0;
+
+    private:
+        friend class SubscriptionResumptionScheduler;
+        SubscriptionResumptionScheduler * mScheduler = nullptr;
+    };
+
+    CHIP_ERROR Init(System::Layer * systemLayer, Delegate * delegate,
+                    uint8_t maxConcurrentPeers = CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_PEERS);
+
+    /**
+     * Delete the queued resumptions. The started ones complete on their own.
+     */
+    void Shutdown();
+
+    /**
+     * Queue a resumption, taking ownership of it. The queued resumptions start once the current event is handled, so
+     * that all the subscriptions of a peer queued together are started together.
+     */
+    void Enqueue(Resumption * resumption);
+
+    /**
+     * Delete the queued resumptions of a fabric.
+     *
+     * @return the number of resumptions deleted
+     */
+    size_t CancelFabric(FabricIndex fabricIndex);
+
+    /**
+     * Whether the resumption of a subscription is queued or started.
+     */
+    bool IsScheduled(const ScopedNodeId & peer, SubscriptionId subscriptionId) const;
+
+    size_t GetQueuedCount() const;
+    size_t GetActivePeerCount() const;
+
+private:
+    // How long to wait for the priming reports to free up buffers before checking again.
+    static constexpr System::Clock::Milliseconds32 kPacingInterval = System::Clock::Milliseconds32(100);
+
+    static void OnStartTimer(System::Layer * systemLayer, void * context);
+    void ScheduleStart(System::Clock::Timeout delay);
+    void StartNextPeers();
+    void OnResumptionDone(Resumption & resumption);
+
+    System::Layer * mSystemLayer = nullptr;
+    Delegate * mDelegate         = nullptr;
+    uint8_t mMaxConcurrentPeers  = 0;
+
+    // Sorted by fabric index and node id, so that the resumptions of a peer follow each other.
+    IntrusiveList<Resumption> mQueued;
+    IntrusiveList<Resumption> mStarted;
+};
+
+} // namespace app
+} // namespace chip
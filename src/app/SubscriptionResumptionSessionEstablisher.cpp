@@ -44,6 +44,16 @@ CHIP_ERROR
 SubscriptionResumptionSessionEstablisher::ResumeSubscription(
     CASESessionManager & caseSessionManager, const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo)
 {
+    ReturnErrorOnFailure(Init(caseSessionManager, subscriptionInfo));
+    Start();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR
+SubscriptionResumptionSessionEstablisher::Init(CASESessionManager & caseSessionManager,
+                                               const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo)
+{
+    mCASESessionManager               = &caseSessionManager;
     mSubscriptionInfo.mNodeId         = subscriptionInfo.mNodeId;
     mSubscriptionInfo.mFabricIndex    = subscriptionInfo.mFabricIndex;
     mSubscriptionInfo.mSubscriptionId = subscriptionInfo.mSubscriptionId;
@@ -79,11 +89,15 @@ SubscriptionResumptionSessionEstablisher::ResumeSubscription(
         }
     }
 
-    ScopedNodeId peerNode = ScopedNodeId(mSubscriptionInfo.mNodeId, mSubscriptionInfo.mFabricIndex);
-    caseSessionManager.FindOrEstablishSession(peerNode, &mOnConnectedCallback, &mOnConnectionFailureCallback);
     return CHIP_NO_ERROR;
 }
 
+void SubscriptionResumptionSessionEstablisher::Start()
+{
+    // The establishers of the subscriptions of a same peer started together share the session being established with it.
+    mCASESessionManager->FindOrEstablishSession(GetPeer(), &mOnConnectedCallback, &mOnConnectionFailureCallback);
+}
+
 void SubscriptionResumptionSessionEstablisher::HandleDeviceConnected(void * context, Messaging::ExchangeManager & exchangeMgr,
                                                                      const SessionHandle & sessionHandle)
 {
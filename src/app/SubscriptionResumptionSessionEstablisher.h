@@ -19,6 +19,7 @@
 
 #include <app/AttributePathParams.h>
 #include <app/CASESessionManager.h>
+#include <app/SubscriptionResumptionScheduler.h>
 #include <app/SubscriptionResumptionStorage.h>
 
 namespace chip {
@@ -29,9 +30,12 @@ namespace app {
  *  ResumeSubscription(), followed by the creation and intialization of a ReadHandler. This class helps prevent
  *  a scenario where all ReadHandlers in the pool grab the invalid session handle. In such scenario, if the device
  *  receives a new subscription request, it will crash as there is no evictable ReadHandler.
+ *
+ *  The establisher can also be queued on a SubscriptionResumptionScheduler after Init(), which calls Start() once its
+ *  turn comes.
  */
 
-class SubscriptionResumptionSessionEstablisher
+class SubscriptionResumptionSessionEstablisher : public SubscriptionResumptionScheduler::Resumption
 {
 public:
     SubscriptionResumptionSessionEstablisher();
@@ -39,6 +43,17 @@ public:
     CHIP_ERROR ResumeSubscription(CASESessionManager & caseSessionManager,
                                   const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo);
 
+    /**
+     * Copy the subscription to resume, without establishing the CASE session yet.
+     */
+    CHIP_ERROR Init(CASESessionManager & caseSessionManager,
+                    const SubscriptionResumptionStorage::SubscriptionInfo & subscriptionInfo);
+
+    // SubscriptionResumptionScheduler::Resumption
+    ScopedNodeId GetPeer() const override { return ScopedNodeId(mSubscriptionInfo.mNodeId, mSubscriptionInfo.mFabricIndex); }
+    SubscriptionId GetSubscriptionId() const override { return mSubscriptionInfo.mSubscriptionId; }
+    void Start() override;
+
     SubscriptionResumptionStorage::SubscriptionInfo mSubscriptionInfo;
 
 private:
@@ -47,6 +62,8 @@ private:
                                       const SessionHandle & sessionHandle);
     static void HandleDeviceConnectionFailure(void * context, const ScopedNodeId & peerId, CHIP_ERROR error);
 
+    CASESessionManager * mCASESessionManager = nullptr;
+
     // Callbacks to handle server-initiated session success/failure
     chip::Callback::Callback<OnDeviceConnected> mOnConnectedCallback;
     chip::Callback::Callback<OnDeviceConnectionFailure> mOnConnectionFailureCallback;
@@ -0,0 +1,289 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/cluster-building-blocks/TransitionScheduler.h>
+
+#include <algorithm>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+namespace chip {
+namespace app {
+
+using namespace System::Clock;
+using namespace System::Clock::Literals;
+
+namespace {
+
+TransitionScheduler sInstance;
+
+} // namespace
+
+TransitionScheduler & TransitionScheduler::Instance()
+{
+    return sInstance;
+}
+
+CHIP_ERROR TransitionScheduler::Init(System::Layer * systemLayer)
+{
+    VerifyOrReturnError(systemLayer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The shared timer is gone when the System::Layer was re-initialized since the ticks were scheduled. The previous
+    // System::Layer may be gone as well: it is left alone. Ticks scheduled before Init() keep their own timers.
+    const bool layerChanged = (mSystemLayer != nullptr && mSystemLayer != systemLayer);
+    if (layerChanged || (mCount > 0 && !mRunning && !systemLayer->IsTimerActive(OnTimerExpired, this)))
+    {
+        Reset();
+    }
+
+    mSystemLayer = systemLayer;
+    return CHIP_NO_ERROR;
+}
+
+void TransitionScheduler::Shutdown()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+
+    mSystemLayer->CancelTimer(OnTimerExpired, this);
+    mSystemLayer = nullptr;
+    Reset();
+}
+
+void TransitionScheduler::Reset()
+{
+    mCount      = 0;
+    mArmed      = false;
+    mOverflowed = false;
+}
+
+CHIP_ERROR TransitionScheduler::StartTimer(Timeout delay, System::TimerCompleteCallback callback, void * context)
+{
+    VerifyOrReturnError(callback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (mSystemLayer == nullptr)
+    {
+        mOverflowed = true;
+        return DeviceLayer::SystemLayer().StartTimer(delay, callback, context);
+    }
+
+    if (mOverflowed)
+    {
+        mSystemLayer->CancelTimer(callback, context);
+    }
+
+    size_t index = Find(callback, context);
+    if (index == kNotFound)
+    {
+        if (mCount == kMaxTicks)
+        {
+            mOverflowed = true;
+            return mSystemLayer->StartTimer(delay, callback, context);
+        }
+        index             = mCount++;
+        mCallbacks[index] = callback;
+        mContexts[index]  = context;
+    }
+
+    // The ticks scheduled by the running ones are armed for once these are done, on the grid unless they are due within
+    // this expiry already.
+    if (mRunning)
+    {
+        const Timestamp deadline = mRunTime + delay;
+        mDeadlines[index]        = (deadline <= mRunStart) ? deadline : Align(deadline);
+        return CHIP_NO_ERROR;
+    }
+
+    // The first tick of a transition runs after its exact delay, and moves it onto the grid.
+    const Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    mDeadlines[index]   = now + delay;
+    if (!mArmed || mDeadlines[index] < mArmedDeadline)
+    {
+        ArmTimer(now);
+    }
+    return CHIP_NO_ERROR;
+}
+
+void TransitionScheduler::CancelTimer(System::TimerCompleteCallback callback, void * context)
+{
+    if (mSystemLayer == nullptr)
+    {
+        DeviceLayer::SystemLayer().CancelTimer(callback, context);
+        return;
+    }
+
+    if (mOverflowed)
+    {
+        mSystemLayer->CancelTimer(callback, context);
+    }
+
+    size_t index = Find(callback, context);
+    VerifyOrReturn(index != kNotFound);
+
+    if (mRunning)
+    {
+        mCallbacks[index] = nullptr;
+        return;
+    }
+
+    Remove(index);
+    if (mCount == 0)
+    {
+        // Expiries with no tick due are harmless, but there is no need for one anymore.
+        mSystemLayer->CancelTimer(OnTimerExpired, this);
+        mArmed      = false;
+        mOverflowed = false;
+    }
+}
+
+Milliseconds64 TransitionScheduler::GetTickGranularity() const
+{
+    // The steps divide the 100 ms color control steps. A lone transition runs on its own schedule.
+    if (mCount <= 1)
+    {
+        return 0_ms64;
+    }
+    if (mCount <= 8)
+    {
+        return 10_ms64;
+    }
+    if (mCount <= 32)
+    {
+        return 25_ms64;
+    }
+    return 50_ms64;
+}
+
+void TransitionScheduler::OnTimerExpired(System::Layer * systemLayer, void * context)
+{
+    static_cast<TransitionScheduler *>(context)->RunDueTicks();
+}
+
+void TransitionScheduler::RunDueTicks()
+{
+    mArmed = false;
+
+    const Timestamp now   = System::SystemClock().GetMonotonicTimestamp();
+    const auto step       = GetTickGranularity();
+    System::Layer * layer = mSystemLayer;
+    mRunStart             = now;
+    mRunTime              = (step.count() != 0) ? Timestamp(now.count() - now.count() % step.count()) : now;
+    mRunning              = true;
+
+    // Ticks added while running are appended, and run in this loop if due.
+    for (size_t i = 0; i < mCount && mSystemLayer != nullptr; i++)
+    {
+        for (unsigned runs = 0; runs < kMaxTicksPerExpiry && mCallbacks[i] != nullptr && mDeadlines[i] <= now; runs++)
+        {
+            System::TimerCompleteCallback callback = mCallbacks[i];
+            mDeadlines[i]                          = Timestamp::max();
+            mRunningIndex                          = i;
+            callback(layer, mContexts[i]);
+            if (mDeadlines[i] == Timestamp::max())
+            {
+                // Not scheduled again: the transition is over.
+                mCallbacks[i] = nullptr;
+            }
+        }
+    }
+
+    mRunningIndex = kNotFound;
+    mRunning      = false;
+
+    // Shut down by one of the ticks.
+    VerifyOrReturn(mSystemLayer != nullptr);
+
+    Compact();
+    if (mCount > 0)
+    {
+        ArmTimer(System::SystemClock().GetMonotonicTimestamp());
+    }
+}
+
+size_t TransitionScheduler::Find(System::TimerCompleteCallback callback, void * context) const
+{
+    // A running tick rescheduling itself is the common case.
+    if (mRunningIndex != kNotFound && mContexts[mRunningIndex] == context && mCallbacks[mRunningIndex] == callback)
+    {
+        return mRunningIndex;
+    }
+
+    for (size_t i = 0; i < mCount; i++)
+    {
+        if (mContexts[i] == context && mCallbacks[i] == callback)
+        {
+            return i;
+        }
+    }
+    return kNotFound;
+}
+
+void TransitionScheduler::Remove(size_t index)
+{
+    mCount--;
+    mDeadlines[index] = mDeadlines[mCount];
+    mCallbacks[index] = mCallbacks[mCount];
+    mContexts[index]  = mContexts[mCount];
+}
+
+void TransitionScheduler::Compact()
+{
+    size_t count = 0;
+    for (size_t i = 0; i < mCount; i++)
+    {
+        if (mCallbacks[i] == nullptr)
+        {
+            continue;
+        }
+        mDeadlines[count] = mDeadlines[i];
+        mCallbacks[count] = mCallbacks[i];
+        mContexts[count]  = mContexts[i];
+        count++;
+    }
+    mCount = count;
+}
+
+Timestamp TransitionScheduler::Align(Timestamp deadline) const
+{
+    const auto step = GetTickGranularity().count();
+    VerifyOrReturnValue(step != 0, deadline);
+    return Timestamp((deadline.count() + step - 1) / step * step);
+}
+
+void TransitionScheduler::ArmTimer(Timestamp now)
+{
+    Timestamp earliest = Timestamp::max();
+    for (size_t i = 0; i < mCount; i++)
+    {
+        earliest = std::min(earliest, mDeadlines[i]);
+    }
+
+    CHIP_ERROR err = mSystemLayer->StartTimer(earliest > now ? earliest - now : 0_ms64, OnTimerExpired, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Zcl, "Transition scheduler failed to schedule event: %" CHIP_ERROR_FORMAT, err.Format());
+        mArmed = false;
+        return;
+    }
+    mArmed         = true;
+    mArmedDeadline = earliest;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,125 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Runs the ticks of the cluster transitions (level control, color control...) off a single System::Layer timer.
+ *
+ * StartTimer() and CancelTimer() stand in for the System::Layer ones: a transition schedules its next tick, identified by
+ * its callback and context, and is called back with the System::Layer once it is due. The ticks are kept in a table and
+ * the shared timer is armed for the earliest one; when it expires, all the due ticks run in one loop, so their attribute
+ * changes are all marked dirty before the reporting engine runs.
+ *
+ * The more transitions are running, the coarser the grid the ticks are aligned on, so that one expiry advances more of
+ * them. The first tick of a transition runs after its exact delay. Ticks scheduled while the due ones run are based on
+ * the grid point and aligned on the grid, so that a transition ticking at a multiple of the grid step (like the 100 ms
+ * color control steps) stays in phase with the others. A tick asking to run again right away, like a level control
+ * transition catching up, runs again within the same expiry.
+ *
+ * Must be used on the Matter thread.
+ */
+class TransitionScheduler
+{
+public:
+    static TransitionScheduler & Instance();
+
+    /**
+     * Initialize the scheduler. Every cluster using the scheduler initializes it each time the data model is initialized;
+     * initializing it again with the same System::Layer keeps the scheduled ticks. The ticks scheduled on another
+     * System::Layer, or on this one before it was re-initialized, could never run anymore and are dropped.
+     */
+    CHIP_ERROR Init(System::Layer * systemLayer);
+
+    /**
+     * Drop the scheduled ticks and stop the shared timer. The clusters do not need to call it: they cancel the ticks of
+     * their endpoints when these shut down, and the shared timer stops with the last tick.
+     */
+    void Shutdown();
+
+    /**
+     * Run callback with context after delay, replacing the tick already scheduled for them, if any. Before Init(), the
+     * tick gets a timer of its own on the System::Layer of the device.
+     */
+    CHIP_ERROR StartTimer(System::Clock::Timeout delay, System::TimerCompleteCallback callback, void * context);
+
+    void CancelTimer(System::TimerCompleteCallback callback, void * context);
+
+    /**
+     * Number of ticks scheduled on the shared timer.
+     */
+    size_t GetScheduledCount() const { return mCount; }
+
+    /**
+     * Step of the grid the ticks are aligned on, which grows with the number of scheduled ticks. Zero when they are not
+     * aligned.
+     */
+    System::Clock::Milliseconds64 GetTickGranularity() const;
+
+private:
+    static constexpr size_t kMaxTicks = CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS;
+    // How many times a tick may run within one expiry, when it keeps asking to run again right away.
+    static constexpr unsigned kMaxTicksPerExpiry = 64;
+    static constexpr size_t kNotFound            = SIZE_MAX;
+
+    static void OnTimerExpired(System::Layer * systemLayer, void * context);
+    void RunDueTicks();
+    size_t Find(System::TimerCompleteCallback callback, void * context) const;
+    void Remove(size_t index);
+    void Compact();
+    System::Clock::Timestamp Align(System::Clock::Timestamp deadline) const;
+    void ArmTimer(System::Clock::Timestamp now);
+    void Reset();
+
+    System::Layer * mSystemLayer = nullptr;
+
+    // The ticks, as a struct of arrays: finding a tick walks the contexts only, and finding the due ones the deadlines only.
+    // While the due ticks run, a cancelled tick keeps its slot with a null callback until they are done.
+    System::Clock::Timestamp mDeadlines[kMaxTicks];
+    System::TimerCompleteCallback mCallbacks[kMaxTicks];
+    void * mContexts[kMaxTicks];
+    size_t mCount = 0;
+
+    // Grid point the ticks scheduled while the due ones run are based on, time they started running, and the slot of the
+    // running tick.
+    System::Clock::Timestamp mRunTime;
+    System::Clock::Timestamp mRunStart;
+    size_t mRunningIndex = kNotFound;
+    bool mRunning        = false;
+
+    System::Clock::Timestamp mArmedDeadline;
+    bool mArmed = false;
+
+    // Whether ticks which did not fit in the table, or were scheduled before Init(), were given timers of their own, which
+    // must then be cancelled as well.
+    bool mOverflowed = false;
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,465 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/cluster-building-blocks/TransitionScheduler.h>
+
+#include <chrono>
+#include <vector>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemClock.h>
+#include <system/SystemTimer.h>
+
+#include <pw_unit_test/framework.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+// A System::Layer running its timers off a mock clock, and counting the expiries.
+class TimerAndMockClock : public Internal::MockClock, public System::Layer
+{
+public:
+    CriticalFailure Init() override { return CHIP_NO_ERROR; }
+    void Shutdown() override
+    {
+        mTimerList.Clear();
+        mTimerNodes.ReleaseAll();
+    }
+    bool IsInitialized() const override { return true; }
+
+    CriticalFailure StartTimer(Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        CancelTimer(aComplete, aAppState);
+        Timestamp awakenTime = GetMonotonicMilliseconds64() + std::chrono::duration_cast<Milliseconds64>(aDelay);
+        System::TimerList::Node * node = mTimerNodes.Create(*this, awakenTime, aComplete, aAppState);
+        VerifyOrReturnError(node != nullptr, CHIP_ERROR_NO_MEMORY);
+        mTimerList.Add(node);
+        return CHIP_NO_ERROR;
+    }
+    void CancelTimer(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        System::TimerList::Node * cancelled = mTimerList.Remove(aComplete, aAppState);
+        if (cancelled != nullptr)
+        {
+            mTimerNodes.Release(cancelled);
+        }
+    }
+    CHIP_ERROR ExtendTimerTo(Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    bool IsTimerActive(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState) != Timeout(0);
+    }
+    Timeout GetRemainingTime(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState);
+    }
+    CriticalFailure ScheduleWork(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    // Run the clock millisecond by millisecond, firing the timers as they expire.
+    void Advance(Milliseconds64 duration)
+    {
+        const Timestamp end = GetMonotonicMilliseconds64() + duration;
+        while (GetMonotonicMilliseconds64() < end)
+        {
+            SetMonotonic(GetMonotonicMilliseconds64() + 1_ms64);
+            System::TimerList::Node * node;
+            while ((node = mTimerList.Earliest()) != nullptr && node->AwakenTime() <= GetMonotonicMilliseconds64())
+            {
+                mTimerList.PopEarliest();
+                mExpiries++;
+                mTimerNodes.Invoke(node);
+            }
+        }
+    }
+
+    bool HasTimers() { return mTimerList.Earliest() != nullptr; }
+
+    size_t mExpiries = 0;
+
+private:
+    System::TimerPool<> mTimerNodes;
+    System::TimerList mTimerList;
+};
+
+// A transition stepping every 100 ms, like the color control ones.
+struct Transition
+{
+    static void OnTick(System::Layer * layer, void * context)
+    {
+        auto * transition = static_cast<Transition *>(context);
+        transition->ticks.push_back(transition->clock->GetMonotonicMilliseconds64());
+        if (--transition->remainingSteps > 0)
+        {
+            transition->Schedule(100_ms32);
+        }
+    }
+
+    void Schedule(Timeout delay)
+    {
+        if (scheduler != nullptr)
+        {
+            EXPECT_EQ(scheduler->StartTimer(delay, OnTick, this), CHIP_NO_ERROR);
+        }
+        else
+        {
+            EXPECT_EQ(clock->StartTimer(delay, OnTick, this), CHIP_NO_ERROR);
+        }
+    }
+
+    TimerAndMockClock * clock       = nullptr;
+    TransitionScheduler * scheduler = nullptr;
+    unsigned remainingSteps         = 0;
+    std::vector<Timestamp> ticks;
+};
+
+class TestTransitionScheduler : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        mSavedClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mLayer);
+        mLayer.SetMonotonic(1000_ms64);
+        ASSERT_EQ(mScheduler.Init(&mLayer), CHIP_NO_ERROR);
+    }
+
+    void TearDown() override
+    {
+        mScheduler.Shutdown();
+        mLayer.Shutdown();
+        System::Clock::Internal::SetSystemClockForTesting(mSavedClock);
+    }
+
+    void StartTransition(Transition & transition, unsigned steps, bool useScheduler = true)
+    {
+        transition.clock          = &mLayer;
+        transition.scheduler      = useScheduler ? &mScheduler : nullptr;
+        transition.remainingSteps = steps;
+        transition.Schedule(100_ms32);
+    }
+
+protected:
+    TimerAndMockClock mLayer;
+    TransitionScheduler mScheduler;
+    System::Clock::ClockBase * mSavedClock = nullptr;
+};
+
+TEST_F(TestTransitionScheduler, TestLoneTransitionKeepsItsSchedule)
+{
+    Transition transition;
+    StartTransition(transition, 5);
+    EXPECT_EQ(mScheduler.GetTickGranularity(), 0_ms64);
+
+    mLayer.Advance(1000_ms64);
+    ASSERT_EQ(transition.ticks.size(), 5u);
+    for (size_t i = 0; i < transition.ticks.size(); i++)
+    {
+        EXPECT_EQ(transition.ticks[i], Timestamp(1100 + 100 * i));
+    }
+    EXPECT_EQ(mScheduler.GetScheduledCount(), 0u);
+    EXPECT_FALSE(mLayer.HasTimers());
+}
+
+TEST_F(TestTransitionScheduler, TestTransitionsShareExpiries)
+{
+    // Transitions started at different times end up ticking together, on the grid.
+    Transition transitions[40];
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(transitions); i++)
+    {
+        StartTransition(transitions[i], 10);
+        mLayer.Advance(Milliseconds64(i % 7));
+    }
+    EXPECT_EQ(mScheduler.GetTickGranularity(), 50_ms64);
+
+    mLayer.Advance(2000_ms64);
+    for (auto & transition : transitions)
+    {
+        ASSERT_EQ(transition.ticks.size(), 10u);
+        EXPECT_EQ(transition.ticks[1].count() % 50, 0u);
+        for (size_t i = 2; i < transition.ticks.size(); i++)
+        {
+            EXPECT_EQ(transition.ticks[i] - transition.ticks[i - 1], 100_ms64);
+        }
+    }
+
+    // 400 ticks, in at most one expiry per first tick plus about one per 50 ms grid point.
+    EXPECT_LE(mLayer.mExpiries, MATTER_ARRAY_SIZE(transitions) + 30u);
+    EXPECT_FALSE(mLayer.HasTimers());
+}
+
+TEST_F(TestTransitionScheduler, TestFirstTickIsNotAligned)
+{
+    Transition transitions[10];
+    for (auto & transition : transitions)
+    {
+        StartTransition(transition, 3);
+    }
+    ASSERT_EQ(mScheduler.GetTickGranularity(), 25_ms64);
+
+    // A transition starting off the grid runs its first tick after its exact delay, and the next ones on the grid.
+    mLayer.Advance(7_ms64);
+    Transition late;
+    StartTransition(late, 3);
+
+    mLayer.Advance(1000_ms64);
+    ASSERT_EQ(late.ticks.size(), 3u);
+    EXPECT_EQ(late.ticks[0], 1107_ms64);
+    EXPECT_EQ(late.ticks[1], 1200_ms64);
+    EXPECT_EQ(late.ticks[2], 1300_ms64);
+}
+
+TEST_F(TestTransitionScheduler, TestInitAgainKeepsTicks)
+{
+    Transition transition;
+    StartTransition(transition, 3);
+
+    // The level control and color control clusters both initialize the scheduler.
+    ASSERT_EQ(mScheduler.Init(&mLayer), CHIP_NO_ERROR);
+    EXPECT_EQ(mScheduler.GetScheduledCount(), 1u);
+
+    mLayer.Advance(1000_ms64);
+    EXPECT_EQ(transition.ticks.size(), 3u);
+    EXPECT_FALSE(mLayer.HasTimers());
+}
+
+TEST_F(TestTransitionScheduler, TestInitAfterLayerReinitDropsStaleTicks)
+{
+    Transition stale;
+    StartTransition(stale, 3);
+    mLayer.Advance(150_ms64);
+    EXPECT_EQ(stale.ticks.size(), 1u);
+
+    // The stack restarts: the System::Layer drops its timers, and the clusters initialize the scheduler again.
+    mLayer.Shutdown();
+    ASSERT_EQ(mLayer.Init(), CHIP_NO_ERROR);
+    ASSERT_EQ(mScheduler.Init(&mLayer), CHIP_NO_ERROR);
+    EXPECT_EQ(mScheduler.GetScheduledCount(), 0u);
+
+    // The transitions started from then on run.
+    Transition transition;
+    StartTransition(transition, 3);
+    mLayer.Advance(1000_ms64);
+    EXPECT_EQ(stale.ticks.size(), 1u);
+    EXPECT_EQ(transition.ticks.size(), 3u);
+    EXPECT_FALSE(mLayer.HasTimers());
+}
+
+TEST_F(TestTransitionScheduler, TestInitWithOtherLayerDropsTicks)
+{
+    Transition transition;
+    StartTransition(transition, 3);
+
+    TimerAndMockClock otherLayer;
+    ASSERT_EQ(mScheduler.Init(&otherLayer), CHIP_NO_ERROR);
+    EXPECT_EQ(mScheduler.GetScheduledCount(), 0u);
+
+    // The ticks are not run by the expiry of the previous System::Layer either.
+    mLayer.Advance(1000_ms64);
+    EXPECT_EQ(transition.ticks.size(), 0u);
+
+    ASSERT_EQ(mScheduler.Init(&mLayer), CHIP_NO_ERROR);
+}
+
+TEST_F(TestTransitionScheduler, TestUninitializedUsesDeviceLayerTimers)
+{
+    mScheduler.Shutdown();
+    EXPECT_FALSE(mLayer.HasTimers());
+    DeviceLayer::SetSystemLayerForTesting(&mLayer);
+
+    // Transitions started before the scheduler is initialized get timers of their own.
+    Transition cancelled;
+    StartTransition(cancelled, 3);
+    Transition transition;
+    StartTransition(transition, 3);
+    EXPECT_EQ(mScheduler.GetScheduledCount(), 0u);
+    EXPECT_TRUE(mLayer.HasTimers());
+
+    mScheduler.CancelTimer(Transition::OnTick, &cancelled);
+    mLayer.Advance(1000_ms64);
+    EXPECT_EQ(cancelled.ticks.size(), 0u);
+    EXPECT_EQ(transition.ticks.size(), 3u);
+    EXPECT_FALSE(mLayer.HasTimers());
+
+    DeviceLayer::SetSystemLayerForTesting(nullptr);
+}
+
+TEST_F(TestTransitionScheduler, TestCancel)
+{
+    Transition first;
+    Transition second;
+    StartTransition(first, 5);
+    StartTransition(second, 5);
+
+    mLayer.Advance(250_ms64);
+    mScheduler.CancelTimer(Transition::OnTick, &first);
+    mLayer.Advance(1000_ms64);
+
+    EXPECT_EQ(first.ticks.size(), 2u);
+    EXPECT_EQ(second.ticks.size(), 5u);
+
+    // Cancelling the last tick stops the shared timer.
+    StartTransition(first, 5);
+    mScheduler.CancelTimer(Transition::OnTick, &first);
+    EXPECT_EQ(mScheduler.GetScheduledCount(), 0u);
+    EXPECT_FALSE(mLayer.HasTimers());
+}
+
+struct Canceller
+{
+    static void OnTick(System::Layer * layer, void * context)
+    {
+        auto * canceller = static_cast<Canceller *>(context);
+        canceller->scheduler->CancelTimer(Transition::OnTick, canceller->victim);
+        canceller->ticks++;
+    }
+
+    TransitionScheduler * scheduler = nullptr;
+    Transition * victim             = nullptr;
+    unsigned ticks                  = 0;
+};
+
+TEST_F(TestTransitionScheduler, TestCancelFromTick)
+{
+    Transition victim;
+    Canceller canceller{ &mScheduler, &victim };
+    EXPECT_EQ(mScheduler.StartTimer(100_ms32, Canceller::OnTick, &canceller), CHIP_NO_ERROR);
+    StartTransition(victim, 5);
+
+    mLayer.Advance(1000_ms64);
+    EXPECT_EQ(canceller.ticks, 1u);
+    EXPECT_TRUE(victim.ticks.empty());
+    EXPECT_EQ(mScheduler.GetScheduledCount(), 0u);
+}
+
+// A tick running late, which asks to run again right away until it caught up, like the level control ones.
+struct CatchingUp
+{
+    static void OnTick(System::Layer * layer, void * context)
+    {
+        auto * catchingUp = static_cast<CatchingUp *>(context);
+        catchingUp->ticks++;
+        if (catchingUp->ticks < catchingUp->steps)
+        {
+            EXPECT_EQ(catchingUp->scheduler->StartTimer(0_ms32, OnTick, context), CHIP_NO_ERROR);
+        }
+    }
+
+    TransitionScheduler * scheduler = nullptr;
+    unsigned steps                  = 0;
+    unsigned ticks                  = 0;
+};
+
+TEST_F(TestTransitionScheduler, TestCatchUpWithinExpiry)
+{
+    CatchingUp catchingUp{ &mScheduler, 10 };
+    Transition other;
+    StartTransition(other, 1);
+    EXPECT_EQ(mScheduler.StartTimer(100_ms32, CatchingUp::OnTick, &catchingUp), CHIP_NO_ERROR);
+
+    mLayer.Advance(200_ms64);
+    EXPECT_EQ(catchingUp.ticks, 10u);
+    EXPECT_EQ(mLayer.mExpiries, 1u);
+}
+
+TEST_F(TestTransitionScheduler, TestOverflowUsesOwnTimers)
+{
+    std::vector<Transition> transitions(CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS + 2);
+    for (auto & transition : transitions)
+    {
+        StartTransition(transition, 3);
+    }
+    EXPECT_EQ(mScheduler.GetScheduledCount(), static_cast<size_t>(CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS));
+
+    // Cancelling one of the overflowing transitions reaches its own timer.
+    mScheduler.CancelTimer(Transition::OnTick, &transitions.back());
+
+    mLayer.Advance(1000_ms64);
+    for (size_t i = 0; i + 1 < transitions.size(); i++)
+    {
+        EXPECT_EQ(transitions[i].ticks.size(), 3u);
+    }
+    EXPECT_TRUE(transitions.back().ticks.empty());
+    EXPECT_FALSE(mLayer.HasTimers());
+}
+
+TEST_F(TestTransitionScheduler, TestTransitionBenchmark)
+{
+    // Fade N transitions over 5 s, started within 100 ms of each other, with one timer each and with the scheduler.
+    constexpr unsigned kSteps = 50;
+    for (size_t count : { 1u, 100u, 500u })
+    {
+        if (count > CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS)
+        {
+            continue;
+        }
+
+        for (bool useScheduler : { false, true })
+        {
+            // Without heap pools, the mock layer only has CHIP_SYSTEM_CONFIG_NUM_TIMERS timers for one per transition.
+            if (!useScheduler && !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && count > CHIP_SYSTEM_CONFIG_NUM_TIMERS)
+            {
+                continue;
+            }
+
+            std::vector<Transition> transitions(count);
+            mLayer.mExpiries = 0;
+
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < count; i++)
+            {
+                StartTransition(transitions[i], kSteps, useScheduler);
+                if (i % (count / 10 + 1) == 0)
+                {
+                    mLayer.Advance(10_ms64);
+                }
+            }
+            mLayer.Advance(Milliseconds64(kSteps * 100 + 200));
+            auto elapsedUs = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+            for (auto & transition : transitions)
+            {
+                EXPECT_EQ(transition.ticks.size(), kSteps);
+            }
+            EXPECT_FALSE(mLayer.HasTimers());
+
+            ChipLogProgress(Test, "%u transitions, %s: %u timer expiries for %u ticks in %u us", static_cast<unsigned>(count),
+                            useScheduler ? "shared timer" : "timer per transition", static_cast<unsigned>(mLayer.mExpiries),
+                            static_cast<unsigned>(count * kSteps), static_cast<unsigned>(elapsedUs));
+        }
+    }
+}
+
+} // namespace
@@ -21,6 +21,7 @@
 #include <app-common/zap-generated/attributes/Accessors.h>
 #include <app/CommandHandler.h>
 #include <app/ConcreteCommandPath.h>
+#include <app/cluster-building-blocks/TransitionScheduler.h>
 #include <app/util/attribute-storage.h>
 #include <app/util/config.h>
 #include <lib/core/Optional.h>
@@ -384,7 +385,8 @@ void ColorControlServer::timerCallback(System::Layer *, void * callbackContext)
 
 void ColorControlServer::scheduleTimerCallbackMs(EmberEventControl * control, uint32_t delayMs)
 {
-    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(chip::System::Clock::Milliseconds32(delayMs), timerCallback, control);
+    CHIP_ERROR err =
+        TransitionScheduler::Instance().StartTimer(chip::System::Clock::Milliseconds32(delayMs), timerCallback, control);
 
     if (err != CHIP_NO_ERROR)
     {
@@ -394,7 +396,7 @@ void ColorControlServer::scheduleTimerCallbackMs(EmberEventControl * control, ui
 
 void ColorControlServer::cancelEndpointTimerCallback(EmberEventControl * control)
 {
-    DeviceLayer::SystemLayer().CancelTimer(timerCallback, control);
+    TransitionScheduler::Instance().CancelTimer(timerCallback, control);
 }
 
 void ColorControlServer::cancelEndpointTimerCallback(EndpointId endpoint)
@@ -3327,5 +3329,9 @@ void emberAfPluginColorControlServerHueSatTransitionEventHandler(EndpointId endp
 }
 #endif // MATTER_DM_PLUGIN_COLOR_CONTROL_SERVER_HSV
 
-void MatterColorControlPluginServerInitCallback() {}
+void MatterColorControlPluginServerInitCallback()
+{
+    LogErrorOnFailure(TransitionScheduler::Instance().Init(&DeviceLayer::SystemLayer()));
+}
+
 void MatterColorControlPluginServerShutdownCallback() {}
@@ -26,6 +26,7 @@
 #include <app/CommandHandler.h>
 #include <app/ConcreteCommandPath.h>
 #include <app/cluster-building-blocks/QuieterReporting.h>
+#include <app/cluster-building-blocks/TransitionScheduler.h>
 #include <app/util/attribute-storage.h>
 #include <app/util/config.h>
 #include <app/util/util.h>
@@ -310,8 +311,8 @@ static uint32_t computeCallbackWaitTimeMs(CallbackScheduleState & callbackSchedu
 
 static void scheduleTimerCallbackMs(EndpointId endpoint, uint32_t delayMs)
 {
-    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(chip::System::Clock::Milliseconds32(delayMs), timerCallback,
-                                                           reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
+    CHIP_ERROR err = TransitionScheduler::Instance().StartTimer(chip::System::Clock::Milliseconds32(delayMs), timerCallback,
+                                                                reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
 
     if (err != CHIP_NO_ERROR)
     {
@@ -321,7 +322,7 @@ static void scheduleTimerCallbackMs(EndpointId endpoint, uint32_t delayMs)
 
 static void cancelEndpointTimerCallback(EndpointId endpoint)
 {
-    DeviceLayer::SystemLayer().CancelTimer(timerCallback, reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
+    TransitionScheduler::Instance().CancelTimer(timerCallback, reinterpret_cast<void *>(static_cast<uintptr_t>(endpoint)));
 }
 
 static EmberAfLevelControlState * getState(EndpointId endpoint)
@@ -1578,5 +1579,9 @@ bool LevelControlHasFeature(EndpointId endpoint, Feature feature)
     return success ? ((featureMap & to_underlying(feature)) != 0) : false;
 }
 
-void MatterLevelControlPluginServerInitCallback() {}
+void MatterLevelControlPluginServerInitCallback()
+{
+    LogErrorOnFailure(TransitionScheduler::Instance().Init(&DeviceLayer::SystemLayer()));
+}
+
 void MatterLevelControlPluginServerShutdownCallback() {}
@@ -102,12 +102,14 @@ template class chip::app::Storage::FabricTableImpl<SceneTableBase::SceneStorageI
 CHIP_ERROR DefaultSceneTableImpl::Init(PersistentStorageDelegate & storage, app::DataModel::Provider & dataModel)
 {
     mDataModel = &dataModel;
+    mCache.Clear();
     return FabricTableImpl::Init(storage);
 }
 
 void DefaultSceneTableImpl::Finish()
 {
     UnregisterAllHandlers();
+    mCache.Clear();
     FabricTableImpl::Finish();
     mDataModel = nullptr;
 }
@@ -136,26 +138,47 @@ CHIP_ERROR DefaultSceneTableImpl::SetSceneTableEntry(FabricIndex fabric_index, c
 {
     // Scene data is small, buffer can be allocated on stack
     PersistenceBuffer<Serializer::kEntryMaxBytes()> writeBuffer;
-    return this->SetTableEntry(fabric_index, entry.mStorageId, entry.mStorageData, writeBuffer);
+    CHIP_ERROR err = this->SetTableEntry(fabric_index, entry.mStorageId, entry.mStorageData, writeBuffer);
+    if (err == CHIP_NO_ERROR)
+    {
+        mCache.Put(fabric_index, mEndpointId, entry.mStorageId, entry.mStorageData, mMaxPerFabric);
+    }
+    else
+    {
+        // The scene may or may not have been persisted
+        mCache.Remove(fabric_index, mEndpointId, entry.mStorageId);
+    }
+    return err;
 }
 
 CHIP_ERROR DefaultSceneTableImpl::GetSceneTableEntry(FabricIndex fabric_index, SceneStorageId scene_id, SceneTableEntry & entry)
 {
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    if (mCache.Get(fabric_index, mEndpointId, scene_id, entry.mStorageData))
+    {
+        entry.mStorageId = scene_id;
+        return CHIP_NO_ERROR;
+    }
+
     // All data is copied to SceneTableEntry, buffer can be allocated on stack
     PersistenceBuffer<Serializer::kEntryMaxBytes()> store;
     ReturnErrorOnFailure(this->GetTableEntry(fabric_index, scene_id, entry.mStorageData, store));
     entry.mStorageId = scene_id;
+    mCache.Put(fabric_index, mEndpointId, scene_id, entry.mStorageData, mMaxPerFabric);
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR DefaultSceneTableImpl::RemoveSceneTableEntry(FabricIndex fabric_index, SceneStorageId scene_id)
 {
+    mCache.Remove(fabric_index, mEndpointId, scene_id);
     return this->RemoveTableEntry(fabric_index, scene_id);
 }
 
 CHIP_ERROR DefaultSceneTableImpl::RemoveSceneTableEntryAtPosition(EndpointId endpoint, FabricIndex fabric_index,
                                                                   SceneIndex scene_idx)
 {
+    // The cache does not know the position of the scenes
+    mCache.RemoveFabric(fabric_index, endpoint);
     return this->RemoveTableEntryAtPosition(endpoint, fabric_index, scene_idx);
 }
 
@@ -196,6 +219,8 @@ CHIP_ERROR DefaultSceneTableImpl::DeleteAllScenesInGroup(FabricIndex fabric_inde
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    mCache.RemoveFabric(fabric_index, mEndpointId);
+
     FabricSceneData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
 
     CHIP_ERROR err = fabric.Load(this->mStorage);
@@ -306,11 +331,13 @@ CHIP_ERROR DefaultSceneTableImpl::SceneApplyEFS(const SceneTableEntry & scene)
 
 CHIP_ERROR DefaultSceneTableImpl::RemoveFabric(FabricIndex fabric_index)
 {
+    mCache.RemoveFabric(fabric_index);
     return FabricTableImpl::RemoveFabric(fabric_index);
 }
 
 CHIP_ERROR DefaultSceneTableImpl::RemoveEndpoint()
 {
+    mCache.RemoveEndpoint(mEndpointId);
     return FabricTableImpl::RemoveEndpoint();
 }
 
@@ -323,6 +350,11 @@ CHIP_ERROR DefaultSceneTableImpl::ServerClusters(ReadOnlyBufferBuilder<app::Data
 void DefaultSceneTableImpl::SetTableSize(uint16_t endpointSceneTableSize)
 {
     FabricTableImpl::SetTableSize(endpointSceneTableSize, static_cast<uint16_t>((endpointSceneTableSize - 1) / 2));
+
+    // Loading the scenes of a fabric from storage drops those beyond the size of the endpoint table, which scenes cached with a
+    // larger table would not reflect. The cluster switches between the default and the endpoint size on every command, which
+    // leaves the scenes cached with the endpoint size alone.
+    mCache.RemoveEndpointBeyondSize(mEndpointId, mMaxPerFabric);
 }
 
 namespace {
@@ -20,6 +20,7 @@
 #include <app/clusters/scenes-server/SceneHandlerImpl.h>
 #include <app/clusters/scenes-server/SceneTable.h>
 #include <app/storage/FabricTableImpl.h>
+#include <app/storage/TableEntryCache.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/PersistentData.h>
 #include <lib/support/Pool.h>
@@ -38,6 +39,7 @@ static_assert(kMaxScenesPerEndpoint <= CHIP_CONFIG_MAX_SCENES_TABLE_SIZE,
               "CHIP_CONFIG_MAX_SCENES_TABLE_SIZE in CHIPConfig.h if you really need more scenes");
 static_assert(kMaxScenesPerEndpoint >= 16, "Per spec, kMaxScenesPerEndpoint must be at least 16");
 static constexpr uint16_t kMaxScenesPerFabric = (kMaxScenesPerEndpoint - 1) / 2;
+static constexpr size_t kSceneTableCacheSize  = CHIP_CONFIG_SCENES_TABLE_CACHE_SIZE;
 
 /**
  * @brief Implementation of a storage in nonvolatile storage of the scene table.
@@ -107,6 +109,10 @@ protected:
 
 private:
     app::DataModel::Provider * mDataModel = nullptr;
+
+    // Scenes recently loaded or stored, on any fabric and endpoint. The table is the only writer of its scenes in storage, and
+    // keeps the cache in sync with it.
+    app::Storage::TableEntryCache<SceneStorageId, SceneData, kSceneTableCacheSize> mCache;
 }; // class DefaultSceneTableImpl
 
 /// @brief Gets a pointer to the instance of Scene Table Impl, providing EndpointId and Table Size for said endpoint
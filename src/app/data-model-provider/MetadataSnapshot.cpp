@@ -0,0 +1,171 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/data-model-provider/MetadataSnapshot.h>
+
+#include <clusters/Descriptor/AttributeIds.h>
+#include <clusters/Descriptor/ClusterId.h>
+#include <clusters/shared/GlobalIds.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+namespace {
+
+constexpr size_t kInvalidIndex = std::numeric_limits<size_t>::max();
+
+/// Appends `elements` to `builder`, at least doubling its capacity when it grows so that
+/// building the snapshot does not re-allocate on every append.
+template <typename T>
+CHIP_ERROR AppendGrowing(ReadOnlyBufferBuilder<T> & builder, Span<const T> elements)
+{
+    ReturnErrorOnFailure(builder.EnsureAppendCapacity(std::max(elements.size(), builder.Size())));
+    return builder.AppendElements(elements);
+}
+
+} // namespace
+
+CHIP_ERROR MetadataSnapshot::EnsureBuilt()
+{
+    VerifyOrReturnError(!mBuilt, CHIP_NO_ERROR);
+
+    CHIP_ERROR err = Build();
+    if (err != CHIP_NO_ERROR)
+    {
+        Invalidate();
+        return err;
+    }
+    mBuilt = true;
+    return CHIP_NO_ERROR;
+}
+
+void MetadataSnapshot::Invalidate()
+{
+    mBuilt = false;
+    mGeneration++;
+
+    mEndpoints         = ReadOnlyBuffer<EndpointEntry>();
+    mEndpointClusters  = ReadOnlyBuffer<Range>();
+    mClusterIds        = ReadOnlyBuffer<ClusterId>();
+    mClusterAttributes = ReadOnlyBuffer<Range>();
+    mAttributes        = ReadOnlyBuffer<AttributeEntry>();
+}
+
+CHIP_ERROR MetadataSnapshot::Build()
+{
+    // Errors reading the tree are ignored (i.e. result in empty lists), as wildcard expansion does.
+    // Only failures to store the snapshot are reported.
+    ReadOnlyBuffer<EndpointEntry> endpoints = mTree.EndpointsIgnoreError();
+
+    ReadOnlyBufferBuilder<Range> endpointClusters;
+    ReadOnlyBufferBuilder<ClusterId> clusterIds;
+    ReadOnlyBufferBuilder<Range> clusterAttributes;
+    ReadOnlyBufferBuilder<AttributeEntry> attributes;
+
+    ReturnErrorOnFailure(endpointClusters.EnsureAppendCapacity(endpoints.size()));
+
+    for (const EndpointEntry & endpoint : endpoints)
+    {
+        ReadOnlyBuffer<ServerClusterEntry> clusters = mTree.ServerClustersIgnoreError(endpoint.id);
+        ReturnErrorOnFailure(endpointClusters.Append({ clusterIds.Size(), clusters.size() }));
+
+        for (const ServerClusterEntry & cluster : clusters)
+        {
+            ReadOnlyBuffer<AttributeEntry> clusterAttributeEntries =
+                mTree.AttributesIgnoreError(ConcreteClusterPath(endpoint.id, cluster.clusterId));
+
+            ReturnErrorOnFailure(AppendGrowing(clusterIds, Span<const ClusterId>(&cluster.clusterId, 1)));
+
+            const Range range{ attributes.Size(), clusterAttributeEntries.size() };
+            ReturnErrorOnFailure(AppendGrowing(clusterAttributes, Span<const Range>(&range, 1)));
+            ReturnErrorOnFailure(AppendGrowing(attributes, Span<const AttributeEntry>(clusterAttributeEntries)));
+        }
+    }
+
+    mEndpoints         = std::move(endpoints);
+    mEndpointClusters  = endpointClusters.TakeBuffer();
+    mClusterIds        = clusterIds.TakeBuffer();
+    mClusterAttributes = clusterAttributes.TakeBuffer();
+    mAttributes        = attributes.TakeBuffer();
+    return CHIP_NO_ERROR;
+}
+
+size_t MetadataSnapshot::FindEndpointIndex(EndpointId endpointId) const
+{
+    for (size_t i = 0; i < mEndpoints.size(); i++)
+    {
+        if (mEndpoints[i].id == endpointId)
+        {
+            return i;
+        }
+    }
+    return kInvalidIndex;
+}
+
+Span<const ClusterId> MetadataSnapshot::ServerClusters(EndpointId endpointId) const
+{
+    const size_t endpointIndex = FindEndpointIndex(endpointId);
+    VerifyOrReturnValue(endpointIndex != kInvalidIndex, Span<const ClusterId>());
+
+    const Range & clusters = mEndpointClusters[endpointIndex];
+    return Span<const ClusterId>(mClusterIds.data() + clusters.start, clusters.count);
+}
+
+Span<const AttributeEntry> MetadataSnapshot::Attributes(const ConcreteClusterPath & path) const
+{
+    const size_t endpointIndex = FindEndpointIndex(path.mEndpointId);
+    VerifyOrReturnValue(endpointIndex != kInvalidIndex, Span<const AttributeEntry>());
+
+    const Range & clusters = mEndpointClusters[endpointIndex];
+    for (size_t i = clusters.start; i < clusters.start + clusters.count; i++)
+    {
+        if (mClusterIds[i] == path.mClusterId)
+        {
+            const Range & clusterAttributes = mClusterAttributes[i];
+            return Span<const AttributeEntry>(mAttributes.data() + clusterAttributes.start, clusterAttributes.count);
+        }
+    }
+    return Span<const AttributeEntry>();
+}
+
+void MetadataSnapshot::MarkDirty(const AttributePathParams & path)
+{
+    VerifyOrReturn(mBuilt);
+
+    // Changes of regular attributes, including wildcard changes within a cluster, are data
+    // changes and leave the tree as is. Only whole endpoints and the attributes that
+    // describe the tree invalidate it.
+    bool structural = path.HasWildcardClusterId() || (path.mAttributeId == Clusters::Globals::Attributes::AttributeList::Id);
+    if (path.mClusterId == Clusters::Descriptor::Id)
+    {
+        structural = structural || path.HasWildcardAttributeId() ||
+            (path.mAttributeId == Clusters::Descriptor::Attributes::PartsList::Id) ||
+            (path.mAttributeId == Clusters::Descriptor::Attributes::ServerList::Id);
+    }
+
+    if (structural)
+    {
+        Invalidate();
+    }
+}
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
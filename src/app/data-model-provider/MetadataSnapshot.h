@@ -0,0 +1,101 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteClusterPath.h>
+#include <app/data-model-provider/MetadataTypes.h>
+#include <app/data-model-provider/ProviderChangeListener.h>
+#include <app/data-model-provider/ProviderMetadataTree.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/ReadOnlyBuffer.h>
+#include <lib/support/Span.h>
+
+#include <cstdint>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+/// A cached copy of the endpoint/cluster/attribute tree of a ProviderMetadataTree.
+///
+/// Wildcard path expansion walks the whole metadata tree, which for most providers means
+/// building (and allocating) a new list of clusters for every endpoint and a new list
+/// of attributes for every cluster. The snapshot builds the tree once, into flat arrays
+/// that can be walked by index, and keeps it until it is invalidated.
+///
+/// Only structural data is kept: endpoint entries, server cluster ids (cluster data versions
+/// change all the time and are not cached) and attribute entries.
+///
+/// Every invalidation bumps a generation counter. Spans returned by the snapshot are only
+/// valid for as long as `Generation()` does not change.
+///
+/// The snapshot is a ProviderChangeListener: changes reported for the attributes describing
+/// the tree (AttributeList, Descriptor PartsList/ServerList) or for whole endpoints invalidate it.
+/// Owners are expected to also call `Invalidate` on structural changes they know about
+/// (e.g. endpoints being enabled/disabled or clusters being registered).
+class MetadataSnapshot : public ProviderChangeListener
+{
+public:
+    MetadataSnapshot(ProviderMetadataTree & tree) : mTree(tree) {}
+
+    /// Builds the snapshot if it is not built yet.
+    ///
+    /// Returns an error if the tree could not be stored (e.g. out of memory), in which case
+    /// the snapshot stays invalid.
+    CHIP_ERROR EnsureBuilt();
+
+    /// Drops the cached tree. The next `EnsureBuilt` call will re-read it.
+    void Invalidate();
+
+    bool IsBuilt() const { return mBuilt; }
+    uint32_t Generation() const { return mGeneration; }
+
+    // Accessors below require the snapshot to be built. Lookups of an endpoint or cluster
+    // that does not exist return empty spans.
+    Span<const EndpointEntry> Endpoints() const { return mEndpoints; }
+    Span<const ClusterId> ServerClusters(EndpointId endpointId) const;
+    Span<const AttributeEntry> Attributes(const ConcreteClusterPath & path) const;
+
+    /// ProviderChangeListener implementation
+    void MarkDirty(const AttributePathParams & path) override;
+
+private:
+    // Location of the children of an endpoint (clusters) or of a cluster (attributes) in the flat arrays
+    struct Range
+    {
+        size_t start;
+        size_t count;
+    };
+
+    CHIP_ERROR Build();
+    size_t FindEndpointIndex(EndpointId endpointId) const;
+
+    ProviderMetadataTree & mTree;
+    bool mBuilt          = false;
+    uint32_t mGeneration = 0;
+
+    ReadOnlyBuffer<EndpointEntry> mEndpoints;
+    ReadOnlyBuffer<Range> mEndpointClusters; // one per endpoint, indexes into mClusterIds/mClusterAttributes
+    ReadOnlyBuffer<ClusterId> mClusterIds;
+    ReadOnlyBuffer<Range> mClusterAttributes; // one per cluster, indexes into mAttributes
+    ReadOnlyBuffer<AttributeEntry> mAttributes;
+};
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
@@ -26,6 +26,7 @@
 
 #include <app/data-model-provider/ActionReturnStatus.h>
 #include <app/data-model-provider/Context.h>
+#include <app/data-model-provider/MetadataSnapshot.h>
 #include <app/data-model-provider/OperationTypes.h>
 #include <app/data-model-provider/ProviderMetadataTree.h>
 
@@ -49,6 +50,13 @@ public:
     virtual CHIP_ERROR Startup(InteractionModelContext context) { return CHIP_NO_ERROR; }
     virtual CHIP_ERROR Shutdown() { return CHIP_NO_ERROR; }
 
+    /// Returns a cached copy of the metadata tree of this provider, or nullptr if the
+    /// provider does not keep one (in which case callers use ProviderMetadataTree directly).
+    ///
+    /// Providers keeping a snapshot are responsible for invalidating it when their tree changes.
+    /// Callers must not keep spans from the snapshot across a change of its `Generation()`.
+    virtual MetadataSnapshot * GetMetadataSnapshot() { return nullptr; }
+
     /// NOTE: this code is NOT required to handle `List` global attributes:
     ///       AcceptedCommandsList, GeneratedCommandsList OR AttributeList
     ///
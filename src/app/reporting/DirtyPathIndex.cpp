@@ -0,0 +1,150 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/DirtyPathIndex.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+DirtyPathIndex::~DirtyPathIndex()
+{
+    Clear();
+}
+
+size_t DirtyPathIndex::Hash(EndpointId endpoint, ClusterId cluster, AttributeId attribute)
+{
+    uint64_t key = (static_cast<uint64_t>(cluster) << 32) ^ (static_cast<uint64_t>(endpoint) << 16) ^ attribute ^
+        (static_cast<uint64_t>(attribute) << 40);
+    // 64-bit finalizer from MurmurHash3, so that consecutive IDs spread over the table.
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return static_cast<size_t>(key);
+}
+
+DirtyPathIndex::Slot * DirtyPathIndex::Probe(EndpointId endpoint, ClusterId cluster, AttributeId attribute) const
+{
+    const size_t mask = mCapacity - 1;
+    for (size_t i = Hash(endpoint, cluster, attribute) & mask;; i = (i + 1) & mask)
+    {
+        Slot & slot = mSlots[i];
+        if (slot.generation == 0 || (slot.endpoint == endpoint && slot.cluster == cluster && slot.attribute == attribute))
+        {
+            return &slot;
+        }
+    }
+}
+
+CHIP_ERROR DirtyPathIndex::Grow()
+{
+    const size_t capacity = (mCapacity == 0) ? kInitialCapacity : mCapacity * 2;
+    auto * slots          = static_cast<Slot *>(Platform::MemoryCalloc(capacity, sizeof(Slot)));
+    VerifyOrReturnError(slots != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    Slot * oldSlots    = mSlots;
+    size_t oldCapacity = mCapacity;
+    mSlots             = slots;
+    mCapacity          = capacity;
+    for (size_t i = 0; i < oldCapacity; ++i)
+    {
+        if (oldSlots[i].generation != 0)
+        {
+            *Probe(oldSlots[i].endpoint, oldSlots[i].cluster, oldSlots[i].attribute) = oldSlots[i];
+        }
+    }
+    Platform::MemoryFree(oldSlots);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DirtyPathIndex::Insert(const AttributePathParams & path, uint64_t generation)
+{
+    VerifyOrReturnError(generation != 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (mCapacity != 0)
+    {
+        Slot * slot = Probe(path.mEndpointId, path.mClusterId, path.mAttributeId);
+        if (slot->generation != 0)
+        {
+            slot->generation = generation;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    VerifyOrReturnError(mCount < mMaxEntries, CHIP_ERROR_NO_MEMORY);
+    if ((mCount + 1) * 2 > mCapacity)
+    {
+        ReturnErrorOnFailure(Grow());
+    }
+
+    Slot * slot      = Probe(path.mEndpointId, path.mClusterId, path.mAttributeId);
+    slot->generation = generation;
+    slot->endpoint   = path.mEndpointId;
+    slot->cluster    = path.mClusterId;
+    slot->attribute  = path.mAttributeId;
+    mCount++;
+
+    const int shape = (path.HasWildcardEndpointId() ? kWildcardEndpoint : 0) |
+        (path.HasWildcardClusterId() ? kWildcardCluster : 0) | (path.HasWildcardAttributeId() ? kWildcardAttribute : 0);
+    mShapeCounts[shape]++;
+    return CHIP_NO_ERROR;
+}
+
+uint64_t DirtyPathIndex::GetGeneration(const ConcreteAttributePath & path) const
+{
+    uint64_t generation = 0;
+    VerifyOrReturnValue(mCount != 0, generation);
+
+    for (uint8_t shape = 0; shape < kShapeCount; ++shape)
+    {
+        if (mShapeCounts[shape] == 0)
+        {
+            continue;
+        }
+        const Slot * slot = Probe((shape & kWildcardEndpoint) ? kInvalidEndpointId : path.mEndpointId,
+                                  (shape & kWildcardCluster) ? kInvalidClusterId : path.mClusterId,
+                                  (shape & kWildcardAttribute) ? kInvalidAttributeId : path.mAttributeId);
+        if (slot->generation > generation)
+        {
+            generation = slot->generation;
+        }
+    }
+    return generation;
+}
+
+void DirtyPathIndex::Clear()
+{
+    VerifyOrReturn(mSlots != nullptr);
+
+    Platform::MemoryFree(mSlots);
+    mSlots    = nullptr;
+    mCapacity = 0;
+    mCount    = 0;
+    memset(mShapeCounts, 0, sizeof(mShapeCounts));
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
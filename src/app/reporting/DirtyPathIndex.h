@@ -0,0 +1,125 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Iterators.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * Index of the attribute paths marked dirty, each with the dirty set generation at which it was last marked.
+ *
+ * Every dirty path is kept as-is (no merging into wider wildcard paths), keyed by its endpoint, cluster and
+ * attribute, any of which may be a wildcard. The table is allocated from the platform heap and grows on
+ * demand up to `maxEntries` paths.
+ *
+ * Looking up the generation of a concrete path only probes the key shapes (which of endpoint, cluster and
+ * attribute are wildcards) that are currently in use, so a lookup costs at most eight hash probes and
+ * usually one, independently of the number of dirty paths.
+ *
+ * List indexes are not tracked: a dirty path with a list index dirties the whole attribute.
+ */
+class DirtyPathIndex
+{
+public:
+    explicit DirtyPathIndex(size_t maxEntries) : mMaxEntries(maxEntries) {}
+    ~DirtyPathIndex();
+
+    DirtyPathIndex(const DirtyPathIndex &)             = delete;
+    DirtyPathIndex & operator=(const DirtyPathIndex &) = delete;
+
+    /**
+     * Record `path` as dirty at `generation`, replacing the generation of an identical path already present.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if the index is full or could not grow, in which case it is unchanged.
+     */
+    CHIP_ERROR Insert(const AttributePathParams & path, uint64_t generation);
+
+    /**
+     * Returns the highest generation of the dirty paths including `path`, or 0 if `path` is not dirty.
+     */
+    uint64_t GetGeneration(const ConcreteAttributePath & path) const;
+
+    /**
+     * Remove all dirty paths and release the table memory.
+     */
+    void Clear();
+
+    size_t Size() const { return mCount; }
+
+    /**
+     * Calls `function(const AttributePathParams & path, uint64_t generation)` for every dirty path, in no particular order,
+     * until it returns Loop::Break.
+     */
+    template <typename Function>
+    Loop ForEach(Function && function) const
+    {
+        for (size_t i = 0; i < mCapacity; ++i)
+        {
+            const Slot & slot = mSlots[i];
+            if (slot.generation != 0 &&
+                function(AttributePathParams(slot.endpoint, slot.cluster, slot.attribute), slot.generation) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+private:
+    static constexpr size_t kInitialCapacity = 16;
+
+    // Bits of a key shape, set for the components which are wildcards.
+    static constexpr uint8_t kWildcardEndpoint  = 0x1;
+    static constexpr uint8_t kWildcardCluster   = 0x2;
+    static constexpr uint8_t kWildcardAttribute = 0x4;
+    static constexpr uint8_t kShapeCount        = 8;
+
+    struct Slot
+    {
+        uint64_t generation; // 0 if the slot is free
+        ClusterId cluster;
+        AttributeId attribute;
+        EndpointId endpoint;
+    };
+
+    static size_t Hash(EndpointId endpoint, ClusterId cluster, AttributeId attribute);
+
+    // Returns the slot holding the given key, or the free slot where it would be inserted. The table must be allocated.
+    Slot * Probe(EndpointId endpoint, ClusterId cluster, AttributeId attribute) const;
+    CHIP_ERROR Grow();
+
+    const size_t mMaxEntries;
+    Slot * mSlots                      = nullptr; // Open addressing with linear probing, kept at most half full
+    size_t mCapacity                   = 0;       // Always a power of two
+    size_t mCount                      = 0;
+    uint32_t mShapeCounts[kShapeCount] = {};      // Number of dirty paths of each key shape
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -320,7 +320,7 @@ void Engine::Shutdown()
 
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
-    mGlobalDirtySet.ReleaseAll();
+    ClearDirtySet();
 }
 
 bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
@@ -403,23 +403,10 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         {
             if (!apReadHandler->IsPriming())
             {
-                bool concretePathDirty = false;
+                // We don't need to worry about paths that were already marked dirty before the last time this read handler
+                // started a report that it completed: those paths already got reported.
                 // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
-                    {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration > apReadHandler->mPreviousReportsBeginGeneration)
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
-                    }
-                    return Loop::Continue;
-                });
-
-                if (!concretePathDirty)
+                if (!IsAttributePathDirtySince(readPath, apReadHandler->mPreviousReportsBeginGeneration))
                 {
                     // This attribute is not dirty, we just skip this one.
                     continue;
@@ -851,6 +838,9 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     SuccessOrExitAction(
         err, ChipLogError(DataManagement, "<RE> Error sending out report data with %" CHIP_ERROR_FORMAT "!", err.Format()));
 
+    apReadHandler->GetReportPacer().OnChunkSent(System::SystemClock().GetMonotonicTimestamp(), reportDataWriter.GetLengthWritten(),
+                                                hasMoreChunks);
+
     ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with readHandler %" PRIu32 ", RE has %s", mNumReportsInFlight,
                   mCurReadHandlerIdx, hasMoreChunks ? "more messages" : "no more messages");
 
@@ -904,6 +894,44 @@ CHIP_ERROR Engine::ScheduleRun()
 }
 
 void Engine::Run()
+{
+    CHIP_ERROR err = mFairSchedulingEnabled ? RunByDeadline() : RunRoundRobin();
+    if (err != CHIP_NO_ERROR)
+    {
+        return;
+    }
+
+    //
+    // If our tracker has exceeded the bounds of the handler list, reset it back to 0.
+    // This isn't strictly necessary, but does make it easier to debug issues in this code if they
+    // do arise.
+    //
+    if (mCurReadHandlerIdx >= mpImEngine->mReadHandlers.Allocated())
+    {
+        mCurReadHandlerIdx = 0;
+    }
+
+    bool allReadClean = true;
+
+    mpImEngine->mReadHandlers.ForEachActiveObject([&allReadClean](ReadHandler * handler) {
+        if (handler->IsDirty())
+        {
+            allReadClean = false;
+            return Loop::Break;
+        }
+
+        return Loop::Continue;
+    });
+
+    if (allReadClean)
+    {
+        ChipLogDetail(DataManagement, "All ReadHandler-s are clean, clear GlobalDirtySet");
+
+        ClearDirtySet();
+    }
+}
+
+CHIP_ERROR Engine::RunRoundRobin()
 {
     uint32_t numReadHandled = 0;
 
@@ -918,14 +946,13 @@ void Engine::Run()
 
         if (readHandler->ShouldReportUnscheduled() || mpImEngine->GetReportScheduler()->IsReportableNow(readHandler))
         {
+            // Keep the latency metrics up to date, even though the deadline is not used for ordering.
+            readHandler->GetReportPacer().MarkReportable(System::SystemClock().GetMonotonicTimestamp(), mReportVirtualTime);
 
             mRunningReadHandler = readHandler;
             CHIP_ERROR err      = BuildAndSendSingleReportData(readHandler);
             mRunningReadHandler = nullptr;
-            if (err != CHIP_NO_ERROR)
-            {
-                return;
-            }
+            ReturnErrorOnFailure(err);
         }
 
         numReadHandled++;
@@ -935,35 +962,89 @@ void Engine::Run()
         mCurReadHandlerIdx++;
     }
 
-    //
-    // If our tracker has exceeded the bounds of the handler list, reset it back to 0.
-    // This isn't strictly necessary, but does make it easier to debug issues in this code if they
-    // do arise.
-    //
-    if (mCurReadHandlerIdx >= mpImEngine->mReadHandlers.Allocated())
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Engine::RunByDeadline()
+{
+    uint32_t numReportsSent = 0;
+
+    // Bound the work done in a single run as the round-robin loop does, one report per handler we started with.
+    size_t initialAllocated = mpImEngine->mReadHandlers.Allocated();
+    while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReportsSent < initialAllocated))
     {
-        mCurReadHandlerIdx = 0;
+        const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+        ReadHandler * earliest             = nullptr;
+        ReportPacer::VirtualTime earliestDeadline;
+
+        // Handlers are picked again on every iteration, since building a report may deallocate any of them.
+        mpImEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+            if (handler->ShouldReportUnscheduled() || mpImEngine->GetReportScheduler()->IsReportableNow(handler))
+            {
+                ReportPacer::VirtualTime deadline = handler->GetReportPacer().GetDeadline(now, mReportVirtualTime);
+                if (earliest == nullptr || deadline < earliestDeadline)
+                {
+                    earliest         = handler;
+                    earliestDeadline = deadline;
+                }
+            }
+            return Loop::Continue;
+        });
+        VerifyOrReturnError(earliest != nullptr, CHIP_NO_ERROR);
+        mReportVirtualTime = std::max(mReportVirtualTime, earliest->GetReportPacer().GetVirtualStart());
+
+        mRunningReadHandler = earliest;
+        CHIP_ERROR err      = BuildAndSendSingleReportData(earliest);
+        mRunningReadHandler = nullptr;
+        ReturnErrorOnFailure(err);
+
+        numReportsSent++;
     }
 
-    bool allReadClean = true;
+    return CHIP_NO_ERROR;
+}
 
-    mpImEngine->mReadHandlers.ForEachActiveObject([&allReadClean](ReadHandler * handler) {
-        if (handler->IsDirty())
+bool Engine::IsAttributePathDirtySince(const ConcreteAttributePath & aPath, uint64_t aGeneration)
+{
+#if CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+    if (mDirtyPathIndexEnabled)
+    {
+        return mDirtyPathIndex.GetGeneration(aPath) > aGeneration;
+    }
+#endif // CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+
+    return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
+        if (dirtyPath->IsAttributePathSupersetOf(aPath) && dirtyPath->mGeneration > aGeneration)
         {
-            allReadClean = false;
             return Loop::Break;
         }
-
         return Loop::Continue;
     });
+}
 
-    if (allReadClean)
-    {
-        ChipLogDetail(DataManagement, "All ReadHandler-s are clean, clear GlobalDirtySet");
+void Engine::ClearDirtySet()
+{
+#if CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+    mDirtyPathIndex.Clear();
+#endif // CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+    mGlobalDirtySet.ReleaseAll();
+}
 
-        mGlobalDirtySet.ReleaseAll();
+#if CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+void Engine::SetDirtyPathIndexEnabled(bool enabled)
+{
+    VerifyOrReturn(enabled != mDirtyPathIndexEnabled);
+
+    const bool wasDirty = (mDirtyPathIndex.Size() != 0 || mGlobalDirtySet.Allocated() != 0);
+    ClearDirtySet();
+    mDirtyPathIndexEnabled = enabled;
+    if (wasDirty)
+    {
+        // The generation of each path is lost, so consider every path as changed now.
+        LogErrorOnFailure(InsertPathIntoDirtySet(AttributePathParams()));
     }
 }
+#endif // CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
 
 bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
 {
@@ -1074,6 +1155,19 @@ bool Engine::MergeDirtyPathsUnderSameEndpoint()
 
 CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttributePath)
 {
+#if CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+    if (mDirtyPathIndexEnabled)
+    {
+        if (mDirtyPathIndex.Insert(aAttributePath, GetDirtySetGeneration()) != CHIP_NO_ERROR)
+        {
+            ChipLogDetail(DataManagement, "Dirty path index full, merge all paths.");
+            mDirtyPathIndex.Clear();
+            return mDirtyPathIndex.Insert(AttributePathParams(), GetDirtySetGeneration());
+        }
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+
     VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
 
     if (mGlobalDirtySet.Exhausted() && !MergeDirtyPathsUnderSameCluster() && !MergeDirtyPathsUnderSameEndpoint())
@@ -1258,6 +1352,16 @@ void Engine::ScheduleUrgentEventDeliverySync(Optional<FabricIndex> fabricIndex)
 
 void Engine::MarkDirty(const AttributePathParams & path)
 {
+    DataModel::Provider * dataModel = mpImEngine->GetDataModelProvider();
+    if (dataModel != nullptr)
+    {
+        DataModel::MetadataSnapshot * snapshot = dataModel->GetMetadataSnapshot();
+        if (snapshot != nullptr)
+        {
+            snapshot->MarkDirty(path);
+        }
+    }
+
     CHIP_ERROR err = SetDirty(path);
     if (err != CHIP_NO_ERROR)
     {
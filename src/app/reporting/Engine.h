@@ -29,6 +29,8 @@
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
 #include <app/data-model-provider/ProviderChangeListener.h>
+#include <app/reporting/DirtyPathIndex.h>
+#include <app/reporting/ReportPacer.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -126,9 +128,35 @@ public:
     uint64_t GetDirtySetGeneration() const { return mDirtyGeneration; }
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-    size_t GetGlobalDirtySetSize() { return mGlobalDirtySet.Allocated(); }
+    size_t GetGlobalDirtySetSize()
+    {
+#if CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+        if (mDirtyPathIndexEnabled)
+        {
+            return mDirtyPathIndex.Size();
+        }
+#endif // CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+        return mGlobalDirtySet.Allocated();
+    }
 #endif
 
+#if CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+    /**
+     * Enable or disable the dirty path index. When disabled, dirty paths are tracked in the fixed size
+     * mGlobalDirtySet pool, which merges them once it is full.
+     *
+     * Paths which are dirty when switching are carried over as a single wildcard path.
+     */
+    void SetDirtyPathIndexEnabled(bool enabled);
+#endif // CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+
+    /**
+     * Enable or disable fair scheduling of reports. When enabled, reportable ReadHandlers are served in the order of their
+     * report deadline (see ReportPacer) instead of round-robin.
+     */
+    void SetFairSchedulingEnabled(bool enabled) { mFairSchedulingEnabled = enabled; }
+    bool IsFairSchedulingEnabled() const { return mFairSchedulingEnabled; }
+
     /* ProviderChangeListener implementation */
     void MarkDirty(const AttributePathParams & path) override;
 
@@ -138,6 +166,13 @@ private:
      */
     void Run();
 
+    /**
+     * Send reports for the reportable ReadHandlers, in round-robin order or in the order of their report deadline.
+     * Returns an error if building or sending a report failed, in which case the run stops.
+     */
+    CHIP_ERROR RunRoundRobin();
+    CHIP_ERROR RunByDeadline();
+
     friend class TestReportingEngine;
     friend class ::chip::app::TestReadInteraction;
 
@@ -233,6 +268,13 @@ private:
 
     CHIP_ERROR InsertPathIntoDirtySet(const AttributePathParams & aAttributePath);
 
+    /**
+     * Returns whether a dirty path including aPath was marked dirty after the given dirty set generation.
+     */
+    bool IsAttributePathDirtySince(const ConcreteAttributePath & aPath, uint64_t aGeneration);
+
+    void ClearDirtySet();
+
     inline void BumpDirtySetGeneration() { mDirtyGeneration++; }
 
     /**
@@ -259,6 +301,13 @@ private:
      */
     ReadHandler * mRunningReadHandler = nullptr;
 
+    bool mFairSchedulingEnabled = CHIP_IM_FAIR_REPORT_SCHEDULING;
+
+    /**
+     * Virtual time of the fair scheduling of reports: the virtual start time of the last report chunk sent.
+     */
+    ReportPacer::VirtualTime mReportVirtualTime{ 0 };
+
     /**
      *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
      *
@@ -270,6 +319,14 @@ private:
     ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
 #endif
 
+#if CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+    /**
+     * Used instead of mGlobalDirtySet when mDirtyPathIndexEnabled is set.
+     */
+    DirtyPathIndex mDirtyPathIndex{ CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES };
+    bool mDirtyPathIndexEnabled = true;
+#endif // CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+
     /**
      * A generation counter for the dirty attrbute set.
      * ReadHandlers can save the generation value when generating reports.
@@ -0,0 +1,138 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/StatusResponse.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemClock.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @class ReportPacer
+ *
+ * @brief Tracks the cost and latency of the reports of a single ReadHandler.
+ *
+ * The reporting engine records when a ReadHandler is first seen reportable and every report chunk it sends. This gives
+ * per-handler latency metrics (time from becoming reportable to sending the last chunk of the report), and a deadline
+ * the engine can order reportable handlers by when fair scheduling is enabled.
+ *
+ * Deadlines follow start-time fair queueing, in a virtual time shared by all the handlers of the engine: every chunk sent
+ * advances the virtual start time of its handler by the cost of the chunk, a full chunk costing
+ * CHIP_IM_REPORT_CHUNK_LATENCY_BUDGET_MS, while the engine's virtual time follows the start time of the chunks it sends.
+ * A handler becoming reportable starts at the engine's virtual time, and the deadline of its next chunk is its virtual
+ * start time plus the expected cost of that chunk. A handler with a small report is therefore served ahead of the
+ * remaining chunks of large reports, instead of waiting for one chunk of each of them.
+ */
+class ReportPacer
+{
+public:
+    using Timestamp   = System::Clock::Timestamp;
+    using VirtualTime = System::Clock::Milliseconds64;
+
+    struct LatencyStats
+    {
+        uint32_t reportCount = 0;
+        uint32_t chunkCount  = 0;
+        uint64_t bytesSent   = 0;
+        System::Clock::Milliseconds64 lastLatency{ 0 };
+        System::Clock::Milliseconds64 maxLatency{ 0 };
+        System::Clock::Milliseconds64 totalLatency{ 0 };
+    };
+
+    /**
+     * Record that the handler is reportable, if it was not already waiting for its report to be sent.
+     *
+     * @param now          The current monotonic time.
+     * @param virtualTime  The virtual time of the engine, which an idle handler catches up with.
+     */
+    void MarkReportable(const Timestamp & now, const VirtualTime & virtualTime)
+    {
+        if (!mReportPending)
+        {
+            mReportPending   = true;
+            mReportableSince = now;
+            mVirtualStart    = std::max(mVirtualStart, virtualTime);
+        }
+    }
+
+    /**
+     * Deadline of the next report chunk of a reportable handler, in virtual time: earlier deadlines should be served first.
+     */
+    VirtualTime GetDeadline(const Timestamp & now, const VirtualTime & virtualTime)
+    {
+        MarkReportable(now, virtualTime);
+        return mVirtualStart + ChunkCost(mAverageChunkBytes);
+    }
+
+    /**
+     * Virtual start time of the next report chunk, which becomes the virtual time of the engine when it sends that chunk.
+     */
+    VirtualTime GetVirtualStart() const { return mVirtualStart; }
+
+    /**
+     * Record that a report chunk of chunkBytes bytes was sent, which completes the report unless hasMoreChunks.
+     */
+    void OnChunkSent(const Timestamp & now, size_t chunkBytes, bool hasMoreChunks)
+    {
+        MarkReportable(now, mVirtualStart);
+        mVirtualStart += ChunkCost(chunkBytes);
+        mAverageChunkBytes = (mAverageChunkBytes * 3 + chunkBytes) / 4;
+
+        mStats.chunkCount++;
+        mStats.bytesSent += chunkBytes;
+        VerifyOrReturn(!hasMoreChunks);
+
+        const System::Clock::Milliseconds64 latency = now - mReportableSince;
+        mStats.reportCount++;
+        mStats.lastLatency = latency;
+        mStats.maxLatency  = std::max(mStats.maxLatency, latency);
+        mStats.totalLatency += latency;
+        mReportPending = false;
+    }
+
+    const LatencyStats & GetLatencyStats() const { return mStats; }
+    void ResetLatencyStats() { mStats = LatencyStats(); }
+
+private:
+    static VirtualTime ChunkCost(size_t chunkBytes)
+    {
+        // Charge at least a millisecond per chunk, so that equal deadlines alternate between handlers.
+        return VirtualTime(
+            std::max<uint64_t>(1, uint64_t{ CHIP_IM_REPORT_CHUNK_LATENCY_BUDGET_MS } * chunkBytes / kMaxSecureSduLengthBytes));
+    }
+
+    Timestamp mReportableSince{ 0 };
+    VirtualTime mVirtualStart{ 0 };
+    // Until a chunk has been sent, assume full chunks.
+    size_t mAverageChunkBytes = kMaxSecureSduLengthBytes;
+    bool mReportPending       = false;
+    LatencyStats mStats;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -20,11 +20,107 @@
 #include <app/InteractionModelEngine.h>
 #include <app/data-model-provider/Provider.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/MpscQueue.h>
+#include <platform/CHIPDeviceLayer.h>
 #include <platform/LockTracker.h>
 
+#include <atomic>
+
 using namespace chip;
 using namespace chip::app;
 
+namespace {
+
+struct AttributeChange
+{
+    EndpointId endpoint;
+    ClusterId clusterId;
+    AttributeId attributeId;
+};
+
+/*
+ * Runs `lambda` on the Matter thread, from any thread: through the lock-free work queue of the System Layer when there is
+ * one and it has room, and otherwise right away with the Matter stack lock held.
+ */
+template <typename Lambda>
+void RunFromAnyThread(const Lambda & lambda)
+{
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0 && !CHIP_SYSTEM_CONFIG_USE_DISPATCH
+    // The System Layer itself is a global, unlike the state of the IM engine, which is only safe to read with the lock.
+    auto & systemLayer = static_cast<System::LayerSocketsLoop &>(DeviceLayer::SystemLayer());
+    VerifyOrReturn(systemLayer.ScheduleLambdaFromAnyThread(lambda) != CHIP_NO_ERROR);
+#endif // CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0 && !CHIP_SYSTEM_CONFIG_USE_DISPATCH
+
+    DeviceLayer::StackLock lock;
+    lambda();
+}
+
+/*
+ * Attribute changes reported from other threads, until the Matter thread marks them dirty.
+ */
+class PendingAttributeChanges
+{
+public:
+    void Add(const AttributeChange & change)
+    {
+        if (!mChanges.TryPush(change))
+        {
+            // Too many changes are waiting for the Matter thread: hand this one over on its own.
+            RunFromAnyThread(
+                [change] { MatterReportingAttributeChangeCallback(change.endpoint, change.clusterId, change.attributeId); });
+            return;
+        }
+
+        // Only the first change since the last flush schedules one. If the flush cannot be posted to the work queue,
+        // RunFromAnyThread() runs it right away, which clears mFlushScheduled again.
+        if (!mFlushScheduled.exchange(true, std::memory_order_acq_rel))
+        {
+            RunFromAnyThread([this] { Flush(); });
+        }
+    }
+
+    /*
+     * Drops the queued changes and forgets about their flush. A flush still in the work queue of the System Layer is
+     * dropped without running when the System Layer shuts down, after which no other flush would be scheduled.
+     */
+    void Clear()
+    {
+        mFlushScheduled.store(false, std::memory_order_release);
+
+        // Changes queued by other threads while this runs are dropped too, or flushed by the flush they schedule.
+        AttributeChange change;
+        for (size_t count = 0; count < mChanges.Capacity(); count++)
+        {
+            VerifyOrReturn(mChanges.TryPop(change));
+        }
+    }
+
+private:
+    void Flush()
+    {
+        // Changes queued from now on schedule another flush. This exchange synchronizes with the one in Add(), which
+        // makes the changes queued before it visible here.
+        mFlushScheduled.exchange(false, std::memory_order_acq_rel);
+
+        AttributeChange change;
+        for (size_t count = 0; count < mChanges.Capacity() && mChanges.TryPop(change); count++)
+        {
+            MatterReportingAttributeChangeCallback(change.endpoint, change.clusterId, change.attributeId);
+        }
+    }
+
+    MpscQueue<AttributeChange, CHIP_IM_SERVER_ATTRIBUTE_CHANGE_QUEUE_SIZE> mChanges;
+    std::atomic<bool> mFlushScheduled{ false };
+};
+
+PendingAttributeChanges & GetPendingAttributeChanges()
+{
+    static PendingAttributeChanges sPendingChanges;
+    return sPendingChanges;
+}
+
+} // namespace
+
 void MatterReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
 {
     // Attribute writes have asserted this already, but this assert should catch
@@ -60,3 +156,13 @@ void MatterReportingAttributeChangeCallback(EndpointId endpoint)
 
     provider->Temporary_ReportAttributeChanged(AttributePathParams(endpoint));
 }
+
+void MatterReportingAttributeChangeCallbackFromAnyThread(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
+{
+    GetPendingAttributeChanges().Add({ endpoint, clusterId, attributeId });
+}
+
+void MatterReportingClearPendingAttributeChanges()
+{
+    GetPendingAttributeChanges().Clear();
+}
@@ -37,3 +37,21 @@ void MatterReportingAttributeChangeCallback(const chip::app::ConcreteAttributePa
  * Same but only with an EndpointId, this is used when adding / enabling an endpoint during runtime.
  */
 void MatterReportingAttributeChangeCallback(chip::EndpointId endpoint);
+
+/*
+ * Same as MatterReportingAttributeChangeCallback(endpoint, clusterId, attributeId), for applications which learn about
+ * changes on threads of their own, e.g. bridges: may be called from any thread, but not with the Matter stack lock held.
+ *
+ * The changes are queued without locking, and marked dirty together on the Matter thread, which is woken up once per
+ * batch rather than once per change. Where the System Layer has no work queue for other threads, or it is full, the
+ * Matter stack lock is taken instead.
+ */
+void MatterReportingAttributeChangeCallbackFromAnyThread(chip::EndpointId endpoint, chip::ClusterId clusterId,
+                                                         chip::AttributeId attributeId);
+
+/*
+ * Drops the changes queued by MatterReportingAttributeChangeCallbackFromAnyThread() that have not been marked dirty yet.
+ * Called by the Interaction Model engine when it starts and shuts down, as the flush scheduled for them does not survive
+ * a restart of the System Layer. Must be called on the Matter thread.
+ */
+void MatterReportingClearPendingAttributeChanges();
@@ -205,6 +205,10 @@ public:
 
     ServerClusterInstances AllServerClusterInstances();
 
+    /// Changes whenever clusters are registered or unregistered. Allows users to
+    /// detect that metadata derived from the registered clusters has to be refreshed.
+    uint32_t Generation() const { return mGeneration; }
+
 protected:
     ServerClusterRegistration * mRegistrations = nullptr;
 
@@ -214,6 +218,8 @@ protected:
 
     // Managing context for this registry
     std::optional<ServerClusterContext> mContext;
+
+    uint32_t mGeneration = 0;
 };
 
 } // namespace app
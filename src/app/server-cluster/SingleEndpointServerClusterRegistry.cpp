@@ -75,6 +75,7 @@ void SingleEndpointServerClusterRegistry::UnregisterAllFromEndpoint(EndpointId e
             ServerClusterRegistration * actual_next = current->next;
 
             current->next = nullptr; // Make sure current does not look like part of a list.
+            mGeneration++;
             if (mContext.has_value())
             {
                 current->serverClusterInterface->Shutdown();
@@ -278,6 +278,12 @@ struct CommonCaseDeviceServerInitParams : public ServerInitParams
             // WARNING: PersistentStorageOperationalKeystore::Finish() is never called. It's fine for
             //          for examples and for now.
             ReturnErrorOnFailure(mPersistentStorageOperationalKeystore.Init(this->persistentStorageDelegate));
+#if CHIP_DEVICE_CONFIG_KVS_THREAD_SAFE && CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+            if (this->persistentStorageDelegate == &mKvsPersistentStorageDelegate)
+            {
+                mPersistentStorageOperationalKeystore.EnableSignWithOpKeypairInBackground();
+            }
+#endif // CHIP_DEVICE_CONFIG_KVS_THREAD_SAFE && CHIP_SYSTEM_CONFIG_POSIX_LOCKING
             this->operationalKeystore = &mPersistentStorageOperationalKeystore;
         }
 
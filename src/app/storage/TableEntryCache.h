@@ -0,0 +1,194 @@
+/**
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/CodeUtils.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace Storage {
+
+/**
+ * @brief Bounded in-memory cache of decoded table entries, keyed by fabric, endpoint and entry id.
+ *
+ * Meant to sit in front of a FabricTableImpl which is the only writer of its storage: entries are cached once loaded from or
+ * persisted to storage (write-through), and invalidated as they are removed from it, so that a hit skips both the storage reads
+ * and the TLV decoding. When full, the least recently used entry is evicted.
+ *
+ * A capacity of 0 disables the cache.
+ */
+template <class StorageId, class StorageData, size_t kCapacity>
+class TableEntryCache
+{
+public:
+    /**
+     * @brief Copies the cached data of the entry to data.
+     * @return true on a hit, false if the entry is not cached
+     */
+    bool Get(FabricIndex fabric, EndpointId endpoint, const StorageId & id, StorageData & data)
+    {
+        size_t index = Find(fabric, endpoint, id);
+        VerifyOrReturnValue(index != kNotFound, false);
+
+        mSlots[index].lastUsed = ++mUseCounter;
+        data                   = mData[index];
+        return true;
+    }
+
+    /**
+     * @brief Caches the data of the entry, as it was persisted or loaded with a table holding maxPerFabric entries per fabric.
+     */
+    void Put(FabricIndex fabric, EndpointId endpoint, const StorageId & id, const StorageData & data, uint16_t maxPerFabric)
+    {
+        size_t index = Find(fabric, endpoint, id);
+        if (index == kNotFound)
+        {
+            index = FindVictim();
+        }
+
+        mSlots[index].fabric   = fabric;
+        mSlots[index].endpoint = endpoint;
+        mSlots[index].id           = id;
+        mSlots[index].maxPerFabric = maxPerFabric;
+        mSlots[index].lastUsed     = ++mUseCounter;
+        mData[index]               = data;
+    }
+
+    void Remove(FabricIndex fabric, EndpointId endpoint, const StorageId & id)
+    {
+        size_t index = Find(fabric, endpoint, id);
+        VerifyOrReturn(index != kNotFound);
+        mSlots[index].fabric = kUndefinedFabricIndex;
+    }
+
+    /**
+     * @brief Removes the entries of a fabric on an endpoint, or on all the endpoints if endpoint is kInvalidEndpointId.
+     */
+    void RemoveFabric(FabricIndex fabric, EndpointId endpoint = kInvalidEndpointId)
+    {
+        for (auto & slot : mSlots)
+        {
+            if (slot.fabric == fabric && (endpoint == kInvalidEndpointId || slot.endpoint == endpoint))
+            {
+                slot.fabric = kUndefinedFabricIndex;
+            }
+        }
+    }
+
+    void RemoveEndpoint(EndpointId endpoint)
+    {
+        for (auto & slot : mSlots)
+        {
+            if (slot.endpoint == endpoint)
+            {
+                slot.fabric = kUndefinedFabricIndex;
+            }
+        }
+    }
+
+    /**
+     * @brief Removes the entries of an endpoint cached with a table holding more than maxPerFabric entries per fabric, which
+     *        may be among the entries dropped when loading with a smaller table.
+     */
+    void RemoveEndpointBeyondSize(EndpointId endpoint, uint16_t maxPerFabric)
+    {
+        for (auto & slot : mSlots)
+        {
+            if (slot.endpoint == endpoint && slot.maxPerFabric > maxPerFabric)
+            {
+                slot.fabric = kUndefinedFabricIndex;
+            }
+        }
+    }
+
+    void Clear()
+    {
+        for (auto & slot : mSlots)
+        {
+            slot.fabric = kUndefinedFabricIndex;
+        }
+    }
+
+private:
+    static constexpr size_t kNotFound = SIZE_MAX;
+
+    // The keys are kept apart from the data, so that lookups only walk the keys.
+    struct Slot
+    {
+        FabricIndex fabric  = kUndefinedFabricIndex;
+        EndpointId endpoint = kInvalidEndpointId;
+        StorageId id;
+        uint16_t maxPerFabric = 0;
+        uint32_t lastUsed     = 0;
+    };
+
+    size_t Find(FabricIndex fabric, EndpointId endpoint, const StorageId & id) const
+    {
+        VerifyOrReturnValue(fabric != kUndefinedFabricIndex, kNotFound);
+        for (size_t i = 0; i < kCapacity; i++)
+        {
+            if (mSlots[i].fabric == fabric && mSlots[i].endpoint == endpoint && mSlots[i].id == id)
+            {
+                return i;
+            }
+        }
+        return kNotFound;
+    }
+
+    size_t FindVictim() const
+    {
+        size_t victim = 0;
+        for (size_t i = 0; i < kCapacity; i++)
+        {
+            if (mSlots[i].fabric == kUndefinedFabricIndex)
+            {
+                return i;
+            }
+            if (mSlots[i].lastUsed < mSlots[victim].lastUsed)
+            {
+                victim = i;
+            }
+        }
+        return victim;
+    }
+
+    Slot mSlots[kCapacity];
+    StorageData mData[kCapacity];
+    uint32_t mUseCounter = 0;
+};
+
+template <class StorageId, class StorageData>
+class TableEntryCache<StorageId, StorageData, 0>
+{
+public:
+    bool Get(FabricIndex fabric, EndpointId endpoint, const StorageId & id, StorageData & data) { return false; }
+    void Put(FabricIndex fabric, EndpointId endpoint, const StorageId & id, const StorageData & data, uint16_t maxPerFabric) {}
+    void Remove(FabricIndex fabric, EndpointId endpoint, const StorageId & id) {}
+    void RemoveFabric(FabricIndex fabric, EndpointId endpoint = kInvalidEndpointId) {}
+    void RemoveEndpoint(EndpointId endpoint) {}
+    void RemoveEndpointBeyondSize(EndpointId endpoint, uint16_t maxPerFabric) {}
+    void Clear() {}
+};
+
+} // namespace Storage
+} // namespace app
+} // namespace chip
@@ -23,6 +23,9 @@
 #include <app/ConcreteAttributePath.h>
 #include <app/EventManagement.h>
 #include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <app/util/mock/MockNodeConfig.h>
+#include <data-model-providers/codegen/CodegenDataModelProvider.h>
 #include <data-model-providers/codegen/Instance.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/StringBuilderAdapters.h>
@@ -32,6 +35,7 @@
 #include <lib/support/LinkedList.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
 
 using namespace chip;
 using namespace chip::Testing;
@@ -519,4 +523,139 @@ TEST_F(TestAttributePathExpandIterator, TestMultipleClusInfo)
     }
 }
 
+TEST_F(TestAttributePathExpandIterator, TestMetadataSnapshot)
+{
+    using namespace Clusters::Globals::Attributes;
+
+    DataModel::Provider * provider         = CodegenDataModelProviderInstance(&gStorageDelegate);
+    DataModel::MetadataSnapshot * snapshot = provider->GetMetadataSnapshot();
+    ASSERT_NE(snapshot, nullptr);
+    ASSERT_EQ(snapshot->EnsureBuilt(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(snapshot->Endpoints().size(), provider->EndpointsIgnoreError().size());
+    EXPECT_EQ(snapshot->ServerClusters(kMockEndpoint2).size(), 3u);
+    EXPECT_EQ(snapshot->ServerClusters(kMockEndpoint2)[2], MockClusterId(3));
+    EXPECT_EQ(snapshot->Attributes(ConcreteClusterPath(kMockEndpoint3, MockClusterId(2))).size(), 9u);
+    EXPECT_TRUE(snapshot->ServerClusters(kInvalidEndpointId).empty());
+    EXPECT_TRUE(snapshot->Attributes(ConcreteClusterPath(kMockEndpoint1, MockClusterId(3))).empty());
+
+    // Data changes, even of a whole cluster, keep the snapshot
+    uint32_t generation = snapshot->Generation();
+    snapshot->MarkDirty(AttributePathParams(kMockEndpoint2, MockClusterId(2), MockAttributeId(1)));
+    snapshot->MarkDirty(AttributePathParams(kMockEndpoint2, MockClusterId(2)));
+    EXPECT_TRUE(snapshot->IsBuilt());
+    EXPECT_EQ(snapshot->Generation(), generation);
+
+    // Changes of the tree invalidate it
+    snapshot->MarkDirty(AttributePathParams(kMockEndpoint2, MockClusterId(2), AttributeList::Id));
+    EXPECT_FALSE(snapshot->IsBuilt());
+    EXPECT_NE(snapshot->Generation(), generation);
+
+    ASSERT_EQ(snapshot->EnsureBuilt(), CHIP_NO_ERROR);
+    generation = snapshot->Generation();
+    snapshot->MarkDirty(AttributePathParams(kMockEndpoint2));
+    EXPECT_FALSE(snapshot->IsBuilt());
+    EXPECT_NE(snapshot->Generation(), generation);
+
+    // So do changes of the ember structure, which the provider picks up
+    ASSERT_EQ(snapshot->EnsureBuilt(), CHIP_NO_ERROR);
+    // clang-format off
+    static const MockNodeConfig config({
+        MockEndpointConfig(kMockEndpoint1, {
+            MockClusterConfig(MockClusterId(1), { ClusterRevision::Id, FeatureMap::Id }),
+        }),
+    });
+    // clang-format on
+    SetMockNodeConfig(config);
+    EXPECT_EQ(provider->GetMetadataSnapshot(), snapshot);
+    EXPECT_FALSE(snapshot->IsBuilt());
+    ASSERT_EQ(snapshot->EnsureBuilt(), CHIP_NO_ERROR);
+    EXPECT_EQ(snapshot->Endpoints().size(), 1u);
+    EXPECT_TRUE(snapshot->ServerClusters(kMockEndpoint2).empty());
+    ResetMockNodeConfig();
+}
+
+TEST_F(TestAttributePathExpandIterator, TestStructureChangeDuringIteration)
+{
+    using namespace Clusters::Globals::Attributes;
+
+    SingleLinkedListNode<app::AttributePathParams> clusInfo;
+    auto position = AttributePathExpandIterator::Position::StartIterating(&clusInfo);
+    app::AttributePathExpandIterator iter(CodegenDataModelProviderInstance(&gStorageDelegate), position);
+
+    app::ConcreteAttributePath path;
+    ASSERT_TRUE(iter.Next(path));
+    ASSERT_TRUE(iter.Next(path));
+    EXPECT_EQ(path, P(kMockEndpoint1, MockClusterId(1), FeatureMap::Id));
+
+    // The iterator drops the metadata of the previous structure and resumes after the current path
+    // clang-format off
+    static const MockNodeConfig config({
+        MockEndpointConfig(kMockEndpoint1, {
+            MockClusterConfig(MockClusterId(1), { ClusterRevision::Id, FeatureMap::Id, MockAttributeId(5) }),
+        }),
+    });
+    // clang-format on
+    SetMockNodeConfig(config);
+
+    P paths[] = {
+        { kMockEndpoint1, MockClusterId(1), MockAttributeId(5) },
+        { kMockEndpoint1, MockClusterId(1), GeneratedCommandList::Id },
+        { kMockEndpoint1, MockClusterId(1), AcceptedCommandList::Id },
+        { kMockEndpoint1, MockClusterId(1), AttributeList::Id },
+    };
+    for (const auto & expected : paths)
+    {
+        ASSERT_TRUE(iter.Next(path));
+        EXPECT_EQ(path, expected);
+    }
+    EXPECT_FALSE(iter.Next(path));
+    ResetMockNodeConfig();
+}
+
+TEST_F(TestAttributePathExpandIterator, TestWildcardExpansionBenchmark)
+{
+    // Measures priming a wildcard read of the whole mock data model, with metadata read from the
+    // provider for every endpoint and cluster, and with the metadata snapshot of the provider.
+    class UncachedProvider : public CodegenDataModelProvider
+    {
+    public:
+        DataModel::MetadataSnapshot * GetMetadataSnapshot() override { return nullptr; }
+    };
+
+    constexpr size_t kIterations = 5000;
+    UncachedProvider uncached;
+    uncached.SetPersistentStorageDelegate(&gStorageDelegate);
+    DataModel::Provider * providers[] = { &uncached, CodegenDataModelProviderInstance(&gStorageDelegate) };
+
+    size_t expectedPathCount = 0;
+    for (DataModel::Provider * provider : providers)
+    {
+        SingleLinkedListNode<app::AttributePathParams> clusInfo;
+        app::ConcreteAttributePath path;
+        std::optional<DataModel::AttributeEntry> entry;
+        size_t pathCount = 0;
+
+        uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            auto position = AttributePathExpandIterator::Position::StartIterating(&clusInfo);
+            for (app::AttributePathExpandIterator iter(provider, position); iter.Next(path, &entry);)
+            {
+                pathCount++;
+            }
+        }
+        uint64_t elapsed = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+
+        if (expectedPathCount == 0)
+        {
+            expectedPathCount = pathCount;
+        }
+        EXPECT_EQ(pathCount, expectedPathCount);
+        ChipLogProgress(Test, "Wildcard expansion %s metadata snapshot: %u ns per path",
+                        (provider == &uncached) ? "without" : "with",
+                        static_cast<unsigned>(elapsed * 1000 / pathCount));
+    }
+}
+
 } // namespace
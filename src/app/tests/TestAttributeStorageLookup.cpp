@@ -0,0 +1,419 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/util/attribute-storage-lookup.h>
+
+#include <app-common/zap-generated/attribute-type.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <pw_unit_test/framework.h>
+
+#include <array>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app::Compatibility::Internal;
+
+namespace {
+
+constexpr EmberAfAttributeMetadata Attribute(AttributeId attributeId, uint16_t size, EmberAfAttributeMask mask = 0)
+{
+    return { EmberAfDefaultOrMinMaxAttributeValue(uint32_t(0)), attributeId, size, ZCL_INT8U_ATTRIBUTE_TYPE,
+             static_cast<EmberAfAttributeMask>(mask | MATTER_ATTRIBUTE_FLAG_READABLE) };
+}
+
+constexpr EmberAfCluster Cluster(ClusterId clusterId, const EmberAfAttributeMetadata * attributes, uint16_t attributeCount,
+                                 uint16_t clusterSize, EmberAfClusterMask mask)
+{
+    return { clusterId, attributes, attributeCount, clusterSize, mask, nullptr, nullptr, nullptr, nullptr, 0 };
+}
+
+// A data model with two endpoint types, with clusters and attributes out of order.
+namespace SmallModel {
+
+constexpr EmberAfAttributeMetadata kAttributes[] = {
+    // Cluster 0x0006
+    Attribute(0x0000, 1),
+    Attribute(0x4000, 2, MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE),
+    Attribute(0x0001, 4),
+    Attribute(0xFFFD, 2),
+    // Cluster 0x0028 (server)
+    Attribute(0x0005, 8),
+    Attribute(0x0002, 2),
+    // Cluster 0x0003
+    Attribute(0x0000, 2),
+    // Cluster 0x0006 of the second endpoint type
+    Attribute(0x0000, 1),
+};
+
+constexpr EmberAfCluster kClusters[] = {
+    Cluster(0x0006, &kAttributes[0], 4, 7, MATTER_CLUSTER_FLAG_SERVER),
+    Cluster(0x0028, nullptr, 0, 0, MATTER_CLUSTER_FLAG_CLIENT),
+    Cluster(0x0028, &kAttributes[4], 2, 10, MATTER_CLUSTER_FLAG_SERVER),
+    Cluster(0x0003, &kAttributes[6], 1, 2, MATTER_CLUSTER_FLAG_SERVER),
+    Cluster(0x0006, &kAttributes[7], 1, 1, MATTER_CLUSTER_FLAG_SERVER),
+};
+
+constexpr EmberAfEndpointType kEndpointTypes[] = {
+    { &kClusters[0], 4, 19 },
+    { &kClusters[4], 1, 1 },
+};
+
+constexpr FixedMetadataLookup<MATTER_ARRAY_SIZE(kClusters), MATTER_ARRAY_SIZE(kAttributes)>
+    kLookup(kEndpointTypes, MATTER_ARRAY_SIZE(kEndpointTypes), kClusters, kAttributes);
+
+} // namespace SmallModel
+
+TEST(TestAttributeStorageLookup, TestFindCluster)
+{
+    using namespace SmallModel;
+
+    const EmberAfEndpointType otherType = { &kClusters[0], 4, 19 };
+    EXPECT_TRUE(kLookup.Covers(&kEndpointTypes[0]));
+    EXPECT_TRUE(kLookup.Covers(&kEndpointTypes[1]));
+    EXPECT_FALSE(kLookup.Covers(&otherType));
+
+    EXPECT_EQ(kLookup.FindCluster(&kEndpointTypes[0], 0x0006, MATTER_CLUSTER_FLAG_SERVER), &kClusters[0]);
+    EXPECT_EQ(kLookup.FindCluster(&kEndpointTypes[0], 0x0003, 0), &kClusters[3]);
+    EXPECT_EQ(kLookup.FindCluster(&kEndpointTypes[1], 0x0006, MATTER_CLUSTER_FLAG_SERVER), &kClusters[4]);
+    EXPECT_EQ(kLookup.FindCluster(&kEndpointTypes[1], 0x0003, 0), nullptr);
+    EXPECT_EQ(kLookup.FindCluster(&kEndpointTypes[0], 0x0099, 0), nullptr);
+
+    // Client and server clusters with the same id are told apart by the mask, and the first one wins without a mask.
+    EXPECT_EQ(kLookup.FindCluster(&kEndpointTypes[0], 0x0028, MATTER_CLUSTER_FLAG_SERVER), &kClusters[2]);
+    EXPECT_EQ(kLookup.FindCluster(&kEndpointTypes[0], 0x0028, MATTER_CLUSTER_FLAG_CLIENT), &kClusters[1]);
+    EXPECT_EQ(kLookup.FindCluster(&kEndpointTypes[0], 0x0028, 0), &kClusters[1]);
+    EXPECT_EQ(kLookup.FindCluster(&kEndpointTypes[0], 0x0003, MATTER_CLUSTER_FLAG_CLIENT), nullptr);
+}
+
+TEST(TestAttributeStorageLookup, TestFindAttribute)
+{
+    using namespace SmallModel;
+
+    EXPECT_EQ(kLookup.FindAttribute(&kClusters[0], 0x0000), &kAttributes[0]);
+    EXPECT_EQ(kLookup.FindAttribute(&kClusters[0], 0x0001), &kAttributes[2]);
+    EXPECT_EQ(kLookup.FindAttribute(&kClusters[0], 0x4000), &kAttributes[1]);
+    EXPECT_EQ(kLookup.FindAttribute(&kClusters[0], 0xFFFD), &kAttributes[3]);
+    EXPECT_EQ(kLookup.FindAttribute(&kClusters[0], 0x0002), nullptr);
+    EXPECT_EQ(kLookup.FindAttribute(&kClusters[1], 0x0002), nullptr);
+    EXPECT_EQ(kLookup.FindAttribute(&kClusters[2], 0x0002), &kAttributes[5]);
+    EXPECT_EQ(kLookup.FindAttribute(&kClusters[2], 0x0005), &kAttributes[4]);
+    EXPECT_EQ(kLookup.FindAttribute(&kClusters[4], 0x0000), &kAttributes[7]);
+}
+
+TEST(TestAttributeStorageLookup, TestStorageOffsets)
+{
+    using namespace SmallModel;
+
+    EXPECT_EQ(kLookup.ClusterStorageOffset(&kClusters[0]), 0u);
+    EXPECT_EQ(kLookup.ClusterStorageOffset(&kClusters[1]), 7u);
+    EXPECT_EQ(kLookup.ClusterStorageOffset(&kClusters[2]), 7u);
+    EXPECT_EQ(kLookup.ClusterStorageOffset(&kClusters[3]), 17u);
+    EXPECT_EQ(kLookup.ClusterStorageOffset(&kClusters[4]), 0u);
+
+    // Externally stored attributes take no room in the attribute storage.
+    EXPECT_EQ(kLookup.AttributeStorageOffset(&kAttributes[0]), 0u);
+    EXPECT_EQ(kLookup.AttributeStorageOffset(&kAttributes[2]), 1u);
+    EXPECT_EQ(kLookup.AttributeStorageOffset(&kAttributes[3]), 5u);
+    EXPECT_EQ(kLookup.AttributeStorageOffset(&kAttributes[4]), 0u);
+    EXPECT_EQ(kLookup.AttributeStorageOffset(&kAttributes[5]), 8u);
+}
+
+TEST(TestAttributeStorageLookup, TestEndpointIndex)
+{
+    EndpointIndexLookup<8> lookup;
+    auto any = [](uint16_t) { return true; };
+
+    lookup.Set(0, 0);
+    lookup.Set(1, 1);
+    lookup.Set(2, 0xFFFE);
+    lookup.Set(3, 12);
+    EXPECT_EQ(lookup.Size(), 4u);
+    EXPECT_EQ(lookup.Find(0, any), 0u);
+    EXPECT_EQ(lookup.Find(12, any), 3u);
+    EXPECT_EQ(lookup.Find(0xFFFE, any), 2u);
+    EXPECT_EQ(lookup.Find(2, any), lookup.kInvalidIndex);
+
+    // The same id can be defined more than once: the lowest accepted index is found.
+    lookup.Set(5, 12);
+    EXPECT_EQ(lookup.Find(12, any), 3u);
+    EXPECT_EQ(lookup.Find(12, [](uint16_t index) { return index != 3; }), 5u);
+    EXPECT_EQ(lookup.Find(12, [](uint16_t) { return false; }), lookup.kInvalidIndex);
+
+    // Redefining or clearing an index replaces its previous id.
+    lookup.Set(3, 13);
+    EXPECT_EQ(lookup.Find(12, any), 5u);
+    EXPECT_EQ(lookup.Find(13, any), 3u);
+    lookup.Set(5, kInvalidEndpointId);
+    EXPECT_EQ(lookup.Find(12, any), lookup.kInvalidIndex);
+    EXPECT_EQ(lookup.Size(), 4u);
+
+    lookup.Clear();
+    EXPECT_EQ(lookup.Find(0, any), lookup.kInvalidIndex);
+}
+
+// A data model with the dimensions of the all-clusters-app: 4 endpoints, of 28, 73, 7 and 2 clusters, with 1029 attributes.
+namespace LargeModel {
+
+constexpr uint16_t kTypeClusterCounts[] = { 28, 73, 7, 2 };
+constexpr size_t kTypeCount             = MATTER_ARRAY_SIZE(kTypeClusterCounts);
+constexpr size_t kClusterCount          = 110;
+constexpr size_t kAttributeCount        = 1029;
+
+// The first 39 clusters have 10 attributes and the others 9.
+constexpr uint16_t AttributeCountOf(size_t cluster)
+{
+    return cluster < 39 ? 10 : 9;
+}
+
+constexpr size_t FirstAttributeOf(size_t cluster)
+{
+    return cluster < 39 ? cluster * 10 : 390 + (cluster - 39) * 9;
+}
+
+constexpr size_t ClusterOfAttribute(size_t attribute)
+{
+    return attribute < 390 ? attribute / 10 : 39 + (attribute - 390) / 9;
+}
+
+constexpr size_t FirstClusterOfType(size_t type)
+{
+    size_t first = 0;
+    for (size_t t = 0; t < type; t++)
+    {
+        first += kTypeClusterCounts[t];
+    }
+    return first;
+}
+
+constexpr size_t TypeOfCluster(size_t cluster)
+{
+    size_t type = 0;
+    while (cluster >= FirstClusterOfType(type + 1))
+    {
+        type++;
+    }
+    return type;
+}
+
+// Attribute ids are sorted but for the global attributes, as generated; one attribute in three is externally stored.
+constexpr EmberAfAttributeMetadata AttributeAt(size_t attribute)
+{
+    const size_t position = attribute - FirstAttributeOf(ClusterOfAttribute(attribute));
+    const size_t count    = AttributeCountOf(ClusterOfAttribute(attribute));
+    const AttributeId id =
+        position + 2 < count ? static_cast<AttributeId>(position) : static_cast<AttributeId>(0xFFFB + count - position);
+    return Attribute(id, static_cast<uint16_t>(1 + attribute % 4),
+                     attribute % 3 == 0 ? MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE : EmberAfAttributeMask(0));
+}
+
+template <size_t... kIndexes>
+constexpr std::array<EmberAfAttributeMetadata, kAttributeCount> MakeAttributes(std::index_sequence<kIndexes...>)
+{
+    return { { AttributeAt(kIndexes)... } };
+}
+
+constexpr std::array<EmberAfAttributeMetadata, kAttributeCount> kAttributes =
+    MakeAttributes(std::make_index_sequence<kAttributeCount>());
+
+constexpr uint16_t ClusterSizeOf(size_t cluster)
+{
+    uint16_t size = 0;
+    for (size_t a = FirstAttributeOf(cluster); a < FirstAttributeOf(cluster) + AttributeCountOf(cluster); a++)
+    {
+        if (!(kAttributes[a].mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+        {
+            size = static_cast<uint16_t>(size + kAttributes[a].size);
+        }
+    }
+    return size;
+}
+
+// Cluster ids are not in order within an endpoint type.
+constexpr EmberAfCluster ClusterAt(size_t cluster)
+{
+    const size_t position = cluster - FirstClusterOfType(TypeOfCluster(cluster));
+    return Cluster(static_cast<ClusterId>((position * 37 + 11) % 128), &kAttributes[FirstAttributeOf(cluster)],
+                   AttributeCountOf(cluster), ClusterSizeOf(cluster), MATTER_CLUSTER_FLAG_SERVER);
+}
+
+template <size_t... kIndexes>
+constexpr std::array<EmberAfCluster, kClusterCount> MakeClusters(std::index_sequence<kIndexes...>)
+{
+    return { { ClusterAt(kIndexes)... } };
+}
+
+constexpr std::array<EmberAfCluster, kClusterCount> kClusters = MakeClusters(std::make_index_sequence<kClusterCount>());
+
+constexpr uint16_t EndpointSizeOf(size_t type)
+{
+    uint16_t size = 0;
+    for (size_t c = FirstClusterOfType(type); c < FirstClusterOfType(type + 1); c++)
+    {
+        size = static_cast<uint16_t>(size + kClusters[c].clusterSize);
+    }
+    return size;
+}
+
+constexpr uint16_t EndpointOffsetOf(size_t type)
+{
+    uint16_t offset = 0;
+    for (size_t t = 0; t < type; t++)
+    {
+        offset = static_cast<uint16_t>(offset + EndpointSizeOf(t));
+    }
+    return offset;
+}
+
+template <size_t... kIndexes>
+constexpr std::array<EmberAfEndpointType, kTypeCount> MakeEndpointTypes(std::index_sequence<kIndexes...>)
+{
+    return { { { &kClusters[FirstClusterOfType(kIndexes)], static_cast<uint8_t>(kTypeClusterCounts[kIndexes]),
+                 EndpointSizeOf(kIndexes) }... } };
+}
+
+constexpr std::array<EmberAfEndpointType, kTypeCount> kEndpointTypes = MakeEndpointTypes(std::make_index_sequence<kTypeCount>());
+
+constexpr FixedMetadataLookup<kClusterCount, kAttributeCount> kLookup(kEndpointTypes.data(), kTypeCount, kClusters.data(),
+                                                                      kAttributes.data());
+
+// The scan emAfReadOrWriteAttribute() does without lookup tables: through the clusters and attributes of all the endpoints
+// stored before the one of the attribute, to find the attribute and its storage offset.
+const EmberAfAttributeMetadata * ScanForAttribute(size_t endpoint, ClusterId clusterId, AttributeId attributeId, uint16_t & offset)
+{
+    offset = 0;
+    for (size_t ep = 0; ep < kTypeCount; ep++)
+    {
+        const EmberAfEndpointType & type = kEndpointTypes[ep];
+        if (ep != endpoint)
+        {
+            offset = static_cast<uint16_t>(offset + type.endpointSize);
+            continue;
+        }
+        for (uint8_t c = 0; c < type.clusterCount; c++)
+        {
+            const EmberAfCluster & cluster = type.cluster[c];
+            if (cluster.clusterId != clusterId || !(cluster.mask & MATTER_CLUSTER_FLAG_SERVER))
+            {
+                offset = static_cast<uint16_t>(offset + cluster.clusterSize);
+                continue;
+            }
+            for (uint16_t a = 0; a < cluster.attributeCount; a++)
+            {
+                const EmberAfAttributeMetadata & attribute = cluster.attributes[a];
+                if (attribute.attributeId == attributeId)
+                {
+                    return &attribute;
+                }
+                if (!(attribute.mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+                {
+                    offset = static_cast<uint16_t>(offset + attribute.size);
+                }
+            }
+            return nullptr;
+        }
+        return nullptr;
+    }
+    return nullptr;
+}
+
+// The lookup emAfReadOrWriteAttribute() does with the tables, and the endpoint storage offsets computed when the endpoints
+// are configured.
+const EmberAfAttributeMetadata * LookUpAttribute(size_t endpoint, ClusterId clusterId, AttributeId attributeId, uint16_t & offset)
+{
+    static constexpr uint16_t kEndpointOffsets[] = { EndpointOffsetOf(0), EndpointOffsetOf(1), EndpointOffsetOf(2),
+                                                     EndpointOffsetOf(3) };
+    offset = kEndpointOffsets[endpoint];
+    const EmberAfCluster * cluster = kLookup.FindCluster(&kEndpointTypes[endpoint], clusterId, MATTER_CLUSTER_FLAG_SERVER);
+    VerifyOrReturnValue(cluster != nullptr, nullptr);
+    const EmberAfAttributeMetadata * attribute = kLookup.FindAttribute(cluster, attributeId);
+    VerifyOrReturnValue(attribute != nullptr, nullptr);
+    offset = static_cast<uint16_t>(offset + kLookup.ClusterStorageOffset(cluster) + kLookup.AttributeStorageOffset(attribute));
+    return attribute;
+}
+
+} // namespace LargeModel
+
+TEST(TestAttributeStorageLookup, TestLargeModelMatchesScan)
+{
+    using namespace LargeModel;
+
+    for (size_t a = 0; a < kAttributeCount; a++)
+    {
+        const size_t cluster = ClusterOfAttribute(a);
+        const size_t type    = TypeOfCluster(cluster);
+        uint16_t scanOffset, lookupOffset;
+        const EmberAfAttributeMetadata * scanned =
+            ScanForAttribute(type, kClusters[cluster].clusterId, kAttributes[a].attributeId, scanOffset);
+        EXPECT_EQ(scanned, &kAttributes[a]);
+        EXPECT_EQ(LookUpAttribute(type, kClusters[cluster].clusterId, kAttributes[a].attributeId, lookupOffset), scanned);
+        EXPECT_EQ(lookupOffset, scanOffset);
+    }
+
+    uint16_t offset;
+    EXPECT_EQ(LookUpAttribute(0, kClusters[0].clusterId, 0x1234, offset), nullptr);
+    EXPECT_EQ(LookUpAttribute(3, kClusters[2].clusterId, 0, offset), nullptr);
+}
+
+TEST(TestAttributeStorageLookup, AttributeLookupBenchmark)
+{
+    using namespace LargeModel;
+
+    // Look every attribute of the data model up, as a read of all the attributes of the node does.
+    struct Path
+    {
+        size_t endpoint;
+        ClusterId clusterId;
+        AttributeId attributeId;
+    };
+    std::vector<Path> paths;
+    for (size_t a = 0; a < kAttributeCount; a++)
+    {
+        const size_t cluster = ClusterOfAttribute(a);
+        paths.push_back({ TypeOfCluster(cluster), kClusters[cluster].clusterId, kAttributes[a].attributeId });
+    }
+
+    constexpr size_t kIterations = 200;
+    for (bool useLookup : { false, true })
+    {
+        size_t found = 0;
+        auto start   = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            for (const Path & path : paths)
+            {
+                uint16_t offset;
+                const EmberAfAttributeMetadata * attribute = useLookup
+                    ? LookUpAttribute(path.endpoint, path.clusterId, path.attributeId, offset)
+                    : ScanForAttribute(path.endpoint, path.clusterId, path.attributeId, offset);
+                found += (attribute != nullptr) ? 1 : 0;
+            }
+        }
+        auto elapsedUs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+        EXPECT_EQ(found, kIterations * kAttributeCount);
+
+        ChipLogProgress(Test, "%s: %u attribute lookups in %u us (%u ns per lookup)", useLookup ? "lookup tables" : "linear scan",
+                        static_cast<unsigned>(found), static_cast<unsigned>(elapsedUs),
+                        static_cast<unsigned>(elapsedUs * 1000 / found));
+    }
+}
+
+} // namespace
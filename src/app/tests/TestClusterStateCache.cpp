@@ -16,9 +16,14 @@
  *    limitations under the License.
  */
 
+#include <algorithm>
 #include <string.h>
 #include <vector>
 
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
 #include "app-common/zap-generated/ids/Attributes.h"
 #include "app-common/zap-generated/ids/Clusters.h"
 #include "lib/core/TLVTags.h"
@@ -34,6 +39,7 @@
 #include <app/tests/AppTestContext.h>
 #include <lib/support/ScopedBuffer.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
+#include <system/SystemClock.h>
 
 #include <lib/core/StringBuilderAdapters.h>
 #include <pw_unit_test/framework.h>
@@ -830,4 +836,410 @@ TEST_F(TestClusterStateCache, TestCache)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+TEST(TestClusterStateCacheStorage, TestFlatMap)
+{
+    app::detail::FlatMap<uint32_t, uint32_t> map;
+    EXPECT_TRUE(map.empty());
+
+    // In order, out of order and repeated insertions.
+    for (uint32_t key : { 10u, 20u, 30u, 15u, 5u, 20u })
+    {
+        map[key] = key * 2;
+    }
+    EXPECT_EQ(map.size(), 5u);
+
+    uint32_t previousKey = 0;
+    for (auto & entry : map)
+    {
+        EXPECT_GT(entry.first, previousKey);
+        EXPECT_EQ(entry.second, entry.first * 2);
+        previousKey = entry.first;
+    }
+
+    EXPECT_NE(map.find(15), map.end());
+    EXPECT_EQ(map.find(16), map.end());
+    EXPECT_EQ(map.erase(15), 1u);
+    EXPECT_EQ(map.erase(15), 0u);
+    EXPECT_EQ(map.find(15), map.end());
+    EXPECT_EQ(map.size(), 4u);
+}
+
+TEST(TestClusterStateCacheStorage, TestPayloadArena)
+{
+    ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+    {
+        app::detail::PayloadArena arena;
+        uint8_t buffer[600];
+
+        // Stores a byte string of `length` bytes of `fill`, returning the length of its TLV encoding.
+        auto store = [&](size_t length, uint8_t fill, const app::detail::PayloadArena::Slice * previous,
+                         app::detail::PayloadArena::Slice & slice) {
+            std::vector<uint8_t> bytes(length, fill);
+            TLV::TLVWriter writer;
+            writer.Init(buffer);
+            EXPECT_EQ(writer.PutBytes(TLV::ProfileTag(0x1234u, 1), bytes.data(), static_cast<uint32_t>(length)), CHIP_NO_ERROR);
+            TLV::TLVReader reader;
+            reader.Init(buffer, writer.GetLengthWritten());
+            EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+            EXPECT_EQ(arena.Store(reader, previous, slice), CHIP_NO_ERROR);
+        };
+        auto check = [&](const app::detail::PayloadArena::Slice & slice, size_t length, uint8_t fill) {
+            TLV::TLVReader reader;
+            reader.Init(arena.Get(slice));
+            ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+            EXPECT_EQ(reader.GetTag(), TLV::AnonymousTag());
+            ByteSpan bytes;
+            ASSERT_EQ(reader.Get(bytes), CHIP_NO_ERROR);
+            ASSERT_EQ(bytes.size(), length);
+            EXPECT_TRUE(std::all_of(bytes.begin(), bytes.end(), [fill](uint8_t byte) { return byte == fill; }));
+        };
+
+        app::detail::PayloadArena::Slice slices[20];
+        for (uint8_t i = 0; i < 20; i++)
+        {
+            store(500, i, nullptr, slices[i]);
+        }
+        size_t liveBytes     = arena.LiveBytes();
+        uint32_t sliceLength = slices[0].mLength;
+
+        // Smaller values are written in place, larger ones are appended.
+        app::detail::PayloadArena::Slice shrunk;
+        store(100, 0xAA, &slices[0], shrunk);
+        EXPECT_EQ(shrunk.mOffset, slices[0].mOffset);
+        slices[0] = shrunk;
+        app::detail::PayloadArena::Slice grown;
+        store(550, 0xBB, &slices[1], grown);
+        EXPECT_GT(grown.mOffset, slices[19].mOffset);
+        slices[1] = grown;
+        EXPECT_EQ(arena.LiveBytes(), liveBytes - 2 * sliceLength + shrunk.mLength + grown.mLength);
+        check(slices[0], 100, 0xAA);
+        check(slices[1], 550, 0xBB);
+        EXPECT_FALSE(arena.NeedsCompaction());
+
+        for (uint8_t i = 2; i < 15; i++)
+        {
+            arena.Release(slices[i]);
+        }
+        EXPECT_TRUE(arena.NeedsCompaction());
+
+        size_t capacity = arena.Capacity();
+        auto forEachSlice = [&](auto && function) {
+            function(slices[0]);
+            function(slices[1]);
+            for (uint8_t i = 15; i < 20; i++)
+            {
+                function(slices[i]);
+            }
+        };
+        EXPECT_EQ(arena.Compact(forEachSlice), CHIP_NO_ERROR);
+        EXPECT_FALSE(arena.NeedsCompaction());
+        EXPECT_LT(arena.Capacity(), capacity);
+        EXPECT_EQ(arena.Capacity(), arena.LiveBytes());
+        check(slices[0], 100, 0xAA);
+        check(slices[1], 550, 0xBB);
+        for (uint8_t i = 15; i < 20; i++)
+        {
+            check(slices[i], 500, i);
+        }
+
+        arena.Clear();
+        EXPECT_EQ(arena.Capacity(), 0u);
+        EXPECT_EQ(arena.LiveBytes(), 0u);
+    }
+    Platform::MemoryShutdown();
+}
+
+// Attribute data or status, pre-encoded so that feeding it to a cache only measures the cache.
+struct EncodedAttribute
+{
+    ConcreteDataAttributePath mPath;
+    std::vector<uint8_t> mValue; // Empty for a failure status
+};
+
+EncodedAttribute EncodeOctetString(const ConcreteDataAttributePath & path, size_t length, uint8_t fill)
+{
+    EncodedAttribute attribute{ path, std::vector<uint8_t>(length + 16) };
+    std::vector<uint8_t> bytes(length, fill);
+    TLV::TLVWriter writer;
+    writer.Init(attribute.mValue.data(), attribute.mValue.size());
+    EXPECT_EQ(writer.PutBytes(TLV::AnonymousTag(), bytes.data(), static_cast<uint32_t>(length)), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    attribute.mValue.resize(writer.GetLengthWritten());
+    return attribute;
+}
+
+EncodedAttribute EncodeUnsigned(const ConcreteDataAttributePath & path, uint32_t value)
+{
+    EncodedAttribute attribute{ path, std::vector<uint8_t>(16) };
+    TLV::TLVWriter writer;
+    writer.Init(attribute.mValue.data(), attribute.mValue.size());
+    EXPECT_EQ(writer.Put(TLV::AnonymousTag(), value), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    attribute.mValue.resize(writer.GetLengthWritten());
+    return attribute;
+}
+
+EncodedAttribute EncodeList(ConcreteDataAttributePath path, size_t count, uint16_t first)
+{
+    path.mListOp = ConcreteDataAttributePath::ListOperation::ReplaceAll;
+    EncodedAttribute attribute{ path, std::vector<uint8_t>(8 + 4 * count) };
+    TLV::TLVWriter writer;
+    writer.Init(attribute.mValue.data(), attribute.mValue.size());
+    TLV::TLVType outerType;
+    EXPECT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerType), CHIP_NO_ERROR);
+    for (size_t i = 0; i < count; i++)
+    {
+        EXPECT_EQ(writer.Put(TLV::AnonymousTag(), static_cast<uint16_t>(first + i)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(writer.EndContainer(outerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    attribute.mValue.resize(writer.GetLengthWritten());
+    return attribute;
+}
+
+template <typename Cache>
+void FeedReport(Cache & cache, const std::vector<EncodedAttribute> & report)
+{
+    ReadClient::Callback & callback = cache.GetBufferedCallback();
+    callback.OnReportBegin();
+    for (const auto & attribute : report)
+    {
+        if (attribute.mValue.empty())
+        {
+            callback.OnAttributeData(attribute.mPath, nullptr, StatusIB(Protocols::InteractionModel::Status::Failure));
+            continue;
+        }
+
+        TLV::TLVReader reader;
+        reader.Init(attribute.mValue.data(), attribute.mValue.size());
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        callback.OnAttributeData(attribute.mPath, &reader, StatusIB());
+    }
+    callback.OnReportEnd();
+}
+
+// Claim a wildcard subscription to the cache, so that it tracks data versions, and returns whether any filter was encoded.
+template <typename Cache>
+bool UpdateDataVersionFilters(Cache & cache, size_t bufferSize)
+{
+    AttributePathParams wildcardPath;
+    const Span<AttributePathParams> pathSpan(&wildcardPath, 1);
+    std::vector<uint8_t> buffer(bufferSize);
+    TLV::TLVWriter writer;
+    writer.Init(buffer.data(), buffer.size());
+    DataVersionFilterIBs::Builder builder;
+    EXPECT_EQ(builder.Init(&writer), CHIP_NO_ERROR);
+    bool encodedDataVersionList = false;
+    EXPECT_EQ(cache.GetBufferedCallback().OnUpdateDataVersionFilterList(builder, pathSpan, encodedDataVersionList),
+              CHIP_NO_ERROR);
+    return encodedDataVersionList;
+}
+
+template <bool UseFlatStorage>
+class StorageTestCallback : public ClusterStateCacheT<true, UseFlatStorage>::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+template <bool UseFlatStorage>
+struct StorageTestCache
+{
+    StorageTestCallback<UseFlatStorage> mCallback;
+    ClusterStateCacheT<true, UseFlatStorage> mCache{ mCallback };
+};
+
+template <typename Cache>
+void ExpectSameAttributes(Cache & cache, const ClusterStateCacheT<true, false> & reference)
+{
+    size_t count = 0;
+    EXPECT_SUCCESS(reference.ForEachAttribute([&](const ConcreteAttributePath & path) {
+        count++;
+        TLV::TLVReader expected;
+        TLV::TLVReader actual;
+        CHIP_ERROR err = reference.Get(path, expected);
+        EXPECT_EQ(cache.Get(path, actual), err);
+        if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
+        {
+            StatusIB status;
+            EXPECT_EQ(cache.GetStatus(path, status), CHIP_NO_ERROR);
+            return CHIP_NO_ERROR;
+        }
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        EXPECT_EQ(actual.GetType(), expected.GetType());
+        if (expected.GetType() == TLV::kTLVType_ByteString)
+        {
+            ByteSpan expectedBytes;
+            ByteSpan actualBytes;
+            EXPECT_EQ(expected.Get(expectedBytes), CHIP_NO_ERROR);
+            EXPECT_EQ(actual.Get(actualBytes), CHIP_NO_ERROR);
+            EXPECT_TRUE(actualBytes.data_equal(expectedBytes));
+        }
+        return CHIP_NO_ERROR;
+    }));
+
+    size_t actualCount = 0;
+    EXPECT_SUCCESS(cache.ForEachAttribute([&](const ConcreteAttributePath &) {
+        actualCount++;
+        return CHIP_NO_ERROR;
+    }));
+    EXPECT_EQ(actualCount, count);
+}
+
+TEST_F(TestClusterStateCache, TestFlatStorageUpdates)
+{
+    constexpr EndpointId kEndpoints   = 20;
+    constexpr AttributeId kAttributes = 8;
+
+    StorageTestCache<false> reference;
+    StorageTestCache<true> flat;
+    UpdateDataVersionFilters(reference.mCache, 200);
+    UpdateDataVersionFilters(flat.mCache, 200);
+
+    // Values of varying sizes, so that they get written in place or appended and the payload buffer gets compacted,
+    // turning into statuses and back.
+    for (uint32_t round = 0; round < 40; round++)
+    {
+        std::vector<EncodedAttribute> report;
+        for (EndpointId endpoint = 1; endpoint <= kEndpoints; endpoint++)
+        {
+            for (AttributeId attribute = 0; attribute < kAttributes; attribute++)
+            {
+                ConcreteDataAttributePath path(endpoint, Clusters::UnitTesting::Id, attribute);
+                path.mDataVersion.SetValue(round);
+                size_t length = (round * 37 + endpoint * 11 + attribute * 5) % 300;
+                if ((round + endpoint + attribute) % 17 == 0)
+                {
+                    report.push_back(EncodedAttribute{ path, {} });
+                }
+                else
+                {
+                    report.push_back(EncodeOctetString(path, length, static_cast<uint8_t>(round + attribute)));
+                }
+            }
+        }
+
+        FeedReport(reference.mCache, report);
+        FeedReport(flat.mCache, report);
+        ExpectSameAttributes(flat.mCache, reference.mCache);
+
+        if (round % 10 == 9)
+        {
+            auto endpoint = static_cast<EndpointId>(1 + round % kEndpoints);
+            auto clear    = [endpoint](auto & cache) {
+                cache.ClearAttribute(ConcreteAttributePath(endpoint, Clusters::UnitTesting::Id, 0));
+                cache.ClearAttributes(ConcreteClusterPath(static_cast<EndpointId>(endpoint + 1), Clusters::UnitTesting::Id));
+                cache.ClearAttributes(static_cast<EndpointId>(endpoint + 2));
+            };
+            clear(reference.mCache);
+            clear(flat.mCache);
+            ExpectSameAttributes(flat.mCache, reference.mCache);
+        }
+    }
+
+    for (EndpointId endpoint = 1; endpoint <= kEndpoints; endpoint++)
+    {
+        Optional<DataVersion> expectedVersion;
+        Optional<DataVersion> version;
+        EXPECT_EQ(flat.mCache.GetVersion(ConcreteClusterPath(endpoint, Clusters::UnitTesting::Id), version),
+                  reference.mCache.GetVersion(ConcreteClusterPath(endpoint, Clusters::UnitTesting::Id), expectedVersion));
+        EXPECT_EQ(version, expectedVersion);
+    }
+}
+
+/*
+ * Compares the memory footprint and report ingestion speed of the two storage modes, caching a bridge with 100
+ * bridged endpoints.
+ */
+TEST_F(TestClusterStateCache, TestBridgeBenchmark)
+{
+    constexpr EndpointId kEndpoints            = 100;
+    constexpr ClusterId kClusters[]            = { 0x0003, 0x0006, 0x0008, 0x001D, 0x0039, 0x0300 };
+    constexpr AttributeId kAttributesPerCluster = 12;
+    constexpr uint32_t kUpdateReports          = 10;
+
+    // The priming report holds every attribute, each update report a new value for a third of them.
+    auto makeReport = [&](uint32_t round) {
+        std::vector<EncodedAttribute> report;
+        for (EndpointId endpoint = 1; endpoint <= kEndpoints; endpoint++)
+        {
+            for (ClusterId cluster : kClusters)
+            {
+                for (AttributeId attribute = 0; attribute < kAttributesPerCluster; attribute++)
+                {
+                    if (round > 0 && (attribute + round) % 3 != 0)
+                    {
+                        continue;
+                    }
+
+                    ConcreteDataAttributePath path(endpoint, cluster, attribute);
+                    path.mDataVersion.SetValue(round);
+                    switch (attribute % 4)
+                    {
+                    case 0:
+                    case 1:
+                        report.push_back(EncodeUnsigned(path, round * 1000 + attribute));
+                        break;
+                    case 2:
+                        report.push_back(EncodeOctetString(path, 8 + (round * 7 + attribute) % 24, static_cast<uint8_t>(round)));
+                        break;
+                    default:
+                        report.push_back(EncodeList(path, 2 + (round + attribute) % 6, static_cast<uint16_t>(round)));
+                        break;
+                    }
+                }
+            }
+        }
+        return report;
+    };
+
+    std::vector<EncodedAttribute> primingReport = makeReport(0);
+    std::vector<std::vector<EncodedAttribute>> updateReports;
+    size_t updatedAttributes = 0;
+    for (uint32_t round = 1; round <= kUpdateReports; round++)
+    {
+        updateReports.push_back(makeReport(round));
+        updatedAttributes += updateReports.back().size();
+    }
+
+    auto run = [&](auto & testCache, const char * name) {
+        auto & cache = testCache.mCache;
+        UpdateDataVersionFilters(cache, 1200);
+
+#if defined(__GLIBC__)
+        struct mallinfo before = mallinfo();
+#endif
+        System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        FeedReport(cache, primingReport);
+        System::Clock::Microseconds64 primed = System::SystemClock().GetMonotonicMicroseconds64();
+#if defined(__GLIBC__)
+        struct mallinfo after = mallinfo();
+        ChipLogProgress(Test, "%s: %u attributes cached in %d bytes of heap", name, static_cast<unsigned>(primingReport.size()),
+                        after.uordblks - before.uordblks);
+#endif
+
+        for (const auto & report : updateReports)
+        {
+            FeedReport(cache, report);
+        }
+        System::Clock::Microseconds64 updated = System::SystemClock().GetMonotonicMicroseconds64();
+
+        EXPECT_TRUE(UpdateDataVersionFilters(cache, 1200));
+        System::Clock::Microseconds64 filtered = System::SystemClock().GetMonotonicMicroseconds64();
+
+        ChipLogProgress(Test, "%s: priming %u us (%u attributes/ms), updates %u us (%u attributes/ms), data version filters %u us",
+                        name, static_cast<unsigned>((primed - start).count()),
+                        static_cast<unsigned>(primingReport.size() * 1000 / std::max<uint64_t>((primed - start).count(), 1)),
+                        static_cast<unsigned>((updated - primed).count()),
+                        static_cast<unsigned>(updatedAttributes * 1000 / std::max<uint64_t>((updated - primed).count(), 1)),
+                        static_cast<unsigned>((filtered - updated).count()));
+    };
+
+    StorageTestCache<false> mapCache;
+    run(mapCache, "std::map storage");
+    StorageTestCache<true> flatCache;
+    run(flatCache, "flat storage");
+
+    ExpectSameAttributes(flatCache.mCache, mapCache.mCache);
+}
+
 } // namespace
@@ -0,0 +1,131 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/DirtyPathIndex.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <pw_unit_test/framework.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+namespace {
+
+class TestDirtyPathIndex : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestDirtyPathIndex, TestConcretePaths)
+{
+    DirtyPathIndex index(64);
+
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 6, 0)), 0u);
+
+    EXPECT_EQ(index.Insert(AttributePathParams(1, 6, 0), 10), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert(AttributePathParams(1, 8, 0), 11), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert(AttributePathParams(2, 6, 0), 12), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Size(), 3u);
+
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 6, 0)), 10u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 8, 0)), 11u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(2, 6, 0)), 12u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 6, 1)), 0u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(2, 8, 0)), 0u);
+
+    // Marking the same path again only updates its generation; list indexes are ignored.
+    EXPECT_EQ(index.Insert(AttributePathParams(1, 6, 0, 3), 13), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Size(), 3u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 6, 0)), 13u);
+
+    index.Clear();
+    EXPECT_EQ(index.Size(), 0u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 6, 0)), 0u);
+}
+
+TEST_F(TestDirtyPathIndex, TestWildcardPaths)
+{
+    DirtyPathIndex index(64);
+
+    EXPECT_EQ(index.Insert(AttributePathParams(1, 6, 0), 10), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert(AttributePathParams(1, 8, kInvalidAttributeId), 11), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert(AttributePathParams(kInvalidEndpointId, 0x1d, kInvalidAttributeId), 12), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert(AttributePathParams(kInvalidEndpointId, kInvalidClusterId, 0xfffd), 13), CHIP_NO_ERROR);
+
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 6, 0)), 10u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 8, 0)), 11u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 8, 0x4000)), 11u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(2, 8, 0)), 0u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(0, 0x1d, 3)), 12u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(7, 0x1d, 0)), 12u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(7, 0x1e, 0)), 0u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 6, 0xfffd)), 13u);
+
+    // The most recent of all the paths including the concrete path wins.
+    EXPECT_EQ(index.Insert(AttributePathParams(1, kInvalidClusterId, kInvalidAttributeId), 14), CHIP_NO_ERROR);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 6, 0)), 14u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 0x1d, 0)), 14u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(2, 0x1d, 0)), 12u);
+
+    EXPECT_EQ(index.Insert(AttributePathParams(), 15), CHIP_NO_ERROR);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(2, 6, 1)), 15u);
+    EXPECT_EQ(index.Size(), 6u);
+}
+
+TEST_F(TestDirtyPathIndex, TestFull)
+{
+    constexpr size_t kMaxEntries = 100;
+    DirtyPathIndex index(kMaxEntries);
+
+    for (AttributeId attribute = 0; attribute < kMaxEntries; attribute++)
+    {
+        EXPECT_EQ(index.Insert(AttributePathParams(1, 6, attribute), attribute + 1), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(index.Insert(AttributePathParams(1, 6, kMaxEntries), 1000), CHIP_ERROR_NO_MEMORY);
+    // Paths already present can still be updated.
+    EXPECT_EQ(index.Insert(AttributePathParams(1, 6, 0), 1001), CHIP_NO_ERROR);
+
+    EXPECT_EQ(index.Size(), kMaxEntries);
+    for (AttributeId attribute = 1; attribute < kMaxEntries; attribute++)
+    {
+        EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 6, attribute)), attribute + 1);
+    }
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 6, 0)), 1001u);
+    EXPECT_EQ(index.GetGeneration(ConcreteAttributePath(1, 6, kMaxEntries)), 0u);
+
+    size_t count = 0;
+    index.ForEach([&](const AttributePathParams & path, uint64_t generation) {
+        EXPECT_EQ(path.mEndpointId, 1);
+        EXPECT_EQ(path.mClusterId, 6u);
+        count++;
+        return Loop::Continue;
+    });
+    EXPECT_EQ(count, kMaxEntries);
+
+    index.Clear();
+    EXPECT_EQ(index.Insert(AttributePathParams(1, 6, kMaxEntries), 1002), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Size(), 1u);
+}
+
+} // namespace
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,152 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/EventBufferIndex.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+namespace chip {
+namespace app {
+namespace {
+
+constexpr uint32_t kTargetBlocks = (CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0) ? CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS : 1;
+constexpr uint32_t kBufferLength = 100 * kTargetBlocks;
+constexpr uint32_t kEventLength  = 30;
+
+struct IndexSummary
+{
+    size_t mBlocks         = 0;
+    size_t mEvents         = 0;
+    uint32_t mLength       = 0;
+    EventNumber mLastEvent = 0;
+};
+
+IndexSummary Summarize(const EventBufferIndex & index)
+{
+    IndexSummary summary;
+    index.ForEachBlock([&](const EventBufferIndex::Block & block) {
+        EXPECT_GT(block.mEventCount, 0u);
+        EXPECT_GE(block.mLastEventNumber, summary.mLastEvent);
+        summary.mBlocks++;
+        summary.mEvents += block.mEventCount;
+        summary.mLength += block.mLength;
+        summary.mLastEvent = block.mLastEventNumber;
+        return Loop::Continue;
+    });
+    return summary;
+}
+
+TEST(TestEventBufferIndex, TestAppendAndRemove)
+{
+    EventBufferIndex index;
+    index.Reset(kBufferLength);
+    EXPECT_EQ(index.GetLength(), 0u);
+    EXPECT_EQ(index.GetBlockCount(), 0u);
+
+    // Fill the buffer, then keep it full by removing the oldest event for every new one.
+    const EventNumber fullCount = kBufferLength / kEventLength;
+    for (EventNumber number = 1; number <= 10 * fullCount; number++)
+    {
+        if (number > fullCount)
+        {
+            index.RemoveHead(kEventLength);
+        }
+        index.Append(number, kEventLength, 1, 6);
+
+        IndexSummary summary = Summarize(index);
+        EXPECT_EQ(summary.mLength, index.GetLength());
+        EXPECT_EQ(summary.mBlocks, index.GetBlockCount());
+        EXPECT_EQ(summary.mLastEvent, number);
+        EXPECT_LE(summary.mBlocks, static_cast<size_t>(kTargetBlocks + 2));
+    }
+    EXPECT_EQ(index.GetLength(), fullCount * kEventLength);
+    EXPECT_EQ(Summarize(index).mEvents, fullCount);
+
+    for (EventNumber number = 0; number < fullCount; number++)
+    {
+        index.RemoveHead(kEventLength);
+    }
+    EXPECT_EQ(index.GetLength(), 0u);
+    EXPECT_EQ(index.GetBlockCount(), 0u);
+
+    // Removing from an empty index is harmless.
+    index.RemoveHead(kEventLength);
+    EXPECT_EQ(index.GetLength(), 0u);
+}
+
+TEST(TestEventBufferIndex, TestMayContain)
+{
+    EventBufferIndex index;
+    index.Reset(kBufferLength);
+
+    index.Append(1, kEventLength, 1, 6);
+    index.Append(2, kEventLength, 2, 8);
+
+    const EventBufferIndex::Block * first = nullptr;
+    index.ForEachBlock([&](const EventBufferIndex::Block & block) {
+        first = &block;
+        return Loop::Break;
+    });
+    ASSERT_NE(first, nullptr);
+
+    EXPECT_TRUE(first->MayContain(EventPathParams(1, 6, 0)));
+    EXPECT_TRUE(first->MayContain(EventPathParams(2, 8, 1)));
+    EXPECT_TRUE(first->MayContain(EventPathParams(kInvalidEndpointId, 6, 0)));
+    EXPECT_TRUE(first->MayContain(EventPathParams(1, kInvalidClusterId, kInvalidEventId)));
+    EXPECT_TRUE(first->MayContain(EventPathParams()));
+
+    // Both bitmaps must match; these ids happen to hash to other bits than those recorded above.
+    EXPECT_FALSE(first->MayContain(EventPathParams(3, 6, 0)));
+    EXPECT_FALSE(first->MayContain(EventPathParams(1, 0x28, 0)));
+    EXPECT_FALSE(first->MayContain(EventPathParams(kInvalidEndpointId, 0x28, kInvalidEventId)));
+}
+
+TEST(TestEventBufferIndex, TestSkipByEventNumber)
+{
+    EventBufferIndex index;
+    index.Reset(kBufferLength);
+
+    constexpr EventNumber kEventCount = kBufferLength / kEventLength;
+    for (EventNumber number = 1; number <= kEventCount; number++)
+    {
+        index.Append(number, kEventLength, 1, 6);
+    }
+
+    // The blocks holding only events older than the one requested can be skipped without decoding them.
+    constexpr EventNumber kStartingEventNumber = kEventCount * 2 / 3;
+    uint32_t skippedLength                     = 0;
+    EventNumber firstEventRead                 = 0;
+    index.ForEachBlock([&](const EventBufferIndex::Block & block) {
+        if (block.mLastEventNumber < kStartingEventNumber)
+        {
+            skippedLength += block.mLength;
+            return Loop::Continue;
+        }
+        firstEventRead = block.mLastEventNumber - block.mEventCount + 1;
+        return Loop::Break;
+    });
+    EXPECT_LE(firstEventRead, kStartingEventNumber);
+    EXPECT_EQ(skippedLength, (firstEventRead - 1) * kEventLength);
+    // Blocks hold about 1/kTargetBlocks of the buffer.
+    EXPECT_GT(firstEventRead + kBufferLength / kTargetBlocks / kEventLength + 1, kStartingEventNumber);
+}
+
+} // namespace
+} // namespace app
+} // namespace chip
@@ -32,11 +32,13 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/EnforceFormat.h>
 #include <lib/support/LinkedList.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/logging/Constants.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/Flags.h>
 #include <platform/CHIPDeviceLayer.h>
+#include <system/SystemClock.h>
 #include <system/TLVPacketBufferBackingStore.h>
 
 #include <lib/core/StringBuilderAdapters.h>
@@ -288,4 +290,120 @@ TEST_F(TestEventLogging, TestCheckLogEventWithDiscardLowEvent)
     CheckLogState(logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
 
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+struct FetchResult
+{
+    size_t mEventCount          = 0;
+    size_t mReportCount         = 0;
+    chip::EventNumber mEventMin = 0;
+    uint64_t mMicroseconds      = 0;
+};
+
+// Fetch all the events from startingEventNumber the way the reporting engine does, in 1 KiB reports.
+FetchResult FetchAllEvents(chip::app::EventManagement & logMgmt, chip::EventNumber startingEventNumber,
+                           const chip::SingleLinkedListNode<chip::app::EventPathParams> * paths)
+{
+    FetchResult result;
+    uint8_t report[1024];
+    size_t eventCount = 0;
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    result.mEventMin = startingEventNumber;
+    auto start       = chip::System::SystemClock().GetMonotonicMicroseconds64();
+    do
+    {
+        chip::TLV::TLVWriter writer;
+        writer.Init(report, sizeof(report));
+        eventCount = 0;
+        err        = logMgmt.FetchEventsSince(writer, paths, result.mEventMin, eventCount, chip::Access::SubjectDescriptor{});
+        result.mEventCount += eventCount;
+        result.mReportCount++;
+    } while ((err == CHIP_ERROR_BUFFER_TOO_SMALL || err == CHIP_ERROR_NO_MEMORY) && eventCount > 0);
+    result.mMicroseconds = (chip::System::SystemClock().GetMonotonicMicroseconds64() - start).count();
+
+    EXPECT_TRUE(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+    return result;
+}
+
+TEST_F(TestEventLogging, TestFetchEventsBenchmark)
+{
+    constexpr uint32_t kBufferSizes[] = { 4 * 1024, 32 * 1024, 256 * 1024 };
+    TestEventGenerator testEventGenerator;
+
+    for (uint32_t bufferSize : kBufferSizes)
+    {
+        chip::Platform::ScopedMemoryBuffer<uint8_t> debugBuffer;
+        chip::Platform::ScopedMemoryBuffer<uint8_t> infoBuffer;
+        chip::Platform::ScopedMemoryBuffer<uint8_t> critBuffer;
+        ASSERT_TRUE(debugBuffer.Alloc(bufferSize));
+        ASSERT_TRUE(infoBuffer.Alloc(bufferSize));
+        ASSERT_TRUE(critBuffer.Alloc(bufferSize));
+
+        const chip::app::LogStorageResources logStorageResources[] = {
+            { debugBuffer.Get(), bufferSize, chip::app::PriorityLevel::Debug },
+            { infoBuffer.Get(), bufferSize, chip::app::PriorityLevel::Info },
+            { critBuffer.Get(), bufferSize, chip::app::PriorityLevel::Critical },
+        };
+        chip::app::CircularEventBuffer circularEventBuffer[3];
+        chip::MonotonicallyIncreasingCounter<chip::EventNumber> eventCounter;
+        ASSERT_EQ(eventCounter.Init(0), CHIP_NO_ERROR);
+
+        chip::app::EventManagement::DestroyEventManagement();
+        chip::app::EventManagement::CreateEventManagement(&GetExchangeManager(), MATTER_ARRAY_SIZE(logStorageResources),
+                                                          circularEventBuffer, logStorageResources, &eventCounter);
+        chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+        // Overflow all the buffers with critical events, logged in bursts of 64 events on the first endpoint followed
+        // by one burst on the second endpoint, so that the events move through every buffer.
+        chip::app::EventOptions options;
+        options.mPriority = chip::app::PriorityLevel::Critical;
+        chip::EventNumber lastEventNumber = 0;
+        for (uint32_t i = 0; i < bufferSize / 4; i++)
+        {
+            chip::EndpointId endpoint = ((i / 64) % 8 == 7) ? kTestEndpointId2 : kTestEndpointId1;
+            options.mPath             = { endpoint, kLivenessClusterId, kLivenessChangeEvent };
+            testEventGenerator.SetStatus(static_cast<int32_t>(i));
+            ASSERT_EQ(logMgmt.LogEvent(&testEventGenerator, options, lastEventNumber), CHIP_NO_ERROR);
+        }
+
+        // A subscription catching up on the latest events, and a read of all the events of the second endpoint.
+        chip::SingleLinkedListNode<chip::app::EventPathParams> wildcardPath;
+        chip::SingleLinkedListNode<chip::app::EventPathParams> endpointPath;
+        endpointPath.mValue.mEndpointId = kTestEndpointId2;
+        endpointPath.mValue.mClusterId  = kLivenessClusterId;
+
+        const struct
+        {
+            const char * mName;
+            chip::EventNumber mStartingEventNumber;
+            const chip::SingleLinkedListNode<chip::app::EventPathParams> * mPaths;
+        } kScenarios[] = {
+            { "latest 16 events", lastEventNumber - 15, &wildcardPath },
+            { "all events of one endpoint", 0, &endpointPath },
+        };
+
+        for (const auto & scenario : kScenarios)
+        {
+            logMgmt.SetEventIndexEnabled(false);
+            FetchResult scan = FetchAllEvents(logMgmt, scenario.mStartingEventNumber, scenario.mPaths);
+            logMgmt.SetEventIndexEnabled(true);
+            FetchResult indexed = FetchAllEvents(logMgmt, scenario.mStartingEventNumber, scenario.mPaths);
+
+            EXPECT_GT(scan.mEventCount, 0u);
+            EXPECT_EQ(indexed.mEventCount, scan.mEventCount);
+            EXPECT_EQ(indexed.mReportCount, scan.mReportCount);
+            EXPECT_EQ(indexed.mEventMin, scan.mEventMin);
+
+            ChipLogProgress(Test, "%u KiB buffers, %s: %u events in %u reports, scan %u us, indexed %u us",
+                            static_cast<unsigned>(bufferSize / 1024), scenario.mName, static_cast<unsigned>(scan.mEventCount),
+                            static_cast<unsigned>(scan.mReportCount), static_cast<unsigned>(scan.mMicroseconds),
+                            static_cast<unsigned>(indexed.mMicroseconds));
+        }
+
+        chip::app::EventManagement::DestroyEventManagement();
+    }
+}
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS > 0
+
 } // namespace
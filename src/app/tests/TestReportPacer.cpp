@@ -0,0 +1,270 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/ReportPacer.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <pw_unit_test/framework.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace chip {
+namespace app {
+namespace reporting {
+namespace {
+
+using namespace System::Clock::Literals;
+using System::Clock::Milliseconds64;
+using System::Clock::Timestamp;
+using VirtualTime = ReportPacer::VirtualTime;
+
+TEST(TestReportPacer, TestLatencyStats)
+{
+    ReportPacer pacer;
+
+    pacer.MarkReportable(Timestamp(1000), VirtualTime(0));
+    // Marking again while the report is pending does not restart the latency measurement.
+    pacer.MarkReportable(Timestamp(1010), VirtualTime(0));
+    pacer.OnChunkSent(Timestamp(1020), 500, true);
+    EXPECT_EQ(pacer.GetLatencyStats().reportCount, 0u);
+    EXPECT_EQ(pacer.GetLatencyStats().chunkCount, 1u);
+
+    pacer.OnChunkSent(Timestamp(1050), 300, false);
+    EXPECT_EQ(pacer.GetLatencyStats().reportCount, 1u);
+    EXPECT_EQ(pacer.GetLatencyStats().chunkCount, 2u);
+    EXPECT_EQ(pacer.GetLatencyStats().bytesSent, 800u);
+    EXPECT_EQ(pacer.GetLatencyStats().lastLatency, 50_ms64);
+
+    pacer.MarkReportable(Timestamp(2000), VirtualTime(0));
+    pacer.OnChunkSent(Timestamp(2010), 300, false);
+    EXPECT_EQ(pacer.GetLatencyStats().reportCount, 2u);
+    EXPECT_EQ(pacer.GetLatencyStats().lastLatency, 10_ms64);
+    EXPECT_EQ(pacer.GetLatencyStats().maxLatency, 50_ms64);
+    EXPECT_EQ(pacer.GetLatencyStats().totalLatency, 60_ms64);
+
+    pacer.ResetLatencyStats();
+    EXPECT_EQ(pacer.GetLatencyStats().reportCount, 0u);
+    EXPECT_EQ(pacer.GetLatencyStats().maxLatency, 0_ms64);
+}
+
+TEST(TestReportPacer, TestDeadlines)
+{
+    ReportPacer large;
+    ReportPacer small;
+
+    // Until they have sent anything, handlers reportable at the same time have the same deadline.
+    EXPECT_EQ(large.GetDeadline(Timestamp(0), VirtualTime(0)), small.GetDeadline(Timestamp(0), VirtualTime(0)));
+
+    // Sending a chunk advances the virtual start time by its cost.
+    EXPECT_EQ(large.GetVirtualStart(), VirtualTime(0));
+    large.OnChunkSent(Timestamp(10), kMaxSecureSduLengthBytes, true);
+    EXPECT_EQ(large.GetVirtualStart(), VirtualTime(CHIP_IM_REPORT_CHUNK_LATENCY_BUDGET_MS));
+    small.OnChunkSent(Timestamp(10), 100, false);
+
+    // A handler in the middle of a chunked report falls behind one which became reportable later with a small report.
+    EXPECT_LT(small.GetDeadline(Timestamp(20), large.GetVirtualStart()), large.GetDeadline(Timestamp(20), VirtualTime(0)));
+
+    // An idle handler does not bank credit: it starts from the virtual time of the engine when it becomes reportable again.
+    ReportPacer idle;
+    idle.OnChunkSent(Timestamp(0), 100, false);
+    idle.MarkReportable(Timestamp(10000), VirtualTime(5000));
+    EXPECT_EQ(idle.GetVirtualStart(), VirtualTime(5000));
+}
+
+// Simulates subscribers sharing a link which sends one report chunk at a time, and reports the latency of their reports.
+class ReportingSimulation
+{
+public:
+    static constexpr uint32_t kSubscriberCount = 50;
+    static constexpr uint32_t kRounds          = 20;
+    static constexpr uint32_t kRoundPeriodMs   = 5000;
+    static constexpr uint32_t kBytesPerMs      = 100;
+
+    struct Result
+    {
+        std::vector<Milliseconds64> smallLatencies;
+        std::vector<Milliseconds64> largeLatencies;
+    };
+
+    static Result Run(bool byDeadline)
+    {
+        std::vector<Subscriber> subscribers(kSubscriberCount);
+        for (uint32_t i = 0; i < kSubscriberCount; i++)
+        {
+            // One in five subscribers has a wildcard subscription producing a large chunked report.
+            bool large                     = (i % 5 == 0);
+            subscribers[i].chunksPerReport = large ? 20 : 1;
+            subscribers[i].chunkBytes      = large ? static_cast<uint32_t>(kMaxSecureSduLengthBytes) : 200;
+            subscribers[i].reportableAtMs  = ArrivalOffsetMs(i);
+            subscribers[i].large           = large;
+            subscribers[i].roundsRemaining = kRounds;
+        }
+
+        Result result;
+        Timestamp now(0);
+        VirtualTime virtualTime(0);
+        uint32_t cursor = 0;
+        while (true)
+        {
+            // Subscribers whose data changed become reportable.
+            Timestamp nextArrival = Timestamp::max();
+            for (auto & subscriber : subscribers)
+            {
+                if (subscriber.chunksLeft == 0 && subscriber.roundsRemaining > 0)
+                {
+                    Timestamp arrival(subscriber.reportableAtMs);
+                    if (arrival <= now)
+                    {
+                        subscriber.chunksLeft = subscriber.chunksPerReport;
+                        subscriber.pacer.MarkReportable(arrival, virtualTime);
+                    }
+                    else
+                    {
+                        nextArrival = std::min(nextArrival, arrival);
+                    }
+                }
+            }
+
+            Subscriber * next =
+                byDeadline ? PickEarliestDeadline(subscribers, now, virtualTime) : PickRoundRobin(subscribers, cursor);
+            if (next == nullptr)
+            {
+                if (nextArrival == Timestamp::max())
+                {
+                    break;
+                }
+                now = nextArrival;
+                continue;
+            }
+            virtualTime = std::max(virtualTime, next->pacer.GetVirtualStart());
+
+            now += Milliseconds64(std::max<uint32_t>(1, next->chunkBytes / kBytesPerMs));
+            next->chunksLeft--;
+            next->pacer.OnChunkSent(now, next->chunkBytes, next->chunksLeft > 0);
+            if (next->chunksLeft == 0)
+            {
+                const auto & stats = next->pacer.GetLatencyStats();
+                (next->large ? result.largeLatencies : result.smallLatencies).push_back(stats.lastLatency);
+                next->roundsRemaining--;
+                next->reportableAtMs += kRoundPeriodMs;
+            }
+        }
+
+        return result;
+    }
+
+    static Milliseconds64 Percentile(std::vector<Milliseconds64> latencies, uint32_t percentile)
+    {
+        VerifyOrReturnValue(!latencies.empty(), 0_ms64);
+        std::sort(latencies.begin(), latencies.end());
+        return latencies[(latencies.size() - 1) * percentile / 100];
+    }
+
+private:
+    struct Subscriber
+    {
+        ReportPacer pacer;
+        uint32_t chunksPerReport = 0;
+        uint32_t chunkBytes      = 0;
+        uint32_t chunksLeft      = 0;
+        uint32_t roundsRemaining = 0;
+        uint64_t reportableAtMs  = 0;
+        bool large               = false;
+    };
+
+    // Spread the changes over the first second of each round, in an order unrelated to the handler order.
+    static uint64_t ArrivalOffsetMs(uint32_t index) { return (index * 37 % kSubscriberCount) * 20; }
+
+    // The order of Engine::RunRoundRobin(): one chunk per reportable handler, visiting them in turn.
+    static Subscriber * PickRoundRobin(std::vector<Subscriber> & subscribers, uint32_t & cursor)
+    {
+        for (uint32_t i = 0; i < subscribers.size(); i++)
+        {
+            Subscriber & candidate = subscribers[cursor];
+            cursor                 = (cursor + 1) % static_cast<uint32_t>(subscribers.size());
+            if (candidate.chunksLeft > 0)
+            {
+                return &candidate;
+            }
+        }
+        return nullptr;
+    }
+
+    // The order of Engine::RunByDeadline().
+    static Subscriber * PickEarliestDeadline(std::vector<Subscriber> & subscribers, Timestamp now, VirtualTime virtualTime)
+    {
+        Subscriber * earliest = nullptr;
+        VirtualTime earliestDeadline;
+        for (auto & candidate : subscribers)
+        {
+            if (candidate.chunksLeft > 0)
+            {
+                VirtualTime deadline = candidate.pacer.GetDeadline(now, virtualTime);
+                if (earliest == nullptr || deadline < earliestDeadline)
+                {
+                    earliest         = &candidate;
+                    earliestDeadline = deadline;
+                }
+            }
+        }
+        return earliest;
+    }
+};
+
+TEST(TestReportPacer, TestTailLatencyOfMixedSubscribers)
+{
+    ReportingSimulation::Result roundRobin = ReportingSimulation::Run(false);
+    ReportingSimulation::Result byDeadline = ReportingSimulation::Run(true);
+
+    // Every report of every subscriber is eventually sent in both modes.
+    constexpr size_t kLargeReports = ReportingSimulation::kRounds * ReportingSimulation::kSubscriberCount / 5;
+    constexpr size_t kSmallReports = ReportingSimulation::kRounds * ReportingSimulation::kSubscriberCount - kLargeReports;
+    EXPECT_EQ(roundRobin.smallLatencies.size(), kSmallReports);
+    EXPECT_EQ(roundRobin.largeLatencies.size(), kLargeReports);
+    EXPECT_EQ(byDeadline.smallLatencies.size(), kSmallReports);
+    EXPECT_EQ(byDeadline.largeLatencies.size(), kLargeReports);
+
+    const struct
+    {
+        const char * name;
+        const ReportingSimulation::Result & result;
+    } kModes[] = { { "round-robin", roundRobin }, { "deadline", byDeadline } };
+
+    for (const auto & mode : kModes)
+    {
+        ChipLogProgress(Test,
+                        "%s: small reports p50 %u ms p99 %u ms max %u ms, large reports p50 %u ms p99 %u ms max %u ms", mode.name,
+                        static_cast<unsigned>(ReportingSimulation::Percentile(mode.result.smallLatencies, 50).count()),
+                        static_cast<unsigned>(ReportingSimulation::Percentile(mode.result.smallLatencies, 99).count()),
+                        static_cast<unsigned>(ReportingSimulation::Percentile(mode.result.smallLatencies, 100).count()),
+                        static_cast<unsigned>(ReportingSimulation::Percentile(mode.result.largeLatencies, 50).count()),
+                        static_cast<unsigned>(ReportingSimulation::Percentile(mode.result.largeLatencies, 99).count()),
+                        static_cast<unsigned>(ReportingSimulation::Percentile(mode.result.largeLatencies, 100).count()));
+    }
+
+    // Small reports no longer queue behind the chunks of large reports.
+    EXPECT_LT(ReportingSimulation::Percentile(byDeadline.smallLatencies, 99),
+              ReportingSimulation::Percentile(roundRobin.smallLatencies, 99));
+}
+
+} // namespace
+} // namespace reporting
+} // namespace app
+} // namespace chip
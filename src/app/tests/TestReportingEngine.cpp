@@ -42,6 +42,7 @@
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/Flags.h>
+#include <system/SystemClock.h>
 
 namespace chip {
 
@@ -98,6 +99,7 @@ public:
     void TestBuildAndSendSingleReportData();
     void TestMergeOverlappedAttributePath();
     void TestMergeAttributePathWhenDirtySetPoolExhausted();
+    void TestDirtySetStress();
 
 private:
     chip::app::DataModel::Provider * mOldProvider = nullptr;
@@ -287,6 +289,11 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
                                                           app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
 
+#if CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+    // This test covers the merging done by the fixed size dirty set pool.
+    InteractionModelEngine::GetInstance()->GetReportingEngine().SetDirtyPathIndexEnabled(false);
+#endif // CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+
     InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.ReleaseAll();
     InteractionModelEngine::GetInstance()->GetReportingEngine().BumpDirtySetGeneration();
 
@@ -357,6 +364,97 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
                                       AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, 1)));
 
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
+#if CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+    InteractionModelEngine::GetInstance()->GetReportingEngine().SetDirtyPathIndexEnabled(true);
+#endif // CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+}
+
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestDirtySetStress)
+{
+    // A bridge exposing 200 endpoints with 50 attributes each, all of them marked dirty once, and 20 subscribers each
+    // interested in the attributes of 10 endpoints. Every subscriber last reported when a different number of its
+    // attributes had already changed.
+    constexpr EndpointId kEndpointCount          = 200;
+    constexpr AttributeId kAttributesPerCluster  = 25;
+    constexpr ClusterId kClusters[]              = { 6, 8 };
+    constexpr size_t kSubscriberCount            = 20;
+    constexpr EndpointId kEndpointsPerSubscriber = kEndpointCount / kSubscriberCount;
+    constexpr size_t kPathsPerSubscriber         = kEndpointsPerSubscriber * MATTER_ARRAY_SIZE(kClusters) * kAttributesPerCluster;
+    constexpr size_t kPathCount                  = kPathsPerSubscriber * kSubscriberCount;
+
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+
+    auto run = [&](size_t & reportedPaths, size_t & expectedPaths) {
+        engine.ClearDirtySet();
+        const uint64_t firstGeneration = engine.GetDirtySetGeneration() + 1;
+
+        System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (EndpointId endpoint = 0; endpoint < kEndpointCount; endpoint++)
+        {
+            for (ClusterId cluster : kClusters)
+            {
+                for (AttributeId attribute = 0; attribute < kAttributesPerCluster; attribute++)
+                {
+                    engine.BumpDirtySetGeneration();
+                    EXPECT_EQ(engine.InsertPathIntoDirtySet(AttributePathParams(endpoint, cluster, attribute)), CHIP_NO_ERROR);
+                }
+            }
+        }
+        const uint64_t insertUs = (System::SystemClock().GetMonotonicMicroseconds64() - start).count();
+
+        reportedPaths = 0;
+        expectedPaths = 0;
+        start         = System::SystemClock().GetMonotonicMicroseconds64();
+        for (size_t subscriber = 0; subscriber < kSubscriberCount; subscriber++)
+        {
+            uint64_t generation                 = firstGeneration + subscriber * kPathsPerSubscriber;
+            const uint64_t lastReportGeneration = generation + subscriber * (kPathsPerSubscriber / kSubscriberCount);
+            for (EndpointId endpoint = 0; endpoint < kEndpointsPerSubscriber; endpoint++)
+            {
+                for (ClusterId cluster : kClusters)
+                {
+                    for (AttributeId attribute = 0; attribute < kAttributesPerCluster; attribute++, generation++)
+                    {
+                        const ConcreteAttributePath path(
+                            static_cast<EndpointId>(subscriber * kEndpointsPerSubscriber + endpoint), cluster, attribute);
+                        reportedPaths += engine.IsAttributePathDirtySince(path, lastReportGeneration) ? 1 : 0;
+                        expectedPaths += (generation > lastReportGeneration) ? 1 : 0;
+                    }
+                }
+            }
+        }
+        const uint64_t queryUs = (System::SystemClock().GetMonotonicMicroseconds64() - start).count();
+
+        ChipLogProgress(Test, "Dirty set with %u paths: insert %u us, %u subscriber queries %u us, %u/%u paths reported",
+                        static_cast<unsigned>(kPathCount), static_cast<unsigned>(insertUs), static_cast<unsigned>(kSubscriberCount),
+                        static_cast<unsigned>(queryUs), static_cast<unsigned>(reportedPaths),
+                        static_cast<unsigned>(expectedPaths));
+    };
+
+    size_t reportedPaths = 0;
+    size_t expectedPaths = 0;
+
+#if CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+    engine.SetDirtyPathIndexEnabled(false);
+#endif // CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+    run(reportedPaths, expectedPaths);
+    // The pool merges paths, so it may report more than what changed but never less.
+    EXPECT_GE(reportedPaths, expectedPaths);
+
+#if CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+    engine.SetDirtyPathIndexEnabled(true);
+    run(reportedPaths, expectedPaths);
+    if (kPathCount <= CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES)
+    {
+        EXPECT_EQ(reportedPaths, expectedPaths);
+        EXPECT_EQ(engine.GetGlobalDirtySetSize(), kPathCount);
+    }
+#endif // CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES > 0
+
+    engine.Shutdown();
 }
 
 } // namespace reporting
@@ -37,6 +37,8 @@
 #include <lib/core/StringBuilderAdapters.h>
 #include <pw_unit_test/framework.h>
 
+#include <chrono>
+
 using namespace chip;
 using namespace chip::Testing;
 using namespace chip::app::Clusters;
@@ -623,6 +625,20 @@ protected:
     }
 };
 
+// Counts the storage reads, to tell the scenes recalled from the cache apart
+class ReadCountingStorageDelegate : public TestPersistentStorageDelegate
+{
+public:
+    size_t mReadCount = 0;
+
+protected:
+    CHIP_ERROR SyncGetKeyValueInternal(const char * key, void * buffer, uint16_t & size) override
+    {
+        mReadCount++;
+        return TestPersistentStorageDelegate::SyncGetKeyValueInternal(key, buffer, size);
+    }
+};
+
 // Test Fixture Class
 class TestSceneTable : public ::testing::Test
 {
@@ -2249,4 +2265,175 @@ TEST_F(TestSceneTable, TestOTAChanges)
     EXPECT_EQ(1, fabric_capacity);
 }
 
+TEST_F(TestSceneTable, TestSceneCache)
+{
+    ReadCountingStorageDelegate storage;
+    TestSceneTableImpl sceneTable;
+    ASSERT_EQ(CHIP_NO_ERROR, sceneTable.Init(storage, app::CodegenDataModelProvider::Instance()));
+    sceneTable.SetEndpoint(kTestEndpoint1);
+
+    SceneTableEntry scene;
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene1));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene2));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric2, scene3));
+
+    // Stored scenes are recalled without reading the storage
+    size_t readCount = storage.mReadCount;
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(scene, scene1);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric2, sceneId3, scene));
+    EXPECT_EQ(scene, scene3);
+    EXPECT_EQ(readCount, storage.mReadCount);
+
+    // Other fabrics and endpoints do not share the cached scenes
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric2, sceneId1, scene));
+    sceneTable.SetEndpoint(kTestEndpoint2);
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+    sceneTable.SetEndpoint(kTestEndpoint1);
+
+    // A table without cached scenes reads them once
+    TestSceneTableImpl otherSceneTable;
+    ASSERT_EQ(CHIP_NO_ERROR, otherSceneTable.Init(storage, app::CodegenDataModelProvider::Instance()));
+    otherSceneTable.SetEndpoint(kTestEndpoint1);
+    readCount = storage.mReadCount;
+    EXPECT_EQ(CHIP_NO_ERROR, otherSceneTable.GetSceneTableEntry(kFabric1, sceneId2, scene));
+    EXPECT_EQ(scene, scene2);
+    EXPECT_LT(readCount, storage.mReadCount);
+    readCount = storage.mReadCount;
+    EXPECT_EQ(CHIP_NO_ERROR, otherSceneTable.GetSceneTableEntry(kFabric1, sceneId2, scene));
+    EXPECT_EQ(scene, scene2);
+    EXPECT_EQ(readCount, storage.mReadCount);
+    otherSceneTable.Finish();
+
+    // Overwritten scenes are recalled with their new data
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene10));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(scene, scene10);
+
+    // Removed scenes are no longer recalled
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.RemoveSceneTableEntry(kFabric1, sceneId1));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.DeleteAllScenesInGroup(kFabric1, kGroup1));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric1, sceneId2, scene));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.RemoveFabric(kFabric2));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric2, sceneId3, scene));
+
+    // Scenes dropped by a smaller table are no longer recalled
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene1));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene2));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene3));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene4));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene5));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene6));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene7));
+    sceneTable.SetTableSize(defaultTestTableSize - 10);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(scene, scene1);
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, sceneTable.GetSceneTableEntry(kFabric1, sceneId4, scene));
+
+    sceneTable.Finish();
+}
+
+TEST_F(TestSceneTable, TestSceneCacheWithReducedTableSize)
+{
+    // An endpoint with a smaller table than the default one
+    constexpr uint16_t kReducedTableSize = defaultTestTableSize - 10;
+
+    ReadCountingStorageDelegate storage;
+    TestSceneTableImpl sceneTable;
+    ASSERT_EQ(CHIP_NO_ERROR, sceneTable.Init(storage, app::CodegenDataModelProvider::Instance()));
+    auto selectEndpoint = [&sceneTable](EndpointId endpoint, uint16_t tableSize) {
+        sceneTable.SetEndpoint(endpoint);
+        sceneTable.SetTableSize(tableSize);
+    };
+
+    selectEndpoint(kTestEndpoint1, kReducedTableSize);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene1));
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, scene2));
+    selectEndpoint(kTestEndpoint2, defaultTestTableSize);
+    for (const auto & entry : { scene1, scene2, scene3, scene4, scene5, scene6, scene7 })
+    {
+        EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, entry));
+    }
+
+    // Like the scenes cluster, each recall gets the table with the default size and then with the size of the endpoint
+    SceneTableEntry scene;
+    size_t readCount = storage.mReadCount;
+    for (int i = 0; i < 3; i++)
+    {
+        selectEndpoint(kTestEndpoint1, scenes::kMaxScenesPerEndpoint);
+        selectEndpoint(kTestEndpoint1, kReducedTableSize);
+        EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+        EXPECT_EQ(scene, scene1);
+        EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, sceneId2, scene));
+        EXPECT_EQ(scene, scene2);
+    }
+    EXPECT_EQ(readCount, storage.mReadCount);
+
+    // Shrinking the table of an endpoint only drops the scenes cached for it
+    selectEndpoint(kTestEndpoint2, kReducedTableSize);
+    selectEndpoint(kTestEndpoint1, kReducedTableSize);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(readCount, storage.mReadCount);
+    selectEndpoint(kTestEndpoint2, kReducedTableSize);
+    EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(scene, scene1);
+    EXPECT_LT(readCount, storage.mReadCount);
+
+    sceneTable.Finish();
+}
+
+TEST_F(TestSceneTable, TestGroupRecallBenchmark)
+{
+    // A bridge recalling a group scene on each of its bridged endpoints
+    constexpr EndpointId kFirstBridgedEndpoint = 100;
+    constexpr uint16_t kBridgedEndpointCount   = 100;
+
+    ReadCountingStorageDelegate storage;
+    TestSceneTableImpl sceneTable;
+    ASSERT_EQ(CHIP_NO_ERROR, sceneTable.Init(storage, app::CodegenDataModelProvider::Instance()));
+
+    static const uint8_t kFieldSetBytes[32] = { 0x15, 0x24, 0x00, 0x01, 0x18 };
+    SceneData data("Group scene"_span, 1000);
+    for (ClusterId cluster : { OnOff::Id, LevelControl::Id, ColorControl::Id })
+    {
+        ASSERT_EQ(CHIP_NO_ERROR, data.mExtensionFieldSets.InsertFieldSet(ExtensionFieldSet(cluster, ByteSpan(kFieldSetBytes))));
+    }
+    const SceneTableEntry groupScene(sceneId1, data);
+
+    for (uint16_t i = 0; i < kBridgedEndpointCount; i++)
+    {
+        sceneTable.SetEndpoint(static_cast<EndpointId>(kFirstBridgedEndpoint + i));
+        ASSERT_EQ(CHIP_NO_ERROR, sceneTable.SetSceneTableEntry(kFabric1, groupScene));
+    }
+
+    auto recallGroupScene = [&](const char * label) {
+        const size_t readCount = storage.mReadCount;
+        const auto start       = std::chrono::steady_clock::now();
+        for (uint16_t i = 0; i < kBridgedEndpointCount; i++)
+        {
+            SceneTableEntry scene;
+            sceneTable.SetEndpoint(static_cast<EndpointId>(kFirstBridgedEndpoint + i));
+            EXPECT_EQ(CHIP_NO_ERROR, sceneTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+            EXPECT_EQ(CHIP_NO_ERROR, sceneTable.SceneApplyEFS(scene));
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        ChipLogProgress(Test, "Group recall on %u endpoints, %s: %u storage reads, %lld us",
+                        static_cast<unsigned>(kBridgedEndpointCount), label,
+                        static_cast<unsigned>(storage.mReadCount - readCount), static_cast<long long>(elapsed.count()));
+        return storage.mReadCount - readCount;
+    };
+
+    // The scenes stored above are cached, as long as the cache holds all of them.
+    const size_t expectedReadCount = (scenes::kSceneTableCacheSize >= kBridgedEndpointCount) ? 0u : 2u * kBridgedEndpointCount;
+    EXPECT_EQ(recallGroupScene("cached"), expectedReadCount);
+
+    // A table started afresh, like after a reboot, reads each scene once.
+    sceneTable.Finish();
+    ASSERT_EQ(CHIP_NO_ERROR, sceneTable.Init(storage, app::CodegenDataModelProvider::Instance()));
+    EXPECT_EQ(recallGroupScene("from storage"), 2u * kBridgedEndpointCount);
+
+    sceneTable.Finish();
+}
+
 } // namespace TestScenes
@@ -0,0 +1,503 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/SubscriptionResumptionScheduler.h>
+
+#include <deque>
+#include <map>
+#include <vector>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+#include <system/SystemTimer.h>
+
+#include <pw_unit_test/framework.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+// Rough costs of resuming a subscription on a Thread device.
+constexpr Milliseconds64 kSessionSetupTime  = 1000_ms64;
+constexpr Milliseconds64 kPrimingReportTime = 200_ms64;
+constexpr size_t kCASEClients               = 2;
+constexpr size_t kMaxReportsInFlight        = 4;
+
+// A System::Layer running its timers off a mock clock.
+class TimerAndMockClock : public Internal::MockClock, public System::Layer
+{
+public:
+    CriticalFailure Init() override { return CHIP_NO_ERROR; }
+    void Shutdown() override
+    {
+        mTimerList.Clear();
+        mTimerNodes.ReleaseAll();
+    }
+    bool IsInitialized() const override { return true; }
+
+    CriticalFailure StartTimer(Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        CancelTimer(aComplete, aAppState);
+        Timestamp awakenTime = GetMonotonicMilliseconds64() + std::chrono::duration_cast<Milliseconds64>(aDelay);
+        System::TimerList::Node * node = mTimerNodes.Create(*this, awakenTime, aComplete, aAppState);
+        VerifyOrReturnError(node != nullptr, CHIP_ERROR_NO_MEMORY);
+        mTimerList.Add(node);
+        return CHIP_NO_ERROR;
+    }
+    void CancelTimer(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        System::TimerList::Node * cancelled = mTimerList.Remove(aComplete, aAppState);
+        if (cancelled != nullptr)
+        {
+            mTimerNodes.Release(cancelled);
+        }
+    }
+    CHIP_ERROR ExtendTimerTo(Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    bool IsTimerActive(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState) != Timeout(0);
+    }
+    Timeout GetRemainingTime(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mTimerList.GetRemainingTime(onComplete, appState);
+    }
+    CriticalFailure ScheduleWork(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    // Fire the timers expiring within duration, moving the clock to each of them, then to the end of duration.
+    void Advance(Milliseconds64 duration)
+    {
+        const Timestamp end = GetMonotonicMilliseconds64() + duration;
+        while (FireNextTimer(end))
+        {
+        }
+        SetMonotonic(end);
+    }
+
+    // Fire the timers until there is none left.
+    void RunUntilIdle()
+    {
+        while (FireNextTimer(Timestamp::max()))
+        {
+        }
+    }
+
+private:
+    bool FireNextTimer(Timestamp end)
+    {
+        System::TimerList::Node * node = mTimerList.Earliest();
+        VerifyOrReturnValue(node != nullptr && node->AwakenTime() <= end, false);
+        if (node->AwakenTime() > GetMonotonicMilliseconds64())
+        {
+            SetMonotonic(node->AwakenTime());
+        }
+        mTimerList.PopEarliest();
+        mTimerNodes.Invoke(node);
+        return true;
+    }
+
+    System::TimerPool<> mTimerNodes;
+    System::TimerList mTimerList;
+};
+
+class FakeResumption;
+
+// Stands in for the CASE session manager and the reporting engine: a session with a peer takes kSessionSetupTime to
+// establish, over one of kCASEClients CASE clients, and each resumed subscription then sends a priming report taking
+// kPrimingReportTime, over one of kMaxReportsInFlight report buffers.
+class FakeNode : public SubscriptionResumptionScheduler::Delegate
+{
+public:
+    struct Session
+    {
+        FakeNode * node  = nullptr;
+        bool established = false;
+        std::vector<FakeResumption *> waiting;
+    };
+
+    FakeNode(TimerAndMockClock & layer) : mLayer(layer) {}
+    ~FakeNode()
+    {
+        mLayer.CancelTimer(OnPrimingReportSent, this);
+        for (auto & entry : mSessions)
+        {
+            mLayer.CancelTimer(OnSessionEstablished, &entry.second);
+        }
+    }
+
+    void Connect(FakeResumption & resumption);
+
+    bool CanSendPrimingReports() override { return mIgnoreReportBuffers || mPrimingReports.size() < kMaxReportsInFlight; }
+
+    bool mIgnoreReportBuffers = false;
+
+    std::vector<std::pair<ScopedNodeId, SubscriptionId>> mStarted;
+    std::vector<std::pair<ScopedNodeId, SubscriptionId>> mResumed;
+    std::vector<std::pair<ScopedNodeId, SubscriptionId>> mFailed;
+    std::vector<Timestamp> mStartTimes;
+    size_t mSessionsEstablished = 0;
+    size_t mConnectionFailures  = 0;
+
+private:
+    static void OnSessionEstablished(System::Layer * layer, void * context);
+    static void OnPrimingReportSent(System::Layer * layer, void * context);
+    void Resumed(FakeResumption & resumption);
+
+    TimerAndMockClock & mLayer;
+    std::map<ScopedNodeId, Session> mSessions;
+    size_t mEstablishing = 0;
+    std::deque<Timestamp> mPrimingReports;
+};
+
+class FakeResumption : public SubscriptionResumptionScheduler::Resumption
+{
+public:
+    FakeResumption(FakeNode & node, ScopedNodeId peer, SubscriptionId subscriptionId) :
+        mNode(node), mPeer(peer), mSubscriptionId(subscriptionId)
+    {
+        sLiveCount++;
+    }
+    ~FakeResumption() override { sLiveCount--; }
+
+    ScopedNodeId GetPeer() const override { return mPeer; }
+    SubscriptionId GetSubscriptionId() const override { return mSubscriptionId; }
+    void Start() override { mNode.Connect(*this); }
+
+    static size_t sLiveCount;
+
+private:
+    FakeNode & mNode;
+    ScopedNodeId mPeer;
+    SubscriptionId mSubscriptionId;
+};
+
+size_t FakeResumption::sLiveCount = 0;
+
+void FakeNode::Connect(FakeResumption & resumption)
+{
+    mStarted.emplace_back(resumption.GetPeer(), resumption.GetSubscriptionId());
+    mStartTimes.push_back(mLayer.GetMonotonicMilliseconds64());
+
+    Session & session = mSessions[resumption.GetPeer()];
+    session.node      = this;
+    if (session.established)
+    {
+        Resumed(resumption);
+        return;
+    }
+    if (!session.waiting.empty())
+    {
+        // Joins the session being established.
+        session.waiting.push_back(&resumption);
+        return;
+    }
+    if (mEstablishing == kCASEClients)
+    {
+        // Out of CASE clients: the session establishment fails right away, and the subscription waits for a retry.
+        mConnectionFailures++;
+        mFailed.emplace_back(resumption.GetPeer(), resumption.GetSubscriptionId());
+        Platform::Delete(&resumption);
+        return;
+    }
+    mEstablishing++;
+    session.waiting.push_back(&resumption);
+    EXPECT_EQ(mLayer.StartTimer(kSessionSetupTime, OnSessionEstablished, &session), CHIP_NO_ERROR);
+}
+
+void FakeNode::OnSessionEstablished(System::Layer * layer, void * context)
+{
+    Session & session = *static_cast<Session *>(context);
+    FakeNode & node   = *session.node;
+    node.mEstablishing--;
+    node.mSessionsEstablished++;
+    session.established = true;
+
+    std::vector<FakeResumption *> waiting;
+    waiting.swap(session.waiting);
+    for (auto * resumption : waiting)
+    {
+        node.Resumed(*resumption);
+    }
+}
+
+void FakeNode::Resumed(FakeResumption & resumption)
+{
+    mResumed.emplace_back(resumption.GetPeer(), resumption.GetSubscriptionId());
+    mPrimingReports.push_back(mLayer.GetMonotonicMilliseconds64() + kPrimingReportTime);
+    if (mPrimingReports.size() == 1)
+    {
+        EXPECT_EQ(mLayer.StartTimer(kPrimingReportTime, OnPrimingReportSent, this), CHIP_NO_ERROR);
+    }
+    Platform::Delete(&resumption);
+}
+
+void FakeNode::OnPrimingReportSent(System::Layer * layer, void * context)
+{
+    FakeNode & node     = *static_cast<FakeNode *>(context);
+    const Timestamp now = node.mLayer.GetMonotonicMilliseconds64();
+    while (!node.mPrimingReports.empty() && node.mPrimingReports.front() <= now)
+    {
+        node.mPrimingReports.pop_front();
+    }
+    if (!node.mPrimingReports.empty())
+    {
+        EXPECT_EQ(node.mLayer.StartTimer(node.mPrimingReports.front() - now, OnPrimingReportSent, &node), CHIP_NO_ERROR);
+    }
+}
+
+class TestSubscriptionResumptionScheduler : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        mSavedClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mLayer);
+        mLayer.SetMonotonic(1000_ms64);
+    }
+
+    void TearDown() override
+    {
+        mLayer.Shutdown();
+        System::Clock::Internal::SetSystemClockForTesting(mSavedClock);
+        EXPECT_EQ(FakeResumption::sLiveCount, 0u);
+    }
+
+    static void Enqueue(SubscriptionResumptionScheduler & scheduler, FakeNode & node, FabricIndex fabricIndex, NodeId nodeId,
+                        SubscriptionId subscriptionId)
+    {
+        scheduler.Enqueue(Platform::New<FakeResumption>(node, ScopedNodeId(nodeId, fabricIndex), subscriptionId));
+    }
+
+    // Resume the subscriptions of peerCount peers, each with subscriptionsPerPeer subscriptions, half of the peers on each
+    // of two fabrics. The subscriptions whose CASE session could not be established are resumed again after the minimum
+    // resumption retry interval, as they would be by the InteractionModelEngine.
+    Milliseconds64 ResumeAll(uint8_t maxConcurrentPeers, bool paceOnReportBuffers, size_t peerCount, size_t subscriptionsPerPeer,
+                             size_t & connectionFailures, size_t & retries)
+    {
+        FakeNode node(mLayer);
+        node.mIgnoreReportBuffers = !paceOnReportBuffers;
+        SubscriptionResumptionScheduler scheduler;
+        EXPECT_EQ(scheduler.Init(&mLayer, &node, maxConcurrentPeers), CHIP_NO_ERROR);
+
+        const Timestamp start         = mLayer.GetMonotonicMilliseconds64();
+        SubscriptionId subscriptionId = 1;
+        for (size_t peer = 0; peer < peerCount; peer++)
+        {
+            for (size_t i = 0; i < subscriptionsPerPeer; i++)
+            {
+                Enqueue(scheduler, node, static_cast<FabricIndex>(1 + peer % 2), 100 + peer, subscriptionId++);
+            }
+        }
+
+        const size_t total = peerCount * subscriptionsPerPeer;
+        retries            = 0;
+        while (true)
+        {
+            mLayer.RunUntilIdle();
+            if (node.mResumed.size() == total || node.mFailed.empty())
+            {
+                break;
+            }
+
+            retries++;
+            mLayer.SetMonotonic(mLayer.GetMonotonicMilliseconds64() +
+                                Seconds32(CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION_MIN_RETRY_INTERVAL_SECS));
+            std::vector<std::pair<ScopedNodeId, SubscriptionId>> failed;
+            failed.swap(node.mFailed);
+            for (auto & subscription : failed)
+            {
+                Enqueue(scheduler, node, subscription.first.GetFabricIndex(), subscription.first.GetNodeId(), subscription.second);
+            }
+        }
+        EXPECT_EQ(node.mResumed.size(), total);
+
+        scheduler.Shutdown();
+        connectionFailures = node.mConnectionFailures;
+        return mLayer.GetMonotonicMilliseconds64() - start;
+    }
+
+protected:
+    TimerAndMockClock mLayer;
+    System::Clock::ClockBase * mSavedClock = nullptr;
+};
+
+TEST_F(TestSubscriptionResumptionScheduler, TestStartsPeerByPeerInFabricOrder)
+{
+    FakeNode node(mLayer);
+    SubscriptionResumptionScheduler scheduler;
+    ASSERT_EQ(scheduler.Init(&mLayer, &node, 1), CHIP_NO_ERROR);
+
+    Enqueue(scheduler, node, 2, 10, 1);
+    Enqueue(scheduler, node, 1, 20, 2);
+    Enqueue(scheduler, node, 2, 10, 3);
+    Enqueue(scheduler, node, 1, 5, 4);
+    Enqueue(scheduler, node, 1, 20, 5);
+
+    // Nothing starts until all the resumptions queued together are.
+    EXPECT_TRUE(node.mStarted.empty());
+    EXPECT_EQ(scheduler.GetQueuedCount(), 5u);
+
+    mLayer.RunUntilIdle();
+
+    const std::vector<std::pair<ScopedNodeId, SubscriptionId>> expected = {
+        { ScopedNodeId(5, 1), 4 },  { ScopedNodeId(20, 1), 2 }, { ScopedNodeId(20, 1), 5 },
+        { ScopedNodeId(10, 2), 1 }, { ScopedNodeId(10, 2), 3 },
+    };
+    EXPECT_EQ(node.mStarted, expected);
+    EXPECT_EQ(node.mResumed.size(), 5u);
+
+    // One session per peer, established one after the other.
+    EXPECT_EQ(node.mSessionsEstablished, 3u);
+    EXPECT_EQ(node.mStartTimes[1], node.mStartTimes[2]);
+    EXPECT_GE(node.mStartTimes[1] - node.mStartTimes[0], kSessionSetupTime);
+    EXPECT_GE(node.mStartTimes[3] - node.mStartTimes[1], kSessionSetupTime);
+    EXPECT_EQ(scheduler.GetQueuedCount(), 0u);
+    EXPECT_EQ(scheduler.GetActivePeerCount(), 0u);
+
+    scheduler.Shutdown();
+}
+
+TEST_F(TestSubscriptionResumptionScheduler, TestLimitsConcurrentPeers)
+{
+    FakeNode node(mLayer);
+    SubscriptionResumptionScheduler scheduler;
+    ASSERT_EQ(scheduler.Init(&mLayer, &node, 2), CHIP_NO_ERROR);
+
+    SubscriptionId subscriptionId = 1;
+    for (NodeId peer = 1; peer <= 6; peer++)
+    {
+        Enqueue(scheduler, node, 1, peer, subscriptionId++);
+        Enqueue(scheduler, node, 1, peer, subscriptionId++);
+    }
+
+    mLayer.Advance(0_ms64);
+    EXPECT_EQ(scheduler.GetActivePeerCount(), 2u);
+    EXPECT_EQ(scheduler.GetQueuedCount(), 8u);
+
+    mLayer.RunUntilIdle();
+    EXPECT_EQ(node.mResumed.size(), 12u);
+    EXPECT_EQ(node.mSessionsEstablished, 6u);
+    EXPECT_EQ(node.mConnectionFailures, 0u);
+
+    scheduler.Shutdown();
+}
+
+TEST_F(TestSubscriptionResumptionScheduler, TestPacesOnReportBuffers)
+{
+    FakeNode node(mLayer);
+    SubscriptionResumptionScheduler scheduler;
+    ASSERT_EQ(scheduler.Init(&mLayer, &node, 4), CHIP_NO_ERROR);
+
+    // The first peer fills up the report buffers with its priming reports.
+    for (SubscriptionId subscriptionId = 1; subscriptionId <= kMaxReportsInFlight; subscriptionId++)
+    {
+        Enqueue(scheduler, node, 1, 1, subscriptionId);
+    }
+    mLayer.Advance(kSessionSetupTime);
+    EXPECT_EQ(node.mResumed.size(), kMaxReportsInFlight);
+
+    // The next one waits for them to be sent.
+    Enqueue(scheduler, node, 1, 2, 100);
+    mLayer.Advance(kPrimingReportTime - 1_ms64);
+    EXPECT_EQ(node.mStarted.size(), kMaxReportsInFlight);
+    EXPECT_EQ(scheduler.GetQueuedCount(), 1u);
+
+    mLayer.Advance(kPrimingReportTime);
+    EXPECT_EQ(node.mStarted.size(), kMaxReportsInFlight + 1);
+
+    mLayer.RunUntilIdle();
+    EXPECT_EQ(node.mResumed.size(), kMaxReportsInFlight + 1);
+
+    scheduler.Shutdown();
+}
+
+TEST_F(TestSubscriptionResumptionScheduler, TestCancelAndShutdown)
+{
+    FakeNode node(mLayer);
+    SubscriptionResumptionScheduler scheduler;
+    ASSERT_EQ(scheduler.Init(&mLayer, &node, 1), CHIP_NO_ERROR);
+
+    Enqueue(scheduler, node, 1, 1, 1);
+    Enqueue(scheduler, node, 1, 1, 2);
+    Enqueue(scheduler, node, 2, 1, 3);
+    Enqueue(scheduler, node, 2, 2, 4);
+    Enqueue(scheduler, node, 1, 3, 5);
+    EXPECT_TRUE(scheduler.IsScheduled(ScopedNodeId(1, 2), 3));
+    EXPECT_FALSE(scheduler.IsScheduled(ScopedNodeId(1, 1), 3));
+
+    // The first peer starts, and waits for its session.
+    mLayer.Advance(0_ms64);
+    EXPECT_EQ(node.mStarted.size(), 2u);
+    EXPECT_TRUE(scheduler.IsScheduled(ScopedNodeId(1, 1), 1));
+
+    // Only the queued resumptions are cancelled.
+    EXPECT_EQ(scheduler.CancelFabric(1), 1u);
+    EXPECT_FALSE(scheduler.IsScheduled(ScopedNodeId(3, 1), 5));
+    EXPECT_TRUE(scheduler.IsScheduled(ScopedNodeId(1, 1), 2));
+    EXPECT_EQ(scheduler.GetQueuedCount(), 2u);
+    EXPECT_EQ(FakeResumption::sLiveCount, 4u);
+
+    // The started resumptions complete on their own after a shutdown.
+    scheduler.Shutdown();
+    EXPECT_EQ(FakeResumption::sLiveCount, 2u);
+    mLayer.RunUntilIdle();
+    EXPECT_EQ(node.mResumed.size(), 2u);
+    EXPECT_EQ(node.mStarted.size(), 2u);
+}
+
+TEST_F(TestSubscriptionResumptionScheduler, TestResumptionBenchmark)
+{
+    constexpr size_t kPeers                = 20;
+    constexpr size_t kSubscriptionsPerPeer = 3;
+
+    size_t failures = 0;
+    size_t retries  = 0;
+
+    // Starting all the resumptions at once, as many peers as there are CASE clients are resumed, and the others wait for
+    // the next retry.
+    Milliseconds64 allAtOnce = ResumeAll(UINT8_MAX, false, kPeers, kSubscriptionsPerPeer, failures, retries);
+    ChipLogProgress(Test, "%u subscriptions of %u peers, all at once: all resumed after %u ms, %u CASE failures, %u retries",
+                    static_cast<unsigned>(kPeers * kSubscriptionsPerPeer), static_cast<unsigned>(kPeers),
+                    static_cast<unsigned>(allAtOnce.count()), static_cast<unsigned>(failures), static_cast<unsigned>(retries));
+    EXPECT_GT(retries, 0u);
+
+    Milliseconds64 scheduled =
+        ResumeAll(static_cast<uint8_t>(kCASEClients), true, kPeers, kSubscriptionsPerPeer, failures, retries);
+    ChipLogProgress(Test, "%u subscriptions of %u peers, scheduled: all resumed after %u ms, %u CASE failures, %u retries",
+                    static_cast<unsigned>(kPeers * kSubscriptionsPerPeer), static_cast<unsigned>(kPeers),
+                    static_cast<unsigned>(scheduled.count()), static_cast<unsigned>(failures), static_cast<unsigned>(retries));
+    EXPECT_EQ(failures, 0u);
+    EXPECT_EQ(retries, 0u);
+    EXPECT_LT(scheduled, allAtOnce);
+}
+
+} // namespace
@@ -0,0 +1,257 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/util/af-types.h>
+#include <lib/core/DataModelTypes.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace chip {
+namespace app {
+namespace Compatibility {
+namespace Internal {
+
+/// Lookup tables over the ember metadata generated for the fixed endpoints: the cluster and attribute
+/// arrays of zap-generated/endpoint_config.h, and the endpoint types referring to them.
+///
+/// The tables are meant to be computed at compile time from the generated arrays. They replace the
+/// linear scans of the clusters of an endpoint type and of the attributes of a cluster by binary
+/// searches, and hold the offsets of clusters and attributes in the attribute storage, which
+/// otherwise have to be summed over all the attributes stored before them.
+///
+/// Lookups return the same cluster or attribute as a scan in declaration order would, including
+/// when several entries share an id.
+template <size_t kClusterCount, size_t kAttributeCount>
+class FixedMetadataLookup
+{
+public:
+    /// clusters and attributes are the kClusterCount clusters and kAttributeCount attributes the endpoint
+    /// types refer to.
+    constexpr FixedMetadataLookup(const EmberAfEndpointType * endpointTypes, size_t endpointTypeCount,
+                                  const EmberAfCluster * clusters, const EmberAfAttributeMetadata * attributes) :
+        mEndpointTypes(endpointTypes),
+        mEndpointTypeCount(endpointTypeCount), mClusters(clusters), mAttributes(attributes)
+    {
+        for (size_t t = 0; t < endpointTypeCount; t++)
+        {
+            const EmberAfEndpointType & type = endpointTypes[t];
+            if (type.clusterCount == 0)
+            {
+                continue;
+            }
+
+            const size_t first = static_cast<size_t>(type.cluster - clusters);
+            uint16_t offset    = 0;
+            for (size_t i = first; i < first + type.clusterCount; i++)
+            {
+                mSortedClusters[i] = static_cast<uint16_t>(i);
+                mClusterOffsets[i] = offset;
+                offset             = static_cast<uint16_t>(offset + clusters[i].clusterSize);
+            }
+            SortRange(mSortedClusters, first, first + type.clusterCount,
+                      [clusters](uint16_t a, uint16_t b) { return clusters[a].clusterId < clusters[b].clusterId; });
+        }
+
+        for (size_t c = 0; c < kClusterCount; c++)
+        {
+            const EmberAfCluster & cluster = clusters[c];
+            if (cluster.attributes == nullptr || cluster.attributeCount == 0)
+            {
+                continue;
+            }
+
+            const size_t first = static_cast<size_t>(cluster.attributes - attributes);
+            uint16_t offset    = 0;
+            for (size_t i = first; i < first + cluster.attributeCount; i++)
+            {
+                mSortedAttributes[i] = static_cast<uint16_t>(i);
+                mAttributeOffsets[i] = offset;
+                if (!(attributes[i].mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+                {
+                    offset = static_cast<uint16_t>(offset + attributes[i].size);
+                }
+            }
+            SortRange(mSortedAttributes, first, first + cluster.attributeCount,
+                      [attributes](uint16_t a, uint16_t b) { return attributes[a].attributeId < attributes[b].attributeId; });
+        }
+    }
+
+    /// Whether the endpoint type is one of the generated endpoint types the tables cover.
+    bool Covers(const EmberAfEndpointType * endpointType) const
+    {
+        std::less<const EmberAfEndpointType *> less;
+        return !less(endpointType, mEndpointTypes) && less(endpointType, mEndpointTypes + mEndpointTypeCount);
+    }
+
+    /// Finds the first cluster of a covered endpoint type with the given id and any of the bits of mask set
+    /// (any cluster if mask is 0).
+    const EmberAfCluster * FindCluster(const EmberAfEndpointType * endpointType, ClusterId clusterId, EmberAfClusterMask mask) const
+    {
+        if (endpointType->clusterCount == 0)
+        {
+            return nullptr;
+        }
+
+        const size_t first   = static_cast<size_t>(endpointType->cluster - mClusters);
+        const uint16_t * end = mSortedClusters + first + endpointType->clusterCount;
+        for (const uint16_t * it = std::lower_bound(mSortedClusters + first, end, clusterId,
+                                                    [this](uint16_t i, ClusterId id) { return mClusters[i].clusterId < id; });
+             it != end && mClusters[*it].clusterId == clusterId; ++it)
+        {
+            if (mask == 0 || (mClusters[*it].mask & mask) != 0)
+            {
+                return &mClusters[*it];
+            }
+        }
+        return nullptr;
+    }
+
+    /// Finds the first attribute of a cluster of a covered endpoint type with the given id.
+    const EmberAfAttributeMetadata * FindAttribute(const EmberAfCluster * cluster, AttributeId attributeId) const
+    {
+        if (cluster->attributes == nullptr || cluster->attributeCount == 0)
+        {
+            return nullptr;
+        }
+
+        const size_t first   = static_cast<size_t>(cluster->attributes - mAttributes);
+        const uint16_t * end = mSortedAttributes + first + cluster->attributeCount;
+        const uint16_t * it  = std::lower_bound(mSortedAttributes + first, end, attributeId,
+                                               [this](uint16_t i, AttributeId id) { return mAttributes[i].attributeId < id; });
+        if (it == end || mAttributes[*it].attributeId != attributeId)
+        {
+            return nullptr;
+        }
+        return &mAttributes[*it];
+    }
+
+    /// Offset of the storage of a cluster from the start of the storage of its endpoint.
+    uint16_t ClusterStorageOffset(const EmberAfCluster * cluster) const { return mClusterOffsets[cluster - mClusters]; }
+
+    /// Offset of the storage of an attribute from the start of the storage of its cluster.
+    uint16_t AttributeStorageOffset(const EmberAfAttributeMetadata * attribute) const
+    {
+        return mAttributeOffsets[attribute - mAttributes];
+    }
+
+private:
+    // A stable insertion sort, usable in constant expressions.
+    template <typename Less>
+    static constexpr void SortRange(uint16_t * values, size_t begin, size_t end, Less less)
+    {
+        for (size_t i = begin + 1; i < end; i++)
+        {
+            uint16_t value = values[i];
+            size_t j       = i;
+            for (; j > begin && less(value, values[j - 1]); j--)
+            {
+                values[j] = values[j - 1];
+            }
+            values[j] = value;
+        }
+    }
+
+    const EmberAfEndpointType * mEndpointTypes;
+    size_t mEndpointTypeCount;
+    const EmberAfCluster * mClusters;
+    const EmberAfAttributeMetadata * mAttributes;
+
+    // For each endpoint type, the indexes of its clusters sorted by id, at the positions of its clusters.
+    uint16_t mSortedClusters[kClusterCount] = {};
+    uint16_t mClusterOffsets[kClusterCount] = {};
+    // For each cluster, the indexes of its attributes sorted by id, at the positions of its attributes.
+    uint16_t mSortedAttributes[kAttributeCount] = {};
+    uint16_t mAttributeOffsets[kAttributeCount] = {};
+};
+
+/// Maps endpoint ids to their index in the ember endpoint table, kept sorted by id as endpoints are
+/// defined and cleared.
+template <size_t kCapacity>
+class EndpointIndexLookup
+{
+public:
+    static constexpr uint16_t kInvalidIndex = 0xFFFF;
+
+    void Clear() { mCount = 0; }
+
+    /// Records the endpoint id of the endpoint table entry at index, replacing any id recorded for it before.
+    /// kInvalidEndpointId removes the entry.
+    void Set(uint16_t index, EndpointId endpoint)
+    {
+        Entry * end = mEntries + mCount;
+        Entry * it  = std::find_if(mEntries, end, [index](const Entry & entry) { return entry.index == index; });
+        if (it != end)
+        {
+            std::copy(it + 1, end, it);
+            mCount--;
+        }
+
+        if (endpoint == kInvalidEndpointId || mCount == kCapacity)
+        {
+            return;
+        }
+
+        end = mEntries + mCount;
+        it  = std::upper_bound(mEntries, end, Entry{ endpoint, index });
+        std::copy_backward(it, end, end + 1);
+        *it = Entry{ endpoint, index };
+        mCount++;
+    }
+
+    /// Returns the lowest index of the given endpoint id for which accept(index) is true, or kInvalidIndex.
+    template <typename Accept>
+    uint16_t Find(EndpointId endpoint, Accept && accept) const
+    {
+        const Entry * end = mEntries + mCount;
+        for (const Entry * it = std::lower_bound(mEntries, end, Entry{ endpoint, 0 }); it != end && it->endpoint == endpoint; ++it)
+        {
+            if (accept(it->index))
+            {
+                return it->index;
+            }
+        }
+        return kInvalidIndex;
+    }
+
+    size_t Size() const { return mCount; }
+
+private:
+    struct Entry
+    {
+        EndpointId endpoint;
+        uint16_t index;
+
+        bool operator<(const Entry & other) const
+        {
+            return endpoint < other.endpoint || (endpoint == other.endpoint && index < other.index);
+        }
+    };
+
+    Entry mEntries[kCapacity > 0 ? kCapacity : 1];
+    size_t mCount = 0;
+};
+
+} // namespace Internal
+} // namespace Compatibility
+} // namespace app
+} // namespace chip
@@ -27,6 +27,7 @@
 #include <app/reporting/reporting.h>
 #include <app/util/attribute-metadata.h>
 #include <app/util/attribute-storage-detail.h>
+#include <app/util/attribute-storage-lookup.h>
 #include <app/util/config.h>
 #include <app/util/ember-io-storage.h>
 #include <app/util/ember-strings.h>
@@ -138,8 +139,24 @@ constexpr const EmberAfDeviceType fixedDeviceTypeList[]             = FIXED_DEVI
 
 // Not const, because these need to mutate.
 DataVersion fixedEndpointDataVersions[ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT];
+
+// Offset of the storage of each fixed endpoint in attributeData.
+uint16_t fixedEndpointStorageOffsets[FIXED_ENDPOINT_COUNT];
 #endif // FIXED_ENDPOINT_COUNT > 0
 
+#if CHIP_CONFIG_EMBER_METADATA_LOOKUP_TABLES && FIXED_ENDPOINT_COUNT > 0 && defined(GENERATED_CLUSTERS)
+#define EMBER_FIXED_METADATA_LOOKUP 1
+// Computed at compile time from the generated metadata, so it lives in read-only memory.
+constexpr Compatibility::Internal::FixedMetadataLookup<MATTER_ARRAY_SIZE(generatedClusters), MATTER_ARRAY_SIZE(generatedAttributes)>
+    fixedMetadataLookup(generatedEmberAfEndpointTypes, MATTER_ARRAY_SIZE(generatedEmberAfEndpointTypes), generatedClusters,
+                        generatedAttributes);
+#else
+#define EMBER_FIXED_METADATA_LOOKUP 0
+#endif
+
+// Index of the endpoint ids of emAfEndpoints, updated whenever an endpoint is defined or cleared.
+Compatibility::Internal::EndpointIndexLookup<MAX_ENDPOINT_COUNT> endpointIndexLookup;
+
 bool emberAfIsThisDataTypeAListType(EmberAfAttributeType dataType)
 {
     return dataType == ZCL_ARRAY_ATTRIBUTE_TYPE;
@@ -152,16 +169,10 @@ uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints
         return kEmberInvalidEndpointIndex;
     }
 
-    uint16_t epi;
-    for (epi = 0; epi < emberAfEndpointCount(); epi++)
-    {
-        if (emAfEndpoints[epi].endpoint == endpoint &&
-            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled)))
-        {
-            return epi;
-        }
-    }
-    return kEmberInvalidEndpointIndex;
+    return endpointIndexLookup.Find(endpoint, [ignoreDisabledEndpoints](uint16_t epi) {
+        return epi < emberAfEndpointCount() &&
+            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled));
+    });
 }
 
 // Returns the index of a given endpoint.  Considers disabled endpoints.
@@ -199,6 +210,7 @@ void emberAfEndpointConfigure()
                   "FIXED_ENDPOINT_COUNT must not exceed the size of the endpoint data type");
 
     emberEndpointCount = FIXED_ENDPOINT_COUNT;
+    endpointIndexLookup.Clear();
 
 #if FIXED_ENDPOINT_COUNT > 0
 
@@ -222,9 +234,11 @@ void emberAfEndpointConfigure()
 #endif // ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT > 0
 
     DataVersion * currentDataVersions = fixedEndpointDataVersions;
+    uint16_t currentStorageOffset     = 0;
     for (ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
     {
         emAfEndpoints[ep].endpoint = fixedEndpoints[ep];
+        endpointIndexLookup.Set(ep, fixedEndpoints[ep]);
         emAfEndpoints[ep].deviceTypeList =
             Span<const EmberAfDeviceType>(&fixedDeviceTypeList[fixedDeviceTypeListOffsets[ep]], fixedDeviceTypeListLengths[ep]);
         emAfEndpoints[ep].endpointType     = &generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[ep]];
@@ -252,6 +266,10 @@ void emberAfEndpointConfigure()
         // Increment currentDataVersions by 1 (slot) for every server cluster
         // this endpoint has.
         currentDataVersions += emberAfClusterCountByIndex(ep, /* server = */ true);
+
+        fixedEndpointStorageOffsets[ep] = currentStorageOffset;
+        currentStorageOffset =
+            static_cast<uint16_t>(currentStorageOffset + emAfEndpoints[ep].endpointType->endpointSize);
     }
 
 #endif // FIXED_ENDPOINT_COUNT > 0
@@ -359,6 +377,7 @@ CHIP_ERROR emberAfSetDynamicEndpointWithEpUniqueId(uint16_t index, EndpointId id
     emAfEndpoints[index].deviceTypeList = deviceTypeList;
     emAfEndpoints[index].endpointType   = ep;
     emAfEndpoints[index].dataVersions   = dataVersionStorage.data();
+    endpointIndexLookup.Set(index, id);
 #if CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
     MutableCharSpan targetSpan(emAfEndpoints[index].endpointUniqueId);
     if (CopyCharSpanToMutableCharSpan(endpointUniqueId, targetSpan) != CHIP_NO_ERROR)
@@ -408,6 +427,7 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index)
         ep = emAfEndpoints[index].endpoint;
         emberAfEndpointEnableDisable(ep, false);
         emAfEndpoints[index].endpoint = kInvalidEndpointId;
+        endpointIndexLookup.Set(index, kInvalidEndpointId);
     }
 
     emberMetadataStructureGeneration++;
@@ -629,6 +649,85 @@ bool emAfMatchAttribute(const EmberAfCluster * cluster, const EmberAfAttributeMe
     return (am->attributeId == attRecord->attributeId);
 }
 
+// Finds the metadata of an attribute on an enabled endpoint, and the offset of its storage in
+// attributeData, which is only meaningful for attributes of fixed endpoints that are not
+// externally stored.
+static Status locateAttribute(const EmberAfAttributeSearchRecord * attRecord, uint16_t & endpointIndex,
+                              const EmberAfAttributeMetadata ** metadata, uint16_t & attributeOffsetIndex)
+{
+    endpointIndex = emberAfIndexFromEndpoint(attRecord->endpoint);
+    if (endpointIndex == kEmberInvalidEndpointIndex)
+    {
+        return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+    }
+
+    // Dynamic endpoints are external and don't factor into storage size
+    attributeOffsetIndex = 0;
+#if FIXED_ENDPOINT_COUNT > 0
+    if (endpointIndex < FIXED_ENDPOINT_COUNT)
+    {
+        attributeOffsetIndex = fixedEndpointStorageOffsets[endpointIndex];
+    }
+#endif // FIXED_ENDPOINT_COUNT > 0
+
+    const EmberAfEndpointType * endpointType = emAfEndpoints[endpointIndex].endpointType;
+
+#if EMBER_FIXED_METADATA_LOOKUP
+    if (fixedMetadataLookup.Covers(endpointType))
+    {
+        const EmberAfCluster * cluster =
+            fixedMetadataLookup.FindCluster(endpointType, attRecord->clusterId, MATTER_CLUSTER_FLAG_SERVER);
+        if (cluster == nullptr)
+        {
+            return Status::UnsupportedCluster;
+        }
+
+        *metadata = fixedMetadataLookup.FindAttribute(cluster, attRecord->attributeId);
+        if (*metadata == nullptr)
+        {
+            return Status::UnsupportedAttribute;
+        }
+
+        attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + fixedMetadataLookup.ClusterStorageOffset(cluster) +
+                                                     fixedMetadataLookup.AttributeStorageOffset(*metadata));
+        return Status::Success;
+    }
+#endif // EMBER_FIXED_METADATA_LOOKUP
+
+    for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    {
+        const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+        if (emAfMatchCluster(cluster, attRecord))
+        { // Got the cluster
+            for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+            {
+                const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+                if (emAfMatchAttribute(cluster, am, attRecord))
+                { // Got the attribute
+                    *metadata = am;
+                    return Status::Success;
+                }
+
+                // Not the attribute we are looking for
+                // Increase the index if attribute is not externally stored
+                if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+                {
+                    attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                }
+            }
+
+            // Attribute is not in the cluster.
+            return Status::UnsupportedAttribute;
+        }
+
+        // Not the cluster we are looking for
+        attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+    }
+
+    // Cluster is not in the endpoint.
+    return Status::UnsupportedCluster;
+}
+
 // When reading non-string attributes, this function returns an error when destination
 // buffer isn't large enough to accommodate the attribute type.  For strings, the
 // function will copy at most readLength bytes.  This means the resulting string
@@ -647,125 +746,76 @@ Status emAfReadOrWriteAttribute(const EmberAfAttributeSearchRecord * attRecord,
 {
     assertChipStackLockedByCurrentThread();
 
-    uint16_t attributeOffsetIndex = 0;
+    uint16_t endpointIndex;
+    uint16_t attributeOffsetIndex;
+    const EmberAfAttributeMetadata * am = nullptr;
 
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    Status status = locateAttribute(attRecord, endpointIndex, &am, attributeOffsetIndex);
+    if (status != Status::Success)
     {
-        // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+        return status;
+    }
 
-        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(ep))
-            {
-                continue;
-            }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
-            {
-                const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
-                    {
-                        const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != nullptr)
-                            {
-                                *metadata = am;
-                            }
+    // Is this a dynamic endpoint?
+    bool isDynamicEndpoint = (endpointIndex >= emberAfFixedEndpointCount());
 
-                            {
-                                uint8_t * attributeLocation = attributeData + attributeOffsetIndex;
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             am->attributeId))
-                                    {
-                                        return Status::UnsupportedAccess;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == nullptr)
-                                    {
-                                        return Status::Success;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            am->attributeId))
-                                    {
-                                        return Status::UnsupportedAccess;
-                                    }
-                                }
-
-                                // Is the attribute externally stored?
-                                if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
-                                {
-                                    if (write)
-                                    {
-                                        return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
-                                                                                     buffer);
-                                    }
-
-                                    if (readLength < emberAfAttributeSize(am))
-                                    {
-                                        // Prevent a potential buffer overflow
-                                        return Status::ResourceExhausted;
-                                    }
-
-                                    return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am,
-                                                                                buffer, emberAfAttributeSize(am));
-                                }
-
-                                // Internal storage is only supported for fixed endpoints
-                                if (!isDynamicEndpoint)
-                                {
-                                    return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                                }
-
-                                return Status::Failure;
-                            }
-                        }
-                        else
-                        { // Not the attribute we are looking for
-                            // Increase the index if attribute is not externally stored
-                            if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
-                            {
-                                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
-                            }
-                        }
-                    }
+    // If passed metadata location is not null, populate
+    if (metadata != nullptr)
+    {
+        *metadata = am;
+    }
 
-                    // Attribute is not in the cluster.
-                    return Status::UnsupportedAttribute;
-                }
+    uint8_t * attributeLocation = attributeData + attributeOffsetIndex;
+    uint8_t *src, *dst;
+    if (write)
+    {
+        src = buffer;
+        dst = attributeLocation;
+        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+        {
+            return Status::UnsupportedAccess;
+        }
+    }
+    else
+    {
+        if (buffer == nullptr)
+        {
+            return Status::Success;
+        }
 
-                // Not the cluster we are looking for
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
-            }
+        src = attributeLocation;
+        dst = buffer;
+        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+        {
+            return Status::UnsupportedAccess;
+        }
+    }
 
-            // Cluster is not in the endpoint.
-            return Status::UnsupportedCluster;
+    // Is the attribute externally stored?
+    if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
+    {
+        if (write)
+        {
+            return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am, buffer);
         }
 
-        // Not the endpoint we are looking for
-        // Dynamic endpoints are external and don't factor into storage size
-        if (!isDynamicEndpoint)
+        if (readLength < emberAfAttributeSize(am))
         {
-            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
+            // Prevent a potential buffer overflow
+            return Status::ResourceExhausted;
         }
+
+        return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
+                                                    emberAfAttributeSize(am));
     }
-    return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+
+    // Internal storage is only supported for fixed endpoints
+    if (!isDynamicEndpoint)
+    {
+        return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
+    }
+
+    return Status::Failure;
 }
 
 const EmberAfEndpointType * emberAfFindEndpointType(EndpointId endpointId)
@@ -784,6 +834,25 @@ const EmberAfCluster * emberAfFindClusterInType(const EmberAfEndpointType * endp
     uint8_t i;
     uint8_t scopedIndex = 0;
 
+#if EMBER_FIXED_METADATA_LOOKUP
+    if (fixedMetadataLookup.Covers(endpointType))
+    {
+        const EmberAfCluster * found = fixedMetadataLookup.FindCluster(endpointType, clusterId, mask);
+        if (found != nullptr && index)
+        {
+            for (const EmberAfCluster * cluster = endpointType->cluster; cluster < found; cluster++)
+            {
+                if (mask == 0 || ((cluster->mask & mask) != 0))
+                {
+                    scopedIndex++;
+                }
+            }
+            *index = scopedIndex;
+        }
+        return found;
+    }
+#endif // EMBER_FIXED_METADATA_LOOKUP
+
     for (i = 0; i < endpointType->clusterCount; i++)
     {
         const EmberAfCluster * cluster = &(endpointType->cluster[i]);
@@ -809,21 +878,14 @@ const EmberAfCluster * emberAfFindClusterInType(const EmberAfEndpointType * endp
 
 uint8_t emberAfClusterIndex(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask)
 {
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
-    {
-        // Check the endpoint id first, because that way we avoid examining the
-        // endpoint type for endpoints that are not actually defined.
-        if (emAfEndpoints[ep].endpoint == endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t index                            = 0xFF;
-            if (emberAfFindClusterInType(endpointType, clusterId, mask, &index) != nullptr)
-            {
-                return index;
-            }
-        }
-    }
-    return 0xFF;
+    uint8_t index = 0xFF;
+    // Looking the endpoint id up first avoids examining the endpoint type
+    // for endpoints that are not actually defined.
+    endpointIndexLookup.Find(endpoint, [&](uint16_t ep) {
+        return ep < emberAfEndpointCount() &&
+            emberAfFindClusterInType(emAfEndpoints[ep].endpointType, clusterId, mask, &index) != nullptr;
+    });
+    return index;
 }
 
 // Returns whether the given endpoint has the server of the given cluster on it.
@@ -377,6 +377,11 @@ public:
 
     OperationalCredentialsDelegate * GetOperationalCredentialsDelegate() { return mOperationalCredentialsDelegate; }
 
+    void SetOperationalCredentialsDelegate(OperationalCredentialsDelegate * operationalCredentialsDelegate)
+    {
+        mOperationalCredentialsDelegate = operationalCredentialsDelegate;
+    }
+
     /**
      * @brief
      *   Reconfigures a new set of operational credentials to be used with this
@@ -0,0 +1,564 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/CommissioningPipeline.h>
+
+#include <lib/support/CHIPMemString.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+using namespace chip::Credentials;
+using namespace chip::System::Clock;
+
+namespace chip {
+namespace Controller {
+
+SharedCredentialsIssuer::SharedCredentialsIssuer()
+{
+    for (auto & request : mRequests)
+    {
+        request.owner = this;
+    }
+}
+
+CHIP_ERROR SharedCredentialsIssuer::Init(OperationalCredentialsDelegate * issuer, uint8_t maxConcurrent)
+{
+    VerifyOrReturnError(issuer != nullptr && maxConcurrent > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    mIssuer        = issuer;
+    mMaxConcurrent = maxConcurrent;
+    return CHIP_NO_ERROR;
+}
+
+void SharedCredentialsIssuer::Shutdown()
+{
+    for (auto & request : mRequests)
+    {
+        request.state = Request::State::kFree;
+    }
+    mIssuer       = nullptr;
+    mAdminSubject = kUndefinedNodeId;
+    mNextNodeId.ClearValue();
+    mNextFabricId.ClearValue();
+}
+
+CHIP_ERROR SharedCredentialsIssuer::GenerateNOCChain(const ByteSpan & csrElements, const ByteSpan & csrNonce,
+                                                     const ByteSpan & attestationSignature, const ByteSpan & attestationChallenge,
+                                                     const ByteSpan & DAC, const ByteSpan & PAI,
+                                                     Callback::Callback<OnNOCChainGeneration> * onCompletion)
+{
+    VerifyOrReturnError(mIssuer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(onCompletion != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Request * request = nullptr;
+    for (auto & candidate : mRequests)
+    {
+        if (candidate.state == Request::State::kFree)
+        {
+            request = &candidate;
+            break;
+        }
+    }
+    VerifyOrReturnError(request != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    request->state                = Request::State::kQueued;
+    request->sequence             = mNextSequence++;
+    request->csrElements          = csrElements;
+    request->csrNonce             = csrNonce;
+    request->attestationSignature = attestationSignature;
+    request->attestationChallenge = attestationChallenge;
+    request->dac                  = DAC;
+    request->pai                  = PAI;
+    request->nodeId               = mNextNodeId;
+    request->fabricId             = mNextFabricId;
+    request->onCompletion         = onCompletion;
+    mNextNodeId.ClearValue();
+    mNextFabricId.ClearValue();
+
+    StartQueuedRequests();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SharedCredentialsIssuer::ObtainCsrNonce(MutableByteSpan & csrNonce)
+{
+    VerifyOrReturnError(mIssuer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return mIssuer->ObtainCsrNonce(csrNonce);
+}
+
+void SharedCredentialsIssuer::StartQueuedRequests()
+{
+    // An issuer which completes synchronously calls back into this from GenerateNOCChain(), possibly for a commissioner
+    // which then makes another request: let the outermost call start it rather than recurse.
+    VerifyOrReturn(!mStartingRequests);
+    mStartingRequests = true;
+
+    while (mIssuer != nullptr && GetActiveCount() < mMaxConcurrent)
+    {
+        Request * next = nullptr;
+        for (auto & request : mRequests)
+        {
+            // Oldest first: the sequence numbers may wrap around.
+            if (request.state == Request::State::kQueued &&
+                (next == nullptr || static_cast<int32_t>(request.sequence - next->sequence) < 0))
+            {
+                next = &request;
+            }
+        }
+        if (next == nullptr)
+        {
+            break;
+        }
+
+        next->state = Request::State::kActive;
+        if (next->nodeId.HasValue())
+        {
+            mIssuer->SetNodeIdForNextNOCRequest(next->nodeId.Value());
+        }
+        if (next->fabricId.HasValue())
+        {
+            mIssuer->SetFabricIdForNextNOCRequest(next->fabricId.Value());
+        }
+        CHIP_ERROR err = mIssuer->GenerateNOCChain(next->csrElements, next->csrNonce, next->attestationSignature,
+                                                   next->attestationChallenge, next->dac, next->pai, &next->issuerCallback);
+        if (err != CHIP_NO_ERROR && next->state == Request::State::kActive)
+        {
+            OnNOCChainGenerated(next, err, ByteSpan(), ByteSpan(), ByteSpan(), NullOptional, NullOptional);
+        }
+    }
+
+    mStartingRequests = false;
+}
+
+void SharedCredentialsIssuer::OnNOCChainGenerated(void * context, CHIP_ERROR status, const ByteSpan & noc, const ByteSpan & icac,
+                                                  const ByteSpan & rcac, Optional<Crypto::IdentityProtectionKeySpan> ipk,
+                                                  Optional<NodeId> adminSubject)
+{
+    auto * request = static_cast<Request *>(context);
+    // Completion of a request dropped by Shutdown().
+    VerifyOrReturn(request->state == Request::State::kActive);
+
+    // Free the request first: the commissioner may make its next one right away.
+    Callback::Callback<OnNOCChainGeneration> * onCompletion = request->onCompletion;
+    request->state                                          = Request::State::kFree;
+    request->onCompletion                                   = nullptr;
+
+    if (!adminSubject.HasValue() && request->owner->mAdminSubject != kUndefinedNodeId)
+    {
+        adminSubject.SetValue(request->owner->mAdminSubject);
+    }
+
+    onCompletion->mCall(onCompletion->mContext, status, noc, icac, rcac, ipk, adminSubject);
+    request->owner->StartQueuedRequests();
+}
+
+size_t SharedCredentialsIssuer::Count(Request::State state) const
+{
+    size_t count = 0;
+    for (const auto & request : mRequests)
+    {
+        count += (request.state == state) ? 1 : 0;
+    }
+    return count;
+}
+
+SharedAttestationVerifier::SharedAttestationVerifier()
+{
+    for (auto & request : mRequests)
+    {
+        request.owner = this;
+    }
+}
+
+CHIP_ERROR SharedAttestationVerifier::Init(DeviceAttestationVerifier * verifier, uint8_t maxConcurrent)
+{
+    VerifyOrReturnError(verifier != nullptr && maxConcurrent > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    mVerifier      = verifier;
+    mMaxConcurrent = maxConcurrent;
+    EnableCdTestKeySupport(verifier->IsCdTestKeySupported());
+    EnableVerboseLogs(verifier->AreVerboseLogsEnabled());
+    return CHIP_NO_ERROR;
+}
+
+void SharedAttestationVerifier::Shutdown()
+{
+    for (auto & request : mRequests)
+    {
+        request.state = Request::State::kFree;
+        request.info.ClearValue();
+    }
+    mVerifier = nullptr;
+}
+
+void SharedAttestationVerifier::VerifyAttestationInformation(
+    const AttestationInfo & info, Callback::Callback<OnAttestationInformationVerification> * onCompletion)
+{
+    Enqueue(Request::Kind::kVerifyAttestationInformation, info, onCompletion);
+}
+
+void SharedAttestationVerifier::CheckForRevokedDACChain(const AttestationInfo & info,
+                                                        Callback::Callback<OnAttestationInformationVerification> * onCompletion)
+{
+    Enqueue(Request::Kind::kCheckForRevokedDACChain, info, onCompletion);
+}
+
+AttestationVerificationResult
+SharedAttestationVerifier::ValidateCertificationDeclarationSignature(const ByteSpan & cmsEnvelopeBuffer, ByteSpan & certDeclBuffer)
+{
+    VerifyOrReturnValue(mVerifier != nullptr, AttestationVerificationResult::kInternalError);
+    return mVerifier->ValidateCertificationDeclarationSignature(cmsEnvelopeBuffer, certDeclBuffer);
+}
+
+AttestationVerificationResult SharedAttestationVerifier::ValidateCertificateDeclarationPayload(
+    const ByteSpan & certDeclBuffer, const ByteSpan & firmwareInfo, const DeviceInfoForAttestation & deviceInfo)
+{
+    VerifyOrReturnValue(mVerifier != nullptr, AttestationVerificationResult::kInternalError);
+    return mVerifier->ValidateCertificateDeclarationPayload(certDeclBuffer, firmwareInfo, deviceInfo);
+}
+
+CHIP_ERROR SharedAttestationVerifier::VerifyNodeOperationalCSRInformation(const ByteSpan & nocsrElementsBuffer,
+                                                                          const ByteSpan & attestationChallengeBuffer,
+                                                                          const ByteSpan & attestationSignatureBuffer,
+                                                                          const Crypto::P256PublicKey & dacPublicKey,
+                                                                          const ByteSpan & csrNonce)
+{
+    VerifyOrReturnError(mVerifier != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return mVerifier->VerifyNodeOperationalCSRInformation(nocsrElementsBuffer, attestationChallengeBuffer,
+                                                          attestationSignatureBuffer, dacPublicKey, csrNonce);
+}
+
+WellKnownKeysTrustStore * SharedAttestationVerifier::GetCertificationDeclarationTrustStore()
+{
+    VerifyOrReturnValue(mVerifier != nullptr, nullptr);
+    return mVerifier->GetCertificationDeclarationTrustStore();
+}
+
+CHIP_ERROR SharedAttestationVerifier::SetRevocationDelegate(DeviceAttestationRevocationDelegate * revocationDelegate)
+{
+    VerifyOrReturnError(mVerifier != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    return mVerifier->SetRevocationDelegate(revocationDelegate);
+}
+
+void SharedAttestationVerifier::Enqueue(Request::Kind kind, const AttestationInfo & info,
+                                        Callback::Callback<OnAttestationInformationVerification> * onCompletion)
+{
+    VerifyOrReturn(onCompletion != nullptr);
+
+    Request * request = nullptr;
+    for (auto & candidate : mRequests)
+    {
+        if (candidate.state == Request::State::kFree)
+        {
+            request = &candidate;
+            break;
+        }
+    }
+    if (mVerifier == nullptr || request == nullptr)
+    {
+        onCompletion->mCall(onCompletion->mContext, info,
+                            mVerifier == nullptr ? AttestationVerificationResult::kInternalError
+                                                 : AttestationVerificationResult::kNoMemory);
+        return;
+    }
+
+    request->state        = Request::State::kQueued;
+    request->kind         = kind;
+    request->sequence     = mNextSequence++;
+    request->onCompletion = onCompletion;
+    request->info.Emplace(info);
+
+    StartQueuedRequests();
+}
+
+void SharedAttestationVerifier::StartQueuedRequests()
+{
+    // The default verifier completes synchronously: see SharedCredentialsIssuer::StartQueuedRequests().
+    VerifyOrReturn(!mStartingRequests);
+    mStartingRequests = true;
+
+    while (mVerifier != nullptr && GetActiveCount() < mMaxConcurrent)
+    {
+        Request * next = nullptr;
+        for (auto & request : mRequests)
+        {
+            // Oldest first: the sequence numbers may wrap around.
+            if (request.state == Request::State::kQueued &&
+                (next == nullptr || static_cast<int32_t>(request.sequence - next->sequence) < 0))
+            {
+                next = &request;
+            }
+        }
+        if (next == nullptr)
+        {
+            break;
+        }
+
+        next->state = Request::State::kActive;
+        if (next->kind == Request::Kind::kVerifyAttestationInformation)
+        {
+            mVerifier->VerifyAttestationInformation(next->info.Value(), &next->verifierCallback);
+        }
+        else
+        {
+            mVerifier->CheckForRevokedDACChain(next->info.Value(), &next->verifierCallback);
+        }
+    }
+
+    mStartingRequests = false;
+}
+
+void SharedAttestationVerifier::OnVerified(void * context, const AttestationInfo & info, AttestationVerificationResult result)
+{
+    auto * request = static_cast<Request *>(context);
+    // Completion of a request dropped by Shutdown().
+    VerifyOrReturn(request->state == Request::State::kActive);
+
+    // Free the request first: the commissioner may make its next one right away. The verifier may have passed the info
+    // of the request, which is about to go away, so keep a copy; it refers to buffers of the commissioner.
+    AttestationInfo infoCopy(info);
+    Callback::Callback<OnAttestationInformationVerification> * onCompletion = request->onCompletion;
+    request->state                                                          = Request::State::kFree;
+    request->onCompletion                                                   = nullptr;
+    request->info.ClearValue();
+
+    onCompletion->mCall(onCompletion->mContext, infoCopy, result);
+    request->owner->StartQueuedRequests();
+}
+
+size_t SharedAttestationVerifier::Count(Request::State state) const
+{
+    size_t count = 0;
+    for (const auto & request : mRequests)
+    {
+        count += (request.state == state) ? 1 : 0;
+    }
+    return count;
+}
+
+void CommissioningPipeline::StageStatistics::Add(Milliseconds64 time)
+{
+    count++;
+    totalTime += time;
+    if (time > maxTime)
+    {
+        maxTime = time;
+    }
+}
+
+CHIP_ERROR CommissioningPipeline::Init(const InitParams & params)
+{
+    VerifyOrReturnError(mSystemLayer == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(params.systemLayer != nullptr && params.delegate != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(params.maxConcurrentNOCChainRequests <= CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES &&
+                            params.maxConcurrentAttestationChecks <= CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(mCredentialsIssuer.Init(params.operationalCredentialsDelegate, params.maxConcurrentNOCChainRequests));
+    CHIP_ERROR err = mAttestationVerifier.Init(params.deviceAttestationVerifier, params.maxConcurrentAttestationChecks);
+    if (err != CHIP_NO_ERROR)
+    {
+        mCredentialsIssuer.Shutdown();
+        return err;
+    }
+
+    mCredentialsIssuer.SetAdminSubject(params.adminSubject);
+    mSystemLayer   = params.systemLayer;
+    mDelegate      = params.delegate;
+    mDiscoveryType = params.discoveryType;
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningPipeline::Shutdown()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+
+    mSystemLayer->CancelTimer(StartQueuedDevices, this);
+    mQueueHead   = 0;
+    mQueuedCount = 0;
+
+    // Stop the requests first: the commissioners must not hear back from them once their commissioning is stopped.
+    mCredentialsIssuer.Shutdown();
+    mAttestationVerifier.Shutdown();
+
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        Lane & lane   = mLanes[i];
+        NodeId nodeId = lane.mNodeId;
+        lane.mNodeId  = kUndefinedNodeId;
+        if (nodeId != kUndefinedNodeId)
+        {
+            RETURN_SAFELY_IGNORED lane.mCommissioner->StopPairing(nodeId);
+        }
+        lane.mCommissioner->RegisterPairingDelegate(lane.mPreviousPairingDelegate);
+        lane.mCommissioner->SetOperationalCredentialsDelegate(lane.mPreviousCredentialsDelegate);
+        lane.mCommissioner->SetDeviceAttestationVerifier(lane.mPreviousAttestationVerifier);
+        lane = Lane();
+    }
+    mLaneCount = 0;
+
+    mSystemLayer = nullptr;
+    mDelegate    = nullptr;
+}
+
+CHIP_ERROR CommissioningPipeline::AddLane(DeviceCommissioner & commissioner)
+{
+    VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mLaneCount < MATTER_ARRAY_SIZE(mLanes), CHIP_ERROR_NO_MEMORY);
+
+    Lane & lane                       = mLanes[mLaneCount++];
+    lane.mPipeline                    = this;
+    lane.mCommissioner                = &commissioner;
+    lane.mPreviousPairingDelegate     = commissioner.GetPairingDelegate();
+    lane.mPreviousCredentialsDelegate = commissioner.GetOperationalCredentialsDelegate();
+    lane.mPreviousAttestationVerifier = commissioner.GetDeviceAttestationVerifier();
+    commissioner.RegisterPairingDelegate(&lane);
+    commissioner.SetOperationalCredentialsDelegate(&mCredentialsIssuer);
+    commissioner.SetDeviceAttestationVerifier(&mAttestationVerifier);
+    if (mCredentialsIssuer.GetAdminSubject() == kUndefinedNodeId)
+    {
+        mCredentialsIssuer.SetAdminSubject(commissioner.GetNodeId());
+    }
+
+    if (mQueuedCount > 0)
+    {
+        StartQueuedDevices();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CommissioningPipeline::Enqueue(NodeId nodeId, const char * setUpCode)
+{
+    VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(nodeId != kUndefinedNodeId && setUpCode != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(strlen(setUpCode) <= kMaxSetUpCodeLength, CHIP_ERROR_BUFFER_TOO_SMALL);
+    VerifyOrReturnError(mQueuedCount < MATTER_ARRAY_SIZE(mQueue), CHIP_ERROR_NO_MEMORY);
+
+    QueuedDevice & device = mQueue[(mQueueHead + mQueuedCount) % MATTER_ARRAY_SIZE(mQueue)];
+    device.nodeId         = nodeId;
+    Platform::CopyString(device.setUpCode, setUpCode);
+    mQueuedCount++;
+
+    StartQueuedDevices();
+    return CHIP_NO_ERROR;
+}
+
+size_t CommissioningPipeline::GetInProgressCount() const
+{
+    size_t count = 0;
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        count += mLanes[i].IsBusy() ? 1 : 0;
+    }
+    return count;
+}
+
+void CommissioningPipeline::ResetStatistics()
+{
+    for (auto & statistics : mStageStatistics)
+    {
+        statistics = StageStatistics();
+    }
+    mDeviceStatistics = StageStatistics();
+}
+
+void CommissioningPipeline::StartQueuedDevices(System::Layer * systemLayer, void * context)
+{
+    static_cast<CommissioningPipeline *>(context)->StartQueuedDevices();
+}
+
+void CommissioningPipeline::StartQueuedDevices()
+{
+    for (size_t i = 0; i < mLaneCount && mQueuedCount > 0; i++)
+    {
+        // A lane which could not start a device takes the next one.
+        Lane & lane = mLanes[i];
+        while (!lane.IsBusy() && mQueuedCount > 0)
+        {
+            QueuedDevice & device = mQueue[mQueueHead];
+            mQueueHead            = (mQueueHead + 1) % MATTER_ARRAY_SIZE(mQueue);
+            mQueuedCount--;
+
+            lane.mNodeId         = device.nodeId;
+            lane.mStartTime      = System::SystemClock().GetMonotonicTimestamp();
+            lane.mStageStartTime = lane.mStartTime;
+            CHIP_ERROR err       = lane.mCommissioner->PairDevice(device.nodeId, device.setUpCode, mDiscoveryType);
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(Controller, "Could not start commissioning node ID 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                             ChipLogValueX64(device.nodeId), err.Format());
+                lane.mNodeId = kUndefinedNodeId;
+                mDelegate->OnDeviceCommissioned(device.nodeId, err);
+            }
+        }
+    }
+
+    if (mQueuedCount == 0 && GetInProgressCount() == 0)
+    {
+        mDelegate->OnPipelineIdle();
+    }
+}
+
+void CommissioningPipeline::OnLaneDone(Lane & lane, CHIP_ERROR error)
+{
+    NodeId nodeId = lane.mNodeId;
+    lane.mNodeId  = kUndefinedNodeId;
+    if (error == CHIP_NO_ERROR)
+    {
+        mDeviceStatistics.Add(Since(lane.mStartTime));
+    }
+    mDelegate->OnDeviceCommissioned(nodeId, error);
+
+    // The commissioner is still unwinding from the completion of this device: give it the next one from the event loop.
+    TEMPORARY_RETURN_IGNORED mSystemLayer->StartTimer(kZero, StartQueuedDevices, this);
+}
+
+Milliseconds64 CommissioningPipeline::Since(Timestamp start)
+{
+    return System::SystemClock().GetMonotonicTimestamp() - start;
+}
+
+void CommissioningPipeline::Lane::OnPairingComplete(CHIP_ERROR error)
+{
+    VerifyOrReturn(IsBusy());
+    mPipeline->mStageStatistics[CommissioningStage::kSecurePairing].Add(Since(mStartTime));
+    if (error != CHIP_NO_ERROR)
+    {
+        // No commissioning without a PASE session: this is the end for this device.
+        mPipeline->OnLaneDone(*this, error);
+    }
+}
+
+void CommissioningPipeline::Lane::OnCommissioningStageStart(PeerId peerId, CommissioningStage stageStarting)
+{
+    mStageStartTime = System::SystemClock().GetMonotonicTimestamp();
+}
+
+void CommissioningPipeline::Lane::OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error)
+{
+    VerifyOrReturn(IsBusy() && peerId.GetNodeId() == mNodeId && stageCompleted < kStageCount);
+    mPipeline->mStageStatistics[stageCompleted].Add(Since(mStageStartTime));
+}
+
+void CommissioningPipeline::Lane::OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error)
+{
+    VerifyOrReturn(IsBusy() && deviceId == mNodeId);
+    mPipeline->OnLaneDone(*this, error);
+}
+
+} // namespace Controller
+} // namespace chip
@@ -0,0 +1,364 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Commissioning of several devices at once, by a set of DeviceCommissioner instances which share the
+ *      operational credentials issuer and the device attestation verifier.
+ */
+
+#pragma once
+
+#include <controller/CHIPDeviceController.h>
+#include <controller/CommissioningDelegate.h>
+#include <controller/DevicePairingDelegate.h>
+#include <controller/OperationalCredentialsDelegate.h>
+#include <controller/SetUpCodePairer.h>
+#include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <lib/core/CHIPCallback.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/NodeId.h>
+#include <lib/core/Optional.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * An OperationalCredentialsDelegate through which several commissioners share one NOC chain issuer.
+ *
+ * At most `maxConcurrent` requests are handed to the issuer at a time, in the order they were made; the others wait.
+ * The node and fabric IDs set for the next request are kept with it and passed to the issuer when it starts, so an
+ * asynchronous issuer cannot mix them up between commissioners.
+ *
+ * A commissioner waits for the completion of its request, so the buffers it passes stay valid while the request is
+ * queued. Each commissioner has one request at most in flight: the queue holds one per pipeline lane.
+ *
+ * A commissioner grants Administer privilege on the device to the admin subject the issuer returns, and to itself when
+ * the issuer returns none. As each commissioner has a node ID of its own, the admin subject set here is returned
+ * instead when the issuer returns none, so that every device grants it to the same subject.
+ */
+class SharedCredentialsIssuer : public OperationalCredentialsDelegate
+{
+public:
+    SharedCredentialsIssuer();
+
+    CHIP_ERROR Init(OperationalCredentialsDelegate * issuer, uint8_t maxConcurrent);
+
+    /**
+     * Drop the queued requests, and ignore the completion of those the issuer is processing.
+     */
+    void Shutdown();
+
+    CHIP_ERROR GenerateNOCChain(const ByteSpan & csrElements, const ByteSpan & csrNonce, const ByteSpan & attestationSignature,
+                                const ByteSpan & attestationChallenge, const ByteSpan & DAC, const ByteSpan & PAI,
+                                Callback::Callback<OnNOCChainGeneration> * onCompletion) override;
+    void SetNodeIdForNextNOCRequest(NodeId nodeId) override { mNextNodeId.SetValue(nodeId); }
+    void SetFabricIdForNextNOCRequest(FabricId fabricId) override { mNextFabricId.SetValue(fabricId); }
+    CHIP_ERROR ObtainCsrNonce(MutableByteSpan & csrNonce) override;
+
+    /**
+     * Set the admin subject returned for the requests the issuer returns none for: a node ID, or a CASE Authenticated
+     * Tag (see NodeIdFromCASEAuthTag()). kUndefinedNodeId, the default, returns none.
+     */
+    void SetAdminSubject(NodeId adminSubject) { mAdminSubject = adminSubject; }
+    NodeId GetAdminSubject() const { return mAdminSubject; }
+
+    size_t GetQueuedCount() const { return Count(Request::State::kQueued); }
+    size_t GetActiveCount() const { return Count(Request::State::kActive); }
+
+private:
+    struct Request
+    {
+        enum class State : uint8_t
+        {
+            kFree,
+            kQueued,
+            kActive,
+        };
+
+        Request() : issuerCallback(OnNOCChainGenerated, this) {}
+
+        SharedCredentialsIssuer * owner = nullptr;
+        State state                     = State::kFree;
+        uint32_t sequence               = 0;
+        ByteSpan csrElements;
+        ByteSpan csrNonce;
+        ByteSpan attestationSignature;
+        ByteSpan attestationChallenge;
+        ByteSpan dac;
+        ByteSpan pai;
+        Optional<NodeId> nodeId;
+        Optional<FabricId> fabricId;
+        Callback::Callback<OnNOCChainGeneration> * onCompletion = nullptr;
+        Callback::Callback<OnNOCChainGeneration> issuerCallback;
+    };
+
+    static void OnNOCChainGenerated(void * context, CHIP_ERROR status, const ByteSpan & noc, const ByteSpan & icac,
+                                    const ByteSpan & rcac, Optional<Crypto::IdentityProtectionKeySpan> ipk,
+                                    Optional<NodeId> adminSubject);
+
+    void StartQueuedRequests();
+    size_t Count(Request::State state) const;
+
+    OperationalCredentialsDelegate * mIssuer = nullptr;
+    uint8_t mMaxConcurrent                   = 1;
+    uint32_t mNextSequence                   = 0;
+    bool mStartingRequests                   = false;
+    NodeId mAdminSubject                     = kUndefinedNodeId;
+    Optional<NodeId> mNextNodeId;
+    Optional<FabricId> mNextFabricId;
+    Request mRequests[CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES];
+};
+
+/**
+ * A DeviceAttestationVerifier through which several commissioners share one verifier.
+ *
+ * Attestation verifications and DAC chain revocation checks go to the verifier `maxConcurrent` at a time, in the order
+ * they were made; the others wait. The other checks are synchronous, and are passed on as they come.
+ */
+class SharedAttestationVerifier : public Credentials::DeviceAttestationVerifier
+{
+public:
+    SharedAttestationVerifier();
+
+    CHIP_ERROR Init(Credentials::DeviceAttestationVerifier * verifier, uint8_t maxConcurrent);
+
+    /**
+     * Drop the queued requests, and ignore the completion of those the verifier is processing.
+     */
+    void Shutdown();
+
+    void VerifyAttestationInformation(const AttestationInfo & info,
+                                      Callback::Callback<OnAttestationInformationVerification> * onCompletion) override;
+    Credentials::AttestationVerificationResult ValidateCertificationDeclarationSignature(const ByteSpan & cmsEnvelopeBuffer,
+                                                                                         ByteSpan & certDeclBuffer) override;
+    Credentials::AttestationVerificationResult
+    ValidateCertificateDeclarationPayload(const ByteSpan & certDeclBuffer, const ByteSpan & firmwareInfo,
+                                          const Credentials::DeviceInfoForAttestation & deviceInfo) override;
+    CHIP_ERROR VerifyNodeOperationalCSRInformation(const ByteSpan & nocsrElementsBuffer,
+                                                   const ByteSpan & attestationChallengeBuffer,
+                                                   const ByteSpan & attestationSignatureBuffer,
+                                                   const Crypto::P256PublicKey & dacPublicKey, const ByteSpan & csrNonce) override;
+    void CheckForRevokedDACChain(const AttestationInfo & info,
+                                 Callback::Callback<OnAttestationInformationVerification> * onCompletion) override;
+    Credentials::WellKnownKeysTrustStore * GetCertificationDeclarationTrustStore() override;
+    CHIP_ERROR SetRevocationDelegate(Credentials::DeviceAttestationRevocationDelegate * revocationDelegate) override;
+
+    size_t GetQueuedCount() const { return Count(Request::State::kQueued); }
+    size_t GetActiveCount() const { return Count(Request::State::kActive); }
+
+private:
+    struct Request
+    {
+        enum class State : uint8_t
+        {
+            kFree,
+            kQueued,
+            kActive,
+        };
+
+        enum class Kind : uint8_t
+        {
+            kVerifyAttestationInformation,
+            kCheckForRevokedDACChain,
+        };
+
+        Request() : verifierCallback(OnVerified, this) {}
+
+        SharedAttestationVerifier * owner = nullptr;
+        State state                       = State::kFree;
+        Kind kind                         = Kind::kVerifyAttestationInformation;
+        uint32_t sequence                 = 0;
+        Optional<AttestationInfo> info;
+        Callback::Callback<OnAttestationInformationVerification> * onCompletion = nullptr;
+        Callback::Callback<OnAttestationInformationVerification> verifierCallback;
+    };
+
+    static void OnVerified(void * context, const AttestationInfo & info, Credentials::AttestationVerificationResult result);
+
+    void Enqueue(Request::Kind kind, const AttestationInfo & info,
+                 Callback::Callback<OnAttestationInformationVerification> * onCompletion);
+    void StartQueuedRequests();
+    size_t Count(Request::State state) const;
+
+    Credentials::DeviceAttestationVerifier * mVerifier = nullptr;
+    uint8_t mMaxConcurrent                             = 1;
+    uint32_t mNextSequence                             = 0;
+    bool mStartingRequests                             = false;
+    Request mRequests[CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES];
+};
+
+/**
+ * Commissions a queue of devices, several at a time.
+ *
+ * A DeviceCommissioner, and the AutoCommissioner state machine it runs, handles one commissionee at a time. The
+ * pipeline drives a set of them, its lanes, which each take the next device from the queue as soon as they are done
+ * with the previous one; the devices thus progress through the commissioning stages independently of each other.
+ *
+ * The lanes find their device with their own SetUpCodePairer, through the DNS-SD resolver of the controller system
+ * state they share. NOC chain issuance and device attestation verification go through a SharedCredentialsIssuer and a
+ * SharedAttestationVerifier, which bound how many requests the issuer and the verifier process at once.
+ *
+ * The lanes are commissioners of the same fabric: each has its own controller node ID (see
+ * ControllerInitParams::permitMultiControllerFabrics). The devices grant Administer privilege to one admin subject
+ * rather than to the lane which commissioned them. Their commissioning parameters are left to the application.
+ *
+ * Must be used on the Matter thread.
+ */
+class CommissioningPipeline
+{
+public:
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /**
+         * A device left the pipeline, commissioned if error is CHIP_NO_ERROR.
+         */
+        virtual void OnDeviceCommissioned(NodeId nodeId, CHIP_ERROR error) = 0;
+
+        /**
+         * No device is queued nor being commissioned anymore.
+         */
+        virtual void OnPipelineIdle() {}
+    };
+
+    struct InitParams
+    {
+        System::Layer * systemLayer                                        = nullptr;
+        OperationalCredentialsDelegate * operationalCredentialsDelegate    = nullptr;
+        Credentials::DeviceAttestationVerifier * deviceAttestationVerifier = nullptr;
+        Delegate * delegate                                                = nullptr;
+        // How many NOC chain requests and attestation verifications the issuer and the verifier process at once.
+        uint8_t maxConcurrentNOCChainRequests  = 1;
+        uint8_t maxConcurrentAttestationChecks = 1;
+        DiscoveryType discoveryType            = DiscoveryType::kAll;
+        // Subject granted Administer privilege on the devices, unless the issuer picks one (see
+        // SharedCredentialsIssuer::SetAdminSubject()). Defaults to the node ID of the first lane.
+        NodeId adminSubject = kUndefinedNodeId;
+    };
+
+    /**
+     * Time spent in a commissioning stage, over the devices which went through it.
+     */
+    struct StageStatistics
+    {
+        uint32_t count                          = 0;
+        System::Clock::Milliseconds64 totalTime = System::Clock::kZero;
+        System::Clock::Milliseconds64 maxTime   = System::Clock::kZero;
+
+        void Add(System::Clock::Milliseconds64 time);
+    };
+
+    ~CommissioningPipeline() { Shutdown(); }
+
+    CHIP_ERROR Init(const InitParams & params);
+
+    /**
+     * Stop the commissionings in progress, drop the queued devices and give the lanes back their own pairing delegate,
+     * operational credentials delegate and device attestation verifier. Must be called before the lanes are shut down.
+     */
+    void Shutdown();
+
+    /**
+     * Add a commissioner to the pipeline. It must be initialized, and not be commissioning a device.
+     */
+    CHIP_ERROR AddLane(DeviceCommissioner & commissioner);
+
+    /**
+     * Queue a device for commissioning, under the given node ID. The device is commissioned by the first lane available.
+     */
+    CHIP_ERROR Enqueue(NodeId nodeId, const char * setUpCode);
+
+    size_t GetQueuedCount() const { return mQueuedCount; }
+    size_t GetInProgressCount() const;
+
+    /**
+     * Statistics of a commissioning stage. kSecurePairing covers the discovery of the device and the PASE session
+     * establishment.
+     */
+    const StageStatistics & GetStageStatistics(CommissioningStage stage) const { return mStageStatistics[stage]; }
+
+    /**
+     * Statistics of the commissioning of a device, from its lane starting it to its completion.
+     */
+    const StageStatistics & GetDeviceStatistics() const { return mDeviceStatistics; }
+
+    void ResetStatistics();
+
+private:
+    static constexpr size_t kMaxSetUpCodeLength = 256;
+    static constexpr size_t kStageCount         = static_cast<size_t>(CommissioningStage::kCleanup) + 1;
+
+    class Lane : public DevicePairingDelegate
+    {
+    public:
+        bool IsBusy() const { return mNodeId != kUndefinedNodeId; }
+
+        void OnPairingComplete(CHIP_ERROR error) override;
+        void OnCommissioningStageStart(PeerId peerId, CommissioningStage stageStarting) override;
+        void OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error) override;
+        void OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error) override;
+
+        CommissioningPipeline * mPipeline                                     = nullptr;
+        DeviceCommissioner * mCommissioner                                    = nullptr;
+        DevicePairingDelegate * mPreviousPairingDelegate                      = nullptr;
+        OperationalCredentialsDelegate * mPreviousCredentialsDelegate         = nullptr;
+        Credentials::DeviceAttestationVerifier * mPreviousAttestationVerifier = nullptr;
+        NodeId mNodeId                                                        = kUndefinedNodeId;
+        System::Clock::Timestamp mStartTime                                   = System::Clock::kZero;
+        System::Clock::Timestamp mStageStartTime                              = System::Clock::kZero;
+    };
+
+    struct QueuedDevice
+    {
+        NodeId nodeId;
+        char setUpCode[kMaxSetUpCodeLength + 1];
+    };
+
+    static void StartQueuedDevices(System::Layer * systemLayer, void * context);
+
+    void StartQueuedDevices();
+    void OnLaneDone(Lane & lane, CHIP_ERROR error);
+    static System::Clock::Milliseconds64 Since(System::Clock::Timestamp start);
+
+    System::Layer * mSystemLayer = nullptr;
+    Delegate * mDelegate         = nullptr;
+    DiscoveryType mDiscoveryType = DiscoveryType::kAll;
+    SharedCredentialsIssuer mCredentialsIssuer;
+    SharedAttestationVerifier mAttestationVerifier;
+
+    Lane mLanes[CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES];
+    size_t mLaneCount = 0;
+
+    // Ring buffer of the devices waiting for a lane.
+    QueuedDevice mQueue[CHIP_CONFIG_COMMISSIONING_PIPELINE_QUEUE_SIZE];
+    size_t mQueueHead   = 0;
+    size_t mQueuedCount = 0;
+
+    StageStatistics mStageStatistics[kStageCount];
+    StageStatistics mDeviceStatistics;
+};
+
+} // namespace Controller
+} // namespace chip
@@ -0,0 +1,352 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <controller/CommissioningPipeline.h>
+#include <lib/core/CASEAuthTag.h>
+#include <lib/core/StringBuilderAdapters.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::Controller;
+using namespace chip::Credentials;
+
+namespace {
+
+// An issuer which completes the requests when told to, or right away. Like ExampleOperationalCredentialsIssuer, it
+// may return no admin subject, which leaves the commissioner to grant Administer privilege to itself.
+class FakeIssuer : public OperationalCredentialsDelegate
+{
+public:
+    struct Request
+    {
+        NodeId nodeId;
+        FabricId fabricId;
+        Callback::Callback<OnNOCChainGeneration> * onCompletion;
+    };
+
+    CHIP_ERROR GenerateNOCChain(const ByteSpan & csrElements, const ByteSpan & csrNonce, const ByteSpan & attestationSignature,
+                                const ByteSpan & attestationChallenge, const ByteSpan & DAC, const ByteSpan & PAI,
+                                Callback::Callback<OnNOCChainGeneration> * onCompletion) override
+    {
+        if (mError != CHIP_NO_ERROR)
+        {
+            return mError;
+        }
+        mRequests.push_back({ mNextNodeId, mNextFabricId, onCompletion });
+        if (mCompleteSynchronously)
+        {
+            Complete(mRequests.size() - 1, CHIP_NO_ERROR);
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    void SetNodeIdForNextNOCRequest(NodeId nodeId) override { mNextNodeId = nodeId; }
+    void SetFabricIdForNextNOCRequest(FabricId fabricId) override { mNextFabricId = fabricId; }
+
+    void Complete(size_t index, CHIP_ERROR status)
+    {
+        auto * onCompletion = mRequests[index].onCompletion;
+        onCompletion->mCall(onCompletion->mContext, status, ByteSpan(), ByteSpan(), ByteSpan(), NullOptional,
+                            mReturnsAdminSubject ? MakeOptional(mRequests[index].nodeId) : NullOptional);
+    }
+
+    std::vector<Request> mRequests;
+    NodeId mNextNodeId          = kUndefinedNodeId;
+    FabricId mNextFabricId      = kUndefinedFabricId;
+    bool mCompleteSynchronously = false;
+    bool mReturnsAdminSubject   = true;
+    CHIP_ERROR mError           = CHIP_NO_ERROR;
+};
+
+// A commissioner waiting for its NOC chain.
+struct NOCChainWaiter
+{
+    NOCChainWaiter() : callback(OnNOCChainGenerated, this) {}
+
+    static void OnNOCChainGenerated(void * context, CHIP_ERROR status, const ByteSpan & noc, const ByteSpan & icac,
+                                    const ByteSpan & rcac, Optional<Crypto::IdentityProtectionKeySpan> ipk,
+                                    Optional<NodeId> adminSubject)
+    {
+        auto * waiter = static_cast<NOCChainWaiter *>(context);
+        waiter->completions++;
+        waiter->status  = status;
+        waiter->subject = adminSubject.ValueOr(kUndefinedNodeId);
+    }
+
+    Callback::Callback<OnNOCChainGeneration> callback;
+    int completions   = 0;
+    CHIP_ERROR status = CHIP_NO_ERROR;
+    NodeId subject    = kUndefinedNodeId;
+};
+
+CHIP_ERROR RequestNOCChain(OperationalCredentialsDelegate & issuer, NodeId nodeId, NOCChainWaiter & waiter)
+{
+    issuer.SetNodeIdForNextNOCRequest(nodeId);
+    issuer.SetFabricIdForNextNOCRequest(1);
+    return issuer.GenerateNOCChain(ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(), &waiter.callback);
+}
+
+TEST(TestCommissioningPipeline, TestSharedIssuerBoundsConcurrency)
+{
+    FakeIssuer fake;
+    SharedCredentialsIssuer issuer;
+    ASSERT_EQ(issuer.Init(&fake, 2), CHIP_NO_ERROR);
+
+    NOCChainWaiter waiters[4];
+    for (size_t i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(RequestNOCChain(issuer, 100 + i, waiters[i]), CHIP_NO_ERROR);
+    }
+
+    // Two requests went to the issuer, each with its own node ID; the others wait.
+    ASSERT_EQ(fake.mRequests.size(), 2u);
+    EXPECT_EQ(fake.mRequests[0].nodeId, 100u);
+    EXPECT_EQ(fake.mRequests[1].nodeId, 101u);
+    EXPECT_EQ(fake.mRequests[1].fabricId, 1u);
+    EXPECT_EQ(issuer.GetActiveCount(), 2u);
+    EXPECT_EQ(issuer.GetQueuedCount(), 2u);
+
+    // Completing one starts the oldest queued request.
+    fake.Complete(1, CHIP_NO_ERROR);
+    EXPECT_EQ(waiters[1].completions, 1);
+    EXPECT_EQ(waiters[1].subject, 101u);
+    ASSERT_EQ(fake.mRequests.size(), 3u);
+    EXPECT_EQ(fake.mRequests[2].nodeId, 102u);
+
+    fake.Complete(0, CHIP_ERROR_INTERNAL);
+    EXPECT_EQ(waiters[0].completions, 1);
+    EXPECT_EQ(waiters[0].status, CHIP_ERROR_INTERNAL);
+    ASSERT_EQ(fake.mRequests.size(), 4u);
+    EXPECT_EQ(fake.mRequests[3].nodeId, 103u);
+
+    fake.Complete(2, CHIP_NO_ERROR);
+    fake.Complete(3, CHIP_NO_ERROR);
+    EXPECT_EQ(waiters[2].subject, 102u);
+    EXPECT_EQ(waiters[3].subject, 103u);
+    EXPECT_EQ(issuer.GetActiveCount(), 0u);
+    EXPECT_EQ(issuer.GetQueuedCount(), 0u);
+}
+
+TEST(TestCommissioningPipeline, TestSharedIssuerSynchronousIssuer)
+{
+    FakeIssuer fake;
+    fake.mCompleteSynchronously = true;
+    SharedCredentialsIssuer issuer;
+    ASSERT_EQ(issuer.Init(&fake, 1), CHIP_NO_ERROR);
+
+    NOCChainWaiter waiter;
+    EXPECT_EQ(RequestNOCChain(issuer, 42, waiter), CHIP_NO_ERROR);
+    EXPECT_EQ(waiter.completions, 1);
+    EXPECT_EQ(waiter.subject, 42u);
+    EXPECT_EQ(issuer.GetActiveCount(), 0u);
+
+    // An issuer failing to start a request completes it with the error.
+    fake.mError = CHIP_ERROR_NO_MEMORY;
+    EXPECT_EQ(RequestNOCChain(issuer, 43, waiter), CHIP_NO_ERROR);
+    EXPECT_EQ(waiter.completions, 2);
+    EXPECT_EQ(waiter.status, CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(issuer.GetActiveCount(), 0u);
+}
+
+TEST(TestCommissioningPipeline, TestSharedIssuerQueueFullAndShutdown)
+{
+    FakeIssuer fake;
+    SharedCredentialsIssuer issuer;
+    ASSERT_EQ(issuer.Init(&fake, 1), CHIP_NO_ERROR);
+
+    NOCChainWaiter waiters[CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES + 1];
+    for (size_t i = 0; i < CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES; i++)
+    {
+        EXPECT_EQ(RequestNOCChain(issuer, 100 + i, waiters[i]), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(RequestNOCChain(issuer, 1, waiters[CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES]), CHIP_ERROR_NO_MEMORY);
+
+    // Requests in progress when shutting down complete into the void.
+    issuer.Shutdown();
+    fake.Complete(0, CHIP_NO_ERROR);
+    EXPECT_EQ(waiters[0].completions, 0);
+    EXPECT_EQ(fake.mRequests.size(), 1u);
+    EXPECT_EQ(RequestNOCChain(issuer, 1, waiters[0]), CHIP_ERROR_INCORRECT_STATE);
+}
+
+TEST(TestCommissioningPipeline, TestSharedIssuerReturnsAdminSubject)
+{
+    FakeIssuer fake;
+    fake.mReturnsAdminSubject = false;
+    SharedCredentialsIssuer issuer;
+    ASSERT_EQ(issuer.Init(&fake, 2), CHIP_NO_ERROR);
+
+    // Without an admin subject, each commissioner would grant Administer privilege to its own node ID.
+    NOCChainWaiter waiters[3];
+    EXPECT_EQ(RequestNOCChain(issuer, 100, waiters[0]), CHIP_NO_ERROR);
+    fake.Complete(0, CHIP_NO_ERROR);
+    EXPECT_EQ(waiters[0].completions, 1);
+    EXPECT_EQ(waiters[0].subject, kUndefinedNodeId);
+
+    // The devices commissioned by any commissioner grant it to the same subject.
+    const NodeId adminSubject = NodeIdFromCASEAuthTag(GetAdminCATWithVersion(1));
+    issuer.SetAdminSubject(adminSubject);
+    EXPECT_EQ(RequestNOCChain(issuer, 101, waiters[1]), CHIP_NO_ERROR);
+    EXPECT_EQ(RequestNOCChain(issuer, 102, waiters[2]), CHIP_NO_ERROR);
+    fake.Complete(2, CHIP_NO_ERROR);
+    fake.Complete(1, CHIP_NO_ERROR);
+    EXPECT_EQ(waiters[1].subject, adminSubject);
+    EXPECT_EQ(waiters[2].subject, adminSubject);
+
+    // An admin subject picked by the issuer is kept.
+    fake.mReturnsAdminSubject = true;
+    EXPECT_EQ(RequestNOCChain(issuer, 103, waiters[0]), CHIP_NO_ERROR);
+    fake.Complete(3, CHIP_NO_ERROR);
+    EXPECT_EQ(waiters[0].subject, 103u);
+
+    issuer.Shutdown();
+    EXPECT_EQ(issuer.GetAdminSubject(), kUndefinedNodeId);
+}
+
+// A verifier which completes the requests when told to.
+class FakeVerifier : public DeviceAttestationVerifier
+{
+public:
+    struct Request
+    {
+        bool revocationCheck;
+        uint16_t productId;
+        Callback::Callback<OnAttestationInformationVerification> * onCompletion;
+    };
+
+    void VerifyAttestationInformation(const AttestationInfo & info,
+                                      Callback::Callback<OnAttestationInformationVerification> * onCompletion) override
+    {
+        mRequests.push_back({ false, info.productId, onCompletion });
+    }
+
+    void CheckForRevokedDACChain(const AttestationInfo & info,
+                                 Callback::Callback<OnAttestationInformationVerification> * onCompletion) override
+    {
+        mRequests.push_back({ true, info.productId, onCompletion });
+    }
+
+    AttestationVerificationResult ValidateCertificationDeclarationSignature(const ByteSpan & cmsEnvelopeBuffer,
+                                                                            ByteSpan & certDeclBuffer) override
+    {
+        return AttestationVerificationResult::kSuccess;
+    }
+
+    AttestationVerificationResult ValidateCertificateDeclarationPayload(const ByteSpan & certDeclBuffer,
+                                                                        const ByteSpan & firmwareInfo,
+                                                                        const DeviceInfoForAttestation & deviceInfo) override
+    {
+        return AttestationVerificationResult::kSuccess;
+    }
+
+    CHIP_ERROR VerifyNodeOperationalCSRInformation(const ByteSpan & nocsrElementsBuffer, const ByteSpan & attestationChallengeBuffer,
+                                                   const ByteSpan & attestationSignatureBuffer,
+                                                   const Crypto::P256PublicKey & dacPublicKey, const ByteSpan & csrNonce) override
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    void Complete(size_t index, AttestationVerificationResult result)
+    {
+        AttestationInfo info(ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(), VendorId::TestVendor1,
+                             mRequests[index].productId);
+        auto * onCompletion = mRequests[index].onCompletion;
+        onCompletion->mCall(onCompletion->mContext, info, result);
+    }
+
+    std::vector<Request> mRequests;
+};
+
+struct VerificationWaiter
+{
+    VerificationWaiter() : callback(OnVerified, this) {}
+
+    static void OnVerified(void * context, const DeviceAttestationVerifier::AttestationInfo & info,
+                           AttestationVerificationResult result)
+    {
+        auto * waiter = static_cast<VerificationWaiter *>(context);
+        waiter->completions++;
+        waiter->productId = info.productId;
+        waiter->result    = result;
+    }
+
+    Callback::Callback<DeviceAttestationVerifier::OnAttestationInformationVerification> callback;
+    int completions                      = 0;
+    uint16_t productId                   = 0;
+    AttestationVerificationResult result = AttestationVerificationResult::kNotImplemented;
+};
+
+TEST(TestCommissioningPipeline, TestSharedVerifierBoundsConcurrency)
+{
+    FakeVerifier fake;
+    SharedAttestationVerifier verifier;
+    ASSERT_EQ(verifier.Init(&fake, 1), CHIP_NO_ERROR);
+
+    VerificationWaiter waiters[3];
+    for (uint16_t i = 0; i < 3; i++)
+    {
+        DeviceAttestationVerifier::AttestationInfo info(ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(),
+                                                        VendorId::TestVendor1, static_cast<uint16_t>(0x8000 + i));
+        if (i == 1)
+        {
+            verifier.CheckForRevokedDACChain(info, &waiters[i].callback);
+        }
+        else
+        {
+            verifier.VerifyAttestationInformation(info, &waiters[i].callback);
+        }
+    }
+
+    ASSERT_EQ(fake.mRequests.size(), 1u);
+    EXPECT_EQ(verifier.GetQueuedCount(), 2u);
+
+    fake.Complete(0, AttestationVerificationResult::kSuccess);
+    EXPECT_EQ(waiters[0].completions, 1);
+    EXPECT_EQ(waiters[0].productId, 0x8000);
+    EXPECT_EQ(waiters[0].result, AttestationVerificationResult::kSuccess);
+
+    // The queued requests keep their kind and their order.
+    ASSERT_EQ(fake.mRequests.size(), 2u);
+    EXPECT_TRUE(fake.mRequests[1].revocationCheck);
+    EXPECT_EQ(fake.mRequests[1].productId, 0x8001);
+    fake.Complete(1, AttestationVerificationResult::kDacRevoked);
+    EXPECT_EQ(waiters[1].result, AttestationVerificationResult::kDacRevoked);
+
+    ASSERT_EQ(fake.mRequests.size(), 3u);
+    EXPECT_FALSE(fake.mRequests[2].revocationCheck);
+    fake.Complete(2, AttestationVerificationResult::kSuccess);
+    EXPECT_EQ(waiters[2].completions, 1);
+    EXPECT_EQ(verifier.GetActiveCount(), 0u);
+    EXPECT_EQ(verifier.GetQueuedCount(), 0u);
+}
+
+TEST(TestCommissioningPipeline, TestStageStatistics)
+{
+    CommissioningPipeline::StageStatistics statistics;
+    statistics.Add(System::Clock::Milliseconds64(30));
+    statistics.Add(System::Clock::Milliseconds64(50));
+    statistics.Add(System::Clock::Milliseconds64(10));
+    EXPECT_EQ(statistics.count, 3u);
+    EXPECT_EQ(statistics.totalTime.count(), 90u);
+    EXPECT_EQ(statistics.maxTime.count(), 50u);
+}
+
+} // namespace
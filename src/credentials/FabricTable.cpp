@@ -33,6 +33,8 @@
 #include <platform/LockTracker.h>
 #include <tracing/macros.h>
 
+#include <algorithm>
+
 namespace chip {
 using namespace Credentials;
 using namespace Crypto;
@@ -394,13 +396,57 @@ CHIP_ERROR FabricTable::VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc,
     uint8_t rootCertBuf[kMaxCHIPCertLength];
     MutableByteSpan rootCertSpan{ rootCertBuf };
     ReturnErrorOnFailure(FetchRootCert(fabricIndex, rootCertSpan));
-    return VerifyCredentials(noc, icac, rootCertSpan, context, outCompressedFabricId, outFabricId, outNodeId, outNocPubkey,
-                             outRootPublicKey);
+
+    VerifiedCertChain chain;
+    VerifiedCertChainCache::ChainDigest digest;
+    const bool cacheable = VerifiedCertChainCache::IsCacheable(context) &&
+        (VerifiedCertChainCache::ComputeDigest(noc, icac, rootCertSpan, digest) == CHIP_NO_ERROR);
+
+    if (cacheable && mVerifiedCertChainCache.Lookup(digest, context, chain))
+    {
+        // The certificates were not decoded, so there is no trust anchor to point to.
+        context.mTrustAnchor = nullptr;
+    }
+    else
+    {
+        ReturnErrorOnFailure(VerifyCredentials(noc, icac, rootCertSpan, context, chain));
+        if (cacheable)
+        {
+            mVerifiedCertChainCache.Insert(digest, context, chain);
+        }
+    }
+
+    outCompressedFabricId = chain.compressedFabricId;
+    outFabricId           = chain.fabricId;
+    outNodeId             = chain.nodeId;
+    outNocPubkey          = chain.nocPublicKey;
+    if (outRootPublicKey != nullptr)
+    {
+        *outRootPublicKey = chain.rootPublicKey;
+    }
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, ValidationContext & context,
                                           CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                           Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey)
+{
+    VerifiedCertChain chain;
+    ReturnErrorOnFailure(VerifyCredentials(noc, icac, rcac, context, chain));
+
+    outCompressedFabricId = chain.compressedFabricId;
+    outFabricId           = chain.fabricId;
+    outNodeId             = chain.nodeId;
+    outNocPubkey          = chain.nocPublicKey;
+    if (outRootPublicKey != nullptr)
+    {
+        *outRootPublicKey = chain.rootPublicKey;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, ValidationContext & context,
+                                          VerifiedCertChain & outChain)
 {
     // TODO - Optimize credentials verification logic
     //        The certificate chain construction and verification is a compute and memory intensive operation.
@@ -428,7 +474,7 @@ CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan
     // It confirms that the certs link correctly (noc -> icac -> rcac), and have been correctly signed.
     ReturnErrorOnFailure(certificates.FindValidCert(nocSubjectDN, nocSubjectKeyId, context, &resultCert));
 
-    ReturnErrorOnFailure(ExtractNodeIdFabricIdFromOpCert(certificates.GetLastCert()[0], &outNodeId, &outFabricId));
+    ReturnErrorOnFailure(ExtractNodeIdFabricIdFromOpCert(certificates.GetLastCert()[0], &outChain.nodeId, &outChain.fabricId));
 
     CHIP_ERROR err;
     FabricId icacFabricId = kUndefinedFabricId;
@@ -437,7 +483,7 @@ CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan
         err = ExtractFabricIdFromCert(certificates.GetCertSet()[1], &icacFabricId);
         if (err == CHIP_NO_ERROR)
         {
-            VerifyOrReturnError(icacFabricId == outFabricId, CHIP_ERROR_FABRIC_MISMATCH_ON_ICA);
+            VerifyOrReturnError(icacFabricId == outChain.fabricId, CHIP_ERROR_FABRIC_MISMATCH_ON_ICA);
         }
         // FabricId is optional field in ICAC and "not found" code is not treated as error.
         else if (err != CHIP_ERROR_NOT_FOUND)
@@ -450,7 +496,7 @@ CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan
     err                   = ExtractFabricIdFromCert(certificates.GetCertSet()[0], &rcacFabricId);
     if (err == CHIP_NO_ERROR)
     {
-        VerifyOrReturnError(rcacFabricId == outFabricId, CHIP_ERROR_WRONG_CERT_DN);
+        VerifyOrReturnError(rcacFabricId == outChain.fabricId, CHIP_ERROR_WRONG_CERT_DN);
     }
     // FabricId is optional field in RCAC and "not found" code is not treated as error.
     else if (err != CHIP_ERROR_NOT_FOUND)
@@ -464,20 +510,29 @@ CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan
         MutableByteSpan compressedFabricIdSpan(compressedFabricIdBuf);
         P256PublicKey rootPubkey(certificates.GetCertSet()[0].mPublicKey);
 
-        ReturnErrorOnFailure(GenerateCompressedFabricId(rootPubkey, outFabricId, compressedFabricIdSpan));
+        ReturnErrorOnFailure(GenerateCompressedFabricId(rootPubkey, outChain.fabricId, compressedFabricIdSpan));
 
         // Decode compressed fabric ID accounting for endianness, as GenerateCompressedFabricId()
         // returns a binary buffer and is agnostic of usage of the output as an integer type.
-        outCompressedFabricId = Encoding::BigEndian::Get64(compressedFabricIdBuf);
+        outChain.compressedFabricId = Encoding::BigEndian::Get64(compressedFabricIdBuf);
+        outChain.rootPublicKey      = rootPubkey;
+    }
+
+    outChain.nocPublicKey = certificates.GetLastCert()->mPublicKey;
 
-        if (outRootPublicKey != nullptr)
+    // Record the window in which every certificate of the chain is valid
+    outChain.notBefore = 0;
+    outChain.notAfter  = kNullCertTime;
+    for (uint8_t i = 0; i < certificates.GetCertCount(); i++)
+    {
+        const ChipCertificateData & cert = certificates.GetCertSet()[i];
+        outChain.notBefore               = std::max(outChain.notBefore, cert.mNotBeforeTime);
+        if (cert.mNotAfterTime != kNullCertTime && (outChain.notAfter == kNullCertTime || cert.mNotAfterTime < outChain.notAfter))
         {
-            *outRootPublicKey = rootPubkey;
+            outChain.notAfter = cert.mNotAfterTime;
         }
     }
 
-    outNocPubkey = certificates.GetLastCert()->mPublicKey;
-
     return CHIP_NO_ERROR;
 }
 
@@ -966,6 +1021,9 @@ CHIP_ERROR FabricTable::Delete(FabricIndex fabricIndex)
         }
     }
 
+    // The fabric's root may no longer be trusted
+    mVerifiedCertChainCache.Clear();
+
     FabricInfo * fabricInfo = GetMutableFabricByIndex(fabricIndex);
     if (fabricInfo == &mPendingFabric)
     {
@@ -1854,6 +1912,9 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
 {
     VerifyOrReturnError((mStorage != nullptr) && (mOpCertStore != nullptr), CHIP_ERROR_INCORRECT_STATE);
 
+    // Trusted roots and operational certificates may change below
+    mVerifiedCertChainCache.Clear();
+
     bool haveNewTrustedRoot      = mStateFlags.Has(StateFlags::kIsTrustedRootPending);
     bool isAdding                = mStateFlags.Has(StateFlags::kIsAddPending);
     bool isUpdating              = mStateFlags.Has(StateFlags::kIsUpdatePending);
@@ -2096,6 +2157,8 @@ void FabricTable::RevertPendingFabricData()
 
     TEMPORARY_RETURN_IGNORED mLastKnownGoodTime.RevertPendingLastKnownGoodChipEpochTime();
 
+    mVerifiedCertChainCache.Clear();
+
     mStateFlags.ClearAll();
     mFabricIndexWithPendingState = kUndefinedFabricIndex;
 }
@@ -29,6 +29,7 @@
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/LastKnownGoodTime.h>
 #include <credentials/OperationalCertificateStore.h>
+#include <credentials/VerifiedCertChainCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <crypto/OperationalKeystore.h>
 #include <lib/core/CHIPEncoding.h>
@@ -1007,7 +1008,8 @@ public:
      */
     void RevertPendingOpCertsExceptRoot();
 
-    // Verifies credentials, using the root certificate of the provided fabric index.
+    // Verifies credentials, using the root certificate of the provided fabric index. Successful validations are kept in the
+    // verified certificate chain cache, and repeated validations of the same chain are served from it.
     CHIP_ERROR VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc, ByteSpan icac, Credentials::ValidationContext & context,
                                  CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                  Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr) const;
@@ -1016,6 +1018,20 @@ public:
     static CHIP_ERROR VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, Credentials::ValidationContext & context,
                                         CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                         Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr);
+
+    // Verifies credentials, using the provided root certificate, and reports everything extracted from the chain including
+    // its validity window, in a form that can be stored in the verified certificate chain cache.
+    static CHIP_ERROR VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, Credentials::ValidationContext & context,
+                                        Credentials::VerifiedCertChain & outChain);
+
+    /**
+     * @brief Cache of the certificate chains that passed VerifyCredentials(fabricIndex, ...).
+     *
+     * Callers that verify a chain away from the Matter thread (e.g. CASE Sigma3 processing in the background) may look it
+     * up and populate it themselves, from the Matter thread. The cache is cleared whenever fabrics or trusted roots change.
+     */
+    Credentials::VerifiedCertChainCache & GetVerifiedCertChainCache() { return mVerifiedCertChainCache; }
+
     /**
      * @brief Enables FabricInfo instances to collide and reference the same logical fabric (i.e Root Public Key + FabricId).
      *
@@ -1298,6 +1314,9 @@ private:
 
     LastKnownGoodTime mLastKnownGoodTime;
 
+    // Mutable so that the const VerifyCredentials(fabricIndex, ...) can populate it.
+    mutable Credentials::VerifiedCertChainCache mVerifiedCertChainCache;
+
     // We may not have an mNextAvailableFabricIndex if our table is as large as
     // it can go and is full.
     Optional<FabricIndex> mNextAvailableFabricIndex;
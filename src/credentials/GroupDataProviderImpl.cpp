@@ -24,6 +24,8 @@
 #include <lib/support/Pool.h>
 #include <stdlib.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Credentials {
 
@@ -832,12 +834,17 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    mGroupSessionCacheUsers = 0;
+    InvalidateGroupSessionCache();
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
     mStorage = storage;
+    InvalidateGroupSessionCache();
 }
 
 //
@@ -1349,6 +1356,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
@@ -1415,6 +1423,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1447,6 +1456,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -1523,6 +1533,7 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1594,6 +1605,7 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1696,6 +1708,7 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
     FabricData fabric(fabric_index);
+    InvalidateGroupSessionCache();
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
     // However, states has a separate list, and needs to be removed regardless
@@ -1845,6 +1858,21 @@ GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGrou
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    if (provider.RefreshGroupSessionCache())
+    {
+        const GroupSessionCacheEntry * begin = provider.mGroupSessionCache;
+        const GroupSessionCacheEntry * end   = begin + provider.mGroupSessionCacheCount;
+        mNext     = std::lower_bound(begin, end, session_id,
+                                     [](const GroupSessionCacheEntry & entry, uint16_t id) { return entry.session_id < id; });
+        mEnd      = std::upper_bound(mNext, end, session_id,
+                                     [](uint16_t id, const GroupSessionCacheEntry & entry) { return id < entry.session_id; });
+        mUseCache = true;
+        provider.mGroupSessionCacheUsers++;
+        return;
+    }
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -1857,6 +1885,13 @@ GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupD
 
 size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 {
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    if (mUseCache)
+    {
+        return static_cast<size_t>(mEnd - mNext);
+    }
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
     FabricData fabric(mFirstFabric);
     size_t count = 0;
 
@@ -1898,6 +1933,19 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    if (mUseCache)
+    {
+        VerifyOrReturnError(mNext < mEnd, false);
+        output.fabric_index    = mNext->fabric_index;
+        output.group_id        = mNext->group_id;
+        output.security_policy = mNext->security_policy;
+        output.keyContext      = mNext->key_context;
+        mNext++;
+        return true;
+    }
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
@@ -1952,10 +2000,140 @@ bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output
 
 void GroupDataProviderImpl::GroupSessionIteratorImpl::Release()
 {
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    if (mUseCache && mProvider.mGroupSessionCacheUsers > 0 && --mProvider.mGroupSessionCacheUsers == 0 &&
+        mProvider.mGroupSessionCacheState != GroupSessionCacheState::kValid)
+    {
+        // The cache was invalidated while this iterator was handing out its key contexts
+        mProvider.ReleaseGroupSessionCacheKeys();
+    }
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
     mGroupKeyContext.ReleaseKeys();
     mProvider.mGroupSessionsIterator.ReleaseObject(this);
 }
 
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
+//
+// Group session cache
+//
+
+void GroupDataProviderImpl::SetGroupSessionCacheEnabled(bool enabled)
+{
+    mGroupSessionCacheEnabled = enabled;
+    InvalidateGroupSessionCache();
+}
+
+bool GroupDataProviderImpl::RefreshGroupSessionCache()
+{
+    VerifyOrReturnError(mGroupSessionCacheEnabled, false);
+
+    // Key contexts still in use by an iterator cannot be replaced, walk storage until they are returned
+    if (GroupSessionCacheState::kInvalid == mGroupSessionCacheState && 0 == mGroupSessionCacheUsers)
+    {
+        ReleaseGroupSessionCacheKeys();
+        CHIP_ERROR err = LoadGroupSessionCache();
+        if (CHIP_NO_ERROR == err)
+        {
+            mGroupSessionCacheState = GroupSessionCacheState::kValid;
+        }
+        else
+        {
+            ChipLogDetail(Crypto, "Group session cache unavailable: %" CHIP_ERROR_FORMAT, err.Format());
+            ReleaseGroupSessionCacheKeys();
+            mGroupSessionCacheState = GroupSessionCacheState::kUnavailable;
+        }
+    }
+    return GroupSessionCacheState::kValid == mGroupSessionCacheState;
+}
+
+CHIP_ERROR GroupDataProviderImpl::LoadGroupSessionCache()
+{
+    // Operational keys shared by several group mappings use a single key context
+    struct CachedKey
+    {
+        FabricIndex fabric_index;
+        KeysetId keyset_id;
+        uint16_t key_index;
+        GroupKeyContext * context;
+    };
+    CachedKey keys[kGroupSessionCacheSize];
+    size_t key_count = 0;
+
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    VerifyOrReturnError(CHIP_ERROR_NOT_FOUND != err, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(err);
+
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        ReturnErrorOnFailure(fabric.Load(mStorage));
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            ReturnErrorOnFailure(mapping.Load(mStorage));
+
+            KeySetData keyset;
+            VerifyOrReturnError(keyset.Find(mStorage, fabric, mapping.keyset_id), CHIP_ERROR_KEY_NOT_FOUND);
+
+            for (uint16_t k = 0; k < keyset.keys_count && k < KeySet::kEpochKeysMax; ++k)
+            {
+                Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[k];
+                GroupKeyContext * context                    = nullptr;
+
+                for (size_t n = 0; n < key_count && nullptr == context; ++n)
+                {
+                    if (keys[n].fabric_index == fabric.fabric_index && keys[n].keyset_id == keyset.keyset_id &&
+                        keys[n].key_index == k)
+                    {
+                        context = keys[n].context;
+                    }
+                }
+                if (nullptr == context)
+                {
+                    VerifyOrReturnError(key_count < kGroupSessionCacheSize, CHIP_ERROR_NO_MEMORY);
+                    context = mGroupSessionKeyContexts.CreateObject(*this);
+                    VerifyOrReturnError(nullptr != context, CHIP_ERROR_NO_MEMORY);
+                    keys[key_count++] = { fabric.fabric_index, keyset.keyset_id, k, context };
+                    ReturnErrorOnFailure(context->Initialize(creds.encryption_key, creds.hash, creds.privacy_key));
+                }
+
+                VerifyOrReturnError(mGroupSessionCacheCount < kGroupSessionCacheSize, CHIP_ERROR_NO_MEMORY);
+                mGroupSessionCache[mGroupSessionCacheCount++] = { creds.hash, fabric.fabric_index, mapping.group_id, keyset.policy,
+                                                                  context };
+            }
+        }
+    }
+
+    // Stable, so candidates for the same session id are tried in the same order as the storage walk
+    std::stable_sort(mGroupSessionCache, mGroupSessionCache + mGroupSessionCacheCount,
+                     [](const GroupSessionCacheEntry & a, const GroupSessionCacheEntry & b) { return a.session_id < b.session_id; });
+    return CHIP_NO_ERROR;
+}
+
+void GroupDataProviderImpl::InvalidateGroupSessionCache()
+{
+    mGroupSessionCacheState = GroupSessionCacheState::kInvalid;
+    if (0 == mGroupSessionCacheUsers)
+    {
+        ReleaseGroupSessionCacheKeys();
+    }
+}
+
+void GroupDataProviderImpl::ReleaseGroupSessionCacheKeys()
+{
+    mGroupSessionKeyContexts.ForEachActiveObject([](GroupKeyContext * context) {
+        context->ReleaseKeys();
+        return Loop::Continue;
+    });
+    mGroupSessionKeyContexts.ReleaseAll();
+    mGroupSessionCacheCount = 0;
+}
+
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
 namespace {
 
 GroupDataProvider * gGroupsProvider = nullptr;
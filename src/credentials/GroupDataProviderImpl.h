@@ -33,7 +33,13 @@ public:
     GroupDataProviderImpl(uint16_t maxGroupsPerFabric, uint16_t maxGroupKeysPerFabric) :
         GroupDataProvider(maxGroupsPerFabric, maxGroupKeysPerFabric)
     {}
-    ~GroupDataProviderImpl() override {}
+    ~GroupDataProviderImpl() override
+    {
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+        // Key handles are released in Finish(), the keystore may already be gone at this point
+        mGroupSessionKeyContexts.ReleaseAll();
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    }
 
     /**
      * @brief Set the storage implementation used for non-volatile storage of configuration data.
@@ -46,6 +52,14 @@ public:
     void SetSessionKeystore(Crypto::SessionKeystore * keystore) { mSessionKeystore = keystore; }
     Crypto::SessionKeystore * GetSessionKeystore() const { return mSessionKeystore; }
 
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    /**
+     * @brief Enable or disable the in-RAM group session index used by IterateGroupSessions().
+     *        The index is enabled by default. When disabled, every lookup walks persistent storage.
+     */
+    void SetGroupSessionCacheEnabled(bool enabled);
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
     CHIP_ERROR Init() override;
     void Finish() override;
 
@@ -221,6 +235,18 @@ protected:
         size_t mTotal       = 0;
     };
 
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    // A candidate operational group key for incoming messages with the given session id (key hash)
+    struct GroupSessionCacheEntry
+    {
+        uint16_t session_id;
+        FabricIndex fabric_index;
+        GroupId group_id;
+        SecurityPolicy security_policy;
+        GroupKeyContext * key_context;
+    };
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
     class GroupSessionIteratorImpl : public GroupSessionIterator
     {
     public:
@@ -242,10 +268,43 @@ protected:
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
         GroupKeyContext mGroupKeyContext;
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+        // Range of matching group session cache entries, only used when mUseCache is set
+        bool mUseCache                       = false;
+        const GroupSessionCacheEntry * mNext = nullptr;
+        const GroupSessionCacheEntry * mEnd  = nullptr;
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
     };
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
 
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    static constexpr size_t kGroupSessionCacheSize = CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE;
+
+    enum class GroupSessionCacheState : uint8_t
+    {
+        kInvalid,     // Must be rebuilt from storage before use
+        kValid,       // Mirrors the sessions currently in storage
+        kUnavailable, // Could not be built (too many sessions, storage error), walk storage instead
+    };
+
+    bool RefreshGroupSessionCache();
+    CHIP_ERROR LoadGroupSessionCache();
+    void InvalidateGroupSessionCache();
+    void ReleaseGroupSessionCacheKeys();
+
+    // Sorted by session_id, entries with the same session_id keep the storage iteration order
+    GroupSessionCacheEntry mGroupSessionCache[kGroupSessionCacheSize];
+    size_t mGroupSessionCacheCount                 = 0;
+    GroupSessionCacheState mGroupSessionCacheState = GroupSessionCacheState::kInvalid;
+    bool mGroupSessionCacheEnabled                 = true;
+    // Number of live session iterators handing out key contexts owned by the cache
+    size_t mGroupSessionCacheUsers = 0;
+    ObjectPool<GroupKeyContext, kGroupSessionCacheSize> mGroupSessionKeyContexts;
+#else
+    void InvalidateGroupSessionCache() {}
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
     ObjectPool<GroupInfoIteratorImpl, kIteratorsMax> mGroupInfoIterators;
@@ -0,0 +1,151 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/VerifiedCertChainCache.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Credentials {
+
+namespace {
+
+// Each certificate is prefixed with its length, so that moving bytes between certificates changes the digest.
+CHIP_ERROR AddCertificate(Crypto::Hash_SHA256_stream & hash, const ByteSpan & cert)
+{
+    VerifyOrReturnError(CanCastTo<uint16_t>(cert.size()), CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t length[sizeof(uint16_t)];
+    Encoding::LittleEndian::Put16(length, static_cast<uint16_t>(cert.size()));
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(length)));
+    return hash.AddData(cert);
+}
+
+} // namespace
+
+CHIP_ERROR VerifiedCertChainCache::ComputeDigest(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                                 ChainDigest & outDigest)
+{
+    Crypto::Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(AddCertificate(hash, noc));
+    ReturnErrorOnFailure(AddCertificate(hash, icac));
+    ReturnErrorOnFailure(AddCertificate(hash, rcac));
+
+    MutableByteSpan digestSpan(outDigest.bytes);
+    return hash.Finish(digestSpan);
+}
+
+bool VerifiedCertChainCache::Lookup(const ChainDigest & digest, const ValidationContext & context, VerifiedCertChain & outChain)
+{
+    VerifyOrReturnValue(IsCacheable(context), false);
+
+    Entry * entry = FindEntry(digest, context);
+    if (entry == nullptr || !IsValidAt(entry->chain, context))
+    {
+        mStats.misses++;
+        return false;
+    }
+
+    mStats.hits++;
+    entry->lastUsed = ++mUseCounter;
+    outChain        = entry->chain;
+    return true;
+}
+
+void VerifiedCertChainCache::Insert(const ChainDigest & digest, const ValidationContext & context, const VerifiedCertChain & chain)
+{
+    VerifyOrReturn(IsCacheable(context));
+
+    Entry * entry = FindEntry(digest, context);
+    if (entry == nullptr)
+    {
+        entry = FindVictim();
+    }
+    VerifyOrReturn(entry != nullptr);
+
+    entry->inUse               = true;
+    entry->lastUsed            = ++mUseCounter;
+    entry->digest              = digest;
+    entry->requiredKeyUsages   = context.mRequiredKeyUsages;
+    entry->requiredKeyPurposes = context.mRequiredKeyPurposes;
+    entry->requiredCertType    = context.mRequiredCertType;
+    entry->chain               = chain;
+}
+
+void VerifiedCertChainCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.inUse = false;
+    }
+}
+
+VerifiedCertChainCache::Entry * VerifiedCertChainCache::FindEntry(const ChainDigest & digest, const ValidationContext & context)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.inUse && memcmp(entry.digest.bytes, digest.bytes, sizeof(digest.bytes)) == 0 && ConstraintsMatch(entry, context))
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+VerifiedCertChainCache::Entry * VerifiedCertChainCache::FindVictim()
+{
+    Entry * victim = nullptr;
+    for (auto & entry : mEntries)
+    {
+        if (!entry.inUse)
+        {
+            return &entry;
+        }
+        if (victim == nullptr || entry.lastUsed < victim->lastUsed)
+        {
+            victim = &entry;
+        }
+    }
+    return victim;
+}
+
+bool VerifiedCertChainCache::ConstraintsMatch(const Entry & entry, const ValidationContext & context)
+{
+    return entry.requiredKeyUsages.Raw() == context.mRequiredKeyUsages.Raw() &&
+        entry.requiredKeyPurposes.Raw() == context.mRequiredKeyPurposes.Raw() &&
+        entry.requiredCertType == context.mRequiredCertType;
+}
+
+bool VerifiedCertChainCache::IsValidAt(const VerifiedCertChain & chain, const ValidationContext & context)
+{
+    // Mirrors the default validity policy: only a current time is checked against NotBefore and NotAfter. A Last Known
+    // Good Time or an unknown time is accepted regardless of the validity period.
+    if (context.mEffectiveTime.Is<CurrentChipEpochTime>())
+    {
+        const uint32_t now = context.mEffectiveTime.Get<CurrentChipEpochTime>().count();
+        return now >= chain.notBefore && (chain.notAfter == kNullCertTime || now <= chain.notAfter);
+    }
+    return true;
+}
+
+} // namespace Credentials
+} // namespace chip
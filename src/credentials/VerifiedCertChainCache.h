@@ -0,0 +1,148 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @brief Defines a cache of operational certificate chains (NOC, ICAC, RCAC) that passed validation.
+ */
+
+#pragma once
+
+#include <credentials/CHIPCert.h>
+#include <credentials/CHIPCertificateSet.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/NodeId.h>
+#include <lib/support/BitFlags.h>
+#include <lib/support/Span.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * @brief Outcome of the successful validation of an operational certificate chain.
+ */
+struct VerifiedCertChain
+{
+    CompressedFabricId compressedFabricId = kUndefinedCompressedFabricId;
+    FabricId fabricId                     = kUndefinedFabricId;
+    NodeId nodeId                         = kUndefinedNodeId;
+    Crypto::P256PublicKey nocPublicKey;
+    Crypto::P256PublicKey rootPublicKey;
+
+    // Intersection of the validity periods of all certificates of the chain, in seconds since the CHIP epoch.
+    // A notAfter of kNullCertTime means that no certificate of the chain expires.
+    uint32_t notBefore = 0;
+    uint32_t notAfter  = kNullCertTime;
+};
+
+/**
+ * @brief Bounded cache of certificate chains that were successfully validated.
+ *
+ * Validating an operational certificate chain decodes every certificate and verifies an ECDSA signature per link,
+ * which dominates the cost of a CASE handshake. Peers that reconnect present the same chain every time, so the
+ * outcome of a successful validation is kept, keyed by a SHA-256 digest over the NOC, ICAC and RCAC.
+ *
+ * Only the parts of a validation that do not depend on the time are reused: a cached chain matches a validation
+ * context with the same required key usages, key purposes and certificate type, and the effective time of that
+ * context is checked against the validity window of the chain on every lookup, as the default validity policy
+ * would. Validations that use an application CertificateValidityPolicy are never cached, since the policy has to
+ * see every certificate.
+ *
+ * Failures are not cached. Owners are expected to Clear() the cache whenever the set of trusted roots changes.
+ *
+ * The cache is not thread-safe; all calls must be made with the Matter stack lock held.
+ */
+class VerifiedCertChainCache
+{
+public:
+    static constexpr size_t kCapacity = CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE;
+
+    struct ChainDigest
+    {
+        uint8_t bytes[Crypto::kSHA256_Hash_Length];
+    };
+
+    struct Stats
+    {
+        uint32_t hits   = 0;
+        uint32_t misses = 0;
+    };
+
+    /**
+     * @brief Whether the outcome of a validation using this context may be cached (and looked up).
+     */
+    static bool IsCacheable(const ValidationContext & context) { return kCapacity > 0 && context.mValidityPolicy == nullptr; }
+
+    /**
+     * @brief Compute the cache key of a chain. icac may be empty.
+     */
+    static CHIP_ERROR ComputeDigest(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac, ChainDigest & outDigest);
+
+    /**
+     * @brief Find a chain that was validated under the constraints of context and is valid at its effective time.
+     *
+     * @return true, with outChain filled in, on a hit.
+     */
+    bool Lookup(const ChainDigest & digest, const ValidationContext & context, VerifiedCertChain & outChain);
+
+    /**
+     * @brief Record that the chain with the given digest was successfully validated using context.
+     *
+     * The least recently used entry is evicted if the cache is full.
+     */
+    void Insert(const ChainDigest & digest, const ValidationContext & context, const VerifiedCertChain & chain);
+
+    /**
+     * @brief Drop all cached chains. Statistics are kept.
+     */
+    void Clear();
+
+    const Stats & GetStats() const { return mStats; }
+    void ResetStats() { mStats = Stats(); }
+
+private:
+    struct Entry
+    {
+        bool inUse        = false;
+        uint32_t lastUsed = 0;
+        ChainDigest digest;
+        BitFlags<KeyUsageFlags> requiredKeyUsages;
+        BitFlags<KeyPurposeFlags> requiredKeyPurposes;
+        CertType requiredCertType = CertType::kNotSpecified;
+        VerifiedCertChain chain;
+    };
+
+    static bool ConstraintsMatch(const Entry & entry, const ValidationContext & context);
+    static bool IsValidAt(const VerifiedCertChain & chain, const ValidationContext & context);
+
+    Entry * FindEntry(const ChainDigest & digest, const ValidationContext & context);
+    // Returns a free entry, or the least recently used one if the cache is full.
+    Entry * FindVictim();
+
+    std::array<Entry, kCapacity> mEntries;
+    uint32_t mUseCounter = 0;
+    Stats mStats;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -3902,4 +3902,62 @@ TEST_F(TestFabricTable, VidVerificationSigningFailsOnBadInput)
     }
 }
 
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+TEST_F(TestFabricTable, TestVerifyCredentialsUsesChainCache)
+{
+    chip::TestPersistentStorageDelegate testStorage;
+    ScopedFabricTable fabricTableHolder;
+    ASSERT_EQ(fabricTableHolder.Init(&testStorage), CHIP_NO_ERROR);
+    FabricTable & fabricTable = fabricTableHolder.GetFabricTable();
+
+    ASSERT_EQ(LoadTestFabric_Node01_01(fabricTable, /* doCommit = */ true), CHIP_NO_ERROR);
+    const FabricIndex fabricIndex = fabricTable.FabricCount() == 1 ? fabricTable.begin()->GetFabricIndex() : kUndefinedFabricIndex;
+    ASSERT_NE(fabricIndex, kUndefinedFabricIndex);
+
+    VerifiedCertChainCache & cache = fabricTable.GetVerifiedCertChainCache();
+    cache.ResetStats();
+
+    auto verify = [&](ValidationContext & context) {
+        CompressedFabricId compressedFabricId;
+        FabricId fabricId;
+        NodeId nodeId;
+        Crypto::P256PublicKey nocPubkey;
+        Crypto::P256PublicKey rootPubkey;
+        ReturnErrorOnFailure(fabricTable.VerifyCredentials(fabricIndex, TestCerts::sTestCert_Node01_01_Chip,
+                                                           TestCerts::sTestCert_ICA01_Chip, context, compressedFabricId, fabricId,
+                                                           nodeId, nocPubkey, &rootPubkey));
+        VerifyOrReturnError(compressedFabricId == fabricTable.FindFabricWithIndex(fabricIndex)->GetCompressedFabricId(),
+                            CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(nodeId == fabricTable.FindFabricWithIndex(fabricIndex)->GetNodeId(), CHIP_ERROR_INTERNAL);
+        return CHIP_NO_ERROR;
+    };
+
+    ValidationContext context;
+    context.Reset();
+    context.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(700000000));
+    context.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    context.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+
+    EXPECT_EQ(verify(context), CHIP_NO_ERROR);
+    EXPECT_EQ(verify(context), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetStats().misses, 1u);
+    EXPECT_EQ(cache.GetStats().hits, 1u);
+
+    // A time outside of the validity period of the chain is not served from the cache
+    ValidationContext expiredContext = context;
+    expiredContext.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(UINT32_MAX - 1));
+    EXPECT_NE(verify(expiredContext), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetStats().hits, 1u);
+
+    // Removing the fabric drops the chains that were validated against its root
+    EXPECT_EQ(fabricTable.Delete(fabricIndex), CHIP_NO_ERROR);
+    VerifiedCertChainCache::ChainDigest digest;
+    VerifiedCertChain chain;
+    ASSERT_EQ(VerifiedCertChainCache::ComputeDigest(TestCerts::sTestCert_Node01_01_Chip, TestCerts::sTestCert_ICA01_Chip,
+                                                    TestCerts::sTestCert_Root01_Chip, digest),
+              CHIP_NO_ERROR);
+    EXPECT_FALSE(cache.Lookup(digest, context, chain));
+}
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
 } // namespace
@@ -20,6 +20,7 @@
 #include <string.h>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <pw_unit_test/framework.h>
 
@@ -31,6 +32,7 @@
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <platform/KeyValueStoreManager.h>
+#include <system/SystemClock.h>
 
 using namespace chip::Credentials;
 using GroupInfo      = GroupDataProvider::GroupInfo;
@@ -1223,6 +1225,257 @@ TEST_F(TestGroupDataProvider, TestGroupDecryption)
     it->Release();
 }
 
+using SessionList = std::vector<std::tuple<FabricIndex, GroupId, SecurityPolicy>>;
+
+// Collects the group sessions matching session_id, checking that each of them can decrypt the given message
+SessionList CollectGroupSessions(GroupDataProvider * provider, uint16_t session_id, const ByteSpan & ciphertext,
+                                 const ByteSpan & aad, const ByteSpan & nonce, const ByteSpan & tag, const ByteSpan & message)
+{
+    SessionList sessions;
+    GroupSession session;
+    auto it = provider->IterateGroupSessions(session_id);
+    VerifyOrReturnValue(it != nullptr, sessions);
+
+    size_t total     = it->Count();
+    size_t decrypted = 0;
+    while (it->Next(session))
+    {
+        sessions.emplace_back(session.fabric_index, session.group_id, session.security_policy);
+        EXPECT_NE(session.keyContext, nullptr);
+        if (session.keyContext == nullptr)
+        {
+            continue;
+        }
+        EXPECT_EQ(session.keyContext->GetKeyHash(), session_id);
+
+        uint8_t plaintext_buffer[16];
+        MutableByteSpan plaintext(plaintext_buffer, message.size());
+        if (session.keyContext->MessageDecrypt(ciphertext, aad, nonce, tag, plaintext) == CHIP_NO_ERROR &&
+            plaintext.data_equal(message))
+        {
+            decrypted++;
+        }
+    }
+    EXPECT_EQ(sessions.size(), total);
+    EXPECT_EQ(decrypted, total);
+    it->Release();
+    return sessions;
+}
+
+TEST_F(TestGroupDataProvider, TestGroupSessionCacheCoherency)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet0), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet3), CHIP_NO_ERROR);
+
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 0, kGroup1Keyset0), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 1, kGroup1Keyset2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 2, kGroup3Keyset2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 1, kGroup1Keyset3), CHIP_NO_ERROR);
+
+    const uint8_t kMessage[10] = { 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9 };
+    const uint8_t kNonce[13]   = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x18, 0x1a, 0x1b, 0x1c };
+    const uint8_t kAad[8]      = { 0x0a, 0x1a, 0x2a, 0x3a, 0x4a, 0x5a, 0x6a, 0x7a };
+    uint8_t mic[16]            = { 0 };
+    uint8_t ciphertext_buffer[sizeof(kMessage)];
+    MutableByteSpan ciphertext(ciphertext_buffer);
+    MutableByteSpan tag(mic);
+
+    // Encrypt with the current key of (kFabric1, kGroup3), which is shared with (kFabric1, kGroup1) through kKeySet2
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric1, kGroup3);
+    ASSERT_NE(nullptr, key_context);
+    uint16_t session_id = key_context->GetKeyHash();
+    EXPECT_EQ(key_context->MessageEncrypt(ByteSpan(kMessage), ByteSpan(kAad), ByteSpan(kNonce), tag, ciphertext), CHIP_NO_ERROR);
+    key_context->Release();
+
+    auto collect = [&]() {
+        SessionList sessions =
+            CollectGroupSessions(provider, session_id, ciphertext, ByteSpan(kAad), ByteSpan(kNonce), tag, ByteSpan(kMessage));
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+        // The index must return exactly what the storage walk returns, in the same order
+        sProvider.SetGroupSessionCacheEnabled(false);
+        SessionList walked =
+            CollectGroupSessions(provider, session_id, ciphertext, ByteSpan(kAad), ByteSpan(kNonce), tag, ByteSpan(kMessage));
+        sProvider.SetGroupSessionCacheEnabled(true);
+        EXPECT_EQ(sessions, walked);
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+        return sessions;
+    };
+
+    const SessionList kBoth = { { kFabric1, kGroup1, SecurityPolicy::kTrustFirst },
+                                { kFabric1, kGroup3, SecurityPolicy::kTrustFirst } };
+    EXPECT_EQ(collect(), kBoth);
+    // Repeated lookups are served from the same index
+    EXPECT_EQ(collect(), kBoth);
+
+    // Removing a mapping drops the corresponding session
+    EXPECT_EQ(provider->RemoveGroupKeyAt(kFabric1, 2), CHIP_NO_ERROR);
+    EXPECT_EQ(collect(), SessionList({ { kFabric1, kGroup1, SecurityPolicy::kTrustFirst } }));
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 2, kGroup3Keyset2), CHIP_NO_ERROR);
+    EXPECT_EQ(collect(), kBoth);
+
+    // Replacing the keyset with different keys drops the old session id
+    KeySet replacement(kKeysetId2, SecurityPolicy::kCacheAndSync, 2);
+    memcpy(replacement.epoch_keys, kEpochKeys3, sizeof(EpochKey) * 2);
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, replacement), CHIP_NO_ERROR);
+    EXPECT_TRUE(collect().empty());
+
+    // Restoring the original keys brings the sessions back
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet2), CHIP_NO_ERROR);
+    EXPECT_EQ(collect(), kBoth);
+
+    // Keyset removal, which also removes its group mappings
+    EXPECT_EQ(provider->RemoveKeySet(kFabric1, kKeysetId2), CHIP_NO_ERROR);
+    EXPECT_TRUE(collect().empty());
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet2), CHIP_NO_ERROR);
+    EXPECT_TRUE(collect().empty());
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 1, kGroup1Keyset2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 2, kGroup3Keyset2), CHIP_NO_ERROR);
+    EXPECT_EQ(collect(), kBoth);
+
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    // Key contexts handed out by a live iterator stay usable across an invalidation
+    {
+        GroupSession session;
+        auto it = provider->IterateGroupSessions(session_id);
+        ASSERT_NE(it, nullptr);
+        ASSERT_TRUE(it->Next(session));
+        EXPECT_EQ(provider->RemoveKeySet(kFabric1, kKeysetId2), CHIP_NO_ERROR);
+
+        uint8_t plaintext_buffer[sizeof(kMessage)];
+        MutableByteSpan plaintext(plaintext_buffer);
+        EXPECT_EQ(session.keyContext->MessageDecrypt(ciphertext, ByteSpan(kAad), ByteSpan(kNonce), tag, plaintext), CHIP_NO_ERROR);
+        EXPECT_TRUE(plaintext.data_equal(ByteSpan(kMessage)));
+        it->Release();
+    }
+    EXPECT_TRUE(collect().empty());
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 1, kGroup1Keyset2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 2, kGroup3Keyset2), CHIP_NO_ERROR);
+    EXPECT_EQ(collect(), kBoth);
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
+    // Fabric removal
+    EXPECT_EQ(provider->RemoveFabric(kFabric2), CHIP_NO_ERROR);
+    EXPECT_EQ(collect(), kBoth);
+    EXPECT_EQ(provider->RemoveFabric(kFabric1), CHIP_NO_ERROR);
+    EXPECT_TRUE(collect().empty());
+}
+
+TEST_F(TestGroupDataProvider, TestGroupSessionLookupBenchmark)
+{
+    struct Config
+    {
+        uint8_t fabrics;
+        uint8_t groups;  // Per fabric, each mapped to one keyset
+        uint8_t keysets; // Per fabric, with 3 epoch keys each
+    };
+    constexpr Config kConfigs[] = { { 1, 1, 1 }, { 2, 2, 2 }, { 2, 5, 3 }, { 3, 5, 3 } };
+    constexpr size_t kSamples   = 200;
+
+    const uint8_t kMessage[10] = { 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9 };
+    const uint8_t kNonce[13]   = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x18, 0x1a, 0x1b, 0x1c };
+    const uint8_t kAad[8]      = { 0x0a, 0x1a, 0x2a, 0x3a, 0x4a, 0x5a, 0x6a, 0x7a };
+
+    for (const Config & config : kConfigs)
+    {
+        chip::TestPersistentStorageDelegate delegate;
+        chip::Crypto::DefaultSessionKeystore keystore;
+        GroupDataProviderImpl provider(kMaxGroupsPerFabric, kMaxGroupKeysPerFabric);
+        provider.SetStorageDelegate(&delegate);
+        provider.SetSessionKeystore(&keystore);
+        ASSERT_EQ(provider.Init(), CHIP_NO_ERROR);
+
+        FabricIndex last_fabric = kUndefinedFabricIndex;
+        GroupId last_group      = kUndefinedGroupId;
+        for (uint8_t f = 0; f < config.fabrics; f++)
+        {
+            FabricIndex fabric_index              = static_cast<FabricIndex>(f + 1);
+            uint8_t compressed_fabric_id_buffer[] = { 0x87, 0xe1, 0xb0, 0x04, 0xe2, 0x35, 0xa1, f };
+
+            for (uint8_t k = 0; k < config.keysets; k++)
+            {
+                KeySet keyset(static_cast<uint16_t>(k + 1), SecurityPolicy::kTrustFirst, 3);
+                for (uint8_t e = 0; e < 3; e++)
+                {
+                    keyset.epoch_keys[e].start_time = e;
+                    memset(keyset.epoch_keys[e].key, (f << 6) | (k << 2) | e, EpochKey::kLengthBytes);
+                }
+                ASSERT_EQ(provider.SetKeySet(fabric_index, ByteSpan(compressed_fabric_id_buffer), keyset), CHIP_NO_ERROR);
+            }
+            for (uint8_t g = 0; g < config.groups; g++)
+            {
+                GroupKey mapping(static_cast<GroupId>(kMinApplicationGroupId + g), static_cast<uint16_t>(g % config.keysets + 1));
+                ASSERT_EQ(provider.SetGroupKeyAt(fabric_index, g, mapping), CHIP_NO_ERROR);
+                last_fabric = fabric_index;
+                last_group  = mapping.group_id;
+            }
+        }
+
+        // Worst case for the storage walk: the sending group is the last one configured
+        uint8_t mic[16] = { 0 };
+        uint8_t ciphertext_buffer[sizeof(kMessage)];
+        MutableByteSpan ciphertext(ciphertext_buffer);
+        MutableByteSpan tag(mic);
+        Crypto::SymmetricKeyContext * key_context = provider.GetKeyContext(last_fabric, last_group);
+        ASSERT_NE(nullptr, key_context);
+        uint16_t session_id = key_context->GetKeyHash();
+        EXPECT_EQ(key_context->MessageEncrypt(ByteSpan(kMessage), ByteSpan(kAad), ByteSpan(kNonce), tag, ciphertext), CHIP_NO_ERROR);
+        key_context->Release();
+
+        // Per-packet dispatch: look up the candidate sessions and trial-decrypt until one succeeds
+        auto dispatch = [&]() {
+            GroupSession session;
+            bool decrypted = false;
+            auto it        = provider.IterateGroupSessions(session_id);
+            while (it != nullptr && !decrypted && it->Next(session))
+            {
+                uint8_t plaintext_buffer[sizeof(kMessage)];
+                MutableByteSpan plaintext(plaintext_buffer);
+                decrypted = (session.keyContext->MessageDecrypt(ciphertext, ByteSpan(kAad), ByteSpan(kNonce), tag, plaintext) ==
+                             CHIP_NO_ERROR);
+            }
+            if (it != nullptr)
+            {
+                it->Release();
+            }
+            return decrypted;
+        };
+
+        auto measure = [&]() {
+            System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+            for (size_t i = 0; i < kSamples; i++)
+            {
+                EXPECT_TRUE(dispatch());
+            }
+            return (System::SystemClock().GetMonotonicMicroseconds64() - start).count();
+        };
+
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+        provider.SetGroupSessionCacheEnabled(false);
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+        uint64_t walk_ns = measure() * 1000 / kSamples;
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+        provider.SetGroupSessionCacheEnabled(true);
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+        uint64_t indexed_ns = measure() * 1000 / kSamples;
+
+        ChipLogProgress(Test, "Group dispatch with %u fabrics, %u groups, %u keysets: storage walk %u ns/msg, indexed %u ns/msg",
+                        config.fabrics, config.groups, config.keysets, static_cast<unsigned>(walk_ns),
+                        static_cast<unsigned>(indexed_ns));
+
+        provider.Finish();
+    }
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
@@ -0,0 +1,307 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <credentials/FabricTable.h>
+#include <credentials/VerifiedCertChainCache.h>
+#include <credentials/examples/StrictCertificateValidityPolicyExample.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include "CHIPCert_test_vectors.h"
+
+#include <chrono>
+#include <cstring>
+
+using namespace chip;
+using namespace chip::Credentials;
+
+namespace {
+
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
+class TestVerifiedCertChainCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+ValidationContext MakeContext(uint32_t chipEpochTime)
+{
+    ValidationContext context;
+    context.Reset();
+    context.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(chipEpochTime));
+    context.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    context.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    return context;
+}
+
+// Some time within the validity period of the Root01:ICA01:Node01_01 chain
+constexpr uint32_t kValidTime = 700000000; // 2022-03-07
+
+VerifiedCertChainCache::ChainDigest MakeDigest(uint8_t seed)
+{
+    VerifiedCertChainCache::ChainDigest digest;
+    memset(digest.bytes, seed, sizeof(digest.bytes));
+    return digest;
+}
+
+VerifiedCertChain MakeChain(NodeId nodeId)
+{
+    VerifiedCertChain chain;
+    chain.fabricId = 1;
+    chain.nodeId   = nodeId;
+    return chain;
+}
+
+TEST_F(TestVerifiedCertChainCache, TestComputeDigest)
+{
+    using TestCerts::sTestCert_ICA01_Chip;
+    using TestCerts::sTestCert_Node01_01_Chip;
+    using TestCerts::sTestCert_Node01_02_Chip;
+    using TestCerts::sTestCert_Root01_Chip;
+
+    VerifiedCertChainCache::ChainDigest digest1;
+    VerifiedCertChainCache::ChainDigest digest2;
+    VerifiedCertChainCache::ChainDigest digest3;
+    VerifiedCertChainCache::ChainDigest digest4;
+
+    EXPECT_EQ(VerifiedCertChainCache::ComputeDigest(sTestCert_Node01_01_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip, digest1),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(VerifiedCertChainCache::ComputeDigest(sTestCert_Node01_01_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip, digest2),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(memcmp(digest1.bytes, digest2.bytes, sizeof(digest1.bytes)), 0);
+
+    // A different NOC, or the same certificates without the ICAC, give different digests
+    EXPECT_EQ(VerifiedCertChainCache::ComputeDigest(sTestCert_Node01_02_Chip, sTestCert_ICA01_Chip, sTestCert_Root01_Chip, digest3),
+              CHIP_NO_ERROR);
+    EXPECT_NE(memcmp(digest1.bytes, digest3.bytes, sizeof(digest1.bytes)), 0);
+
+    EXPECT_EQ(VerifiedCertChainCache::ComputeDigest(sTestCert_Node01_01_Chip, ByteSpan(), sTestCert_Root01_Chip, digest4),
+              CHIP_NO_ERROR);
+    EXPECT_NE(memcmp(digest1.bytes, digest4.bytes, sizeof(digest1.bytes)), 0);
+}
+
+TEST_F(TestVerifiedCertChainCache, TestLookupAfterVerification)
+{
+    VerifiedCertChainCache cache;
+    ValidationContext context = MakeContext(kValidTime);
+
+    VerifiedCertChainCache::ChainDigest digest;
+    ASSERT_EQ(VerifiedCertChainCache::ComputeDigest(TestCerts::sTestCert_Node01_01_Chip, TestCerts::sTestCert_ICA01_Chip,
+                                                    TestCerts::sTestCert_Root01_Chip, digest),
+              CHIP_NO_ERROR);
+
+    VerifiedCertChain chain;
+    EXPECT_FALSE(cache.Lookup(digest, context, chain));
+
+    VerifiedCertChain verified;
+    ASSERT_EQ(FabricTable::VerifyCredentials(TestCerts::sTestCert_Node01_01_Chip, TestCerts::sTestCert_ICA01_Chip,
+                                             TestCerts::sTestCert_Root01_Chip, context, verified),
+              CHIP_NO_ERROR);
+    EXPECT_LE(verified.notBefore, kValidTime);
+    EXPECT_TRUE(verified.notAfter == kNullCertTime || verified.notAfter >= kValidTime);
+    cache.Insert(digest, context, verified);
+
+    ASSERT_TRUE(cache.Lookup(digest, context, chain));
+    EXPECT_EQ(chain.compressedFabricId, verified.compressedFabricId);
+    EXPECT_EQ(chain.fabricId, verified.fabricId);
+    EXPECT_EQ(chain.nodeId, verified.nodeId);
+    EXPECT_TRUE(chain.nocPublicKey.Matches(verified.nocPublicKey));
+    EXPECT_TRUE(chain.rootPublicKey.Matches(verified.rootPublicKey));
+
+    EXPECT_EQ(cache.GetStats().hits, 1u);
+    EXPECT_EQ(cache.GetStats().misses, 1u);
+
+    // Outputs of the legacy overload match the cached chain
+    CompressedFabricId compressedFabricId;
+    FabricId fabricId;
+    NodeId nodeId;
+    Crypto::P256PublicKey nocPubkey;
+    ASSERT_EQ(FabricTable::VerifyCredentials(TestCerts::sTestCert_Node01_01_Chip, TestCerts::sTestCert_ICA01_Chip,
+                                             TestCerts::sTestCert_Root01_Chip, context, compressedFabricId, fabricId, nodeId,
+                                             nocPubkey),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(compressedFabricId, chain.compressedFabricId);
+    EXPECT_EQ(fabricId, chain.fabricId);
+    EXPECT_EQ(nodeId, chain.nodeId);
+    EXPECT_TRUE(nocPubkey.Matches(chain.nocPublicKey));
+
+    cache.Clear();
+    EXPECT_FALSE(cache.Lookup(digest, context, chain));
+}
+
+TEST_F(TestVerifiedCertChainCache, TestValidityWindow)
+{
+    VerifiedCertChainCache cache;
+    VerifiedCertChainCache::ChainDigest digest = MakeDigest(1);
+
+    VerifiedCertChain chain = MakeChain(1);
+    chain.notBefore         = 1000;
+    chain.notAfter          = 2000;
+    cache.Insert(digest, MakeContext(1500), chain);
+
+    VerifiedCertChain out;
+    EXPECT_TRUE(cache.Lookup(digest, MakeContext(1000), out));
+    EXPECT_TRUE(cache.Lookup(digest, MakeContext(2000), out));
+    EXPECT_FALSE(cache.Lookup(digest, MakeContext(999), out));
+    EXPECT_FALSE(cache.Lookup(digest, MakeContext(2001), out));
+
+    // As with the default validity policy, a last known good time is not checked against the window
+    ValidationContext lkgContext = MakeContext(0);
+    lkgContext.SetEffectiveTime<LastKnownGoodChipEpochTime>(System::Clock::Seconds32(5000));
+    EXPECT_TRUE(cache.Lookup(digest, lkgContext, out));
+
+    // A chain without an expiration is valid forever
+    chain.notAfter = kNullCertTime;
+    cache.Insert(digest, MakeContext(1500), chain);
+    EXPECT_TRUE(cache.Lookup(digest, MakeContext(UINT32_MAX - 1), out));
+}
+
+TEST_F(TestVerifiedCertChainCache, TestConstraintsMismatch)
+{
+    VerifiedCertChainCache cache;
+    VerifiedCertChainCache::ChainDigest digest = MakeDigest(2);
+    ValidationContext context                  = MakeContext(kValidTime);
+
+    cache.Insert(digest, context, MakeChain(1));
+
+    VerifiedCertChain out;
+    ValidationContext otherContext = context;
+    otherContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kClientAuth);
+    EXPECT_FALSE(cache.Lookup(digest, otherContext, out));
+
+    otherContext = context;
+    otherContext.mRequiredKeyUsages.Set(KeyUsageFlags::kKeyCertSign);
+    EXPECT_FALSE(cache.Lookup(digest, otherContext, out));
+
+    otherContext                  = context;
+    otherContext.mRequiredCertType = CertType::kICA;
+    EXPECT_FALSE(cache.Lookup(digest, otherContext, out));
+
+    EXPECT_TRUE(cache.Lookup(digest, context, out));
+}
+
+TEST_F(TestVerifiedCertChainCache, TestValidityPolicyNotCacheable)
+{
+    StrictCertificateValidityPolicyExample policy;
+    ValidationContext context = MakeContext(kValidTime);
+    EXPECT_TRUE(VerifiedCertChainCache::IsCacheable(context));
+
+    context.mValidityPolicy = &policy;
+    EXPECT_FALSE(VerifiedCertChainCache::IsCacheable(context));
+
+    VerifiedCertChainCache cache;
+    VerifiedCertChainCache::ChainDigest digest = MakeDigest(3);
+    cache.Insert(digest, context, MakeChain(1));
+
+    VerifiedCertChain out;
+    EXPECT_FALSE(cache.Lookup(digest, context, out));
+    context.mValidityPolicy = nullptr;
+    EXPECT_FALSE(cache.Lookup(digest, context, out));
+}
+
+TEST_F(TestVerifiedCertChainCache, TestLruEviction)
+{
+    VerifiedCertChainCache cache;
+    ValidationContext context = MakeContext(kValidTime);
+    VerifiedCertChain out;
+
+    for (size_t i = 0; i < VerifiedCertChainCache::kCapacity; i++)
+    {
+        cache.Insert(MakeDigest(static_cast<uint8_t>(i)), context, MakeChain(i + 1));
+    }
+
+    // Use the oldest entry, so that the second oldest one is evicted by the next insertion
+    EXPECT_TRUE(cache.Lookup(MakeDigest(0), context, out));
+    cache.Insert(MakeDigest(static_cast<uint8_t>(VerifiedCertChainCache::kCapacity)), context,
+                 MakeChain(VerifiedCertChainCache::kCapacity + 1));
+
+    EXPECT_TRUE(cache.Lookup(MakeDigest(0), context, out));
+    EXPECT_EQ(out.nodeId, 1u);
+    EXPECT_FALSE(cache.Lookup(MakeDigest(1), context, out));
+    for (size_t i = 2; i <= VerifiedCertChainCache::kCapacity; i++)
+    {
+        EXPECT_TRUE(cache.Lookup(MakeDigest(static_cast<uint8_t>(i)), context, out));
+        EXPECT_EQ(out.nodeId, i + 1);
+    }
+
+    // Re-inserting an existing chain replaces it in place
+    cache.Insert(MakeDigest(0), context, MakeChain(100));
+    EXPECT_TRUE(cache.Lookup(MakeDigest(0), context, out));
+    EXPECT_EQ(out.nodeId, 100u);
+    EXPECT_TRUE(cache.Lookup(MakeDigest(2), context, out));
+}
+
+// Reports the cost of validating a chain against looking it up, for a mix of repeat and new peers.
+TEST_F(TestVerifiedCertChainCache, TestVerificationBenchmark)
+{
+    constexpr unsigned kIterations = 200;
+    // One in kNewPeerInterval handshakes comes from a peer that was never seen, i.e. misses the cache
+    constexpr unsigned kNewPeerInterval = 10;
+
+    const ByteSpan noc  = TestCerts::sTestCert_Node01_01_Chip;
+    const ByteSpan icac = TestCerts::sTestCert_ICA01_Chip;
+    const ByteSpan rcac = TestCerts::sTestCert_Root01_Chip;
+
+    using Clock = std::chrono::steady_clock;
+
+    auto start = Clock::now();
+    for (unsigned i = 0; i < kIterations; i++)
+    {
+        ValidationContext context = MakeContext(kValidTime);
+        VerifiedCertChain chain;
+        ASSERT_EQ(FabricTable::VerifyCredentials(noc, icac, rcac, context, chain), CHIP_NO_ERROR);
+    }
+    auto uncachedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count() / kIterations;
+
+    VerifiedCertChainCache cache;
+    start = Clock::now();
+    for (unsigned i = 0; i < kIterations; i++)
+    {
+        if (i % kNewPeerInterval == 0)
+        {
+            cache.Clear();
+        }
+
+        ValidationContext context = MakeContext(kValidTime);
+        VerifiedCertChainCache::ChainDigest digest;
+        VerifiedCertChain chain;
+        ASSERT_EQ(VerifiedCertChainCache::ComputeDigest(noc, icac, rcac, digest), CHIP_NO_ERROR);
+        if (!cache.Lookup(digest, context, chain))
+        {
+            ASSERT_EQ(FabricTable::VerifyCredentials(noc, icac, rcac, context, chain), CHIP_NO_ERROR);
+            cache.Insert(digest, context, chain);
+        }
+    }
+    auto cachedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count() / kIterations;
+
+    const VerifiedCertChainCache::Stats & stats = cache.GetStats();
+    EXPECT_EQ(stats.hits + stats.misses, kIterations);
+    EXPECT_EQ(stats.misses, kIterations / kNewPeerInterval);
+
+    ChipLogProgress(Test, "VerifyCredentials: uncached %u ns/chain, cached %u ns/chain (hit rate %u%%)",
+                    static_cast<unsigned>(uncachedNs), static_cast<unsigned>(cachedNs),
+                    static_cast<unsigned>(stats.hits * 100 / kIterations));
+}
+
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
+} // namespace
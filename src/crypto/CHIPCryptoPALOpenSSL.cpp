@@ -23,6 +23,7 @@
 #include "CHIPCryptoPALOpenSSL.h"
 #include "CHIPCryptoPAL.h"
 
+#include <mutex>
 #include <type_traits>
 
 #if CHIP_CRYPTO_BORINGSSL
@@ -139,6 +140,232 @@ static int _compareDaysAndSeconds(const int days, const int seconds)
     return 0;
 }
 
+#if !CHIP_CRYPTO_BORINGSSL
+
+namespace {
+
+// Create a context for AES-CCM with `key`, the nonce length and the tag length, ready to take a nonce.
+EVP_CIPHER_CTX * NewAesCcmContext(const Aes128KeyHandle & key, size_t nonce_length, size_t tag_length, bool encrypt)
+{
+    const int enc            = encrypt ? 1 : 0;
+    EVP_CIPHER_CTX * context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnValue(context != nullptr, nullptr);
+
+    // Pass in cipher, nonce length, tag length and key, leaving the nonce for each message. Casts are safe because the
+    // callers checked the lengths.
+    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
+    if (EVP_CipherInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr, enc) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr) != 1 ||
+        EVP_CipherInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), nullptr, enc) != 1)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return nullptr;
+    }
+    return context;
+}
+
+#if CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+
+/**
+ * AES-CCM cipher contexts set up with the key schedule of a key handle, so that the messages of a session reuse them
+ * rather than allocating a context and expanding the key for each message.
+ *
+ * Contexts are only cached for the nonce and tag lengths of Matter messages, since CCM binds them to the key schedule.
+ * An entry is identified by the address of its key handle and checked against a copy of the key, so a handle reused for
+ * another key gets new contexts. Entries are released by DestroyKey(), or evicted, least recently used first, once the
+ * cache is full. A context is taken out of its entry while in use, so concurrent users of a key fall back to uncached
+ * contexts.
+ */
+class AesCcmContextCache
+{
+public:
+    // Take the context set up with `key` for encryption or decryption, or return nullptr if there is none to be had.
+    EVP_CIPHER_CTX * Acquire(const Aes128KeyHandle & key, bool encrypt);
+
+    // Give back a context returned by Acquire(). A context is freed rather than cached again if its operation failed,
+    // or if its key was destroyed or replaced meanwhile.
+    void Release(const Aes128KeyHandle & key, bool encrypt, EVP_CIPHER_CTX * context, bool reusable);
+
+    // Free the contexts set up with `key`.
+    void Remove(const Symmetric128BitsKeyHandle & key);
+
+private:
+    struct Entry
+    {
+        const Symmetric128BitsKeyHandle * handle; // nullptr for a free entry
+        Symmetric128BitsKeyByteArray key;
+        EVP_CIPHER_CTX * contexts[2]; // decryption and encryption contexts, created on first use
+        bool inUse[2];
+        uint32_t lastUse;
+    };
+
+    Entry * Find(const Symmetric128BitsKeyHandle & key);
+    Entry * Insert(const Aes128KeyHandle & key);
+    static void Clear(Entry & entry);
+
+    std::mutex mMutex;
+    Entry mEntries[CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE];
+    uint32_t mUseCount;
+};
+
+AesCcmContextCache gAesCcmContextCache;
+
+AesCcmContextCache::Entry * AesCcmContextCache::Find(const Symmetric128BitsKeyHandle & key)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.handle == &key)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+AesCcmContextCache::Entry * AesCcmContextCache::Insert(const Aes128KeyHandle & key)
+{
+    Entry * victim = nullptr;
+    for (auto & entry : mEntries)
+    {
+        if (entry.inUse[0] || entry.inUse[1])
+        {
+            continue;
+        }
+        if (entry.handle == nullptr)
+        {
+            victim = &entry;
+            break;
+        }
+        if (victim == nullptr || static_cast<int32_t>(entry.lastUse - victim->lastUse) < 0)
+        {
+            victim = &entry;
+        }
+    }
+    VerifyOrReturnValue(victim != nullptr, nullptr);
+
+    Clear(*victim);
+    victim->handle = &key;
+    memcpy(victim->key, key.As<Symmetric128BitsKeyByteArray>(), sizeof(victim->key));
+    return victim;
+}
+
+void AesCcmContextCache::Clear(Entry & entry)
+{
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(entry.contexts); i++)
+    {
+        // A context in use is freed when given back, as its entry no longer matches.
+        if (!entry.inUse[i] && entry.contexts[i] != nullptr)
+        {
+            EVP_CIPHER_CTX_free(entry.contexts[i]);
+        }
+        entry.contexts[i] = nullptr;
+        entry.inUse[i]    = false;
+    }
+    ClearSecretData(entry.key);
+    entry.handle = nullptr;
+}
+
+EVP_CIPHER_CTX * AesCcmContextCache::Acquire(const Aes128KeyHandle & key, bool encrypt)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    Entry * entry = Find(key);
+    if (entry != nullptr && memcmp(entry->key, key.As<Symmetric128BitsKeyByteArray>(), sizeof(entry->key)) != 0)
+    {
+        // The handle holds another key than the one the contexts were set up with.
+        VerifyOrReturnValue(!entry->inUse[0] && !entry->inUse[1], nullptr);
+        Clear(*entry);
+        entry = nullptr;
+    }
+    if (entry == nullptr)
+    {
+        entry = Insert(key);
+        VerifyOrReturnValue(entry != nullptr, nullptr);
+    }
+    VerifyOrReturnValue(!entry->inUse[encrypt], nullptr);
+
+    if (entry->contexts[encrypt] == nullptr)
+    {
+        entry->contexts[encrypt] = NewAesCcmContext(key, kAES_CCM128_Nonce_Length, CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, encrypt);
+        VerifyOrReturnValue(entry->contexts[encrypt] != nullptr, nullptr);
+    }
+    entry->inUse[encrypt] = true;
+    entry->lastUse        = mUseCount++;
+    return entry->contexts[encrypt];
+}
+
+void AesCcmContextCache::Release(const Aes128KeyHandle & key, bool encrypt, EVP_CIPHER_CTX * context, bool reusable)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    Entry * entry = Find(key);
+    if (entry != nullptr && entry->inUse[encrypt] && entry->contexts[encrypt] == context)
+    {
+        entry->inUse[encrypt] = false;
+        if (reusable)
+        {
+            return;
+        }
+        entry->contexts[encrypt] = nullptr;
+    }
+    EVP_CIPHER_CTX_free(context);
+}
+
+void AesCcmContextCache::Remove(const Symmetric128BitsKeyHandle & key)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    Entry * entry = Find(key);
+    if (entry != nullptr)
+    {
+        Clear(*entry);
+    }
+}
+
+#endif // CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+
+/**
+ * Get a context set up for AES-CCM with `key`, the nonce length and the tag length, ready to take a nonce, from the
+ * cache when possible. `cached` tells where the context comes from and must be passed to ReleaseAesCcmContext().
+ */
+EVP_CIPHER_CTX * AcquireAesCcmContext(const Aes128KeyHandle & key, size_t nonce_length, size_t tag_length, bool encrypt,
+                                      bool & cached)
+{
+    EVP_CIPHER_CTX * context = nullptr;
+#if CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+    if (nonce_length == kAES_CCM128_Nonce_Length && tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES)
+    {
+        context = gAesCcmContextCache.Acquire(key, encrypt);
+    }
+#endif // CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+    cached = (context != nullptr);
+    return cached ? context : NewAesCcmContext(key, nonce_length, tag_length, encrypt);
+}
+
+void ReleaseAesCcmContext(const Aes128KeyHandle & key, bool encrypt, EVP_CIPHER_CTX * context, bool cached, bool reusable)
+{
+#if CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+    if (cached)
+    {
+        gAesCcmContextCache.Release(key, encrypt, context, reusable);
+        return;
+    }
+#endif // CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+    EVP_CIPHER_CTX_free(context);
+}
+
+} // namespace
+
+#endif // !CHIP_CRYPTO_BORINGSSL
+
+void ReleaseCachedAesCcmContexts(const Symmetric128BitsKeyHandle & key)
+{
+#if !CHIP_CRYPTO_BORINGSSL && CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+    gAesCcmContextCache.Remove(key);
+#endif // !CHIP_CRYPTO_BORINGSSL && CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+}
+
 CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
                            const Aes128KeyHandle & key, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
                            uint8_t * tag, size_t tag_length)
@@ -149,9 +376,9 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
     const EVP_AEAD * aead  = nullptr;
 #else
     EVP_CIPHER_CTX * context = nullptr;
+    bool cachedContext       = false;
     int bytesWritten         = 0;
     size_t ciphertext_length = 0;
-    const EVP_CIPHER * type  = nullptr;
 #endif
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
@@ -206,26 +433,12 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
     VerifyOrExit(written_tag_len == tag_length, error = CHIP_ERROR_INTERNAL);
 #else
 
-    type = EVP_aes_128_ccm();
-
-    context = EVP_CIPHER_CTX_new();
+    // Get a context with cipher, nonce length, tag length and key passed in
+    context = AcquireAesCcmContext(key, nonce_length, tag_length, true, cachedContext);
     VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
 
-    // Pass in cipher
-    result = EVP_EncryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in nonce length.  Cast is safe because we checked with CanCastTo.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in tag length. Cast is safe because we checked against CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in key + nonce
-    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_EncryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
+    // Pass in nonce
+    result = EVP_EncryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
     // Pass in plain text length
@@ -266,7 +479,7 @@ exit:
 #if CHIP_CRYPTO_BORINGSSL
         EVP_AEAD_CTX_free(context);
 #else
-        EVP_CIPHER_CTX_free(context);
+        ReleaseAesCcmContext(key, true, context, cachedContext, error == CHIP_NO_ERROR);
 #endif // CHIP_CRYPTO_BORINGSSL
         context = nullptr;
     }
@@ -284,8 +497,8 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
 #else
 
     EVP_CIPHER_CTX * context = nullptr;
+    bool cachedContext       = false;
     int bytesOutput          = 0;
-    const EVP_CIPHER * type  = nullptr;
 #endif // CHIP_CRYPTO_BORINGSSL
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
@@ -336,19 +549,10 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                                       aad_length);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 #else
-    type = EVP_aes_128_ccm();
-
-    context = EVP_CIPHER_CTX_new();
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
-
-    // Pass in cipher
-    result = EVP_DecryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in nonce length
+    // Get a context with cipher, nonce length, tag length and key passed in
     VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    context = AcquireAesCcmContext(key, nonce_length, tag_length, false, cachedContext);
+    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
 
     // Pass in expected tag
     // Removing "const" from |tag| here should hopefully be safe as
@@ -358,9 +562,8 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                                             const_cast<void *>(static_cast<const void *>(tag)));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in key + nonce
-    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_DecryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
+    // Pass in nonce
+    result = EVP_DecryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce));
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
     // Pass in cipher text length
@@ -395,7 +598,7 @@ exit:
 #if CHIP_CRYPTO_BORINGSSL
         EVP_AEAD_CTX_free(context);
 #else
-        EVP_CIPHER_CTX_free(context);
+        ReleaseAesCcmContext(key, false, context, cachedContext, error == CHIP_NO_ERROR);
 #endif // CHIP_CRYPTO_BORINGSSL
 
         context = nullptr;
@@ -60,5 +60,10 @@ ECName MapECName(SupportedECPKeyTypes keyType);
  **/
 CHIP_ERROR P256PublicKeyFromECKey(EC_KEY * ec_key, P256PublicKey & pubkey);
 
+/**
+ * @brief Free the AES-CCM cipher contexts cached for a key handle, if any. Must be called before the key is destroyed.
+ **/
+void ReleaseCachedAesCcmContexts(const Symmetric128BitsKeyHandle & key);
+
 } // namespace Crypto
 } // namespace chip
@@ -204,6 +204,8 @@ CHIP_ERROR PersistentStorageOperationalKeystore::NewOpKeypairForFabric(FabricInd
     }
     VerifyOrReturnError(outCertificateSigningRequest.size() >= Crypto::kMIN_CSR_Buffer_Size, CHIP_ERROR_BUFFER_TOO_SMALL);
 
+    PendingKeypairLock lock(*this);
+
     // Replace previous pending keypair, if any was previously allocated
     ResetPendingKey();
 
@@ -235,6 +237,7 @@ CHIP_ERROR PersistentStorageOperationalKeystore::ActivateOpKeypairForFabric(Fabr
     // Validate public key being activated matches last generated pending keypair
     VerifyOrReturnError(mPendingKeypair->Pubkey().Matches(nocPublicKey), CHIP_ERROR_INVALID_PUBLIC_KEY);
 
+    PendingKeypairLock lock(*this);
     mIsPendingKeypairActive = true;
 
     return CHIP_NO_ERROR;
@@ -252,6 +255,7 @@ CHIP_ERROR PersistentStorageOperationalKeystore::CommitOpKeypairForFabric(Fabric
     ReturnErrorOnFailure(err);
 
     // If we got here, we succeeded and can reset the pending key: next `SignWithOpKeypair` will use the stored key.
+    PendingKeypairLock lock(*this);
     ResetPendingKey();
     return CHIP_NO_ERROR;
 }
@@ -288,23 +292,31 @@ void PersistentStorageOperationalKeystore::RevertPendingKeypair()
     VerifyOrReturn(mStorage != nullptr);
 
     // Just reset the pending key, we never stored anything
+    PendingKeypairLock lock(*this);
     ResetPendingKey();
 }
 
 CHIP_ERROR PersistentStorageOperationalKeystore::SignWithOpKeypair(FabricIndex fabricIndex, const ByteSpan & message,
                                                                    Crypto::P256ECDSASignature & outSignature) const
 {
-    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex), CHIP_ERROR_INVALID_FABRIC_INDEX);
 
-    if (mIsPendingKeypairActive && (fabricIndex == mPendingFabricIndex))
+    PersistentStorageDelegate * storage = nullptr;
     {
-        VerifyOrReturnError(mPendingKeypair != nullptr, CHIP_ERROR_INTERNAL);
-        // We have an override key: sign with it!
-        return mPendingKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
+        // May be called in the background, see SupportsSignWithOpKeypairInBackground()
+        PendingKeypairLock lock(*this);
+        VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+        if (mIsPendingKeypairActive && (fabricIndex == mPendingFabricIndex))
+        {
+            VerifyOrReturnError(mPendingKeypair != nullptr, CHIP_ERROR_INTERNAL);
+            // We have an override key: sign with it!
+            return mPendingKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
+        }
+        storage = mStorage;
     }
 
-    return SignWithStoredOpKey(fabricIndex, mStorage, message, outSignature);
+    return SignWithStoredOpKey(fabricIndex, storage, message, outSignature);
 }
 
 Crypto::P256Keypair * PersistentStorageOperationalKeystore::AllocateEphemeralKeypairForCASE()
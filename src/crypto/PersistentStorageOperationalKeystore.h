@@ -24,6 +24,10 @@
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <mutex>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
 namespace chip {
 
 /**
@@ -71,10 +75,23 @@ public:
     {
         VerifyOrReturn(mStorage != nullptr);
 
+        PendingKeypairLock lock(*this);
         ResetPendingKey();
         mStorage = nullptr;
     }
 
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    /**
+     * @brief Let `CASESession` call `SignWithOpKeypair` from the background event processing thread(s).
+     *
+     * The pending keypair is only replaced or released while no background signature uses it, but the storage
+     * delegate is then read from the background too: only enable this when it may be accessed from any thread.
+     */
+    void EnableSignWithOpKeypairInBackground() { mSignInBackground = true; }
+
+    bool SupportsSignWithOpKeypairInBackground() const override { return mSignInBackground; }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
     bool HasPendingOpKeypair() const override { return (mPendingKeypair != nullptr); }
 
     bool HasOpKeypairForFabric(FabricIndex fabricIndex) const override;
@@ -91,6 +108,23 @@ public:
     CHIP_ERROR MigrateOpKeypairForFabric(FabricIndex fabricIndex, OperationalKeystore & operationalKeystore) const override;
 
 protected:
+    // Held by the Matter thread while it changes the pending keypair, and by SignWithOpKeypair() while it reads it.
+    // Subclasses that change the pending keypair themselves must not enable background signing.
+    class PendingKeypairLock
+    {
+    public:
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+        explicit PendingKeypairLock(const PersistentStorageOperationalKeystore & keystore) : mLock(keystore.mPendingKeypairMutex) {}
+#else
+        explicit PendingKeypairLock(const PersistentStorageOperationalKeystore &) {}
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    private:
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+        std::lock_guard<std::mutex> mLock;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    };
+
     void ResetPendingKey()
     {
         if (!mIsExternallyOwnedKeypair && (mPendingKeypair != nullptr))
@@ -113,6 +147,11 @@ protected:
     // If overridding NewOpKeypairForFabric method in a subclass, set this to true in
     // `NewOpKeypairForFabric` if the mPendingKeypair should not be deleted when no longer in use.
     bool mIsExternallyOwnedKeypair = false;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mutable std::mutex mPendingKeypairMutex;
+    bool mSignInBackground = false;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 };
 
 } // namespace chip
@@ -18,6 +18,7 @@
 
 #include <inttypes.h>
 #include <string>
+#include <vector>
 
 #include <pw_unit_test/framework.h>
 
@@ -30,6 +31,10 @@
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <thread>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
 using namespace chip;
 using namespace chip::Crypto;
 
@@ -305,6 +310,73 @@ TEST_F(TestPersistentStorageOpKeyStore, TestBasicLifeCycle)
     opKeystore.Finish();
 }
 
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+TEST_F(TestPersistentStorageOpKeyStore, TestSignInBackground)
+{
+    constexpr FabricIndex kFabricIndex = 111;
+    constexpr int kIterations          = 20;
+
+    TestPersistentStorageDelegate storageDelegate;
+    PersistentStorageOperationalKeystore opKeystore;
+    ASSERT_EQ(opKeystore.Init(&storageDelegate), CHIP_NO_ERROR);
+
+    EXPECT_FALSE(opKeystore.SupportsSignWithOpKeypairInBackground());
+    opKeystore.EnableSignWithOpKeypairInBackground();
+    EXPECT_TRUE(opKeystore.SupportsSignWithOpKeypairInBackground());
+
+    // Every key the fabric used: the committed one first, then the pending ones.
+    std::vector<P256PublicKey> publicKeys;
+    auto activateNewKeypair = [&]() {
+        uint8_t csrBuf[kMIN_CSR_Buffer_Size];
+        MutableByteSpan csrSpan{ csrBuf };
+        P256PublicKey publicKey;
+        ASSERT_EQ(opKeystore.NewOpKeypairForFabric(kFabricIndex, csrSpan), CHIP_NO_ERROR);
+        ASSERT_EQ(VerifyCertificateSigningRequest(csrSpan.data(), csrSpan.size(), publicKey), CHIP_NO_ERROR);
+        ASSERT_EQ(opKeystore.ActivateOpKeypairForFabric(kFabricIndex, publicKey), CHIP_NO_ERROR);
+        publicKeys.push_back(publicKey);
+    };
+
+    activateNewKeypair();
+    ASSERT_EQ(opKeystore.CommitOpKeypairForFabric(kFabricIndex), CHIP_NO_ERROR);
+    activateNewKeypair();
+
+    // Sign in the background while the pending keypair keeps being replaced and reverted. The storage is only read
+    // by the background thread from now on, as the test storage delegate is not thread-safe.
+    uint8_t message[] = { 1, 2, 3, 4 };
+    std::vector<P256ECDSASignature> signatures(kIterations);
+    std::vector<CHIP_ERROR> results(kIterations, CHIP_ERROR_INTERNAL);
+    std::thread signer([&]() {
+        for (int i = 0; i < kIterations; i++)
+        {
+            results[static_cast<size_t>(i)] =
+                opKeystore.SignWithOpKeypair(kFabricIndex, ByteSpan{ message }, signatures[static_cast<size_t>(i)]);
+        }
+    });
+    for (int i = 0; i < kIterations; i++)
+    {
+        opKeystore.RevertPendingKeypair();
+        activateNewKeypair();
+    }
+    signer.join();
+
+    // Every signature was made with one of the keys, whole.
+    for (int i = 0; i < kIterations; i++)
+    {
+        EXPECT_EQ(results[static_cast<size_t>(i)], CHIP_NO_ERROR);
+        bool verified = false;
+        for (const auto & publicKey : publicKeys)
+        {
+            verified = verified ||
+                (publicKey.ECDSA_validate_msg_signature(message, sizeof(message), signatures[static_cast<size_t>(i)]) ==
+                 CHIP_NO_ERROR);
+        }
+        EXPECT_TRUE(verified);
+    }
+
+    opKeystore.Finish();
+}
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
 TEST_F(TestPersistentStorageOpKeyStore, TestEphemeralKeys)
 {
     chip::TestPersistentStorageDelegate storage;
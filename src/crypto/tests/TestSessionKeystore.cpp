@@ -27,7 +27,9 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/ScopedBuffer.h>
 #include <lib/support/Span.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
+#include <system/SystemClock.h>
 
 #if CHIP_CRYPTO_PSA
 #include <psa/crypto.h>
@@ -208,4 +210,104 @@ TEST_F(TestSessionKeystore, TestDeriveSessionKeys)
     }
 }
 
+TEST_F(TestSessionKeystore, TestReusedKeyHandle)
+{
+    TestSessionKeystoreImpl keystore;
+
+    // Verify that a key handle given another key, with or without destroying the previous one, encrypts and decrypts
+    // with the new key, including when the previous key was used for several messages, e.g. through cached contexts.
+    Aes128KeyHandle keyHandle;
+    bool destroy = false;
+    for (const ccm_128_test_vector * testPtr : ccm_128_test_vectors)
+    {
+        const ccm_128_test_vector & test = *testPtr;
+        if (test.result != CHIP_NO_ERROR || test.ct_len == 0)
+        {
+            continue;
+        }
+
+        Symmetric128BitsKeyByteArray keyMaterial;
+        memcpy(keyMaterial, test.key, test.key_len);
+        EXPECT_EQ(keystore.CreateKey(keyMaterial, keyHandle), CHIP_NO_ERROR);
+
+        Platform::ScopedMemoryBuffer<uint8_t> buffer;
+        ASSERT_TRUE(buffer.Alloc(test.ct_len));
+        uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+        ASSERT_LE(test.tag_len, sizeof(tag));
+
+        for (int i = 0; i < 2; i++)
+        {
+            EXPECT_EQ(AES_CCM_encrypt(test.pt, test.pt_len, test.aad, test.aad_len, keyHandle, test.nonce, test.nonce_len,
+                                      buffer.Get(), tag, test.tag_len),
+                      CHIP_NO_ERROR);
+            EXPECT_EQ(memcmp(buffer.Get(), test.ct, test.ct_len), 0);
+            EXPECT_EQ(memcmp(tag, test.tag, test.tag_len), 0);
+
+            EXPECT_EQ(AES_CCM_decrypt(test.ct, test.ct_len, test.aad, test.aad_len, test.tag, test.tag_len, keyHandle, test.nonce,
+                                      test.nonce_len, buffer.Get()),
+                      CHIP_NO_ERROR);
+            EXPECT_EQ(memcmp(buffer.Get(), test.pt, test.pt_len), 0);
+        }
+
+        // A message failing authentication does not prevent decrypting the next one.
+        tag[0] = static_cast<uint8_t>(test.tag[0] ^ 0x01);
+        EXPECT_NE(AES_CCM_decrypt(test.ct, test.ct_len, test.aad, test.aad_len, tag, test.tag_len, keyHandle, test.nonce,
+                                  test.nonce_len, buffer.Get()),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(AES_CCM_decrypt(test.ct, test.ct_len, test.aad, test.aad_len, test.tag, test.tag_len, keyHandle, test.nonce,
+                                  test.nonce_len, buffer.Get()),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(buffer.Get(), test.pt, test.pt_len), 0);
+
+        if (destroy)
+        {
+            keystore.DestroyKey(keyHandle);
+        }
+        destroy = !destroy;
+    }
+
+    keystore.DestroyKey(keyHandle);
+}
+
+TEST_F(TestSessionKeystore, TestMessageEncryptionBenchmark)
+{
+    // Measures the encryption and the decryption of small messages, such as Interaction Model reports, with a session key,
+    // as done by CryptoContext::Encrypt() and CryptoContext::Decrypt() for every secure unicast message.
+    constexpr size_t kIterations = 20000;
+    constexpr size_t kAadLength  = 16; // message header
+    TestSessionKeystoreImpl keystore;
+
+    Symmetric128BitsKeyByteArray keyMaterial = { 0x01, 0x02, 0x03, 0x04 };
+    Aes128KeyHandle keyHandle;
+    EXPECT_EQ(keystore.CreateKey(keyMaterial, keyHandle), CHIP_NO_ERROR);
+
+    for (size_t payloadLength : { 32u, 64u, 256u })
+    {
+        uint8_t aad[kAadLength]                          = {};
+        uint8_t nonce[CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES] = {};
+        uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+        uint8_t payload[256] = {};
+
+        uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            // Every message gets its own nonce, as from its message counter.
+            memcpy(nonce, &i, sizeof(i));
+            ASSERT_EQ(AES_CCM_encrypt(payload, payloadLength, aad, sizeof(aad), keyHandle, nonce, sizeof(nonce), payload, tag,
+                                      sizeof(tag)),
+                      CHIP_NO_ERROR);
+            ASSERT_EQ(AES_CCM_decrypt(payload, payloadLength, aad, sizeof(aad), tag, sizeof(tag), keyHandle, nonce, sizeof(nonce),
+                                      payload),
+                      CHIP_NO_ERROR);
+        }
+        uint64_t elapsed = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+
+        ChipLogProgress(Test, "%u-byte messages: %u ns to encrypt and decrypt a message, %u messages per second",
+                        static_cast<unsigned>(payloadLength), static_cast<unsigned>(elapsed * 1000 / kIterations),
+                        static_cast<unsigned>(kIterations * 1000000 / (elapsed > 0 ? elapsed : 1)));
+    }
+
+    keystore.DestroyKey(keyHandle);
+}
+
 } // namespace
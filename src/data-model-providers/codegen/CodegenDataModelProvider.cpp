@@ -132,6 +132,18 @@ CHIP_ERROR CodegenDataModelProvider::Shutdown()
     return DataModel::Provider::Shutdown();
 }
 
+DataModel::MetadataSnapshot * CodegenDataModelProvider::GetMetadataSnapshot()
+{
+    if ((mSnapshotEmberGeneration != emberAfMetadataStructureGeneration()) ||
+        (mSnapshotRegistryGeneration != mRegistry.Generation()))
+    {
+        mMetadataSnapshot.Invalidate();
+        mSnapshotEmberGeneration    = emberAfMetadataStructureGeneration();
+        mSnapshotRegistryGeneration = mRegistry.Generation();
+    }
+    return &mMetadataSnapshot;
+}
+
 CHIP_ERROR CodegenDataModelProvider::Startup(DataModel::InteractionModelContext context)
 {
     // server clusters require a valid persistent storage delegate
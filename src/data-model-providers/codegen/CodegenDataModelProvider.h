@@ -22,6 +22,7 @@
 #include <app/ConcreteAttributePath.h>
 #include <app/ConcreteCommandPath.h>
 #include <app/data-model-provider/ActionReturnStatus.h>
+#include <app/data-model-provider/MetadataSnapshot.h>
 #include <app/data-model-provider/MetadataTypes.h>
 #include <app/server-cluster/SingleEndpointServerClusterRegistry.h>
 #include <app/util/af-types.h>
@@ -51,7 +52,11 @@ public:
 
     /// clears out internal caching. Especially useful in unit tests,
     /// where path caching does not really apply (the same path may result in different outcomes)
-    void Reset() { mPreviouslyFoundCluster = std::nullopt; }
+    void Reset()
+    {
+        mPreviouslyFoundCluster = std::nullopt;
+        mMetadataSnapshot.Invalidate();
+    }
 
     void SetPersistentStorageDelegate(PersistentStorageDelegate * delegate) { mPersistentStorageDelegate = delegate; }
     PersistentStorageDelegate * GetPersistentStorageDelegate() { return mPersistentStorageDelegate; }
@@ -61,6 +66,7 @@ public:
     /// Generic model implementations
     CHIP_ERROR Startup(DataModel::InteractionModelContext context) override;
     CHIP_ERROR Shutdown() override;
+    DataModel::MetadataSnapshot * GetMetadataSnapshot() override;
 
     DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
                                                 AttributeValueEncoder & encoder) override;
@@ -127,6 +133,11 @@ private:
 
     SingleEndpointServerClusterRegistry mRegistry;
 
+    // Cached metadata tree, invalidated whenever the ember structure or the registered clusters change
+    DataModel::MetadataSnapshot mMetadataSnapshot{ *this };
+    unsigned mSnapshotEmberGeneration     = 0;
+    uint32_t mSnapshotRegistryGeneration = 0;
+
     /// Finds the specified ember cluster
     ///
     /// Effectively the same as `emberAfFindServerCluster` except with some caching capabilities
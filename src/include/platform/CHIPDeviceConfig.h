@@ -127,6 +127,26 @@
 #define CHIP_DEVICE_CONFIG_BG_TASK_PRIORITY 1
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+ *
+ * The number of threads processing background events, on platforms that can run several (POSIX).
+ * Background work (e.g. the CASE signature generation and verification) is then processed concurrently.
+ */
+#ifndef CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+#define CHIP_DEVICE_CONFIG_BG_TASK_COUNT 1
+#endif
+
+/**
+ * CHIP_DEVICE_CONFIG_KVS_THREAD_SAFE
+ *
+ * Set to 1 if the KeyValueStoreManager may be called from any thread. The default operational keystore
+ * of CommonCaseDeviceServerInitParams then signs the CASE Sigma3 messages as background work.
+ */
+#ifndef CHIP_DEVICE_CONFIG_KVS_THREAD_SAFE
+#define CHIP_DEVICE_CONFIG_KVS_THREAD_SAFE 0
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE
  *
@@ -295,4 +295,58 @@
 #define INET_CONFIG_UDP_SOCKET_MREQN 0
 #endif
 
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE
+ *
+ *  @brief
+ *    Maximum number of datagrams read with a single recvmmsg() call by the
+ *    socket-based implementation of UDP endpoints, or 0 to read them one at
+ *    a time with recvmsg().
+ *
+ *  @details
+ *    The datagrams are read into a static area shared by all endpoints, of
+ *    this many times the maximum packet buffer size, and only copied into
+ *    packet buffers as they are delivered. Requires recvmmsg(), e.g. on
+ *    Linux.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE 0
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE
+ *
+ *  @brief
+ *    Maximum number of datagrams queued by the socket-based implementation of
+ *    UDP endpoints while an Inet::UDPSendBatch is open, or 0 to always send
+ *    datagrams immediately with sendmsg().
+ *
+ *  @details
+ *    Queued datagrams are copied to a static area of this many times the
+ *    maximum packet buffer size, then sent with sendmmsg(), using UDP
+ *    segmentation offload (UDP_SEGMENT) for consecutive datagrams of the same
+ *    size to the same destination when the kernel supports it. Requires
+ *    sendmmsg(), e.g. on Linux.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE 0
+#endif // INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT
+ *
+ *  @brief
+ *    Maximum number of packet buffers of the send queue written with a single
+ *    sendmsg() call by the socket-based implementation of TCP endpoints.
+ *
+ *  @details
+ *    With more than one, the headers, payload and trailer of a message, or
+ *    several queued messages, may be written in one system call without
+ *    first being copied to a contiguous buffer. Uses this many struct iovec
+ *    on the stack.
+ */
+#ifndef INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT
+#define INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT 1
+#endif // INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT
+
 // clang-format on
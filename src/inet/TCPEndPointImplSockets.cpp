@@ -67,6 +67,20 @@
 namespace chip {
 namespace Inet {
 
+namespace {
+TCPEndPointImplSockets::IOCounters sIOCounters;
+} // anonymous namespace
+
+const TCPEndPointImplSockets::IOCounters & TCPEndPointImplSockets::GetIOCounters()
+{
+    return sIOCounters;
+}
+
+void TCPEndPointImplSockets::ResetIOCounters()
+{
+    sIOCounters = IOCounters();
+}
+
 CHIP_ERROR TCPEndPointImplSockets::BindImpl(IPAddressType addrType, const IPAddress & addr, uint16_t port, bool reuseAddr)
 {
     CHIP_ERROR res = GetSocket(addrType);
@@ -484,9 +498,48 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
     TCPEndPointHandle handle(this);
     while (!mSendQueue.IsNull())
     {
-        size_t bufLen = mSendQueue->DataLength();
+        // Gather the first buffers of the send queue, so that a message split in several buffers (or several small
+        // messages) goes out with a single system call and without being made contiguous first.
+        struct iovec sendIOVs[INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT];
+        size_t iovCount = 0;
+        size_t bufLen   = 0;
+        for (System::PacketBufferHandle buf = mSendQueue.Retain(); !buf.IsNull() && iovCount < MATTER_ARRAY_SIZE(sendIOVs);
+             buf.Advance())
+        {
+            if (buf->DataLength() > 0)
+            {
+                sendIOVs[iovCount].iov_base = buf->Start();
+                sendIOVs[iovCount].iov_len  = buf->DataLength();
+                bufLen += buf->DataLength();
+                iovCount++;
+            }
+        }
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        if (bufLen == 0)
+        {
+            // Nothing but empty buffers at the head of the queue; drop them.
+            while (!mSendQueue.IsNull() && mSendQueue->DataLength() == 0)
+            {
+                mSendQueue.FreeHead();
+            }
+            if (mSendQueue.IsNull())
+            {
+                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            }
+            if (err != CHIP_NO_ERROR)
+            {
+                break;
+            }
+            continue;
+        }
+
+        struct msghdr msgHeader;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_iov    = sendIOVs;
+        msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
+
+        ssize_t lenSentRaw = sendmsg(mSocket, &msgHeader, sendFlags);
+        sIOCounters.mSendCalls++;
 
         if (lenSentRaw == -1)
         {
@@ -504,25 +557,30 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         }
 
         size_t lenSent = static_cast<size_t>(lenSentRaw);
+        sIOCounters.mBytesSent += lenSent;
 
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+        // Release the buffers that were sent in full, and consume what was sent of the next one.
+        size_t lenToRelease = lenSent;
+        while (!mSendQueue.IsNull() && mSendQueue->DataLength() <= lenToRelease)
         {
-            mSendQueue->ConsumeHead(lenSent);
+            lenToRelease -= mSendQueue->DataLength();
+            mSendQueue.FreeHead();
         }
-        else
+        if (lenToRelease > 0)
         {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            mSendQueue->ConsumeHead(lenToRelease);
+        }
+
+        if (mSendQueue.IsNull())
+        {
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
@@ -879,6 +937,7 @@ void TCPEndPointImplSockets::ReceiveData()
 
     // Attempt to receive data from the socket.
     ssize_t rcvLen = recv(mSocket, rcvBuf->Start() + rcvBuf->DataLength(), rcvBuf->AvailableDataLength(), 0);
+    sIOCounters.mReceiveCalls++;
 
 #if INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
     CHIP_ERROR err;
@@ -958,10 +1017,22 @@ void TCPEndPointImplSockets::ReceiveData()
         {
             VerifyOrDie(rcvLen > 0);
             size_t newDataLength = rcvBuf->DataLength() + static_cast<size_t>(rcvLen);
+            sIOCounters.mBytesReceived += static_cast<size_t>(rcvLen);
             if (isNewBuf)
             {
                 rcvBuf->SetDataLength(newDataLength);
-                rcvBuf.RightSize();
+                // Right-sizing copies the data, so only do it when most of the buffer would be wasted. The room left
+                // after a large read lets the rest of a long message be gathered in place by the consumer, rather
+                // than the whole message being copied to a contiguous buffer.
+                if (rcvBuf->AvailableDataLength() > newDataLength)
+                {
+                    const uint8_t * unsizedStart = rcvBuf->Start();
+                    rcvBuf.RightSize();
+                    if (rcvBuf->Start() != unsizedStart)
+                    {
+                        sIOCounters.mBytesCopied += newDataLength;
+                    }
+                }
                 if (mRcvQueue.IsNull())
                 {
                     mRcvQueue = std::move(rcvBuf);
@@ -51,6 +51,22 @@ public:
     void TCPUserTimeoutHandler() override;
 #endif // INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
 
+    /**
+     * Numbers of bytes received and sent by all the endpoints, of the system calls used to do so, and of the bytes
+     * copied between packet buffers on the way.
+     */
+    struct IOCounters
+    {
+        uint64_t mBytesReceived = 0;
+        uint64_t mReceiveCalls  = 0;
+        uint64_t mBytesSent     = 0;
+        uint64_t mSendCalls     = 0;
+        uint64_t mBytesCopied   = 0;
+    };
+
+    static const IOCounters & GetIOCounters();
+    static void ResetIOCounters();
+
 private:
     // TCPEndPoint overrides.
     CHIP_ERROR BindImpl(IPAddressType addrType, const IPAddress & addr, uint16_t port, bool reuseAddr) override;
@@ -307,6 +307,87 @@ protected:
     virtual void Free();
 };
 
+/**
+ * Scope within which selected UDP messages sent by socket-based endpoints are queued rather than sent immediately.
+ *
+ * Only the messages sent between BeginQueueing() and EndQueueing() on the innermost scope are queued; the others, like
+ * the ones sent by callbacks run within the scope, are sent right away and get their errors as usual. The queued
+ * messages are handed to the kernel together when the outermost scope ends, the queue is full or the sending endpoint is
+ * closed, with as few system calls as possible (sendmmsg() and UDP segmentation offload). A queued message counts as
+ * sent: errors reported by the kernel when the queue is flushed are passed to the delegate of the scope which queued it,
+ * if any, along with the send context given to BeginQueueing(). A scope with a delegate flushes the queue when it ends,
+ * so the delegate is never called after that.
+ *
+ * This is a no-op unless INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE is enabled, in which case errors are returned by the
+ * sends themselves. Scopes must only be opened from the thread owning the CHIP stack.
+ */
+class UDPSendBatch
+{
+public:
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /**
+         * A message queued with @p sendContext could not be sent.
+         */
+        virtual void OnQueuedSendFailed(const void * sendContext, CHIP_ERROR error) = 0;
+    };
+
+    UDPSendBatch(const UDPSendBatch &)             = delete;
+    UDPSendBatch & operator=(const UDPSendBatch &) = delete;
+
+#if INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0 && CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    explicit UDPSendBatch(Delegate * delegate = nullptr) : mDelegate(delegate), mOuter(sInnermost)
+    {
+        sInnermost = this;
+        sDepth++;
+    }
+    ~UDPSendBatch();
+
+    /**
+     * Queue the messages sent from now on until EndQueueing(), passing @p sendContext to the delegate for their errors.
+     */
+    void BeginQueueing(const void * sendContext = nullptr)
+    {
+        mQueueing    = true;
+        mSendContext = sendContext;
+    }
+
+    /**
+     * Send the messages sent from now on right away again.
+     */
+    void EndQueueing()
+    {
+        mQueueing    = false;
+        mSendContext = nullptr;
+    }
+
+    static bool IsQueueing() { return sInnermost != nullptr && sInnermost->mQueueing; }
+    static UDPSendBatch * GetInnermost() { return sInnermost; }
+
+    Delegate * GetDelegate() const { return mDelegate; }
+    const void * GetSendContext() const { return mSendContext; }
+
+private:
+    static unsigned sDepth;
+    static UDPSendBatch * sInnermost;
+
+    Delegate * const mDelegate;
+    UDPSendBatch * const mOuter;
+    const void * mSendContext = nullptr;
+    bool mQueueing            = false;
+#else
+    explicit UDPSendBatch(Delegate * delegate = nullptr) {}
+
+    void BeginQueueing(const void * sendContext = nullptr) {}
+    void EndQueueing() {}
+
+    static bool IsQueueing() { return false; }
+#endif // INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0 && CHIP_SYSTEM_CONFIG_USE_SOCKETS
+};
+
 template <>
 struct EndPointProperties<UDPEndPoint>
 {
@@ -228,8 +228,7 @@ CHIP_ERROR UDPEndPointImplOT::SendMsgImpl(const IPPacketInfo * aPktInfo, System:
     otMessage * message;
     otMessageInfo messageInfo;
 
-    // For now the entire message must fit within a single buffer.
-    VerifyOrReturnError(!msg->HasChainedBuffer() && msg->DataLength() <= UINT16_MAX, CHIP_ERROR_MESSAGE_TOO_LONG);
+    VerifyOrReturnError(msg->TotalLength() <= UINT16_MAX, CHIP_ERROR_MESSAGE_TOO_LONG);
 
     memset(&messageInfo, 0, sizeof(messageInfo));
 
@@ -241,7 +240,11 @@ CHIP_ERROR UDPEndPointImplOT::SendMsgImpl(const IPPacketInfo * aPktInfo, System:
     message = otUdpNewMessage(mOTInstance, NULL);
     VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
 
-    error = otMessageAppend(message, msg->Start(), static_cast<uint16_t>(msg->DataLength()));
+    // Append every buffer of the chain (e.g. packet header, payload and MIC) to the message.
+    for (System::PacketBufferHandle buf = msg.Retain(); !buf.IsNull() && error == OT_ERROR_NONE; buf.Advance())
+    {
+        error = otMessageAppend(message, buf->Start(), static_cast<uint16_t>(buf->DataLength()));
+    }
 
     if (error == OT_ERROR_NONE)
     {
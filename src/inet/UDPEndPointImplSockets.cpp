@@ -36,6 +36,9 @@
 #endif // HAVE_SYS_SOCKET_H
 #include <net/if.h>
 #include <netinet/in.h>
+#if INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+#include <netinet/udp.h> // UDP_SEGMENT, where supported
+#endif // INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
 #include <sys/ioctl.h>
 #endif // CHIP_SYSTEM_CONFIG_USE_POSIX_SOCKETS
 
@@ -167,12 +170,479 @@ CHIP_ERROR IPv4Bind(int socket, const IPAddress & address, uint16_t port)
 }
 #endif // INET_CONFIG_ENABLE_IPV4
 
+// Destination and ancillary data of a datagram to send.
+struct DatagramHeader
+{
+    SockAddr peer;
+    socklen_t peerLength;
+    size_t controlLength; // 0 if the datagram has no control message
+    alignas(struct cmsghdr) uint8_t control[256];
+};
+
+CHIP_ERROR PrepareDatagramHeader(IPAddressType addressType, InterfaceId boundIntfId, const IPPacketInfo * aPktInfo,
+                                 DatagramHeader & header)
+{
+    memset(&header, 0, sizeof(header));
+
+    // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
+    SockAddr & peerSockAddr = header.peer;
+    if (addressType == IPAddressType::kIPv6)
+    {
+        peerSockAddr.in6.sin6_family     = AF_INET6;
+        peerSockAddr.in6.sin6_port       = htons(aPktInfo->DestPort);
+        peerSockAddr.in6.sin6_addr       = aPktInfo->DestAddress.ToIPv6();
+        InterfaceId::PlatformType intfId = aPktInfo->Interface.GetPlatformInterface();
+        VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId), CHIP_ERROR_INCORRECT_STATE);
+        peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId);
+        header.peerLength              = sizeof(sockaddr_in6);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        peerSockAddr.in.sin_family = AF_INET;
+        peerSockAddr.in.sin_port   = htons(aPktInfo->DestPort);
+        peerSockAddr.in.sin_addr   = aPktInfo->DestAddress.ToIPv4();
+        header.peerLength          = sizeof(sockaddr_in);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+
+    // If the endpoint has been bound to a particular interface,
+    // and the caller didn't supply a specific interface to send
+    // on, use the bound interface. This appears to be necessary
+    // for messages to multicast addresses, which under Linux
+    // don't seem to get sent out the correct interface, despite
+    // the socket being bound.
+    InterfaceId intf = aPktInfo->Interface;
+    if (!intf.IsPresent())
+    {
+        intf = boundIntfId;
+    }
+
+#if INET_CONFIG_UDP_SOCKET_PKTINFO
+    // If the packet should be sent over a specific interface, or with a specific source
+    // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
+    // add add it to the message header.  If the local OS doesn't support IP_PKTINFO/IPV6_PKTINFO
+    // fail with an error.
+    if (intf.IsPresent() || aPktInfo->SrcAddress.Type() != IPAddressType::kAny)
+    {
+#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+        struct msghdr msgHeader;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_control    = header.control;
+        msgHeader.msg_controllen = sizeof(header.control);
+
+        struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
+        InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
+
+#if INET_CONFIG_ENABLE_IPV4
+
+        if (addressType == IPAddressType::kIPv4)
+        {
+#if defined(IP_PKTINFO)
+            controlHdr->cmsg_level = IPPROTO_IP;
+            controlHdr->cmsg_type  = IP_PKTINFO;
+            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in_pktinfo));
+
+            auto * pktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<decltype(pktInfo->ipi_ifindex)>(intfId))
+            {
+                return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+            }
+
+            pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
+            pktInfo->ipi_spec_dst = aPktInfo->SrcAddress.ToIPv4();
+
+            header.controlLength = CMSG_SPACE(sizeof(in_pktinfo));
+#else  // !defined(IP_PKTINFO)
+            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !defined(IP_PKTINFO)
+        }
+
+#endif // INET_CONFIG_ENABLE_IPV4
+
+        if (addressType == IPAddressType::kIPv6)
+        {
+#if defined(IPV6_PKTINFO)
+            controlHdr->cmsg_level = IPPROTO_IPV6;
+            controlHdr->cmsg_type  = IPV6_PKTINFO;
+            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in6_pktinfo));
+
+            auto * pktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<decltype(pktInfo->ipi6_ifindex)>(intfId))
+            {
+                return CHIP_ERROR_UNEXPECTED_EVENT;
+            }
+            pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
+            pktInfo->ipi6_addr    = aPktInfo->SrcAddress.ToIPv6();
+
+            header.controlLength = CMSG_SPACE(sizeof(in6_pktinfo));
+#else  // !defined(IPV6_PKTINFO)
+            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !defined(IPV6_PKTINFO)
+        }
+
+#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+    }
+#endif // INET_CONFIG_UDP_SOCKET_PKTINFO
+
+    return CHIP_NO_ERROR;
+}
+
+void InitMessageHeader(struct msghdr & msgHeader, DatagramHeader & header, struct iovec * msgIOV, size_t iovLength)
+{
+    memset(&msgHeader, 0, sizeof(msgHeader));
+    msgHeader.msg_name    = &header.peer;
+    msgHeader.msg_namelen = header.peerLength;
+    msgHeader.msg_iov     = msgIOV;
+    msgHeader.msg_iovlen  = static_cast<decltype(msgHeader.msg_iovlen)>(iovLength);
+    if (header.controlLength > 0)
+    {
+        msgHeader.msg_control    = header.control;
+        msgHeader.msg_controllen = static_cast<decltype(msgHeader.msg_controllen)>(header.controlLength);
+    }
+}
+
+// Fill the source of a received datagram, and its destination and interface from its IP_PKTINFO/IPV6_PKTINFO control message.
+CHIP_ERROR ParseReceivedDatagram(struct msghdr & msgHeader, IPPacketInfo & pktInfo)
+{
+    const SockAddr & peerSockAddr = *static_cast<const SockAddr *>(msgHeader.msg_name);
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        pktInfo.SrcAddress = IPAddress(peerSockAddr.in6.sin6_addr);
+        pktInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        pktInfo.SrcAddress = IPAddress(peerSockAddr.in.sin_addr);
+        pktInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            pktInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            pktInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            pktInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            pktInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+UDPEndPointImplSockets::IOCounters sIOCounters;
+
+// Largest number of chained buffers a datagram is gathered from (e.g. packet header, payload and MIC).
+constexpr size_t kMaxDatagramBuffers = 4;
+
+#if INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0 || INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+bool sBatchedIOEnabled = true;
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0 || INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+
+#if INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0
+constexpr size_t kReceiveBatchSize = INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE;
+
+// Storage for the datagrams read by a recvmmsg(), shared by all the endpoints since reads are never nested. Datagrams are
+// only copied to packet buffers, which may come from a small pool, as they are delivered.
+struct ReceivedDatagram
+{
+    SockAddr peer;
+    alignas(struct cmsghdr) uint8_t control[256];
+    uint8_t data[System::PacketBuffer::kMaxSizeWithoutReserve];
+};
+
+ReceivedDatagram sReceivedDatagrams[kReceiveBatchSize];
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0
+
+#if INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+constexpr size_t kSendBatchSize = INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE;
+
+// Datagrams are copied rather than kept in their packet buffers, which may come from a small pool.
+struct PendingDatagram
+{
+    int socket;
+    DatagramHeader header;
+    size_t length;
+    UDPSendBatch::Delegate * delegate; // Told about the send errors, if not null
+    const void * sendContext;
+    uint8_t data[System::PacketBuffer::kMaxSizeWithoutReserve];
+};
+
+// Datagrams sent while a UDPSendBatch is open, oldest first.
+PendingDatagram sPendingDatagrams[kSendBatchSize];
+size_t sPendingDatagramCount = 0;
+
+#ifdef UDP_SEGMENT
+// Kernel limits on the segments of a message sent with UDP_SEGMENT.
+constexpr size_t kMaxSegments        = 64;
+constexpr size_t kMaxSegmentedLength = 65507; // Largest UDP payload over IPv4
+
+static_assert(sizeof(DatagramHeader::control) >= CMSG_SPACE(sizeof(in6_pktinfo)) + CMSG_SPACE(sizeof(uint16_t)),
+              "No room for a UDP_SEGMENT control message after the IP_PKTINFO/IPV6_PKTINFO one");
+
+// Cleared if the kernel rejects segmented messages.
+bool sSegmentationEnabled = true;
+#endif // UDP_SEGMENT
+
+// Returns the number of pending datagrams, starting at `first`, which can be sent as the segments of a single message:
+// they go through the same socket, to the same destination with the same control messages, and all but the last one
+// have the same length, which the last one does not exceed.
+size_t CountSegments(size_t first)
+{
+#ifdef UDP_SEGMENT
+    const PendingDatagram & head = sPendingDatagrams[first];
+    const size_t segmentLength   = head.length;
+    VerifyOrReturnValue(sSegmentationEnabled && segmentLength > 0, 1);
+
+    size_t count       = 1;
+    size_t totalLength = segmentLength;
+    while (first + count < sPendingDatagramCount && count < kMaxSegments)
+    {
+        const PendingDatagram & datagram = sPendingDatagrams[first + count];
+        const size_t length              = datagram.length;
+        if (datagram.socket != head.socket || length == 0 || length > segmentLength || totalLength + length > kMaxSegmentedLength ||
+            datagram.header.peerLength != head.header.peerLength ||
+            memcmp(&datagram.header.peer, &head.header.peer, head.header.peerLength) != 0 ||
+            datagram.header.controlLength != head.header.controlLength ||
+            memcmp(datagram.header.control, head.header.control, head.header.controlLength) != 0)
+        {
+            break;
+        }
+
+        count++;
+        totalLength += length;
+        if (length < segmentLength)
+        {
+            // Only the last segment may be shorter.
+            break;
+        }
+    }
+    return count;
+#else
+    return 1;
+#endif // UDP_SEGMENT
+}
+
+// Send errors are only passed to the delegates once the queue is empty, as they may send more messages.
+struct FailedSend
+{
+    UDPSendBatch::Delegate * delegate;
+    const void * sendContext;
+    CHIP_ERROR error;
+};
+
+struct FailedSends
+{
+    FailedSend sends[kSendBatchSize];
+    size_t count = 0;
+
+    void Add(const PendingDatagram & datagram, CHIP_ERROR error)
+    {
+        ChipLogError(Inet, "Failed to send queued UDP datagram: %" CHIP_ERROR_FORMAT, error.Format());
+        if (datagram.delegate != nullptr)
+        {
+            sends[count++] = { datagram.delegate, datagram.sendContext, error };
+        }
+    }
+};
+
+void SendDatagram(PendingDatagram & datagram, FailedSends & failedSends)
+{
+    struct iovec msgIOV;
+    msgIOV.iov_base = datagram.data;
+    msgIOV.iov_len  = datagram.length;
+
+    struct msghdr msgHeader;
+    InitMessageHeader(msgHeader, datagram.header, &msgIOV, 1);
+
+    const ssize_t lenSent = sendmsg(datagram.socket, &msgHeader, 0);
+    sIOCounters.mSendCalls++;
+    if (lenSent < 0)
+    {
+        failedSends.Add(datagram, CHIP_ERROR_POSIX(errno));
+        return;
+    }
+    sIOCounters.mDatagramsSent++;
+}
+
+// Send all the pending datagrams, with one sendmmsg() per run of datagrams going through the same socket.
+void FlushPendingDatagrams()
+{
+    struct mmsghdr msgHeaders[kSendBatchSize];
+    struct iovec msgIOVs[kSendBatchSize];
+    size_t firstDatagrams[kSendBatchSize]; // Index of the first datagram of each message
+    FailedSends failedSends;
+
+    size_t first = 0;
+    while (first < sPendingDatagramCount)
+    {
+        const int socket    = sPendingDatagrams[first].socket;
+        size_t messageCount = 0;
+        size_t next         = first;
+        while (next < sPendingDatagramCount && sPendingDatagrams[next].socket == socket)
+        {
+            const size_t segmentCount = CountSegments(next);
+            for (size_t i = next; i < next + segmentCount; i++)
+            {
+                msgIOVs[i].iov_base = sPendingDatagrams[i].data;
+                msgIOVs[i].iov_len  = sPendingDatagrams[i].length;
+            }
+
+            DatagramHeader & header   = sPendingDatagrams[next].header;
+            struct msghdr & msgHeader = msgHeaders[messageCount].msg_hdr;
+            InitMessageHeader(msgHeader, header, &msgIOVs[next], segmentCount);
+#ifdef UDP_SEGMENT
+            if (segmentCount > 1)
+            {
+                // Have the kernel split the message into datagrams of the length of the first one.
+                auto * controlHdr          = reinterpret_cast<struct cmsghdr *>(header.control + header.controlLength);
+                controlHdr->cmsg_level     = IPPROTO_UDP;
+                controlHdr->cmsg_type      = UDP_SEGMENT;
+                controlHdr->cmsg_len       = CMSG_LEN(sizeof(uint16_t));
+                const uint16_t segmentSize = static_cast<uint16_t>(sPendingDatagrams[next].length);
+                memcpy(CMSG_DATA(controlHdr), &segmentSize, sizeof(segmentSize));
+
+                msgHeader.msg_control    = header.control;
+                msgHeader.msg_controllen = header.controlLength + CMSG_SPACE(sizeof(uint16_t));
+            }
+#endif // UDP_SEGMENT
+            msgHeaders[messageCount].msg_len = 0;
+            firstDatagrams[messageCount]     = next;
+            messageCount++;
+            next += segmentCount;
+        }
+
+        // sendmmsg() stops at the first message which cannot be sent: report it, then go on with the next ones.
+        size_t sent = 0;
+        while (sent < messageCount)
+        {
+            const int result          = sendmmsg(socket, &msgHeaders[sent], static_cast<unsigned int>(messageCount - sent), 0);
+            const size_t segmentCount = msgHeaders[sent].msg_hdr.msg_iovlen;
+            sIOCounters.mSendCalls++;
+            if (result > 0)
+            {
+                for (size_t i = sent; i < sent + static_cast<size_t>(result); i++)
+                {
+                    sIOCounters.mDatagramsSent += msgHeaders[i].msg_hdr.msg_iovlen;
+                }
+                sent += static_cast<size_t>(result);
+                continue;
+            }
+
+            if (result == 0)
+            {
+                // No message went out, but there is no error to report either: send the datagrams of the first one with
+                // sendmsg(), which does report its errors, so the flush keeps making progress.
+                for (size_t i = firstDatagrams[sent]; i < firstDatagrams[sent] + segmentCount; i++)
+                {
+                    SendDatagram(sPendingDatagrams[i], failedSends);
+                }
+                sent++;
+                continue;
+            }
+
+            const int error = errno;
+            if (segmentCount == 1)
+            {
+                failedSends.Add(sPendingDatagrams[firstDatagrams[sent]], CHIP_ERROR_POSIX(error));
+            }
+#ifdef UDP_SEGMENT
+            else
+            {
+                // The kernel or the interface may not support segmentation offload: send the datagrams one at a time.
+                if (error == EINVAL || error == EIO || error == EOPNOTSUPP)
+                {
+                    ChipLogProgress(Inet, "Disabling UDP segmentation offload: %" CHIP_ERROR_FORMAT,
+                                    CHIP_ERROR_POSIX(error).Format());
+                    sSegmentationEnabled = false;
+                }
+                for (size_t i = firstDatagrams[sent]; i < firstDatagrams[sent] + segmentCount; i++)
+                {
+                    SendDatagram(sPendingDatagrams[i], failedSends);
+                }
+            }
+#endif // UDP_SEGMENT
+            sent++;
+        }
+
+        first = next;
+    }
+
+    sPendingDatagramCount = 0;
+
+    for (size_t i = 0; i < failedSends.count; i++)
+    {
+        failedSends.sends[i].delegate->OnQueuedSendFailed(failedSends.sends[i].sendContext, failedSends.sends[i].error);
+    }
+}
+#endif // INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+
 } // anonymous namespace
 
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 UDPEndPointImplSockets::MulticastGroupHandler UDPEndPointImplSockets::sMulticastGroupHandler;
 #endif // CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 
+#if INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+unsigned UDPSendBatch::sDepth               = 0;
+UDPSendBatch * UDPSendBatch::sInnermost = nullptr;
+
+UDPSendBatch::~UDPSendBatch()
+{
+    sInnermost = mOuter;
+    if (--sDepth == 0 || mDelegate != nullptr)
+    {
+        FlushPendingDatagrams();
+    }
+}
+#endif // INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+
+const UDPEndPointImplSockets::IOCounters & UDPEndPointImplSockets::GetIOCounters()
+{
+    return sIOCounters;
+}
+
+void UDPEndPointImplSockets::ResetIOCounters()
+{
+    sIOCounters = IOCounters();
+}
+
+#if INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0 || INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+void UDPEndPointImplSockets::SetBatchedIOEnabled(bool enabled)
+{
+#if INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+    FlushPendingDatagrams();
+#endif // INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+    sBatchedIOEnabled = enabled;
+}
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0 || INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+
 CHIP_ERROR UDPEndPointImplSockets::BindImpl(IPAddressType addressType, const IPAddress & addr, uint16_t port, InterfaceId interface)
 {
     // Make sure we have the appropriate type of socket.
@@ -289,129 +759,50 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // Ensure the destination address type is compatible with the endpoint address type.
     VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
-    // For now the entire message must fit within a single buffer.
-    VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
-
-    struct iovec msgIOV;
-    msgIOV.iov_base = msg->Start();
-    msgIOV.iov_len  = msg->DataLength();
-
-#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-    uint8_t controlData[256];
-    memset(controlData, 0, sizeof(controlData));
-#endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-
-    struct msghdr msgHeader;
-    memset(&msgHeader, 0, sizeof(msgHeader));
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
+    const size_t msgLength = msg->TotalLength();
 
-    // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
-    SockAddr peerSockAddr;
-    memset(&peerSockAddr, 0, sizeof(peerSockAddr));
-    msgHeader.msg_name = &peerSockAddr;
-    if (mAddrType == IPAddressType::kIPv6)
+#if INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+    if (sBatchedIOEnabled && UDPSendBatch::IsQueueing() && msgLength <= sizeof(PendingDatagram::data))
     {
-        peerSockAddr.in6.sin6_family     = AF_INET6;
-        peerSockAddr.in6.sin6_port       = htons(aPktInfo->DestPort);
-        peerSockAddr.in6.sin6_addr       = aPktInfo->DestAddress.ToIPv6();
-        InterfaceId::PlatformType intfId = aPktInfo->Interface.GetPlatformInterface();
-        VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId), CHIP_ERROR_INCORRECT_STATE);
-        peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId);
-        msgHeader.msg_namelen          = sizeof(sockaddr_in6);
-    }
-#if INET_CONFIG_ENABLE_IPV4
-    else
-    {
-        peerSockAddr.in.sin_family = AF_INET;
-        peerSockAddr.in.sin_port   = htons(aPktInfo->DestPort);
-        peerSockAddr.in.sin_addr   = aPktInfo->DestAddress.ToIPv4();
-        msgHeader.msg_namelen      = sizeof(sockaddr_in);
-    }
-#endif // INET_CONFIG_ENABLE_IPV4
-
-    // If the endpoint has been bound to a particular interface,
-    // and the caller didn't supply a specific interface to send
-    // on, use the bound interface. This appears to be necessary
-    // for messages to multicast addresses, which under Linux
-    // don't seem to get sent out the correct interface, despite
-    // the socket being bound.
-    InterfaceId intf = aPktInfo->Interface;
-    if (!intf.IsPresent())
-    {
-        intf = mBoundIntfId;
-    }
-
-#if INET_CONFIG_UDP_SOCKET_PKTINFO
-    // If the packet should be sent over a specific interface, or with a specific source
-    // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
-    // add add it to the message header.  If the local OS doesn't support IP_PKTINFO/IPV6_PKTINFO
-    // fail with an error.
-    if (intf.IsPresent() || aPktInfo->SrcAddress.Type() != IPAddressType::kAny)
-    {
-#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
-
-        struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
-        InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
-
-#if INET_CONFIG_ENABLE_IPV4
-
-        if (mAddrType == IPAddressType::kIPv4)
+        if (sPendingDatagramCount == kSendBatchSize)
         {
-#if defined(IP_PKTINFO)
-            controlHdr->cmsg_level = IPPROTO_IP;
-            controlHdr->cmsg_type  = IP_PKTINFO;
-            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in_pktinfo));
-
-            auto * pktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-            if (!CanCastTo<decltype(pktInfo->ipi_ifindex)>(intfId))
-            {
-                return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-            }
-
-            pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
-            pktInfo->ipi_spec_dst = aPktInfo->SrcAddress.ToIPv4();
-
-            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in_pktinfo));
-#else  // !defined(IP_PKTINFO)
-            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !defined(IP_PKTINFO)
+            FlushPendingDatagrams();
         }
 
-#endif // INET_CONFIG_ENABLE_IPV4
-
-        if (mAddrType == IPAddressType::kIPv6)
-        {
-#if defined(IPV6_PKTINFO)
-            controlHdr->cmsg_level = IPPROTO_IPV6;
-            controlHdr->cmsg_type  = IPV6_PKTINFO;
-            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in6_pktinfo));
-
-            auto * pktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-            if (!CanCastTo<decltype(pktInfo->ipi6_ifindex)>(intfId))
-            {
-                return CHIP_ERROR_UNEXPECTED_EVENT;
-            }
-            pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
-            pktInfo->ipi6_addr    = aPktInfo->SrcAddress.ToIPv6();
+        PendingDatagram & datagram = sPendingDatagrams[sPendingDatagramCount];
+        ReturnErrorOnFailure(PrepareDatagramHeader(mAddrType, mBoundIntfId, aPktInfo, datagram.header));
+        ReturnErrorOnFailure(msg->Read(datagram.data, msgLength));
+        datagram.socket      = mSocket;
+        datagram.length      = msgLength;
+        datagram.delegate    = UDPSendBatch::GetInnermost()->GetDelegate();
+        datagram.sendContext = UDPSendBatch::GetInnermost()->GetSendContext();
+        sPendingDatagramCount++;
+        return CHIP_NO_ERROR;
+    }
+#endif // INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
 
-            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in6_pktinfo));
-#else  // !defined(IPV6_PKTINFO)
-            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !defined(IPV6_PKTINFO)
-        }
+    DatagramHeader header;
+    ReturnErrorOnFailure(PrepareDatagramHeader(mAddrType, mBoundIntfId, aPktInfo, header));
 
-#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
-        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+    // Gather the datagram from the buffers of the chain, so that a separately allocated header or MIC
+    // does not have to be copied next to the payload first.
+    struct iovec msgIOVs[kMaxDatagramBuffers];
+    size_t msgIOVCount = 0;
+    for (System::PacketBufferHandle buf = msg.Retain(); !buf.IsNull(); buf.Advance())
+    {
+        VerifyOrReturnError(msgIOVCount < kMaxDatagramBuffers, CHIP_ERROR_MESSAGE_TOO_LONG);
+        msgIOVs[msgIOVCount].iov_base = buf->Start();
+        msgIOVs[msgIOVCount].iov_len  = buf->DataLength();
+        msgIOVCount++;
     }
-#endif // INET_CONFIG_UDP_SOCKET_PKTINFO
+
+    struct msghdr msgHeader;
+    InitMessageHeader(msgHeader, header, msgIOVs, msgIOVCount);
 
     // Send IP packet.
     // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
     const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
+    sIOCounters.mSendCalls++;
     if (lenSent == -1)
     {
         return CHIP_ERROR_POSIX(errno);
@@ -419,10 +810,11 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
 
     size_t len = static_cast<size_t>(lenSent);
 
-    if (len != msg->DataLength())
+    if (len != msgLength)
     {
         return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
     }
+    sIOCounters.mDatagramsSent++;
     return CHIP_NO_ERROR;
 }
 
@@ -430,6 +822,10 @@ void UDPEndPointImplSockets::CloseImpl()
 {
     if (mSocket != kInvalidSocketFd)
     {
+#if INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+        // Send what is queued before the socket goes away.
+        FlushPendingDatagrams();
+#endif // INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
         TEMPORARY_RETURN_IGNORED static_cast<System::LayerSockets *>(&GetSystemLayer())->StopWatchingSocket(&mWatch);
         close(mSocket);
         mSocket = kInvalidSocketFd;
@@ -574,6 +970,15 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 
     // Prevent the endpoint from being freed while in the middle of a callback.
     UDPEndPointHandle ref(this);
+
+#if INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0
+    if (sBatchedIOEnabled)
+    {
+        HandlePendingReads();
+        return;
+    }
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0
+
     CHIP_ERROR lStatus = CHIP_NO_ERROR;
     IPPacketInfo lPacketInfo;
     System::PacketBufferHandle lBuffer;
@@ -606,6 +1011,7 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         msgHeader.msg_controllen = sizeof(controlData);
 
         ssize_t rcvLen = recvmsg(mSocket, &msgHeader, MSG_DONTWAIT);
+        sIOCounters.mReceiveCalls++;
 
         if (rcvLen == -1)
         {
@@ -618,62 +1024,7 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         else
         {
             lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
-        }
-
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+            lStatus = ParseReceivedDatagram(msgHeader, lPacketInfo);
         }
     }
     else
@@ -683,6 +1034,7 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 
     if (lStatus == CHIP_NO_ERROR)
     {
+        sIOCounters.mDatagramsReceived++;
         lBuffer.RightSize();
         OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
     }
@@ -695,6 +1047,76 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
     }
 }
 
+#if INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0
+void UDPEndPointImplSockets::HandlePendingReads()
+{
+    struct mmsghdr msgHeaders[kReceiveBatchSize];
+    struct iovec msgIOVs[kReceiveBatchSize];
+
+    memset(msgHeaders, 0, sizeof(msgHeaders));
+    for (size_t i = 0; i < kReceiveBatchSize; i++)
+    {
+        ReceivedDatagram & datagram = sReceivedDatagrams[i];
+        msgIOVs[i].iov_base         = datagram.data;
+        msgIOVs[i].iov_len          = sizeof(datagram.data);
+
+        memset(&datagram.peer, 0, sizeof(datagram.peer));
+
+        struct msghdr & msgHeader = msgHeaders[i].msg_hdr;
+        msgHeader.msg_name        = &datagram.peer;
+        msgHeader.msg_namelen     = sizeof(datagram.peer);
+        msgHeader.msg_iov         = &msgIOVs[i];
+        msgHeader.msg_iovlen      = 1;
+        msgHeader.msg_control     = datagram.control;
+        msgHeader.msg_controllen  = sizeof(datagram.control);
+    }
+
+    const int received = recvmmsg(mSocket, msgHeaders, kReceiveBatchSize, MSG_DONTWAIT, nullptr);
+    sIOCounters.mReceiveCalls++;
+    if (received == -1)
+    {
+        const CHIP_ERROR status = CHIP_ERROR_POSIX(errno);
+        if (OnReceiveError != nullptr && status != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, status, nullptr);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < static_cast<size_t>(received); i++)
+    {
+        // The callbacks may close the endpoint, which drops the datagrams not delivered yet.
+        if (mState != State::kListening || OnMessageReceived == nullptr)
+        {
+            break;
+        }
+
+        IPPacketInfo packetInfo;
+        packetInfo.Clear();
+        packetInfo.DestPort  = mBoundPort;
+        packetInfo.Interface = mBoundIntfId;
+
+        System::PacketBufferHandle buffer;
+        CHIP_ERROR status = ParseReceivedDatagram(msgHeaders[i].msg_hdr, packetInfo);
+        if (status == CHIP_NO_ERROR)
+        {
+            buffer = System::PacketBufferHandle::NewWithData(sReceivedDatagrams[i].data, msgHeaders[i].msg_len, 0, 0);
+            status = buffer.IsNull() ? CHIP_ERROR_NO_MEMORY : CHIP_NO_ERROR;
+        }
+
+        if (status == CHIP_NO_ERROR)
+        {
+            sIOCounters.mDatagramsReceived++;
+            OnMessageReceived(this, std::move(buffer), &packetInfo);
+        }
+        else if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, status, nullptr);
+        }
+    }
+}
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0
+
 #ifdef IPV6_MULTICAST_LOOP
 static CHIP_ERROR SocketsSetMulticastLoopback(int aSocket, bool aLoopback, int aProtocol, int aOption)
 {
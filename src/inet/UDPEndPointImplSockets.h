@@ -41,6 +41,27 @@ public:
     InterfaceId GetBoundInterface() const override;
     uint16_t GetBoundPort() const override;
 
+    /**
+     * Numbers of datagrams received and sent by all the endpoints, and of the system calls used to do so.
+     */
+    struct IOCounters
+    {
+        uint64_t mDatagramsReceived = 0;
+        uint64_t mReceiveCalls      = 0;
+        uint64_t mDatagramsSent     = 0;
+        uint64_t mSendCalls         = 0;
+    };
+
+    static const IOCounters & GetIOCounters();
+    static void ResetIOCounters();
+
+#if INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0 || INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+    /**
+     * Switch between batched I/O (the default) and one recvmsg() or sendmsg() per datagram, e.g. to compare them.
+     */
+    static void SetBatchedIOEnabled(bool enabled);
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0 || INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+
 private:
     // UDPEndPoint overrides.
 #if INET_CONFIG_ENABLE_IPV4
@@ -56,6 +77,9 @@ private:
     CHIP_ERROR GetSocket(IPAddressType addressType);
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
+#if INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0
+    void HandlePendingReads();
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0
 
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
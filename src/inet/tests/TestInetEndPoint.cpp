@@ -378,6 +378,159 @@ TEST_F(TestInetEndPoint, TestInetEndPointInternal)
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 }
 
+#if INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0 || INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+size_t gLoopbackReceived = 0;
+
+void HandleLoopbackMessage(UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+{
+    gLoopbackReceived++;
+}
+
+void HandleLoopbackError(UDPEndPoint * endPoint, CHIP_ERROR err, const IPPacketInfo * pktInfo)
+{
+    ChipLogError(Test, "Loopback receive error: %" CHIP_ERROR_FORMAT, err.Format());
+}
+
+// Send bursts of datagrams over the IPv6 loopback and report the packet rate and the system calls per packet.
+void RunLoopbackBenchmark(bool batched, const char * label)
+{
+    constexpr size_t kPacketCount = 8192;
+    constexpr size_t kBurstLength = 16;
+    constexpr size_t kPacketSize  = 100;
+
+    UDPEndPointImplSockets::SetBatchedIOEnabled(batched);
+
+    UDPEndPointHandle receiver;
+    UDPEndPointHandle sender;
+    ASSERT_EQ(gUDP.NewEndPoint(receiver), CHIP_NO_ERROR);
+    ASSERT_EQ(gUDP.NewEndPoint(sender), CHIP_NO_ERROR);
+
+    const IPAddress loopback = IPAddress::Loopback(IPAddressType::kIPv6);
+    ASSERT_EQ(receiver->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+    ASSERT_EQ(receiver->Listen(HandleLoopbackMessage, HandleLoopbackError), CHIP_NO_ERROR);
+    ASSERT_EQ(sender->Bind(IPAddressType::kIPv6, IPAddress::Any, 0), CHIP_NO_ERROR);
+    const uint16_t port = receiver->GetBoundPort();
+
+    gLoopbackReceived = 0;
+    UDPEndPointImplSockets::ResetIOCounters();
+    const uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+
+    size_t sent = 0;
+    while (sent < kPacketCount)
+    {
+        {
+            UDPSendBatch batch;
+            batch.BeginQueueing();
+            for (size_t i = 0; i < kBurstLength; i++)
+            {
+                PacketBufferHandle buffer = PacketBufferHandle::New(kPacketSize);
+                ASSERT_FALSE(buffer.IsNull());
+                buffer->SetDataLength(kPacketSize);
+                memset(buffer->Start(), static_cast<int>(i), kPacketSize);
+                EXPECT_EQ(sender->SendTo(loopback, port, std::move(buffer)), CHIP_NO_ERROR);
+            }
+        }
+        sent += kBurstLength;
+
+        for (int attempt = 0; gLoopbackReceived < sent && attempt < 100; attempt++)
+        {
+            ServiceEvents(10);
+        }
+        ASSERT_EQ(gLoopbackReceived, sent);
+    }
+
+    const uint64_t elapsed                      = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+    const UDPEndPointImplSockets::IOCounters io = UDPEndPointImplSockets::GetIOCounters();
+    EXPECT_EQ(io.mDatagramsSent, kPacketCount);
+    EXPECT_EQ(io.mDatagramsReceived, kPacketCount);
+    if (batched)
+    {
+#if INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0
+        EXPECT_LT(io.mReceiveCalls, kPacketCount);
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0
+#if INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+        EXPECT_LT(io.mSendCalls, kPacketCount);
+#endif // INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+    }
+
+    ChipLogProgress(Test, "%s: %u packets in %u us, %u packets/s, %u.%02u syscalls/packet (%u sends, %u receives)", label,
+                    static_cast<unsigned>(kPacketCount), static_cast<unsigned>(elapsed),
+                    static_cast<unsigned>(kPacketCount * 1000000 / (elapsed > 0 ? elapsed : 1)),
+                    static_cast<unsigned>((io.mSendCalls + io.mReceiveCalls) / kPacketCount),
+                    static_cast<unsigned>((io.mSendCalls + io.mReceiveCalls) * 100 / kPacketCount % 100),
+                    static_cast<unsigned>(io.mSendCalls), static_cast<unsigned>(io.mReceiveCalls));
+
+    receiver.Release();
+    sender.Release();
+    UDPEndPointImplSockets::SetBatchedIOEnabled(true);
+}
+
+TEST_F(TestInetEndPoint, TestUDPLoopbackBenchmark)
+{
+    RunLoopbackBenchmark(false, "One datagram per system call");
+    RunLoopbackBenchmark(true, "Batched");
+}
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE > 0 || INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+
+#if INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+class RecordingSendBatchDelegate : public UDPSendBatch::Delegate
+{
+public:
+    void OnQueuedSendFailed(const void * sendContext, CHIP_ERROR error) override
+    {
+        mFailureCount++;
+        mSendContext = sendContext;
+        mError       = error;
+    }
+
+    size_t mFailureCount      = 0;
+    const void * mSendContext = nullptr;
+    CHIP_ERROR mError         = CHIP_NO_ERROR;
+};
+
+// The kernel errors of queued datagrams are passed to the delegate along with the context they were queued with.
+TEST_F(TestInetEndPoint, TestUDPSendBatchReportsErrors)
+{
+    constexpr size_t kPacketSize = 100;
+
+    UDPEndPointHandle sender;
+    ASSERT_EQ(gUDP.NewEndPoint(sender), CHIP_NO_ERROR);
+    const IPAddress loopback = IPAddress::Loopback(IPAddressType::kIPv6);
+    ASSERT_EQ(sender->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+
+    RecordingSendBatchDelegate delegate;
+    const int contexts[2] = {};
+    {
+        UDPSendBatch batch(&delegate);
+        for (const int & context : contexts)
+        {
+            PacketBufferHandle buffer = PacketBufferHandle::New(kPacketSize);
+            ASSERT_FALSE(buffer.IsNull());
+            buffer->SetDataLength(kPacketSize);
+
+            // Only the first datagram is invalid: the kernel rejects UDP datagrams sent to port 0.
+            const uint16_t port = (&context == &contexts[0]) ? 0 : sender->GetBoundPort();
+            batch.BeginQueueing(&context);
+            EXPECT_EQ(sender->SendTo(loopback, port, std::move(buffer)), CHIP_NO_ERROR);
+        }
+        batch.EndQueueing();
+        EXPECT_EQ(delegate.mFailureCount, 0u);
+
+        // Messages sent outside of BeginQueueing() are not queued, and get their error right away.
+        PacketBufferHandle buffer = PacketBufferHandle::New(kPacketSize);
+        ASSERT_FALSE(buffer.IsNull());
+        buffer->SetDataLength(kPacketSize);
+        EXPECT_EQ(sender->SendTo(loopback, 0, std::move(buffer)), CHIP_ERROR_POSIX(EINVAL));
+    }
+
+    EXPECT_EQ(delegate.mFailureCount, 1u);
+    EXPECT_EQ(delegate.mSendContext, &contexts[0]);
+    EXPECT_EQ(delegate.mError, CHIP_ERROR_POSIX(EINVAL));
+
+    sender.Release();
+}
+#endif // INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE > 0
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 // Test the Inet resource limitations.
 TEST_F(TestInetEndPoint, TestInetEndPointLimit)
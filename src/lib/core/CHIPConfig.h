@@ -231,6 +231,20 @@
 #define CHIP_CONFIG_HKDF_KEY_HANDLE_CONTEXT_SIZE (32 + 1)
 #endif // CHIP_CONFIG_HKDF_KEY_HANDLE_CONTEXT_SIZE
 
+/**
+ *  @def CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE
+ *
+ *  @brief
+ *    Number of session keys for which the OpenSSL crypto PAL keeps AES-CCM cipher contexts set up, so that messages
+ *    reuse the key schedule rather than allocating a context and expanding the key for each of them.
+ *
+ *  Each entry holds up to two OpenSSL cipher contexts, released when its key is destroyed or evicted. Zero disables
+ *  the cache.
+ */
+#ifndef CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE
+#define CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE 0
+#endif // CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_CRYPTO_PSA_KEY_ID_BASE
  *
@@ -802,6 +816,20 @@
 #define CHIP_CONFIG_MAX_FABRICS 16
 #endif // CHIP_CONFIG_MAX_FABRICS
 
+/**
+ *  @def CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+ *
+ *  @brief
+ *    Number of successfully validated operational certificate chains (NOC, ICAC, RCAC) that the fabric table
+ *    remembers, so that CASE handshakes with peers that reconnect skip decoding and verifying their chain again.
+ *
+ *  Each entry holds the public keys and identifiers extracted from a chain (roughly 200 bytes). Zero disables
+ *  the cache.
+ */
+#ifndef CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE 0
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
  *
@@ -824,6 +852,19 @@
 #define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 2)
 #endif // CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+ *
+ * @brief Enables the indexes of the secure session table, which find a session by its local session id or by its peer
+ * without scanning the whole session table.
+ *
+ * The indexes take two tables of pointers of twice CHIP_CONFIG_SECURE_SESSION_POOL_SIZE entries (rounded up to a power
+ * of two) plus two pointers in every session, which is worthwhile for large session tables only.
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+#define CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX 0
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
 /**
  *  @def CHIP_CONFIG_MAX_GROUP_DATA_PEERS
  *
@@ -959,6 +1000,28 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_REPORTS_IN_FLIGHT 4
 #endif
 
+/**
+ * @def CHIP_IM_FAIR_REPORT_SCHEDULING
+ *
+ * @brief If 1, the reporting engine serves reportable ReadHandlers in the order of their report deadline instead of
+ *        round-robin. The deadline of a handler advances with the size of the report chunks it sends, so subscribers
+ *        with small reports are not held behind subscribers with large chunked reports. Can be changed at runtime with
+ *        Engine::SetFairSchedulingEnabled().
+ */
+#ifndef CHIP_IM_FAIR_REPORT_SCHEDULING
+#define CHIP_IM_FAIR_REPORT_SCHEDULING 0
+#endif
+
+/**
+ * @def CHIP_IM_REPORT_CHUNK_LATENCY_BUDGET_MS
+ *
+ * @brief The latency budget, in milliseconds, charged to a ReadHandler for sending a full report chunk when fair report
+ *        scheduling is enabled. Smaller chunks are charged proportionally less.
+ */
+#ifndef CHIP_IM_REPORT_CHUNK_LATENCY_BUDGET_MS
+#define CHIP_IM_REPORT_CHUNK_LATENCY_BUDGET_MS 50
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
  *
@@ -986,6 +1049,40 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES
+ *
+ * @brief If non-zero, the reporting engine tracks dirty attribute paths in a heap allocated index holding up to this
+ *        many paths instead of the CHIP_IM_SERVER_MAX_NUM_DIRTY_SET pool. Paths are never merged into wider wildcard
+ *        paths until the index is full, so reports only include attributes which actually changed.
+ */
+#ifndef CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES
+#define CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES 0
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_ATTRIBUTE_CHANGE_QUEUE_SIZE
+ *
+ * @brief Number of attribute changes MatterReportingAttributeChangeCallbackFromAnyThread() queues without locking, until
+ *        the Matter thread marks them dirty in a single batch. Must be a power of two. Changes which do not fit are handed
+ *        to the Matter thread one by one.
+ */
+#ifndef CHIP_IM_SERVER_ATTRIBUTE_CHANGE_QUEUE_SIZE
+#define CHIP_IM_SERVER_ATTRIBUTE_CHANGE_QUEUE_SIZE 256
+#endif
+
+/**
+ * @def CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE
+ *
+ * @brief If 1, ClusterStateCache keeps its endpoints, clusters and attributes in sorted vectors instead of std::map
+ *        nodes, and the attribute TLV payloads back to back in a single compacted buffer instead of one heap
+ *        allocation each. This saves memory and speeds up report processing for clients caching large nodes
+ *        (e.g. bridges), at the cost of invalidating any TLV reader obtained from the cache whenever it is updated.
+ */
+#ifndef CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE
+#define CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE 0
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1089,6 +1186,24 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES 64
 #endif
 
+/**
+ * @def CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES
+ *
+ * @brief Maximum number of commissioners a CommissioningPipeline drives, i.e. of devices it commissions at the same time.
+ */
+#ifndef CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES
+#define CHIP_CONFIG_COMMISSIONING_PIPELINE_MAX_LANES 8
+#endif
+
+/**
+ * @def CHIP_CONFIG_COMMISSIONING_PIPELINE_QUEUE_SIZE
+ *
+ * @brief Number of devices which can wait in a CommissioningPipeline for a commissioner to become available.
+ */
+#ifndef CHIP_CONFIG_COMMISSIONING_PIPELINE_QUEUE_SIZE
+#define CHIP_CONFIG_COMMISSIONING_PIPELINE_QUEUE_SIZE 64
+#endif
+
 /**
  * @def CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_CASE_CLIENTS
  *
@@ -1182,6 +1297,22 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE
+ *
+ * @brief Defines the number of group sessions kept in the RAM index used to decrypt incoming group messages
+ *
+ * Each entry maps a session id (operational group key hash) to a fabric, group and ready-to-use key context,
+ * so that the group message receive path does not need to load the group key maps and key sets from
+ * persistent storage for every message. The index is rebuilt lazily after any change to the group keys.
+ * When more sessions are configured than fit in the index, the storage walk is used instead.
+ *
+ * Set to 0 to disable the index.
+ */
+#ifndef CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE
+#define CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE 0
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1293,6 +1424,38 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
     "Please enable at least one of CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FAST_COPY_SUPPORT or CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FLEXIBLE_COPY_SUPPORT"
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_INDEX
+ *
+ * If set to 1, AccessControl keeps a compiled, per-fabric form of the access control
+ * entries (privileges expanded, subjects sorted for lookup, targets grouped per entry)
+ * and uses it instead of iterating and decoding every entry on each check.
+ *
+ * The compiled form of a fabric is allocated from the platform heap on the first check
+ * after its entries change. Fabrics whose entries cannot be compiled keep using the
+ * entry iteration.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_INDEX
+#define CHIP_CONFIG_ACCESS_CONTROL_INDEX 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+ *
+ * Defines the number of recent access control decisions (subject, cluster, endpoint
+ * and privilege) remembered on top of the compiled entries. Decisions that depend on
+ * device type targets are not cached. Requires CHIP_CONFIG_ACCESS_CONTROL_INDEX.
+ *
+ * Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 0
+#endif
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0 && !CHIP_CONFIG_ACCESS_CONTROL_INDEX
+#error "Please enable CHIP_CONFIG_ACCESS_CONTROL_INDEX to use CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE"
+#endif
+
 /**
  * @def CHIP_CONFIG_ACCESS_RESTRICTION_MAX_ENTRIES_PER_FABRIC
  *
@@ -1344,6 +1507,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS
+ *
+ * @brief If non-zero, every event buffer keeps a side index splitting its content in about this many blocks, each
+ *        summarized by the number of its last event and a bitmap of the endpoints and clusters it holds. Fetching
+ *        events then skips the blocks which hold only already delivered events or no event of an interested path.
+ *        Each block costs 32 bytes of RAM per event buffer.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS 0
+#endif /* CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS */
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -1669,6 +1844,36 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SCENES_USE_DEFAULT_HANDLERS 1
 #endif // CHIP_CONFIG_SCENES_USE_DEFAULT_HANDLERS
 
+/**
+ * @def CHIP_CONFIG_SCENES_TABLE_CACHE_SIZE
+ *
+ * @brief Number of decoded scenes the scene table keeps in RAM, across all fabrics and endpoints, so that recalling them does
+ * not read them from persistent storage again. Each cached scene takes about the size of a SceneTableEntry. Bridges recalling
+ * group scenes on many endpoints at once should raise it to their endpoint count. 0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_SCENES_TABLE_CACHE_SIZE
+#if CHIP_CONFIG_TEST
+#define CHIP_CONFIG_SCENES_TABLE_CACHE_SIZE 128
+#else
+#define CHIP_CONFIG_SCENES_TABLE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_TEST
+#endif // CHIP_CONFIG_SCENES_TABLE_CACHE_SIZE
+
+/**
+ * @def CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS
+ *
+ * @brief Number of running transitions (level control, color control...) whose ticks the TransitionScheduler runs off its
+ * shared timer. Transitions beyond this number get a System::Layer timer of their own. Bridges running transitions on
+ * many endpoints at once should raise it to their endpoint count.
+ */
+#ifndef CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS
+#if CHIP_CONFIG_TEST
+#define CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS 512
+#else
+#define CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS 16
+#endif // CHIP_CONFIG_TEST
+#endif // CHIP_CONFIG_MAX_CONCURRENT_TRANSITIONS
+
 /**
  * @def CHIP_CONFIG_TIME_ZONE_LIST_MAX_SIZE
  *
@@ -1840,6 +2045,19 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION_MAX_RETRY_INTERVAL_SECS (3600 * 6)
 #endif // CHIP_CONFIG_SUBSCRIPTION_TIMEOUT_RESUMPTION_MAX_RETRY_INTERVAL_SECS
 
+/**
+ *  @def CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_PEERS
+ *
+ *  @brief The maximum number of subscribers the persisted subscriptions are resumed with at the same time.
+ *
+ *  All the subscriptions of a subscriber are resumed over the same CASE session, so this bounds the number of CASE sessions
+ *  established at once for resuming subscriptions. Resuming with more subscribers than there are CASE clients makes the
+ *  extra session establishments fail, and their subscriptions wait for the next resumption retry.
+ */
+#ifndef CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_PEERS
+#define CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_PEERS CHIP_CONFIG_DEVICE_MAX_ACTIVE_CASE_CLIENTS
+#endif // CHIP_CONFIG_SUBSCRIPTION_RESUMPTION_MAX_CONCURRENT_PEERS
+
 /**
  * @def CHIP_CONFIG_SYNCHRONOUS_REPORTS_ENABLED
  *
@@ -1952,6 +2170,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_BDX_LOG_TRANSFER_MAX_BLOCK_SIZE 1024
 #endif // CHIP_CONFIG_BDX_LOG_TRANSFER_MAX_BLOCK_SIZE
 
+/**
+ *  @def CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE
+ *
+ *  @brief
+ *    Default number of Blocks a BDX sender may have in flight (sent but not yet acknowledged) when a transfer uses the
+ *    asynchronous control mode. Larger windows hide more round-trip latency at the cost of buffering on the receiver.
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE
+#define CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE 8
+#endif // CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE
+
 /**
  *  @def CHIP_CONFIG_TEST_GOOGLETEST
  *
@@ -1991,6 +2221,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID 0
 #endif // CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
 
+/**
+ *  @def CHIP_CONFIG_EMBER_METADATA_LOOKUP_TABLES
+ *
+ *  @brief
+ *    Enables lookup tables over the ember metadata of the fixed endpoints, computed at compile time.
+ *
+ * The tables let the ember attribute store find clusters and attributes, and their storage, with binary searches
+ * instead of scanning the metadata of all the endpoints. They take 4 bytes of read-only memory per generated cluster
+ * and attribute, and can be disabled by overriding this macro in project specific configuration.
+ */
+#ifndef CHIP_CONFIG_EMBER_METADATA_LOOKUP_TABLES
+#define CHIP_CONFIG_EMBER_METADATA_LOOKUP_TABLES 1
+#endif // CHIP_CONFIG_EMBER_METADATA_LOOKUP_TABLES
+
 /**
  * @def CHIP_CONFIG_TLS_PERSISTED_ROOT_CERT_BYTES
  *
@@ -360,10 +360,10 @@ public:
     static_assert(std::is_base_of<IntrusiveListNodeBase<Mode>, T>::value, "T must be derived from IntrusiveListNodeBase");
 
     static T * ToObject(IntrusiveListNodePrivateBase * node) { return static_cast<T *>(node); }
-    static const T * ToObject(const IntrusiveListNodePrivateBase * node) { return static_cast<T *>(node); }
+    static const T * ToObject(const IntrusiveListNodePrivateBase * node) { return static_cast<const T *>(node); }
 
     static T * ToObject(IntrusiveListNodeBase<Mode> * node) { return static_cast<T *>(node); }
-    static const T * ToObject(const IntrusiveListNodeBase<Mode> * node) { return static_cast<T *>(node); }
+    static const T * ToObject(const IntrusiveListNodeBase<Mode> * node) { return static_cast<const T *>(node); }
 
     static IntrusiveListNodeBase<Mode> * ToNode(T * object) { return static_cast<IntrusiveListNodeBase<Mode> *>(object); }
     static const IntrusiveListNodeBase<Mode> * ToNode(const T * object)
@@ -0,0 +1,140 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a bounded, lock-free queue with multiple producers and a single consumer.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+namespace chip {
+
+/**
+ *  @class MpscQueue
+ *
+ *  @brief
+ *      A fixed-capacity FIFO queue which any number of threads may push to concurrently, and one thread pops from.
+ *
+ *      Neither side ever blocks or takes a lock: each slot carries a sequence number which tells whether it holds an
+ *      item for the current lap around the ring, so a producer only contends with other producers on the atomic
+ *      increment of the tail index. TryPush() fails rather than waits when the queue is full.
+ *
+ *      Items are copied in and out, so T must be trivially copyable. kCapacity must be a power of two.
+ */
+template <typename T, size_t kCapacity>
+class MpscQueue
+{
+public:
+    static_assert(kCapacity > 0 && (kCapacity & (kCapacity - 1)) == 0, "capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "items must be trivially copyable");
+
+    MpscQueue()
+    {
+        for (size_t i = 0; i < kCapacity; i++)
+        {
+            mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Append an item. May be called from any thread.
+     *
+     * @returns false if the queue is full.
+     */
+    bool TryPush(const T & item)
+    {
+        size_t position = mTail.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot & slot       = mSlots[position & kIndexMask];
+            intptr_t distance = static_cast<intptr_t>(slot.mSequence.load(std::memory_order_acquire) - position);
+            if (distance == 0)
+            {
+                // The slot is free for this lap: claim it, unless another producer got it first.
+                if (mTail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.mItem = item;
+                    slot.mSequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (distance < 0)
+            {
+                // The slot still holds the item of the previous lap, which the consumer has not popped yet.
+                return false;
+            }
+            else
+            {
+                position = mTail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Remove the oldest item. Must only be called from the consumer thread.
+     *
+     * Returns false if the queue is empty, including when a producer has claimed the next slot but not filled it yet;
+     * the item then shows up on a later call.
+     */
+    bool TryPop(T & item)
+    {
+        Slot & slot = mSlots[mHead & kIndexMask];
+        if (slot.mSequence.load(std::memory_order_acquire) != mHead + 1)
+        {
+            return false;
+        }
+        item = slot.mItem;
+        slot.mSequence.store(mHead + kCapacity, std::memory_order_release);
+        mHead++;
+        return true;
+    }
+
+    /**
+     * Whether TryPop() would fail. Must only be called from the consumer thread.
+     */
+    bool Empty() const { return mSlots[mHead & kIndexMask].mSequence.load(std::memory_order_acquire) != mHead + 1; }
+
+    static constexpr size_t Capacity() { return kCapacity; }
+
+private:
+    static constexpr size_t kIndexMask = kCapacity - 1;
+
+    // Producers and the consumer write different members: keep them on different cache lines.
+    static constexpr size_t kCacheLineSize = 64;
+
+    struct Slot
+    {
+        std::atomic<size_t> mSequence;
+        T mItem;
+    };
+
+    alignas(kCacheLineSize) std::atomic<size_t> mTail{ 0 };
+    alignas(kCacheLineSize) size_t mHead = 0;
+    alignas(kCacheLineSize) Slot mSlots[kCapacity];
+
+    MpscQueue(const MpscQueue &)             = delete;
+    MpscQueue & operator=(const MpscQueue &) = delete;
+};
+
+} // namespace chip
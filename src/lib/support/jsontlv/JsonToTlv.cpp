@@ -17,15 +17,17 @@
 
 #include <stdint.h>
 
-#include <algorithm>
 #include <charconv>
-#include <sstream>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <string>
-#include <vector>
 
-#include <json/json.h>
+#include <lib/core/CHIPSafeCasts.h>
 #include <lib/support/Base64.h>
 #include <lib/support/SafeInt.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/jsontlv/ElementTypes.h>
 #include <lib/support/jsontlv/JsonToTlv.h>
 
@@ -38,61 +40,78 @@ namespace {
 // This profile, but will be used for deciding what binary values to encode.
 constexpr uint32_t kTemporaryImplicitProfileId = 0xFF01;
 
-std::vector<std::string> SplitIntoFieldsBySeparator(const std::string & input, char separator)
-{
-    std::vector<std::string> substrings;
-    std::stringstream ss(input);
-    std::string substring;
+// Nesting limit of the JsonCpp reader, whose syntax is accepted here.
+constexpr size_t kMaxJsonNestingDepth = 1000;
+
+// Objects with up to this many members are sorted on the stack; larger ones take a pass per member.
+constexpr size_t kMaxSortedStructMembers = 16;
 
-    while (std::getline(ss, substring, separator))
+// Splits the input into at most maxFields fields, as successive std::getline() calls would: a trailing separator does not
+// start an empty field. Returns the number of fields, which may be larger than maxFields.
+size_t SplitIntoFieldsBySeparator(CharSpan input, char separator, CharSpan * fields, size_t maxFields)
+{
+    size_t count = 0;
+    while (!input.empty())
     {
-        substrings.push_back(std::move(substring));
+        const char * found = static_cast<const char *>(memchr(input.data(), separator, input.size()));
+        size_t length      = (found != nullptr) ? static_cast<size_t>(found - input.data()) : input.size();
+        if (count < maxFields)
+        {
+            fields[count] = input.SubSpan(0, length);
+        }
+        count++;
+        input = input.SubSpan(std::min(length + 1, input.size()));
     }
+    return count;
+}
 
-    return substrings;
+bool FieldEquals(CharSpan field, const char * str)
+{
+    return field.data_equal(CharSpan::fromCharString(str));
 }
 
-CHIP_ERROR JsonTypeStrToTlvType(const char * elementType, ElementTypeContext & type)
+CHIP_ERROR JsonTypeStrToTlvType(CharSpan elementType, ElementTypeContext & type)
 {
-    if (strcmp(elementType, kElementTypeInt) == 0)
+    if (FieldEquals(elementType, kElementTypeInt))
     {
         type.tlvType = TLV::kTLVType_SignedInteger;
     }
-    else if (strcmp(elementType, kElementTypeUInt) == 0)
+    else if (FieldEquals(elementType, kElementTypeUInt))
     {
         type.tlvType = TLV::kTLVType_UnsignedInteger;
     }
-    else if (strcmp(elementType, kElementTypeBool) == 0)
+    else if (FieldEquals(elementType, kElementTypeBool))
     {
         type.tlvType = TLV::kTLVType_Boolean;
     }
-    else if (strcmp(elementType, kElementTypeFloat) == 0)
+    else if (FieldEquals(elementType, kElementTypeFloat))
     {
         type.tlvType  = TLV::kTLVType_FloatingPointNumber;
         type.isDouble = false;
     }
-    else if (strcmp(elementType, kElementTypeDouble) == 0)
+    else if (FieldEquals(elementType, kElementTypeDouble))
     {
         type.tlvType  = TLV::kTLVType_FloatingPointNumber;
         type.isDouble = true;
     }
-    else if (strcmp(elementType, kElementTypeBytes) == 0)
+    else if (FieldEquals(elementType, kElementTypeBytes))
     {
         type.tlvType = TLV::kTLVType_ByteString;
     }
-    else if (strcmp(elementType, kElementTypeString) == 0)
+    else if (FieldEquals(elementType, kElementTypeString))
     {
         type.tlvType = TLV::kTLVType_UTF8String;
     }
-    else if (strcmp(elementType, kElementTypeNull) == 0)
+    else if (FieldEquals(elementType, kElementTypeNull))
     {
         type.tlvType = TLV::kTLVType_Null;
     }
-    else if (strcmp(elementType, kElementTypeStruct) == 0)
+    else if (FieldEquals(elementType, kElementTypeStruct))
     {
         type.tlvType = TLV::kTLVType_Structure;
     }
-    else if (strncmp(elementType, kElementTypeArray, strlen(kElementTypeArray)) == 0)
+    else if (elementType.size() >= strlen(kElementTypeArray) &&
+             memcmp(elementType.data(), kElementTypeArray, strlen(kElementTypeArray)) == 0)
     {
         type.tlvType = TLV::kTLVType_Array;
     }
@@ -106,7 +125,6 @@ CHIP_ERROR JsonTypeStrToTlvType(const char * elementType, ElementTypeContext & t
 
 struct ElementContext
 {
-    std::string jsonName;
     TLV::Tag tag = TLV::AnonymousTag();
     ElementTypeContext type;
     ElementTypeContext subType;
@@ -149,252 +167,1015 @@ CHIP_ERROR InternalConvertTlvTag(uint32_t tagNumber, TLV::Tag & tag, const uint3
 }
 
 template <typename T>
-CHIP_ERROR ParseNumericalField(const std::string & decimalString, T & outValue)
+CHIP_ERROR ParseNumericalField(CharSpan decimalString, T & outValue)
 {
     const char * start_ptr       = decimalString.data();
     const char * end_ptr         = decimalString.data() + decimalString.size();
-    auto [last_converted_ptr, _] = std::from_chars(start_ptr, end_ptr, outValue, 10);
-    VerifyOrReturnError(last_converted_ptr == end_ptr, CHIP_ERROR_INVALID_ARGUMENT);
+    auto [last_converted_ptr, ec] = std::from_chars(start_ptr, end_ptr, outValue, 10);
+    VerifyOrReturnError(ec == std::errc() && last_converted_ptr == end_ptr, CHIP_ERROR_INVALID_ARGUMENT);
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR ParseJsonName(const std::string & name, ElementContext & elementCtx, uint32_t implicitProfileId)
+CHIP_ERROR ParseJsonName(CharSpan name, ElementContext & elementCtx, uint32_t implicitProfileId)
 {
-    uint32_t tagNumber                  = 0;
-    const char * elementType            = nullptr;
-    std::vector<std::string> nameFields = SplitIntoFieldsBySeparator(name, ':');
-    TLV::Tag tag                        = TLV::AnonymousTag();
+    uint32_t tagNumber = 0;
+    CharSpan elementType;
+    CharSpan nameFields[3];
+    TLV::Tag tag = TLV::AnonymousTag();
     ElementTypeContext type;
     ElementTypeContext subType;
 
-    if (nameFields.size() == 2)
+    size_t fieldCount = SplitIntoFieldsBySeparator(name, ':', nameFields, MATTER_ARRAY_SIZE(nameFields));
+    if (fieldCount == 2)
     {
         ReturnErrorOnFailure(ParseNumericalField(nameFields[0], tagNumber));
-        elementType = nameFields[1].c_str();
+        elementType = nameFields[1];
     }
-    else if (nameFields.size() == 3)
+    else if (fieldCount == 3)
     {
         ReturnErrorOnFailure(ParseNumericalField(nameFields[1], tagNumber));
-        elementType = nameFields[2].c_str();
+        elementType = nameFields[2];
     }
     else
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
+    // The element type is a C string: anything after a null character is ignored.
+    const char * nullChar = static_cast<const char *>(memchr(elementType.data(), '\0', elementType.size()));
+    if (nullChar != nullptr)
+    {
+        elementType = elementType.SubSpan(0, static_cast<size_t>(nullChar - elementType.data()));
+    }
+
     ReturnErrorOnFailure(InternalConvertTlvTag(tagNumber, tag, implicitProfileId));
     ReturnErrorOnFailure(JsonTypeStrToTlvType(elementType, type));
 
     if (type.tlvType == TLV::kTLVType_Array)
     {
-        std::vector<std::string> arrayFields = SplitIntoFieldsBySeparator(elementType, '-');
-        VerifyOrReturnError(arrayFields.size() == 2, CHIP_ERROR_INVALID_ARGUMENT);
+        CharSpan arrayFields[2];
+        VerifyOrReturnError(SplitIntoFieldsBySeparator(elementType, '-', arrayFields, MATTER_ARRAY_SIZE(arrayFields)) == 2,
+                            CHIP_ERROR_INVALID_ARGUMENT);
 
-        if (strcmp(arrayFields[1].c_str(), kElementTypeEmpty) == 0)
+        if (FieldEquals(arrayFields[1], kElementTypeEmpty))
         {
             subType.tlvType = TLV::kTLVType_NotSpecified;
         }
         else
         {
-            ReturnErrorOnFailure(JsonTypeStrToTlvType(arrayFields[1].c_str(), subType));
+            ReturnErrorOnFailure(JsonTypeStrToTlvType(arrayFields[1], subType));
         }
     }
 
-    elementCtx.jsonName = name;
-    elementCtx.tag      = tag;
-    elementCtx.type     = type;
-    elementCtx.subType  = subType;
+    elementCtx.tag     = tag;
+    elementCtx.type    = type;
+    elementCtx.subType = subType;
 
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, const ElementContext & elementCtx)
+enum class JsonTokenType : uint8_t
 {
-    TLV::Tag tag = elementCtx.tag;
+    kObjectBegin,
+    kObjectEnd,
+    kArrayBegin,
+    kArrayEnd,
+    kString,
+    kNumber,
+    kTrue,
+    kFalse,
+    kNull,
+    kArraySeparator,
+    kMemberSeparator,
+    kEndOfStream,
+    kError,
+};
 
-    switch (elementCtx.type.tlvType)
+struct JsonToken
+{
+    JsonTokenType type = JsonTokenType::kError;
+    // For strings, the characters between the quotes, still escaped.
+    CharSpan text;
+};
+
+/*
+ * Iterates over the bytes of a JSON string, resolving escape sequences as the JsonCpp reader does.
+ */
+class JsonStringDecoder
+{
+public:
+    explicit JsonStringDecoder(CharSpan escaped) : mCurrent(escaped.data()), mEnd(escaped.data() + escaped.size()) {}
+
+    // Returns false at the end of the string or on an invalid escape sequence, which is reported by IsValid().
+    bool Next(char & c)
     {
-    case TLV::kTLVType_UnsignedInteger: {
-        uint64_t v = 0;
-        if (val.isUInt64())
+        if (mPendingIndex < mPendingCount)
         {
-            v = val.asUInt64();
+            c = mPending[mPendingIndex++];
+            return true;
         }
-        else if (val.isString())
+        VerifyOrReturnValue(mCurrent < mEnd && mValid, false);
+
+        c = *mCurrent++;
+        VerifyOrReturnValue(c == '\\', true);
+        VerifyOrReturnValue(mCurrent < mEnd, mValid = false);
+
+        switch (*mCurrent++)
         {
-            ReturnErrorOnFailure(ParseNumericalField(val.asString(), v));
+        case '"':
+            c = '"';
+            return true;
+        case '/':
+            c = '/';
+            return true;
+        case '\\':
+            c = '\\';
+            return true;
+        case 'b':
+            c = '\b';
+            return true;
+        case 'f':
+            c = '\f';
+            return true;
+        case 'n':
+            c = '\n';
+            return true;
+        case 'r':
+            c = '\r';
+            return true;
+        case 't':
+            c = '\t';
+            return true;
+        case 'u':
+            break;
+        default:
+            return mValid = false;
         }
-        else
+
+        uint32_t codePoint;
+        VerifyOrReturnValue(DecodeCodeUnit(codePoint), mValid = false);
+        if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
         {
-            return CHIP_ERROR_INVALID_ARGUMENT;
+            // Surrogate pair
+            uint32_t low;
+            VerifyOrReturnValue(mEnd - mCurrent >= 6 && mCurrent[0] == '\\' && mCurrent[1] == 'u', mValid = false);
+            mCurrent += 2;
+            VerifyOrReturnValue(DecodeCodeUnit(low), mValid = false);
+            codePoint = 0x10000 + ((codePoint & 0x3FF) << 10) + (low & 0x3FF);
         }
-        ReturnErrorOnFailure(writer.Put(tag, v));
-        break;
-    }
 
-    case TLV::kTLVType_SignedInteger: {
-        int64_t v = 0;
-        if (val.isInt64())
+        // UTF-8 encoding of the code point
+        mPendingIndex = 0;
+        if (codePoint <= 0x7F)
+        {
+            mPendingCount = 1;
+            mPending[0]   = static_cast<char>(codePoint);
+        }
+        else if (codePoint <= 0x7FF)
         {
-            v = val.asInt64();
+            mPendingCount = 2;
+            mPending[0]   = static_cast<char>(0xC0 | (codePoint >> 6));
+            mPending[1]   = static_cast<char>(0x80 | (codePoint & 0x3F));
         }
-        else if (val.isString())
+        else if (codePoint <= 0xFFFF)
         {
-            ReturnErrorOnFailure(ParseNumericalField(val.asString(), v));
+            mPendingCount = 3;
+            mPending[0]   = static_cast<char>(0xE0 | (codePoint >> 12));
+            mPending[1]   = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            mPending[2]   = static_cast<char>(0x80 | (codePoint & 0x3F));
         }
         else
         {
-            return CHIP_ERROR_INVALID_ARGUMENT;
+            mPendingCount = 4;
+            mPending[0]   = static_cast<char>(0xF0 | (codePoint >> 18));
+            mPending[1]   = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            mPending[2]   = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            mPending[3]   = static_cast<char>(0x80 | (codePoint & 0x3F));
         }
-        ReturnErrorOnFailure(writer.Put(tag, v));
-        break;
+        c = mPending[mPendingIndex++];
+        return true;
     }
 
-    case TLV::kTLVType_Boolean: {
-        VerifyOrReturnError(val.isBool(), CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.Put(tag, val.asBool()));
-        break;
-    }
+    bool IsValid() const { return mValid; }
 
-    case TLV::kTLVType_FloatingPointNumber: {
-        if (val.isNumeric())
+private:
+    bool DecodeCodeUnit(uint32_t & unit)
+    {
+        VerifyOrReturnValue(mEnd - mCurrent >= 4, false);
+        unit = 0;
+        for (int i = 0; i < 4; i++)
         {
-            if (elementCtx.type.isDouble)
+            char c = *mCurrent++;
+            unit *= 16;
+            if (c >= '0' && c <= '9')
+            {
+                unit += static_cast<uint32_t>(c - '0');
+            }
+            else if (c >= 'a' && c <= 'f')
+            {
+                unit += static_cast<uint32_t>(c - 'a' + 10);
+            }
+            else if (c >= 'A' && c <= 'F')
             {
-                ReturnErrorOnFailure(writer.Put(tag, val.asDouble()));
+                unit += static_cast<uint32_t>(c - 'A' + 10);
             }
             else
             {
-                ReturnErrorOnFailure(writer.Put(tag, val.asFloat()));
+                return false;
             }
         }
-        else if (val.isString())
+        return true;
+    }
+
+    const char * mCurrent;
+    const char * mEnd;
+    char mPending[4];
+    uint8_t mPendingCount = 0;
+    uint8_t mPendingIndex = 0;
+    bool mValid           = true;
+};
+
+// Compares two escaped JSON strings by their decoded bytes, as the member names of a JSON object are ordered.
+bool JsonStringLess(CharSpan a, CharSpan b)
+{
+    JsonStringDecoder decoderA(a);
+    JsonStringDecoder decoderB(b);
+    char ca;
+    char cb;
+    while (true)
+    {
+        bool hasA = decoderA.Next(ca);
+        bool hasB = decoderB.Next(cb);
+        if (!hasA || !hasB)
+        {
+            return !hasA && hasB;
+        }
+        if (ca != cb)
+        {
+            return static_cast<uint8_t>(ca) < static_cast<uint8_t>(cb);
+        }
+    }
+}
+
+/*
+ * A JSON number, typed as the JsonCpp reader types numbers.
+ */
+struct JsonNumber
+{
+    enum class Kind : uint8_t
+    {
+        kInt,
+        kUInt,
+        kReal,
+    };
+
+    Kind kind      = Kind::kInt;
+    int64_t intValue   = 0;
+    uint64_t uintValue = 0;
+    double realValue   = 0;
+
+    bool GetUInt64(uint64_t & value) const
+    {
+        switch (kind)
         {
-            const std::string valAsString = val.asString();
-            bool isPositiveInfinity       = (valAsString == kFloatingPointPositiveInfinity);
-            bool isNegativeInfinity       = (valAsString == kFloatingPointNegativeInfinity);
-            VerifyOrReturnError(isPositiveInfinity || isNegativeInfinity, CHIP_ERROR_INVALID_ARGUMENT);
-            if (elementCtx.type.isDouble)
+        case Kind::kInt:
+            VerifyOrReturnValue(intValue >= 0, false);
+            value = static_cast<uint64_t>(intValue);
+            return true;
+        case Kind::kUInt:
+            value = uintValue;
+            return true;
+        case Kind::kReal:
+            VerifyOrReturnValue(realValue >= 0 && realValue < 18446744073709551616.0 && IsIntegral(realValue), false);
+            value = static_cast<uint64_t>(realValue);
+            return true;
+        }
+        return false;
+    }
+
+    bool GetInt64(int64_t & value) const
+    {
+        switch (kind)
+        {
+        case Kind::kInt:
+            value = intValue;
+            return true;
+        case Kind::kUInt:
+            VerifyOrReturnValue(uintValue <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()), false);
+            value = static_cast<int64_t>(uintValue);
+            return true;
+        case Kind::kReal:
+            VerifyOrReturnValue(realValue >= -9223372036854775808.0 && realValue < 9223372036854775808.0 && IsIntegral(realValue),
+                                false);
+            value = static_cast<int64_t>(realValue);
+            return true;
+        }
+        return false;
+    }
+
+    template <typename T>
+    T GetFloatingPoint() const
+    {
+        switch (kind)
+        {
+        case Kind::kInt:
+            return static_cast<T>(intValue);
+        case Kind::kUInt:
+            // JsonCpp converts halves of unsigned values, which may round differently than a direct conversion.
+            return static_cast<T>(static_cast<double>(static_cast<int64_t>(uintValue / 2)) * 2.0 +
+                                  static_cast<double>(static_cast<int64_t>(uintValue & 1)));
+        case Kind::kReal:
+            break;
+        }
+        return static_cast<T>(realValue);
+    }
+
+private:
+    static bool IsIntegral(double value)
+    {
+        double integralPart;
+        return std::modf(value, &integralPart) == 0.0;
+    }
+};
+
+/*
+ * Encodes JSON text into TLV as it reads it, without building a tree of the JSON document.
+ *
+ * Strings without escape sequences are encoded straight from the JSON text, and other strings are decoded into a
+ * scratch buffer reused for the whole document.
+ */
+class JsonStreamEncoder
+{
+public:
+    explicit JsonStreamEncoder(CharSpan json) : mBegin(json.data()), mEnd(json.data() + json.size()) {}
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer)
+    {
+        // Check the syntax of the whole document first, so that nothing is encoded from invalid JSON.
+        const char * current = mBegin;
+        VerifyOrReturnError(SkipValue(current, 0), CHIP_ERROR_INTERNAL);
+
+        ElementContext elementCtx;
+        elementCtx.type = { TLV::kTLVType_Structure, false };
+
+        current = mBegin;
+        return EncodeValue(current, writer, elementCtx);
+    }
+
+private:
+    static bool IsSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+    void SkipSpaces(const char *& current) const
+    {
+        while (current < mEnd && IsSpace(*current))
+        {
+            current++;
+        }
+    }
+
+    // Skips the comment starting at current. On error, current is left where JsonCpp stops reading.
+    bool SkipComment(const char *& current) const
+    {
+        VerifyOrReturnValue(++current < mEnd, false);
+        char c = *current++;
+        if (c == '*')
+        {
+            for (; current + 1 < mEnd; current++)
             {
-                if (isPositiveInfinity)
+                if (current[0] == '*' && current[1] == '/')
                 {
-                    ReturnErrorOnFailure(writer.Put(tag, std::numeric_limits<double>::infinity()));
-                }
-                else
-                {
-                    ReturnErrorOnFailure(writer.Put(tag, -std::numeric_limits<double>::infinity()));
+                    current += 2;
+                    return true;
                 }
             }
-            else
+            current = mEnd;
+            return false;
+        }
+        VerifyOrReturnValue(c == '/', false);
+        while (current < mEnd && *current != '\n' && *current != '\r')
+        {
+            current++;
+        }
+        return true;
+    }
+
+    bool SkipSpacesAndComments(const char *& current) const
+    {
+        SkipSpaces(current);
+        while (current < mEnd && *current == '/')
+        {
+            VerifyOrReturnValue(SkipComment(current), false);
+            SkipSpaces(current);
+        }
+        return true;
+    }
+
+    JsonToken ReadToken(const char *& current) const
+    {
+        JsonToken token;
+        VerifyOrReturnValue(SkipSpacesAndComments(current), token);
+        if (current == mEnd || *current == '\0')
+        {
+            token.type = JsonTokenType::kEndOfStream;
+            return token;
+        }
+
+        const char * start = current++;
+        switch (*start)
+        {
+        case '{':
+            token.type = JsonTokenType::kObjectBegin;
+            break;
+        case '}':
+            token.type = JsonTokenType::kObjectEnd;
+            break;
+        case '[':
+            token.type = JsonTokenType::kArrayBegin;
+            break;
+        case ']':
+            token.type = JsonTokenType::kArrayEnd;
+            break;
+        case ',':
+            token.type = JsonTokenType::kArraySeparator;
+            break;
+        case ':':
+            token.type = JsonTokenType::kMemberSeparator;
+            break;
+        case '"':
+            while (current < mEnd && *current != '"')
             {
-                if (isPositiveInfinity)
-                {
-                    ReturnErrorOnFailure(writer.Put(tag, std::numeric_limits<float>::infinity()));
-                }
-                else
+                current += (*current == '\\' && mEnd - current > 1) ? 2 : 1;
+            }
+            VerifyOrReturnValue(current < mEnd, token);
+            token.type = JsonTokenType::kString;
+            token.text = CharSpan(start + 1, static_cast<size_t>(current - start - 1));
+            current++;
+            break;
+        case 't':
+            token.type = MatchLiteral(current, "rue") ? JsonTokenType::kTrue : JsonTokenType::kError;
+            break;
+        case 'f':
+            token.type = MatchLiteral(current, "alse") ? JsonTokenType::kFalse : JsonTokenType::kError;
+            break;
+        case 'n':
+            token.type = MatchLiteral(current, "ull") ? JsonTokenType::kNull : JsonTokenType::kError;
+            break;
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+            // Integral part, fractional part and exponent, any of which may be empty.
+            SkipDigits(current);
+            if (current < mEnd && *current == '.')
+            {
+                current++;
+                SkipDigits(current);
+            }
+            if (current < mEnd && (*current == 'e' || *current == 'E'))
+            {
+                current++;
+                if (current < mEnd && (*current == '+' || *current == '-'))
                 {
-                    ReturnErrorOnFailure(writer.Put(tag, -std::numeric_limits<float>::infinity()));
+                    current++;
                 }
+                SkipDigits(current);
             }
+            token.type = JsonTokenType::kNumber;
+            token.text = CharSpan(start, static_cast<size_t>(current - start));
+            break;
+        default:
+            break;
         }
-        else
+        return token;
+    }
+
+    // Reads what follows the value of an object member. As with JsonCpp, any token following a comment there, even an
+    // invalid one, separates members as a comma does.
+    JsonToken ReadMemberEnd(const char *& current) const
+    {
+        SkipSpaces(current);
+        VerifyOrReturnValue(current < mEnd && *current == '/', ReadToken(current));
+        VerifyOrReturnValue(SkipComment(current), JsonToken());
+
+        JsonToken token = ReadToken(current);
+        if (token.type != JsonTokenType::kObjectEnd)
         {
-            return CHIP_ERROR_INVALID_ARGUMENT;
+            token.type = JsonTokenType::kArraySeparator;
         }
-        break;
+        return token;
+    }
+
+    // JsonCpp does not allow comments between a member name and the colon following it.
+    bool SkipMemberSeparator(const char *& current) const
+    {
+        SkipSpaces(current);
+        VerifyOrReturnValue(current < mEnd && *current == ':', false);
+        current++;
+        return true;
+    }
+
+    bool MatchLiteral(const char *& current, const char * rest) const
+    {
+        size_t len = strlen(rest);
+        VerifyOrReturnValue(static_cast<size_t>(mEnd - current) >= len && memcmp(current, rest, len) == 0, false);
+        current += len;
+        return true;
     }
 
-    case TLV::kTLVType_ByteString: {
-        VerifyOrReturnError(val.isString(), CHIP_ERROR_INVALID_ARGUMENT);
-        const std::string valAsString = val.asString();
-        size_t encodedLen             = valAsString.length();
-        VerifyOrReturnError(CanCastTo<uint16_t>(encodedLen), CHIP_ERROR_INVALID_ARGUMENT);
+    void SkipDigits(const char *& current) const
+    {
+        while (current < mEnd && *current >= '0' && *current <= '9')
+        {
+            current++;
+        }
+    }
 
-        // Check if the length is a multiple of 4 as strict padding is required.
-        VerifyOrReturnError(encodedLen % 4 == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    bool DecodeNumber(CharSpan text, JsonNumber & number)
+    {
+        const char * current = text.data();
+        const char * end     = text.data() + text.size();
+        bool isNegative      = (*current == '-');
+        current += isNegative ? 1 : 0;
 
-        Platform::ScopedMemoryBuffer<uint8_t> byteString;
-        byteString.Alloc(BASE64_MAX_DECODED_LEN(static_cast<uint16_t>(encodedLen)));
-        VerifyOrReturnError(byteString.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+        // Integers which fit in 64 bits are integers, anything else is a real number. As in JsonCpp, positive integers
+        // beyond the range of int32_t are unsigned.
+        uint64_t maxValue = isNegative ? static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1
+                                       : std::numeric_limits<uint64_t>::max();
+        uint64_t value    = 0;
+        bool isInteger    = true;
+        for (; current < end && isInteger; current++)
+        {
+            VerifyOrReturnValue(*current >= '0' && *current <= '9', DecodeReal(text, number));
+            uint64_t digit = static_cast<uint64_t>(*current - '0');
+            isInteger      = (value <= (maxValue - digit) / 10);
+            value          = value * 10 + digit;
+        }
+        VerifyOrReturnValue(isInteger, DecodeReal(text, number));
 
-        auto decodedLen = Base64Decode(valAsString.c_str(), static_cast<uint16_t>(encodedLen), byteString.Get());
-        VerifyOrReturnError(decodedLen < UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.PutBytes(tag, byteString.Get(), decodedLen));
-        break;
+        if (isNegative)
+        {
+            number.kind     = JsonNumber::Kind::kInt;
+            number.intValue = (value == maxValue) ? std::numeric_limits<int64_t>::min() : -static_cast<int64_t>(value);
+        }
+        else if (value <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max()))
+        {
+            number.kind     = JsonNumber::Kind::kInt;
+            number.intValue = static_cast<int64_t>(value);
+        }
+        else
+        {
+            number.kind      = JsonNumber::Kind::kUInt;
+            number.uintValue = value;
+        }
+        return true;
     }
 
-    case TLV::kTLVType_UTF8String: {
-        VerifyOrReturnError(val.isString(), CHIP_ERROR_INVALID_ARGUMENT);
-        const std::string valAsString = val.asString();
-        ReturnErrorOnFailure(writer.PutString(tag, valAsString.data(), static_cast<uint32_t>(valAsString.size())));
-        break;
+    bool DecodeReal(CharSpan text, JsonNumber & number)
+    {
+        // strtod() needs a null-terminated string.
+        char buffer[64];
+        char * str = buffer;
+        if (text.size() >= sizeof(buffer))
+        {
+            VerifyOrReturnValue(ReserveScratch(text.size() + 1), false);
+            str = mScratch.Get();
+        }
+        memcpy(str, text.data(), text.size());
+        str[text.size()] = '\0';
+
+        // As with JsonCpp, numbers out of the range of double are invalid.
+        char * end       = nullptr;
+        number.kind      = JsonNumber::Kind::kReal;
+        number.realValue = strtod(str, &end);
+        return end == str + text.size() && !std::isinf(number.realValue);
     }
 
-    case TLV::kTLVType_Null: {
-        VerifyOrReturnError(val.isNull(), CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.PutNull(tag));
-        break;
+    bool ReserveScratch(size_t size)
+    {
+        if (size > mScratchSize)
+        {
+            VerifyOrReturnValue(mScratch.Alloc(size), false);
+            mScratchSize = size;
+        }
+        return true;
     }
 
-    case TLV::kTLVType_Structure: {
-        TLV::TLVType containerType;
-        VerifyOrReturnError(val.isObject(), CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, containerType));
+    // Decodes a JSON string, in place in the JSON text when it has no escape sequences.
+    CHIP_ERROR DecodeString(CharSpan escaped, CharSpan & decoded)
+    {
+        if (memchr(escaped.data(), '\\', escaped.size()) == nullptr)
+        {
+            decoded = escaped;
+            return CHIP_NO_ERROR;
+        }
 
-        std::vector<std::string> jsonNames = val.getMemberNames();
-        std::vector<ElementContext> nestedElementsCtx;
+        // Escape sequences are longer than what they decode to.
+        VerifyOrReturnError(ReserveScratch(escaped.size()), CHIP_ERROR_NO_MEMORY);
+        JsonStringDecoder decoder(escaped);
+        size_t length = 0;
+        char c;
+        while (decoder.Next(c))
+        {
+            mScratch[length++] = c;
+        }
+        VerifyOrReturnError(decoder.IsValid(), CHIP_ERROR_INTERNAL);
+        decoded = CharSpan(mScratch.Get(), length);
+        return CHIP_NO_ERROR;
+    }
 
-        for (size_t i = 0; i < jsonNames.size(); i++)
+    bool IsValidString(CharSpan escaped) const
+    {
+        JsonStringDecoder decoder(escaped);
+        char c;
+        while (decoder.Next(c))
         {
-            ElementContext ctx;
-            ReturnErrorOnFailure(ParseJsonName(jsonNames[i], ctx, writer.ImplicitProfileId));
-            nestedElementsCtx.push_back(ctx);
         }
+        return decoder.IsValid();
+    }
 
-        // Sort Json object elements by Tag number (low to high).
-        // Note that all sorted Context Tags will appear first followed by all sorted Common Tags.
-        std::sort(nestedElementsCtx.begin(), nestedElementsCtx.end(), CompareByTag);
+    // Reads the next value, checking its syntax, as the JsonCpp reader would.
+    bool SkipValue(const char *& current, size_t depth)
+    {
+        VerifyOrReturnValue(depth < kMaxJsonNestingDepth, false);
 
-        for (auto & ctx : nestedElementsCtx)
+        JsonToken token = ReadToken(current);
+        switch (token.type)
         {
-            ReturnErrorOnFailure(EncodeTlvElement(val[ctx.jsonName], writer, ctx));
+        case JsonTokenType::kObjectBegin: {
+            bool lastNameEmpty = true;
+            while (true)
+            {
+                token = ReadToken(current);
+                // JsonCpp accepts a closing brace after a comma if the name of the previous member was empty.
+                VerifyOrReturnValue(token.type != JsonTokenType::kObjectEnd || !lastNameEmpty, true);
+                VerifyOrReturnValue(token.type == JsonTokenType::kString && IsValidString(token.text), false);
+                lastNameEmpty = token.text.empty();
+                VerifyOrReturnValue(SkipMemberSeparator(current), false);
+                VerifyOrReturnValue(SkipValue(current, depth + 1), false);
+                token = ReadMemberEnd(current);
+                VerifyOrReturnValue(token.type != JsonTokenType::kObjectEnd, true);
+                VerifyOrReturnValue(token.type == JsonTokenType::kArraySeparator, false);
+            }
         }
 
-        ReturnErrorOnFailure(writer.EndContainer(containerType));
-        break;
+        case JsonTokenType::kArrayBegin: {
+            // Only whitespace is allowed in an empty array, not comments.
+            SkipSpaces(current);
+            if (current < mEnd && *current == ']')
+            {
+                current++;
+                return true;
+            }
+            while (true)
+            {
+                VerifyOrReturnValue(SkipValue(current, depth + 1), false);
+                token = ReadToken(current);
+                VerifyOrReturnValue(token.type != JsonTokenType::kArrayEnd, true);
+                VerifyOrReturnValue(token.type == JsonTokenType::kArraySeparator, false);
+            }
+        }
+
+        case JsonTokenType::kString:
+            return IsValidString(token.text);
+
+        case JsonTokenType::kNumber: {
+            JsonNumber number;
+            return DecodeNumber(token.text, number);
+        }
+
+        case JsonTokenType::kTrue:
+        case JsonTokenType::kFalse:
+        case JsonTokenType::kNull:
+            return true;
+
+        default:
+            return false;
+        }
     }
 
-    case TLV::kTLVType_Array: {
-        TLV::TLVType containerType;
-        VerifyOrReturnError(val.isArray(), CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Array, containerType));
+    struct ObjectMember
+    {
+        CharSpan name;
+        const char * value = nullptr;
+        ElementContext ctx;
 
-        if (elementCtx.subType.tlvType == TLV::kTLVType_NotSpecified)
+        // Order of the members in TLV: by tag, then by name for members with the same tag.
+        bool IsBefore(const ObjectMember & other) const
         {
-            VerifyOrReturnError(val.size() == 0, CHIP_ERROR_INVALID_ARGUMENT);
+            if (CompareByTag(ctx, other.ctx))
+            {
+                return true;
+            }
+            if (CompareByTag(other.ctx, ctx))
+            {
+                return false;
+            }
+            return JsonStringLess(name, other.name);
         }
-        else
+    };
+
+    // Reads the object member starting at current, and moves current past its value.
+    CHIP_ERROR ReadMember(const char *& current, const TLV::TLVWriter & writer, const JsonToken & nameToken, ObjectMember & member)
+    {
+        member.name = nameToken.text;
+        VerifyOrReturnError(SkipMemberSeparator(current), CHIP_ERROR_INTERNAL);
+        member.value = current;
+        VerifyOrReturnError(SkipValue(current, 0), CHIP_ERROR_INTERNAL);
+
+        CharSpan name;
+        ReturnErrorOnFailure(DecodeString(member.name, name));
+        return ParseJsonName(name, member.ctx, writer.ImplicitProfileId);
+    }
+
+    // Encodes the members of the object starting at current, and moves current past the end of the object.
+    //
+    // TLV structure members are sorted by tag, which is not the order of the JSON object members. As in a JSON object, the
+    // last of several members with the same name wins.
+    CHIP_ERROR EncodeStruct(const char *& current, TLV::TLVWriter & writer)
+    {
+        const char * members = current;
+        ObjectMember sorted[kMaxSortedStructMembers];
+        size_t count = 0;
+        while (true)
         {
-            ElementContext nestedElementCtx;
-            nestedElementCtx.tag  = TLV::AnonymousTag();
-            nestedElementCtx.type = elementCtx.subType;
-            for (Json::ArrayIndex i = 0; i < val.size(); i++)
+            JsonToken token = ReadToken(current);
+            if (token.type != JsonTokenType::kString)
             {
-                ReturnErrorOnFailure(EncodeTlvElement(val[i], writer, nestedElementCtx));
+                break;
+            }
+            if (count == kMaxSortedStructMembers)
+            {
+                current = members;
+                return EncodeStructBySelection(current, writer);
+            }
+
+            // Insertion sort, keeping members with the same name in the order of the object.
+            ObjectMember member;
+            ReturnErrorOnFailure(ReadMember(current, writer, token, member));
+            size_t i = count++;
+            for (; i > 0 && member.IsBefore(sorted[i - 1]); i--)
+            {
+                sorted[i] = sorted[i - 1];
+            }
+            sorted[i] = member;
+
+            if (ReadMemberEnd(current).type != JsonTokenType::kArraySeparator)
+            {
+                break;
             }
         }
 
-        ReturnErrorOnFailure(writer.EndContainer(containerType));
-        break;
+        for (size_t i = 0; i < count; i++)
+        {
+            if (i + 1 < count && !sorted[i].IsBefore(sorted[i + 1]))
+            {
+                continue;
+            }
+            const char * value = sorted[i].value;
+            ReturnErrorOnFailure(EncodeValue(value, writer, sorted[i].ctx));
+        }
+        return CHIP_NO_ERROR;
     }
 
-    default:
-        return CHIP_ERROR_INVALID_TLV_ELEMENT;
-        break;
+    // Same as EncodeStruct, for objects with too many members to sort on the stack: each pass over the object selects the
+    // member which comes next.
+    CHIP_ERROR EncodeStructBySelection(const char *& current, TLV::TLVWriter & writer)
+    {
+        const char * members = current;
+        ObjectMember previous;
+        bool hasPrevious = false;
+        while (true)
+        {
+            ObjectMember member;
+            ObjectMember selected;
+            bool hasSelected = false;
+            current          = members;
+            while (true)
+            {
+                JsonToken token = ReadToken(current);
+                if (token.type != JsonTokenType::kString)
+                {
+                    break;
+                }
+                ReturnErrorOnFailure(ReadMember(current, writer, token, member));
+                if ((!hasPrevious || previous.IsBefore(member)) && (!hasSelected || !selected.IsBefore(member)))
+                {
+                    selected    = member;
+                    hasSelected = true;
+                }
+
+                if (ReadMemberEnd(current).type != JsonTokenType::kArraySeparator)
+                {
+                    break;
+                }
+            }
+
+            if (!hasSelected)
+            {
+                return CHIP_NO_ERROR;
+            }
+            const char * value = selected.value;
+            ReturnErrorOnFailure(EncodeValue(value, writer, selected.ctx));
+            previous    = selected;
+            hasPrevious = true;
+        }
     }
 
-    return CHIP_NO_ERROR;
-}
+    CHIP_ERROR EncodeValue(const char *& current, TLV::TLVWriter & writer, const ElementContext & elementCtx)
+    {
+        TLV::Tag tag    = elementCtx.tag;
+        JsonToken token = ReadToken(current);
+
+        switch (elementCtx.type.tlvType)
+        {
+        case TLV::kTLVType_UnsignedInteger: {
+            uint64_t v = 0;
+            JsonNumber number;
+            if (token.type == JsonTokenType::kNumber)
+            {
+                VerifyOrReturnError(DecodeNumber(token.text, number) && number.GetUInt64(v), CHIP_ERROR_INVALID_ARGUMENT);
+            }
+            else if (token.type == JsonTokenType::kString)
+            {
+                CharSpan str;
+                ReturnErrorOnFailure(DecodeString(token.text, str));
+                ReturnErrorOnFailure(ParseNumericalField(str, v));
+            }
+            else
+            {
+                return CHIP_ERROR_INVALID_ARGUMENT;
+            }
+            ReturnErrorOnFailure(writer.Put(tag, v));
+            break;
+        }
+
+        case TLV::kTLVType_SignedInteger: {
+            int64_t v = 0;
+            JsonNumber number;
+            if (token.type == JsonTokenType::kNumber)
+            {
+                VerifyOrReturnError(DecodeNumber(token.text, number) && number.GetInt64(v), CHIP_ERROR_INVALID_ARGUMENT);
+            }
+            else if (token.type == JsonTokenType::kString)
+            {
+                CharSpan str;
+                ReturnErrorOnFailure(DecodeString(token.text, str));
+                ReturnErrorOnFailure(ParseNumericalField(str, v));
+            }
+            else
+            {
+                return CHIP_ERROR_INVALID_ARGUMENT;
+            }
+            ReturnErrorOnFailure(writer.Put(tag, v));
+            break;
+        }
+
+        case TLV::kTLVType_Boolean: {
+            VerifyOrReturnError(token.type == JsonTokenType::kTrue || token.type == JsonTokenType::kFalse,
+                                CHIP_ERROR_INVALID_ARGUMENT);
+            ReturnErrorOnFailure(writer.Put(tag, token.type == JsonTokenType::kTrue));
+            break;
+        }
+
+        case TLV::kTLVType_FloatingPointNumber: {
+            if (token.type == JsonTokenType::kNumber)
+            {
+                JsonNumber number;
+                VerifyOrReturnError(DecodeNumber(token.text, number), CHIP_ERROR_INTERNAL);
+                if (elementCtx.type.isDouble)
+                {
+                    ReturnErrorOnFailure(writer.Put(tag, number.GetFloatingPoint<double>()));
+                }
+                else
+                {
+                    ReturnErrorOnFailure(writer.Put(tag, number.GetFloatingPoint<float>()));
+                }
+            }
+            else if (token.type == JsonTokenType::kString)
+            {
+                CharSpan str;
+                ReturnErrorOnFailure(DecodeString(token.text, str));
+                bool isPositiveInfinity = FieldEquals(str, kFloatingPointPositiveInfinity);
+                bool isNegativeInfinity = FieldEquals(str, kFloatingPointNegativeInfinity);
+                VerifyOrReturnError(isPositiveInfinity || isNegativeInfinity, CHIP_ERROR_INVALID_ARGUMENT);
+                if (elementCtx.type.isDouble)
+                {
+                    if (isPositiveInfinity)
+                    {
+                        ReturnErrorOnFailure(writer.Put(tag, std::numeric_limits<double>::infinity()));
+                    }
+                    else
+                    {
+                        ReturnErrorOnFailure(writer.Put(tag, -std::numeric_limits<double>::infinity()));
+                    }
+                }
+                else
+                {
+                    if (isPositiveInfinity)
+                    {
+                        ReturnErrorOnFailure(writer.Put(tag, std::numeric_limits<float>::infinity()));
+                    }
+                    else
+                    {
+                        ReturnErrorOnFailure(writer.Put(tag, -std::numeric_limits<float>::infinity()));
+                    }
+                }
+            }
+            else
+            {
+                return CHIP_ERROR_INVALID_ARGUMENT;
+            }
+            break;
+        }
+
+        case TLV::kTLVType_ByteString: {
+            VerifyOrReturnError(token.type == JsonTokenType::kString, CHIP_ERROR_INVALID_ARGUMENT);
+            CharSpan str;
+            ReturnErrorOnFailure(DecodeString(token.text, str));
+            size_t encodedLen = str.size();
+            VerifyOrReturnError(CanCastTo<uint16_t>(encodedLen), CHIP_ERROR_INVALID_ARGUMENT);
+
+            // Check if the length is a multiple of 4 as strict padding is required.
+            VerifyOrReturnError(encodedLen % 4 == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+            // Base64 decoding can be done in place, when the string had to be decoded into the scratch buffer.
+            VerifyOrReturnError(ReserveScratch(std::max<size_t>(token.text.size(), 1)), CHIP_ERROR_NO_MEMORY);
+            uint8_t * byteString = Uint8::from_char(mScratch.Get());
+            auto decodedLen      = Base64Decode(str.data(), static_cast<uint16_t>(encodedLen), byteString);
+            VerifyOrReturnError(decodedLen < UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+            ReturnErrorOnFailure(writer.PutBytes(tag, byteString, decodedLen));
+            break;
+        }
+
+        case TLV::kTLVType_UTF8String: {
+            VerifyOrReturnError(token.type == JsonTokenType::kString, CHIP_ERROR_INVALID_ARGUMENT);
+            CharSpan str;
+            ReturnErrorOnFailure(DecodeString(token.text, str));
+            ReturnErrorOnFailure(writer.PutString(tag, str.data(), static_cast<uint32_t>(str.size())));
+            break;
+        }
+
+        case TLV::kTLVType_Null: {
+            VerifyOrReturnError(token.type == JsonTokenType::kNull, CHIP_ERROR_INVALID_ARGUMENT);
+            ReturnErrorOnFailure(writer.PutNull(tag));
+            break;
+        }
+
+        case TLV::kTLVType_Structure: {
+            TLV::TLVType containerType;
+            VerifyOrReturnError(token.type == JsonTokenType::kObjectBegin, CHIP_ERROR_INVALID_ARGUMENT);
+            ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, containerType));
+            ReturnErrorOnFailure(EncodeStruct(current, writer));
+            ReturnErrorOnFailure(writer.EndContainer(containerType));
+            break;
+        }
+
+        case TLV::kTLVType_Array: {
+            TLV::TLVType containerType;
+            VerifyOrReturnError(token.type == JsonTokenType::kArrayBegin, CHIP_ERROR_INVALID_ARGUMENT);
+            ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Array, containerType));
+
+            const char * next = current;
+            bool isEmpty      = (ReadToken(next).type == JsonTokenType::kArrayEnd);
+            if (elementCtx.subType.tlvType == TLV::kTLVType_NotSpecified)
+            {
+                VerifyOrReturnError(isEmpty, CHIP_ERROR_INVALID_ARGUMENT);
+            }
+            else if (!isEmpty)
+            {
+                ElementContext nestedElementCtx;
+                nestedElementCtx.tag  = TLV::AnonymousTag();
+                nestedElementCtx.type = elementCtx.subType;
+                do
+                {
+                    ReturnErrorOnFailure(EncodeValue(current, writer, nestedElementCtx));
+                } while (ReadToken(current).type == JsonTokenType::kArraySeparator);
+            }
+
+            ReturnErrorOnFailure(writer.EndContainer(containerType));
+            break;
+        }
+
+        default:
+            return CHIP_ERROR_INVALID_TLV_ELEMENT;
+            break;
+        }
+
+        return CHIP_NO_ERROR;
+    }
+
+    const char * mBegin;
+    const char * mEnd;
+    Platform::ScopedMemoryBuffer<char> mScratch;
+    size_t mScratchSize = 0;
+};
 
 } // namespace
 
@@ -411,14 +1192,11 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, MutableByteSpan & tlv)
 
 CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer)
 {
-    Json::Reader reader;
-    Json::Value json;
-    bool result = reader.parse(jsonString, json);
-    VerifyOrReturnError(result, CHIP_ERROR_INTERNAL);
-
-    ElementContext elementCtx;
-    elementCtx.type = { TLV::kTLVType_Structure, false };
+    return JsonToTlv(CharSpan(jsonString.data(), jsonString.size()), writer);
+}
 
+CHIP_ERROR JsonToTlv(const CharSpan & json, TLV::TLVWriter & writer)
+{
     // Use kTemporaryImplicitProfileId as the default value for cases where no explicit implicit profile ID is provided by
     // the caller. This allows for the encoding of tags that are not vendor-specific or context-specific but are instead
     // associated with a temporary implicit profile ID (0xFF01).
@@ -427,7 +1205,8 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer)
         writer.ImplicitProfileId = kTemporaryImplicitProfileId;
     }
 
-    return EncodeTlvElement(json, writer, elementCtx);
+    JsonStreamEncoder encoder(json);
+    return encoder.Encode(writer);
 }
 
 CHIP_ERROR ConvertTlvTag(uint32_t tagNumber, TLV::Tag & tag)
@@ -32,6 +32,12 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, MutableByteSpan & tlv);
  */
 CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer);
 
+/*
+ * Same as above, for JSON text which is not held in a std::string. The text is encoded as it is read, without building a
+ * document tree.
+ */
+CHIP_ERROR JsonToTlv(const CharSpan & json, TLV::TLVWriter & writer);
+
 /*
  * Convert a uint32_t tagNumber (from MEI) to a TLV tag.
  * The upper 16 bits of tag_number represent the vendor_id.
@@ -15,9 +15,13 @@
  *    limitations under the License.
  */
 
-#include "lib/support/CHIPMemString.h"
-#include "lib/support/ScopedBuffer.h"
-#include <json/json.h>
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/Base64.h>
 #include <lib/support/SafeInt.h>
@@ -35,6 +39,16 @@ namespace {
 // and this value is never stored.
 constexpr uint32_t kTemporaryImplicitProfileId = 0xFF01;
 
+// Layout parameters of the JsonCpp StyledWriter, whose output format is reproduced here.
+constexpr size_t kIndentSize  = 3;
+constexpr size_t kRightMargin = 74;
+
+// Longest JSON element name: a 32-bit tag number, ':' and "ARRAY-" followed by the longest element type.
+constexpr size_t kMaxJsonElementNameLength = 10 + 1 + 6 + 6;
+
+// Structures with up to this many members are sorted on the stack; larger ones take a pass per member.
+constexpr size_t kMaxSortedStructMembers = 16;
+
 /// RAII to switch the implicit profile id for a reader
 class ImplicitProfileIdChange
 {
@@ -77,151 +91,484 @@ const char * GetJsonElementStrFromType(const ElementTypeContext & ctx)
     }
 };
 
+ElementTypeContext GetElementType(const TLV::TLVReader & reader)
+{
+    ElementTypeContext type;
+    type.tlvType = reader.GetType();
+    if (type.tlvType == TLV::kTLVType_FloatingPointNumber)
+    {
+        TLV::TLVReader element(reader);
+        type.isDouble = element.IsElementDouble();
+    }
+    return type;
+}
+
+CHIP_ERROR ValidateElement(TLV::TLVReader & reader);
+
 /*
- * Encapsulates the element information required to construct a JSON element name string in a JSON object.
- *
- * The generated JSON element name string is constructed as:
- *     'TagNumber:ElementType-SubElementType'.
+ * Checks that all the elements of the TLV structure the reader is positioned on can be converted to JSON, and leaves the
+ * reader after the structure. Elements are checked in the order they are read, so that the first error found is the one
+ * a conversion in that order would report.
  */
-struct JsonObjectElementContext
+CHIP_ERROR ValidateStruct(TLV::TLVReader & reader)
 {
-    JsonObjectElementContext(TLV::TLVReader & reader)
+    CHIP_ERROR err;
+    TLV::TLVType containerType;
+
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
     {
-        tag               = reader.GetTag();
-        implicitProfileId = reader.ImplicitProfileId;
-        type.tlvType      = reader.GetType();
-        if (type.tlvType == TLV::kTLVType_FloatingPointNumber)
+        TLV::Tag tag = reader.GetTag();
+        VerifyOrReturnError(TLV::IsContextTag(tag) || TLV::IsProfileTag(tag), CHIP_ERROR_INVALID_TLV_TAG);
+
+        if (TLV::IsProfileTag(tag) && TLV::VendorIdFromTag(tag) == 0)
         {
-            type.isDouble = reader.IsElementDouble();
+            VerifyOrReturnError(TLV::TagNumFromTag(tag) > UINT8_MAX, CHIP_ERROR_INVALID_TLV_TAG);
         }
+
+        ReturnErrorOnFailure(ValidateElement(reader));
     }
 
-    std::string GenerateJsonElementName() const
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return reader.ExitContainer(containerType);
+}
+
+CHIP_ERROR ValidateArray(TLV::TLVReader & reader)
+{
+    CHIP_ERROR err;
+    TLV::TLVType containerType;
+    ElementTypeContext firstType;
+    bool isFirst = true;
+
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
     {
-        std::string str = "???";
-        if (TLV::IsContextTag(tag))
+        VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+        VerifyOrReturnError(reader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+        // All the elements of an array have the type of its first element.
+        ElementTypeContext type = GetElementType(reader);
+        if (isFirst)
         {
-            // common case for context tags: raw value
-            str = std::to_string(TLV::TagNumFromTag(tag));
+            firstType = type;
+            isFirst   = false;
         }
-        else if (TLV::IsProfileTag(tag))
+        else
         {
-            if (TLV::ProfileIdFromTag(tag) == implicitProfileId)
-            {
-                str = std::to_string(TLV::TagNumFromTag(tag));
-            }
-            else
-            {
-                uint32_t tagNumber = (static_cast<uint32_t>(TLV::VendorIdFromTag(tag)) << 16) | TLV::TagNumFromTag(tag);
-                str                = std::to_string(tagNumber);
-            }
+            VerifyOrReturnError(firstType.tlvType == type.tlvType && firstType.isDouble == type.isDouble,
+                                CHIP_ERROR_INVALID_TLV_ELEMENT);
+        }
+
+        ReturnErrorOnFailure(ValidateElement(reader));
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return reader.ExitContainer(containerType);
+}
+
+CHIP_ERROR ValidateElement(TLV::TLVReader & reader)
+{
+    switch (reader.GetType())
+    {
+    case TLV::kTLVType_UnsignedInteger:
+    case TLV::kTLVType_SignedInteger:
+    case TLV::kTLVType_Boolean:
+    case TLV::kTLVType_FloatingPointNumber:
+    case TLV::kTLVType_ByteString:
+    case TLV::kTLVType_UTF8String:
+    case TLV::kTLVType_Null:
+        return CHIP_NO_ERROR;
+    case TLV::kTLVType_Structure:
+        return ValidateStruct(reader);
+    case TLV::kTLVType_Array:
+        return ValidateArray(reader);
+    default:
+        return CHIP_ERROR_INVALID_TLV_ELEMENT;
+    }
+}
+
+/*
+ * JSON element name of a structure member, constructed as:
+ *     'TagNumber:ElementType-SubElementType'.
+ */
+struct JsonElementName
+{
+    char str[kMaxJsonElementNameLength + 1];
+
+    CHIP_ERROR Generate(const TLV::TLVReader & reader)
+    {
+        TLV::Tag tag       = reader.GetTag();
+        uint32_t tagNumber = TLV::TagNumFromTag(tag);
+        if (TLV::IsProfileTag(tag) && TLV::ProfileIdFromTag(tag) != reader.ImplicitProfileId)
+        {
+            tagNumber = (static_cast<uint32_t>(TLV::VendorIdFromTag(tag)) << 16) | tagNumber;
         }
-        str = str + ":" + GetJsonElementStrFromType(type);
-        if (type.tlvType == TLV::kTLVType_Array)
+
+        ElementTypeContext type = GetElementType(reader);
+        if (type.tlvType != TLV::kTLVType_Array)
         {
-            str = str + "-" + GetJsonElementStrFromType(subType);
+            snprintf(str, sizeof(str), "%" PRIu32 ":%s", tagNumber, GetJsonElementStrFromType(type));
+            return CHIP_NO_ERROR;
         }
-        return str;
+
+        // The sub-element type of an array is the type of its first element.
+        TLV::TLVReader array;
+        TLV::TLVType containerType;
+        ElementTypeContext subType;
+        array.Init(reader);
+        ReturnErrorOnFailure(array.EnterContainer(containerType));
+        CHIP_ERROR err = array.Next();
+        if (err == CHIP_NO_ERROR)
+        {
+            subType = GetElementType(array);
+        }
+        else
+        {
+            VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        }
+        snprintf(str, sizeof(str), "%" PRIu32 ":%s-%s", tagNumber, kElementTypeArray, GetJsonElementStrFromType(subType));
+        return CHIP_NO_ERROR;
     }
+};
 
-    TLV::Tag tag;
-    uint32_t implicitProfileId;
-    ElementTypeContext type;
-    ElementTypeContext subType;
+/*
+ * Destination of the JSON text: a caller-provided buffer, a std::string, or nothing when only measuring the length of
+ * the text. Keeps counting once a buffer is full, so that the required size is known.
+ */
+class JsonOutput
+{
+public:
+    JsonOutput() = default;
+    explicit JsonOutput(MutableCharSpan buffer) : mBuffer(buffer.data()), mCapacity(buffer.size()) {}
+    explicit JsonOutput(std::string & string) : mString(&string) {}
+
+    void Append(const char * str, size_t len)
+    {
+        VerifyOrReturn(len > 0);
+        if (mString != nullptr)
+        {
+            mString->append(str, len);
+        }
+        else if (mBuffer != nullptr && len <= mCapacity - std::min(mLength, mCapacity))
+        {
+            memcpy(mBuffer + mLength, str, len);
+        }
+        mLength += len;
+        mLastChar = str[len - 1];
+    }
+
+    void Append(const char * str) { Append(str, strlen(str)); }
+    void Append(char c) { Append(&c, 1); }
+
+    size_t Length() const { return mLength; }
+    char LastChar() const { return mLastChar; }
+
+private:
+    char * mBuffer        = nullptr;
+    size_t mCapacity      = 0;
+    std::string * mString = nullptr;
+    size_t mLength        = 0;
+    char mLastChar        = '\0';
 };
 
 /*
- * This templated function inserts a name/value pair into the Json object.
- * The value is templated to be of type T and accepts any of the following types:
+ * Writes the JSON representation of TLV elements as it reads them, with the layout of the JsonCpp StyledWriter:
+ *   - members of objects are sorted by name, and each written on its own line,
+ *   - arrays of scalars which fit within the right margin are written on a single line,
+ *   - every nesting level is indented by 3 spaces.
  *
- *      bool, uint*_t, int*_t, char *, float, double, std::string, Json::Value
- *
- * This method uses the provided element context to generate Json name string.
+ * The elements must have been checked by ValidateStruct().
  */
-template <typename T>
-void InsertJsonElement(Json::Value & json, const JsonObjectElementContext & ctx, T val)
+class JsonStreamWriter
 {
-    if (json.isArray())
+public:
+    explicit JsonStreamWriter(JsonOutput & output) : mOutput(output) {}
+
+    // Converts the TLV structure the reader is positioned on into a JSON object.
+    CHIP_ERROR WriteStruct(const TLV::TLVReader & reader);
+
+    // Converts the TLV element the reader is positioned on into a JSON value.
+    CHIP_ERROR WriteValue(const TLV::TLVReader & reader);
+
+private:
+    CHIP_ERROR WriteStructBySelection(const TLV::TLVReader & reader);
+    CHIP_ERROR WriteMember(const JsonElementName & name, const TLV::TLVReader & reader, bool hasNext);
+    CHIP_ERROR WriteArray(const TLV::TLVReader & reader);
+    void WriteDouble(double value);
+    void WriteQuotedString(CharSpan str);
+    void WriteBase64(ByteSpan bytes);
+
+    // StyledWriter::writeIndent(): start a new line, unless already at the start of an indented value.
+    void WriteIndent()
     {
-        json.append(val);
+        if (mOutput.Length() > 0)
+        {
+            VerifyOrReturn(mOutput.LastChar() != ' ');
+            if (mOutput.LastChar() != '\n')
+            {
+                mOutput.Append('\n');
+            }
+        }
+        static constexpr char kSpaces[] = "                                ";
+        for (size_t indent = mIndent; indent > 0;)
+        {
+            size_t len = std::min(indent, sizeof(kSpaces) - 1);
+            mOutput.Append(kSpaces, len);
+            indent -= len;
+        }
     }
-    else
+
+    void WriteWithIndent(const char * str)
     {
-        json[ctx.GenerateJsonElementName()] = val;
+        WriteIndent();
+        mOutput.Append(str);
     }
-}
 
-static CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj);
+    JsonOutput & mOutput;
+    size_t mIndent = 0;
+};
 
-/*
- * Given a TLVReader positioned at TLV structure this function:
- *   - enters structure
- *   - converts all elements of a structure into JSON object representation
- *   - exits structure
- */
-CHIP_ERROR TlvStructToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
+CHIP_ERROR JsonStreamWriter::WriteStruct(const TLV::TLVReader & reader)
 {
+    // Members are written in the order of their JSON names, which is not the order of their TLV tags. As with a JSON
+    // object, the last of several members with the same name wins.
+    struct Member
+    {
+        JsonElementName name;
+        TLV::TLVReader reader;
+    };
+    Member members[kMaxSortedStructMembers];
+    size_t count = 0;
+
     CHIP_ERROR err;
+    TLV::TLVReader scan;
     TLV::TLVType containerType;
+    scan.Init(reader);
+    ReturnErrorOnFailure(scan.EnterContainer(containerType));
+    while ((err = scan.Next()) == CHIP_NO_ERROR)
+    {
+        if (count == kMaxSortedStructMembers)
+        {
+            return WriteStructBySelection(reader);
+        }
+        ReturnErrorOnFailure(members[count].name.Generate(scan));
+        members[count].reader.Init(scan);
 
-    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+        // Insertion sort, keeping members with the same name in TLV order.
+        for (size_t i = count; i > 0 && strcmp(members[i].name.str, members[i - 1].name.str) < 0; i--)
+        {
+            std::swap(members[i], members[i - 1]);
+        }
+        count++;
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
 
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    if (count == 0)
     {
-        TLV::Tag tag = reader.GetTag();
-        VerifyOrReturnError(TLV::IsContextTag(tag) || TLV::IsProfileTag(tag), CHIP_ERROR_INVALID_TLV_TAG);
+        mOutput.Append("{}");
+        return CHIP_NO_ERROR;
+    }
 
-        if (TLV::IsProfileTag(tag) && TLV::VendorIdFromTag(tag) == 0)
+    WriteWithIndent("{");
+    mIndent += kIndentSize;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (i + 1 < count && strcmp(members[i].name.str, members[i + 1].name.str) == 0)
         {
-            VerifyOrReturnError(TLV::TagNumFromTag(tag) > UINT8_MAX, CHIP_ERROR_INVALID_TLV_TAG);
+            continue;
+        }
+        ReturnErrorOnFailure(WriteMember(members[i].name, members[i].reader, i + 1 < count));
+    }
+    mIndent -= kIndentSize;
+    WriteWithIndent("}");
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JsonStreamWriter::WriteStructBySelection(const TLV::TLVReader & reader)
+{
+    // Each pass over the structure selects the member with the next name.
+    JsonElementName previous;
+    bool hasPrevious = false;
+    while (true)
+    {
+        CHIP_ERROR err;
+        TLV::TLVReader scan;
+        TLV::TLVReader selected;
+        TLV::TLVType containerType;
+        JsonElementName name;
+        JsonElementName selectedName;
+        bool hasSelected = false;
+        bool hasNext     = false;
+
+        scan.Init(reader);
+        ReturnErrorOnFailure(scan.EnterContainer(containerType));
+        while ((err = scan.Next()) == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(name.Generate(scan));
+            if (hasPrevious && strcmp(name.str, previous.str) <= 0)
+            {
+                continue;
+            }
+            int order = hasSelected ? strcmp(name.str, selectedName.str) : -1;
+            if (order > 0)
+            {
+                hasNext = true;
+                continue;
+            }
+            hasNext = hasNext || (order < 0 && hasSelected);
+            selected.Init(scan);
+            selectedName = name;
+            hasSelected  = true;
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+        if (!hasSelected)
+        {
+            break;
+        }
+
+        if (!hasPrevious)
+        {
+            WriteWithIndent("{");
+            mIndent += kIndentSize;
         }
+        ReturnErrorOnFailure(WriteMember(selectedName, selected, hasNext));
 
-        // Recursively convert to JSON the item within the struct.
-        ReturnErrorOnFailure(TlvToJson(reader, jsonObj));
+        previous    = selectedName;
+        hasPrevious = true;
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    return reader.ExitContainer(containerType);
+    mIndent -= kIndentSize;
+    WriteWithIndent("}");
+    return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
+CHIP_ERROR JsonStreamWriter::WriteMember(const JsonElementName & name, const TLV::TLVReader & reader, bool hasNext)
 {
-    JsonObjectElementContext context(reader);
+    WriteIndent();
+    mOutput.Append('"');
+    mOutput.Append(name.str);
+    mOutput.Append("\" : ");
+    ReturnErrorOnFailure(WriteValue(reader));
+    if (hasNext)
+    {
+        mOutput.Append(',');
+    }
+    return CHIP_NO_ERROR;
+}
 
-    switch (reader.GetType())
+CHIP_ERROR JsonStreamWriter::WriteArray(const TLV::TLVReader & reader)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TLV::TLVReader element;
+    TLV::TLVType containerType;
+    size_t count = 0;
+
+    // Decide the layout of the array: arrays containing non-empty structures, of 25 elements or more, or which would not
+    // fit within the right margin span multiple lines. Only the first elements need to be looked at.
+    JsonOutput measure;
+    JsonStreamWriter measuringWriter(measure);
+    bool multiLine = false;
+
+    element.Init(reader);
+    ReturnErrorOnFailure(element.EnterContainer(containerType));
+    while (!multiLine && (err = element.Next()) == CHIP_NO_ERROR)
     {
-    case TLV::kTLVType_UnsignedInteger: {
-        uint64_t v;
-        ReturnErrorOnFailure(reader.Get(v));
-        if (CanCastTo<uint32_t>(v))
+        count++;
+        if (count * 3 >= kRightMargin)
         {
-            InsertJsonElement(jsonObj, context, v);
+            multiLine = true;
+            break;
         }
-        else
+        if (element.GetType() == TLV::kTLVType_Structure)
         {
-            InsertJsonElement(jsonObj, context, std::to_string(v));
+            TLV::TLVReader member;
+            TLV::TLVType structType;
+            member.Init(element);
+            ReturnErrorOnFailure(member.EnterContainer(structType));
+            CHIP_ERROR memberErr = member.Next();
+            VerifyOrReturnError(memberErr == CHIP_NO_ERROR || memberErr == CHIP_END_OF_TLV, memberErr);
+            if (memberErr == CHIP_NO_ERROR)
+            {
+                multiLine = true;
+                break;
+            }
         }
-        break;
+        ReturnErrorOnFailure(measuringWriter.WriteValue(element));
+        // '[ ' and ' ]' around the elements, separated by ', '.
+        multiLine = (4 + (count - 1) * 2 + measure.Length() >= kRightMargin);
     }
+    VerifyOrReturnError(multiLine || err == CHIP_END_OF_TLV, err);
 
-    case TLV::kTLVType_SignedInteger: {
-        int64_t v;
-        ReturnErrorOnFailure(reader.Get(v));
-        if (CanCastTo<int32_t>(v))
+    if (count == 0)
+    {
+        mOutput.Append("[]");
+        return CHIP_NO_ERROR;
+    }
+
+    if (multiLine)
+    {
+        WriteWithIndent("[");
+        mIndent += kIndentSize;
+    }
+    else
+    {
+        mOutput.Append("[ ");
+    }
+
+    element.Init(reader);
+    ReturnErrorOnFailure(element.EnterContainer(containerType));
+    for (size_t i = 0; (err = element.Next()) == CHIP_NO_ERROR; i++)
+    {
+        if (i > 0)
         {
-            InsertJsonElement(jsonObj, context, v);
+            mOutput.Append(multiLine ? "," : ", ");
         }
-        else
+        if (multiLine)
         {
-            InsertJsonElement(jsonObj, context, std::to_string(v));
+            WriteIndent();
         }
+        ReturnErrorOnFailure(WriteValue(element));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    if (multiLine)
+    {
+        mIndent -= kIndentSize;
+        WriteWithIndent("]");
+    }
+    else
+    {
+        mOutput.Append(" ]");
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JsonStreamWriter::WriteValue(const TLV::TLVReader & reader)
+{
+    char number[32];
+    switch (reader.GetType())
+    {
+    case TLV::kTLVType_UnsignedInteger: {
+        uint64_t v;
+        ReturnErrorOnFailure(reader.Get(v));
+        snprintf(number, sizeof(number), CanCastTo<uint32_t>(v) ? "%" PRIu64 : "\"%" PRIu64 "\"", v);
+        mOutput.Append(number);
+        break;
+    }
+
+    case TLV::kTLVType_SignedInteger: {
+        int64_t v;
+        ReturnErrorOnFailure(reader.Get(v));
+        snprintf(number, sizeof(number), CanCastTo<int32_t>(v) ? "%" PRId64 : "\"%" PRId64 "\"", v);
+        mOutput.Append(number);
         break;
     }
 
     case TLV::kTLVType_Boolean: {
         bool v;
         ReturnErrorOnFailure(reader.Get(v));
-        InsertJsonElement(jsonObj, context, v);
+        mOutput.Append(v ? "true" : "false");
         break;
     }
 
@@ -230,15 +577,15 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         ReturnErrorOnFailure(reader.Get(v));
         if (v == std::numeric_limits<double>::infinity())
         {
-            InsertJsonElement(jsonObj, context, kFloatingPointPositiveInfinity);
+            WriteQuotedString(CharSpan::fromCharString(kFloatingPointPositiveInfinity));
         }
         else if (v == -std::numeric_limits<double>::infinity())
         {
-            InsertJsonElement(jsonObj, context, kFloatingPointNegativeInfinity);
+            WriteQuotedString(CharSpan::fromCharString(kFloatingPointNegativeInfinity));
         }
         else
         {
-            InsertJsonElement(jsonObj, context, v);
+            WriteDouble(v);
         }
         break;
     }
@@ -246,86 +593,191 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
     case TLV::kTLVType_ByteString: {
         ByteSpan span;
         ReturnErrorOnFailure(reader.Get(span));
-
-        Platform::ScopedMemoryBuffer<char> byteString;
-        byteString.Alloc(BASE64_ENCODED_LEN(span.size()) + 1);
-        VerifyOrReturnError(byteString.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-
-        auto encodedLen              = Base64Encode(span.data(), static_cast<uint16_t>(span.size()), byteString.Get());
-        byteString.Get()[encodedLen] = '\0';
-
-        InsertJsonElement(jsonObj, context, byteString.Get());
+        WriteBase64(span);
         break;
     }
 
     case TLV::kTLVType_UTF8String: {
         CharSpan span;
         ReturnErrorOnFailure(reader.Get(span));
-
-        std::string str(span.data(), span.size());
-        InsertJsonElement(jsonObj, context, str);
+        WriteQuotedString(span);
         break;
     }
 
     case TLV::kTLVType_Null: {
-        InsertJsonElement(jsonObj, context, Json::Value());
+        mOutput.Append("null");
         break;
     }
 
     case TLV::kTLVType_Structure: {
-        Json::Value jsonStruct(Json::objectValue);
-        ReturnErrorOnFailure(TlvStructToJson(reader, jsonStruct));
-        InsertJsonElement(jsonObj, context, jsonStruct);
+        ReturnErrorOnFailure(WriteStruct(reader));
         break;
     }
 
     case TLV::kTLVType_Array: {
-        CHIP_ERROR err;
-        Json::Value jsonArray(Json::arrayValue);
-        ElementTypeContext prevSubType;
-        ElementTypeContext nextSubType;
-        TLV::TLVType containerType;
+        ReturnErrorOnFailure(WriteArray(reader));
+        break;
+    }
+
+    default:
+        return CHIP_ERROR_INVALID_TLV_ELEMENT;
+        break;
+    }
+
+    return CHIP_NO_ERROR;
+}
 
-        ReturnErrorOnFailure(reader.EnterContainer(containerType));
+void JsonStreamWriter::WriteDouble(double value)
+{
+    // As JsonCpp does: 17 significant digits, marked as a real number when they look like an integer.
+    VerifyOrReturn(!std::isnan(value), mOutput.Append("null"));
+
+    char number[40];
+    int len = snprintf(number, sizeof(number), "%.17g", value);
+    VerifyOrReturn(len > 0 && static_cast<size_t>(len) < sizeof(number));
+    std::replace(number, number + len, ',', '.');
+    mOutput.Append(number, static_cast<size_t>(len));
+    if (strchr(number, '.') == nullptr && strchr(number, 'e') == nullptr)
+    {
+        mOutput.Append(".0");
+    }
+}
 
-        while ((err = reader.Next()) == CHIP_NO_ERROR)
+void JsonStreamWriter::WriteQuotedString(CharSpan str)
+{
+    // Escapes the same characters as JsonCpp: quotes, backslashes, control characters, and all non-ASCII characters,
+    // which become \u escapes of their UTF-16 code units (invalid UTF-8 sequences become U+FFFD).
+    auto writeCodeUnit = [this](uint32_t unit) {
+        char escape[7];
+        snprintf(escape, sizeof(escape), "\\u%04" PRIx32, unit);
+        mOutput.Append(escape, 6);
+    };
+
+    mOutput.Append('"');
+    const char * end   = str.data() + str.size();
+    const char * plain = str.data();
+    for (const char * c = str.data(); c < end; c++)
+    {
+        uint8_t byte = static_cast<uint8_t>(*c);
+        if (byte >= 0x20 && byte < 0x80 && byte != '"' && byte != '\\')
         {
-            VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
-            VerifyOrReturnError(reader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+            continue;
+        }
 
-            nextSubType.tlvType = reader.GetType();
-            if (nextSubType.tlvType == TLV::kTLVType_FloatingPointNumber)
+        mOutput.Append(plain, static_cast<size_t>(c - plain));
+        switch (byte)
+        {
+        case '"':
+            mOutput.Append("\\\"");
+            break;
+        case '\\':
+            mOutput.Append("\\\\");
+            break;
+        case '\b':
+            mOutput.Append("\\b");
+            break;
+        case '\f':
+            mOutput.Append("\\f");
+            break;
+        case '\n':
+            mOutput.Append("\\n");
+            break;
+        case '\r':
+            mOutput.Append("\\r");
+            break;
+        case '\t':
+            mOutput.Append("\\t");
+            break;
+        default: {
+            constexpr uint32_t kReplacementCharacter = 0xFFFD;
+            uint32_t codePoint                       = kReplacementCharacter;
+            size_t remaining                         = static_cast<size_t>(end - c);
+            auto continuation = [c](size_t i) { return static_cast<uint32_t>(static_cast<uint8_t>(c[i]) & 0x3F); };
+            if (byte < 0x80)
+            {
+                codePoint = byte;
+            }
+            else if (byte < 0xE0)
+            {
+                if (remaining >= 2)
+                {
+                    codePoint = ((byte & 0x1Fu) << 6) | continuation(1);
+                    codePoint = (codePoint < 0x80) ? kReplacementCharacter : codePoint;
+                    c += 1;
+                }
+            }
+            else if (byte < 0xF0)
             {
-                nextSubType.isDouble = reader.IsElementDouble();
+                if (remaining >= 3)
+                {
+                    codePoint = ((byte & 0x0Fu) << 12) | (continuation(1) << 6) | continuation(2);
+                    codePoint = (codePoint < 0x800 || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) ? kReplacementCharacter : codePoint;
+                    c += 2;
+                }
+            }
+            else if (byte < 0xF8)
+            {
+                if (remaining >= 4)
+                {
+                    codePoint = ((byte & 0x07u) << 18) | (continuation(1) << 12) | (continuation(2) << 6) | continuation(3);
+                    codePoint = (codePoint < 0x10000) ? kReplacementCharacter : codePoint;
+                    c += 3;
+                }
             }
 
-            if (jsonArray.empty())
+            if (codePoint < 0x10000)
             {
-                prevSubType = nextSubType;
+                writeCodeUnit(codePoint);
             }
             else
             {
-                VerifyOrReturnError(prevSubType.tlvType == nextSubType.tlvType && prevSubType.isDouble == nextSubType.isDouble,
-                                    CHIP_ERROR_INVALID_TLV_ELEMENT);
+                codePoint -= 0x10000;
+                writeCodeUnit(0xD800 + ((codePoint >> 10) & 0x3FF));
+                writeCodeUnit(0xDC00 + (codePoint & 0x3FF));
             }
-
-            // Recursively convert to JSON the encompassing item within the array.
-            ReturnErrorOnFailure(TlvToJson(reader, jsonArray));
+            break;
         }
+        }
+        plain = c + 1;
+    }
+    mOutput.Append(plain, static_cast<size_t>(end - plain));
+    mOutput.Append('"');
+}
 
-        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-        ReturnErrorOnFailure(reader.ExitContainer(containerType));
+void JsonStreamWriter::WriteBase64(ByteSpan bytes)
+{
+    // Encode whole groups of 3 bytes at a time, so that only the last chunk is padded.
+    constexpr size_t kChunkSize = 48;
+    char encoded[BASE64_ENCODED_LEN(kChunkSize)];
 
-        context.subType = prevSubType;
-        InsertJsonElement(jsonObj, context, jsonArray);
-        break;
+    mOutput.Append('"');
+    while (!bytes.empty())
+    {
+        size_t chunkSize = std::min(bytes.size(), kChunkSize);
+        uint16_t len     = Base64Encode(bytes.data(), static_cast<uint16_t>(chunkSize), encoded);
+        mOutput.Append(encoded, len);
+        bytes = bytes.SubSpan(chunkSize);
     }
+    mOutput.Append('"');
+}
 
-    default:
-        return CHIP_ERROR_INVALID_TLV_ELEMENT;
-        break;
-    }
+CHIP_ERROR TlvToJson(TLV::TLVReader & reader, JsonOutput & output)
+{
+    // The top level element must be a TLV Structure of Anonymous type.
+    VerifyOrReturnError(reader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+    VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+
+    // During json conversion, a implicit profile ID is required
+    ImplicitProfileIdChange implicitProfileIdChange(reader, kTemporaryImplicitProfileId);
 
+    // Check the whole structure first, which leaves the reader after it, so that no JSON text is written for invalid data.
+    TLV::TLVReader structure;
+    structure.Init(reader);
+    ReturnErrorOnFailure(ValidateStruct(reader));
+
+    JsonStreamWriter writer(output);
+    ReturnErrorOnFailure(writer.WriteStruct(structure));
+    output.Append('\n');
     return CHIP_NO_ERROR;
 }
 
@@ -343,18 +795,20 @@ CHIP_ERROR TlvToJson(const ByteSpan & tlv, std::string & jsonString)
 
 CHIP_ERROR TlvToJson(TLV::TLVReader & reader, std::string & jsonString)
 {
-    // The top level element must be a TLV Structure of Anonymous type.
-    VerifyOrReturnError(reader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
-    VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
-
-    // During json conversion, a implicit profile ID is required
-    ImplicitProfileIdChange implicitProfileIdChange(reader, kTemporaryImplicitProfileId);
-
-    Json::Value jsonObject(Json::objectValue);
-    ReturnErrorOnFailure(TlvStructToJson(reader, jsonObject));
+    std::string json;
+    JsonOutput output(json);
+    ReturnErrorOnFailure(TlvToJson(reader, output));
+    jsonString = std::move(json);
+    return CHIP_NO_ERROR;
+}
 
-    Json::StyledWriter writer;
-    jsonString = writer.write(jsonObject);
+CHIP_ERROR TlvToJson(TLV::TLVReader & reader, MutableCharSpan & json)
+{
+    JsonOutput output(json);
+    ReturnErrorOnFailure(TlvToJson(reader, output));
+    VerifyOrReturnError(output.Length() <= json.size(), CHIP_ERROR_BUFFER_TOO_SMALL);
+    json.reduce_size(output.Length());
     return CHIP_NO_ERROR;
 }
+
 } // namespace chip
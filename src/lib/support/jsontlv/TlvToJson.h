@@ -33,4 +33,11 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, std::string & jsonString);
  * Given a TLV encoded byte array, this function converts it into JSON object.
  */
 CHIP_ERROR TlvToJson(const ByteSpan & tlv, std::string & jsonString);
+
+/*
+ * Same as TlvToJson(TLVReader &, std::string &), but writes the JSON text directly into the provided buffer as the TLV
+ * data is read. The size of json will be adjusted to the length of the JSON text, which is not null-terminated.
+ * Returns CHIP_ERROR_BUFFER_TOO_SMALL if the JSON text does not fit in the buffer.
+ */
+CHIP_ERROR TlvToJson(TLV::TLVReader & reader, MutableCharSpan & json);
 } // namespace chip
@@ -0,0 +1,272 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/tests/JsonTlvDifferential.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <json/json.h>
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLVReader.h>
+#include <lib/support/Base64.h>
+#include <lib/support/jsontlv/JsonToTlv.h>
+#include <lib/support/jsontlv/TlvToJson.h>
+
+namespace chip {
+namespace Testing {
+
+namespace {
+
+constexpr size_t kMaxTlvSize = 4096;
+
+// The implicit profile id TlvToJson() uses when given the TLV as a span.
+constexpr uint32_t kImplicitProfileId = 0xFF01;
+
+CHIP_ERROR ConvertJsonToTlv(const std::string & json, std::vector<uint8_t> & tlv)
+{
+    tlv.resize(kMaxTlvSize);
+    MutableByteSpan span(tlv.data(), tlv.size());
+    CHIP_ERROR err = JsonToTlv(json, span);
+    tlv.resize(err == CHIP_NO_ERROR ? span.size() : 0);
+    return err;
+}
+
+// Returns the tag number in the name of a member, which is "tag:TYPE" or "name:tag:TYPE".
+bool TagNumberFromMemberName(const std::string & name, uint64_t & tagNumber)
+{
+    size_t typeSeparator = name.rfind(':');
+    VerifyOrReturnValue(typeSeparator != std::string::npos && typeSeparator > 0, false);
+    size_t tagSeparator = name.rfind(':', typeSeparator - 1);
+    size_t tagStart     = (tagSeparator == std::string::npos) ? 0 : tagSeparator + 1;
+    std::string tag     = name.substr(tagStart, typeSeparator - tagStart);
+    VerifyOrReturnValue(!tag.empty() && tag.find_first_not_of("0123456789") == std::string::npos, false);
+    tagNumber = strtoull(tag.c_str(), nullptr, 10);
+    return true;
+}
+
+uint64_t TagNumberFromTlvTag(TLV::Tag tag)
+{
+    if (TLV::IsContextTag(tag))
+    {
+        return TLV::TagNumFromTag(tag);
+    }
+    return (static_cast<uint64_t>(TLV::VendorIdFromTag(tag)) << 16) | TLV::TagNumFromTag(tag);
+}
+
+template <typename T>
+bool ParseIntegerString(const Json::Value & value, T & out)
+{
+    VerifyOrReturnValue(value.isString(), false);
+    std::string str = value.asString();
+    char * end      = nullptr;
+    errno           = 0;
+    if (std::is_signed<T>::value)
+    {
+        out = static_cast<T>(strtoll(str.c_str(), &end, 10));
+    }
+    else
+    {
+        out = static_cast<T>(strtoull(str.c_str(), &end, 10));
+    }
+    return errno == 0 && !str.empty() && *end == '\0';
+}
+
+bool FloatingPointMatches(const Json::Value & value, double tlvValue)
+{
+    if (value.isString())
+    {
+        return (value.asString() == "Infinity" && tlvValue == std::numeric_limits<double>::infinity()) ||
+            (value.asString() == "-Infinity" && tlvValue == -std::numeric_limits<double>::infinity());
+    }
+    return value.isNumeric() && value.asDouble() == tlvValue;
+}
+
+// Checks that the element the reader is on holds the values Json::Reader read into `value`. JsonToTlv() encodes the
+// whole of a string, while TlvToJson() only writes the text before the separator of a localized string identifier,
+// so `wholeStrings` selects the part of the strings the JSON values hold.
+bool ElementMatchesDocument(TLV::TLVReader & reader, const Json::Value & value, bool wholeStrings)
+{
+    switch (reader.GetType())
+    {
+    case TLV::kTLVType_SignedInteger: {
+        int64_t tlvValue;
+        int64_t jsonValue;
+        VerifyOrReturnValue(reader.Get(tlvValue) == CHIP_NO_ERROR, false);
+        if (!ParseIntegerString(value, jsonValue))
+        {
+            VerifyOrReturnValue(value.isInt64(), false);
+            jsonValue = value.asInt64();
+        }
+        return tlvValue == jsonValue;
+    }
+    case TLV::kTLVType_UnsignedInteger: {
+        uint64_t tlvValue;
+        uint64_t jsonValue;
+        VerifyOrReturnValue(reader.Get(tlvValue) == CHIP_NO_ERROR, false);
+        if (!ParseIntegerString(value, jsonValue))
+        {
+            VerifyOrReturnValue(value.isUInt64(), false);
+            jsonValue = value.asUInt64();
+        }
+        return tlvValue == jsonValue;
+    }
+    case TLV::kTLVType_Boolean: {
+        bool tlvValue;
+        VerifyOrReturnValue(reader.Get(tlvValue) == CHIP_NO_ERROR, false);
+        return value.isBool() && value.asBool() == tlvValue;
+    }
+    case TLV::kTLVType_FloatingPointNumber: {
+        float floatValue;
+        double tlvValue;
+        VerifyOrReturnValue(reader.Get(tlvValue) == CHIP_NO_ERROR, false);
+        if (reader.Get(floatValue) == CHIP_NO_ERROR && value.isNumeric())
+        {
+            return static_cast<float>(value.asDouble()) == floatValue;
+        }
+        return FloatingPointMatches(value, tlvValue);
+    }
+    case TLV::kTLVType_UTF8String: {
+        const uint8_t * data;
+        CharSpan tlvValue;
+        VerifyOrReturnValue(reader.GetDataPtr(data) == CHIP_NO_ERROR && reader.Get(tlvValue) == CHIP_NO_ERROR, false);
+        if (wholeStrings)
+        {
+            tlvValue = CharSpan(reinterpret_cast<const char *>(data), reader.GetLength());
+        }
+        return value.isString() && value.asString() == std::string(tlvValue.data(), tlvValue.size());
+    }
+    case TLV::kTLVType_ByteString: {
+        ByteSpan tlvValue;
+        VerifyOrReturnValue(reader.Get(tlvValue) == CHIP_NO_ERROR && value.isString(), false);
+        std::string encoded = value.asString();
+        std::vector<uint8_t> decoded(BASE64_MAX_DECODED_LEN(encoded.size()) + 1);
+        uint32_t length = Base64Decode32(encoded.data(), static_cast<uint32_t>(encoded.size()), decoded.data());
+        return length != UINT32_MAX && tlvValue.data_equal(ByteSpan(decoded.data(), length));
+    }
+    case TLV::kTLVType_Null:
+        return value.isNull();
+    case TLV::kTLVType_Structure:
+    case TLV::kTLVType_Array: {
+        const bool isStructure = (reader.GetType() == TLV::kTLVType_Structure);
+        VerifyOrReturnValue(isStructure ? value.isObject() : value.isArray(), false);
+        TLV::TLVType container;
+        VerifyOrReturnValue(reader.EnterContainer(container) == CHIP_NO_ERROR, false);
+        Json::ArrayIndex count = 0;
+        CHIP_ERROR err;
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            const Json::Value * element = nullptr;
+            if (isStructure)
+            {
+                uint64_t tagNumber = TagNumberFromTlvTag(reader.GetTag());
+                for (const auto & name : value.getMemberNames())
+                {
+                    uint64_t memberTagNumber;
+                    if (TagNumberFromMemberName(name, memberTagNumber) && memberTagNumber == tagNumber)
+                    {
+                        element = &value[name];
+                    }
+                }
+            }
+            else if (count < value.size())
+            {
+                element = &value[count];
+            }
+            VerifyOrReturnValue(element != nullptr && ElementMatchesDocument(reader, *element, wholeStrings), false);
+            count++;
+        }
+        VerifyOrReturnValue(err == CHIP_END_OF_TLV && count == value.size(), false);
+        return reader.ExitContainer(container) == CHIP_NO_ERROR;
+    }
+    default:
+        return false;
+    }
+}
+
+// Checks that the TLV element in `tlv` holds the values Json::Reader read into `document`.
+bool TlvMatchesDocument(const ByteSpan & tlv, const Json::Value & document, bool wholeStrings)
+{
+    TLV::TLVReader reader;
+    reader.Init(tlv);
+    reader.ImplicitProfileId = kImplicitProfileId;
+    VerifyOrReturnValue(reader.Next() == CHIP_NO_ERROR, false);
+    return ElementMatchesDocument(reader, document, wholeStrings);
+}
+
+} // namespace
+
+void ExpectJsonToTlvMatchesJsonCpp(const std::string & json)
+{
+    Json::Reader reader;
+    Json::Value document;
+    const bool accepted = reader.parse(json, document);
+
+    std::vector<uint8_t> tlv;
+    CHIP_ERROR err = ConvertJsonToTlv(json, tlv);
+    if (!accepted)
+    {
+        EXPECT_NE(err, CHIP_NO_ERROR) << "Json::Reader rejects: " << json.c_str();
+        return;
+    }
+
+    // Json::Reader has already decoded the escapes and numbers of the text, so converting the text JsonCpp writes for its
+    // document checks the values the parser decoded. Json::StyledWriter would replace strings that are not valid UTF-8,
+    // such as an unpaired low surrogate, so the bytes of strings are written as they are.
+    Json::StreamWriterBuilder builder;
+    builder["emitUTF8"]   = true;
+    std::string reference = Json::writeString(builder, document);
+    std::vector<uint8_t> referenceTlv;
+    EXPECT_EQ(err, ConvertJsonToTlv(reference, referenceTlv)) << "Json::Reader accepts: " << json.c_str();
+    EXPECT_EQ(tlv, referenceTlv) << "Json::Reader reads: " << reference.c_str();
+    if (err == CHIP_NO_ERROR)
+    {
+        EXPECT_TRUE(TlvMatchesDocument(ByteSpan(tlv.data(), tlv.size()), document, /* wholeStrings = */ true)) << json.c_str();
+    }
+}
+
+void ExpectTlvToJsonMatchesJsonCpp(const ByteSpan & tlv)
+{
+    std::string json;
+    ASSERT_EQ(TlvToJson(tlv, json), CHIP_NO_ERROR);
+
+    Json::Reader reader;
+    Json::Value document;
+    ASSERT_TRUE(reader.parse(json, document)) << json.c_str();
+    EXPECT_EQ(Json::StyledWriter().write(document), json);
+    EXPECT_TRUE(TlvMatchesDocument(tlv, document, /* wholeStrings = */ false)) << json.c_str();
+
+    std::vector<char> buf(json.size());
+    TLV::TLVReader tlvReader;
+    tlvReader.Init(tlv);
+    tlvReader.ImplicitProfileId = kImplicitProfileId;
+    ASSERT_EQ(tlvReader.Next(), CHIP_NO_ERROR);
+    MutableCharSpan text(buf.data(), buf.size());
+    ASSERT_EQ(TlvToJson(tlvReader, text), CHIP_NO_ERROR);
+    EXPECT_EQ(std::string(text.data(), text.size()), json);
+
+    ExpectJsonToTlvMatchesJsonCpp(json);
+}
+
+} // namespace Testing
+} // namespace chip
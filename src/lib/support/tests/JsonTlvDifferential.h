@@ -0,0 +1,47 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <string>
+
+#include <lib/support/Span.h>
+
+namespace chip {
+namespace Testing {
+
+/**
+ * Checks the JSON parser of JsonToTlv() against Json::Reader.
+ *
+ * Text that Json::Reader rejects must be rejected. Text that it accepts must convert to the same TLV, or fail with the
+ * same error, as the text JsonCpp writes for the document Json::Reader read, and the TLV must hold the values of that
+ * document.
+ */
+void ExpectJsonToTlvMatchesJsonCpp(const std::string & json);
+
+/**
+ * Checks the JSON writer of TlvToJson() against Json::StyledWriter.
+ *
+ * The text written for the TLV element in `tlv` must be text Json::Reader accepts, into a document holding the values
+ * of the TLV, which Json::StyledWriter writes back unchanged. Writing the text into a buffer must produce the same text,
+ * and the text must pass ExpectJsonToTlvMatchesJsonCpp().
+ */
+void ExpectTlvToJsonMatchesJsonCpp(const ByteSpan & tlv);
+
+} // namespace Testing
+} // namespace chip
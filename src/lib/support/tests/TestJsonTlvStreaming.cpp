@@ -0,0 +1,642 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <json/json.h>
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/jsontlv/JsonToTlv.h>
+#include <lib/support/jsontlv/TextFormat.h>
+#include <lib/support/jsontlv/TlvToJson.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <lib/support/tests/JsonTlvDifferential.h>
+
+namespace {
+
+using namespace chip;
+
+class TestJsonTlvStreaming : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+// Encodes a structure exercising the layout rules of the JSON text: member ordering, single and multiple line arrays,
+// nested structures and escaped strings. Members are in tag order, as JsonToTlv() encodes them.
+CHIP_ERROR EncodeLayoutSample(TLV::TLVWriter & writer)
+{
+    TLV::TLVType outer;
+    TLV::TLVType container;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer));
+
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(2), static_cast<int64_t>(-7)));
+    ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(3), "quote\" tab\t \xc3\xa9"));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(4), 1.0));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(5), std::numeric_limits<float>::infinity()));
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(6), TLV::kTLVType_Array, container));
+    for (uint64_t i = 1; i <= 3; i++)
+    {
+        ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), i));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(container));
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(7), TLV::kTLVType_Array, container));
+    for (uint64_t i = 0; i < 30; i++)
+    {
+        ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), i));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(container));
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(8), TLV::kTLVType_Array, container));
+    TLV::TLVType element;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, element));
+    ReturnErrorOnFailure(writer.PutBytes(TLV::ContextTag(0), reinterpret_cast<const uint8_t *>("bytes"), 5));
+    ReturnErrorOnFailure(writer.PutNull(TLV::ProfileTag(writer.ImplicitProfileId, 0x1000)));
+    ReturnErrorOnFailure(writer.EndContainer(element));
+    ReturnErrorOnFailure(writer.EndContainer(container));
+
+    ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(9), TLV::kTLVType_Array, container));
+    ReturnErrorOnFailure(writer.EndContainer(container));
+
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(10), static_cast<uint64_t>(1) << 40));
+
+    ReturnErrorOnFailure(writer.EndContainer(outer));
+    return writer.Finalize();
+}
+
+// The layout of the JSON text is the one the JsonCpp StyledWriter produced.
+constexpr char kLayoutSampleJson[] = "{\n"
+                                     "   \"10:UINT\" : \"1099511627776\",\n"
+                                     "   \"2:INT\" : -7,\n"
+                                     "   \"3:STRING\" : \"quote\\\" tab\\t \\u00e9\",\n"
+                                     "   \"4:DOUBLE\" : 1.0,\n"
+                                     "   \"5:FLOAT\" : \"Infinity\",\n"
+                                     "   \"6:ARRAY-UINT\" : [ 1, 2, 3 ],\n"
+                                     "   \"7:ARRAY-UINT\" : [\n"
+                                     "      0,\n"
+                                     "      1,\n"
+                                     "      2,\n"
+                                     "      3,\n"
+                                     "      4,\n"
+                                     "      5,\n"
+                                     "      6,\n"
+                                     "      7,\n"
+                                     "      8,\n"
+                                     "      9,\n"
+                                     "      10,\n"
+                                     "      11,\n"
+                                     "      12,\n"
+                                     "      13,\n"
+                                     "      14,\n"
+                                     "      15,\n"
+                                     "      16,\n"
+                                     "      17,\n"
+                                     "      18,\n"
+                                     "      19,\n"
+                                     "      20,\n"
+                                     "      21,\n"
+                                     "      22,\n"
+                                     "      23,\n"
+                                     "      24,\n"
+                                     "      25,\n"
+                                     "      26,\n"
+                                     "      27,\n"
+                                     "      28,\n"
+                                     "      29\n"
+                                     "   ],\n"
+                                     "   \"8:ARRAY-STRUCT\" : [\n"
+                                     "      {\n"
+                                     "         \"0:BYTES\" : \"Ynl0ZXM=\",\n"
+                                     "         \"4096:NULL\" : null\n"
+                                     "      }\n"
+                                     "   ],\n"
+                                     "   \"9:ARRAY-?\" : []\n"
+                                     "}\n";
+
+TEST_F(TestJsonTlvStreaming, TestExactLayout)
+{
+    uint8_t buf[256];
+    TLV::TLVWriter writer;
+    writer.Init(buf);
+    writer.ImplicitProfileId = 0xFF01;
+    ASSERT_EQ(EncodeLayoutSample(writer), CHIP_NO_ERROR);
+    ByteSpan tlv(buf, writer.GetLengthWritten());
+
+    std::string json;
+    ASSERT_EQ(TlvToJson(tlv, json), CHIP_NO_ERROR);
+    EXPECT_EQ(json, kLayoutSampleJson);
+
+    // Pretty printing through a JsonCpp document does not change the text.
+    EXPECT_EQ(PrettyPrintJsonString(json), json);
+
+    // And the text converts back to the same TLV.
+    uint8_t roundTrip[256];
+    MutableByteSpan roundTripSpan(roundTrip);
+    ASSERT_EQ(JsonToTlv(json, roundTripSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(roundTripSpan.data_equal(tlv));
+}
+
+TEST_F(TestJsonTlvStreaming, TestConvertIntoBuffer)
+{
+    uint8_t buf[256];
+    TLV::TLVWriter writer;
+    writer.Init(buf);
+    writer.ImplicitProfileId = 0xFF01;
+    ASSERT_EQ(EncodeLayoutSample(writer), CHIP_NO_ERROR);
+    const size_t jsonLength = sizeof(kLayoutSampleJson) - 1;
+
+    char jsonBuf[sizeof(kLayoutSampleJson) + 16];
+    TLV::TLVReader reader;
+
+    // The text is written directly into the buffer, and the reader is left after the structure.
+    reader.Init(buf, writer.GetLengthWritten());
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    MutableCharSpan json(jsonBuf);
+    ASSERT_EQ(TlvToJson(reader, json), CHIP_NO_ERROR);
+    EXPECT_TRUE(json.data_equal(CharSpan(kLayoutSampleJson, jsonLength)));
+    EXPECT_EQ(reader.Next(), CHIP_END_OF_TLV);
+
+    // A buffer of the exact size is enough, as the text is not null-terminated.
+    reader.Init(buf, writer.GetLengthWritten());
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    MutableCharSpan exact(jsonBuf, jsonLength);
+    EXPECT_EQ(TlvToJson(reader, exact), CHIP_NO_ERROR);
+    EXPECT_EQ(exact.size(), jsonLength);
+
+    reader.Init(buf, writer.GetLengthWritten());
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    MutableCharSpan tooSmall(jsonBuf, jsonLength - 1);
+    EXPECT_EQ(TlvToJson(reader, tooSmall), CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+TEST_F(TestJsonTlvStreaming, TestInvalidTlvWritesNothing)
+{
+    uint8_t buf[64];
+    TLV::TLVWriter writer;
+    TLV::TLVType outer;
+    TLV::TLVType container;
+    writer.Init(buf);
+    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(TLV::ContextTag(0), true), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_Array, container), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(TLV::AnonymousTag(), static_cast<uint8_t>(1)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Put(TLV::AnonymousTag(), static_cast<int8_t>(1)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(container), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(outer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    // Elements of different types in an array are rejected before any text is written.
+    TLV::TLVReader reader;
+    reader.Init(buf, writer.GetLengthWritten());
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    char jsonBuf[64] = {};
+    MutableCharSpan json(jsonBuf);
+    EXPECT_EQ(TlvToJson(reader, json), CHIP_ERROR_INVALID_TLV_ELEMENT);
+    EXPECT_EQ(jsonBuf[0], '\0');
+}
+
+TEST_F(TestJsonTlvStreaming, TestJsonSpanToTlv)
+{
+    // The JSON text does not need to be null-terminated, nor held in a std::string.
+    const char text[] = "{\"1:UINT\" : 7, \"2:STRING\" : \"a\\u00e9\", \"0:ARRAY-BOOL\" : [true, false]}trailing";
+    CharSpan json(text, sizeof(text) - 1 - strlen("trailing"));
+
+    uint8_t buf[64];
+    TLV::TLVWriter writer;
+    writer.Init(buf);
+    ASSERT_EQ(JsonToTlv(json, writer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    uint8_t expected[64];
+    MutableByteSpan expectedSpan(expected);
+    ASSERT_EQ(JsonToTlv(std::string(json.data(), json.size()), expectedSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(ByteSpan(buf, writer.GetLengthWritten()).data_equal(expectedSpan));
+
+    // Members are encoded in tag order.
+    TLV::TLVReader reader;
+    TLV::TLVType container;
+    reader.Init(buf, writer.GetLengthWritten());
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    ASSERT_EQ(reader.EnterContainer(container), CHIP_NO_ERROR);
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.GetTag(), TLV::ContextTag(0));
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.GetTag(), TLV::ContextTag(1));
+    ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.GetTag(), TLV::ContextTag(2));
+    CharSpan str;
+    ASSERT_EQ(reader.Get(str), CHIP_NO_ERROR);
+    EXPECT_TRUE(str.data_equal(CharSpan::fromCharString("a\xc3\xa9")));
+
+    // Invalid JSON is rejected before anything is encoded.
+    writer.Init(buf);
+    EXPECT_EQ(JsonToTlv(CharSpan::fromCharString("{\"1:UINT\" : 7, \"2:UINT\" : }"), writer), CHIP_ERROR_INTERNAL);
+    EXPECT_EQ(writer.GetLengthWritten(), 0u);
+}
+
+// Wraps each member of `members` in a top-level structure, in the layout of the JSON text.
+std::string JsonStructure(std::initializer_list<const char *> members)
+{
+    std::string json = "{";
+    for (const char * member : members)
+    {
+        json += (json.size() > 1) ? ", " : " ";
+        json += member;
+    }
+    return json + " }";
+}
+
+TEST_F(TestJsonTlvStreaming, TestDifferentialEscapes)
+{
+    static const char * const kStrings[] = {
+        R"("1:STRING" : "\u0001\u001f\u007f \" \\ \/ \b \f \n \r \t")",
+        R"("1:STRING" : "é € 😀")",
+        "\"1:STRING\" : \"\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80\"",
+        R"("1:STRING" : "\ud83d")",
+        R"("1:STRING" : "\ud83dA")",
+        R"("1:STRING" : "\ude00")",
+        R"("1:STRING" : "\x41")",
+        R"("1:STRING" : "\u12")",
+        "\"1:STRING\" : \"tab\tnewline\n\"",
+        R"("1:BYTES" : "AAECAwQ=")",
+        R"("1:BYTES" : "AAEC\/wQ=")",
+        R"("1:\u0053TRING" : "escaped name")",
+        R"("name\u003a1:STRING" : "escaped separator")",
+    };
+    for (const char * member : kStrings)
+    {
+        Testing::ExpectJsonToTlvMatchesJsonCpp(JsonStructure({ member }));
+    }
+
+    uint8_t buf[256];
+    TLV::TLVWriter writer;
+    TLV::TLVType outer;
+    writer.Init(buf);
+    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.PutString(TLV::ContextTag(0), "\x01\x1e\x7f \" \\ / \b \f \n \r \t"), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.PutString(TLV::ContextTag(1), "\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80"), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.PutString(TLV::ContextTag(2), CharSpan("nul\0inside", 10)), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.PutBytes(TLV::ContextTag(3), reinterpret_cast<const uint8_t *>("\x00\xff\xfe"), 3), CHIP_NO_ERROR);
+    // Only the text before the separator of a localized string identifier is written.
+    ASSERT_EQ(writer.PutString(TLV::ContextTag(4), "localized\x1f" "0001"), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(outer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    Testing::ExpectTlvToJsonMatchesJsonCpp(ByteSpan(buf, writer.GetLengthWritten()));
+}
+
+TEST_F(TestJsonTlvStreaming, TestDifferentialIntegers)
+{
+    static const char * const kIntegers[] = {
+        R"("1:INT" : -9223372036854775808)",
+        R"("1:INT" : "-9223372036854775808")",
+        R"("1:INT" : 9223372036854775807)",
+        R"("1:INT" : "9223372036854775807")",
+        R"("1:INT" : -9223372036854775809)",
+        R"("1:INT" : 9223372036854775808)",
+        R"("1:INT" : -1)",
+        R"("1:INT" : -0)",
+        R"("1:INT" : 1.5)",
+        R"("1:INT" : 1e3)",
+        R"("1:UINT" : 18446744073709551615)",
+        R"("1:UINT" : "18446744073709551615")",
+        R"("1:UINT" : 18446744073709551616)",
+        R"("1:UINT" : "18446744073709551616")",
+        R"("1:UINT" : 9007199254740993)",
+        R"("1:UINT" : -1)",
+        R"("1:UINT" : "-1")",
+        R"("1:UINT" : 01)",
+        R"("1:UINT" : +1)",
+        R"("1:UINT" : 0x10)",
+        R"("4294967296:INT" : 1)",
+        R"("1:ARRAY-INT" : [ -9223372036854775808, -1, 0, "9223372036854775807" ])",
+        R"("1:ARRAY-UINT" : [ 0, 4294967296, "18446744073709551615" ])",
+    };
+    for (const char * member : kIntegers)
+    {
+        Testing::ExpectJsonToTlvMatchesJsonCpp(JsonStructure({ member }));
+    }
+
+    static const int64_t kSigned[] = {
+        std::numeric_limits<int64_t>::min(),
+        std::numeric_limits<int32_t>::min() - INT64_C(1),
+        -1,
+        0,
+        std::numeric_limits<int32_t>::max() + INT64_C(1),
+        (INT64_C(1) << 53) + 1,
+        std::numeric_limits<int64_t>::max(),
+    };
+
+    static const uint64_t kUnsigned[] = {
+        0,
+        std::numeric_limits<uint32_t>::max() + UINT64_C(1),
+        (UINT64_C(1) << 53) + 1,
+        std::numeric_limits<uint64_t>::max(),
+    };
+
+    uint8_t buf[512];
+    TLV::TLVWriter writer;
+    TLV::TLVType outer;
+    TLV::TLVType container;
+    writer.Init(buf);
+    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer), CHIP_NO_ERROR);
+    uint8_t tag = 0;
+    for (int64_t value : kSigned)
+    {
+        ASSERT_EQ(writer.Put(TLV::ContextTag(tag++), value), CHIP_NO_ERROR);
+    }
+    for (uint64_t value : kUnsigned)
+    {
+        ASSERT_EQ(writer.Put(TLV::ContextTag(tag++), value), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(writer.StartContainer(TLV::ContextTag(tag++), TLV::kTLVType_Array, container), CHIP_NO_ERROR);
+    for (int64_t value : kSigned)
+    {
+        ASSERT_EQ(writer.Put(TLV::AnonymousTag(), value), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(writer.EndContainer(container), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.StartContainer(TLV::ContextTag(tag++), TLV::kTLVType_Array, container), CHIP_NO_ERROR);
+    for (uint64_t value : kUnsigned)
+    {
+        ASSERT_EQ(writer.Put(TLV::AnonymousTag(), value), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(writer.EndContainer(container), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(outer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    Testing::ExpectTlvToJsonMatchesJsonCpp(ByteSpan(buf, writer.GetLengthWritten()));
+}
+
+TEST_F(TestJsonTlvStreaming, TestDifferentialFloats)
+{
+    static const char * const kFloats[] = {
+        R"("1:DOUBLE" : 0.1)",
+        R"("1:DOUBLE" : -0.0)",
+        R"("1:DOUBLE" : 1e300)",
+        R"("1:DOUBLE" : 1E-300)",
+        R"("1:DOUBLE" : 5e-324)",
+        R"("1:DOUBLE" : 1.7976931348623157e+308)",
+        R"("1:DOUBLE" : 1e400)",
+        R"("1:DOUBLE" : 18446744073709551616)",
+        R"("1:DOUBLE" : -9223372036854775809)",
+        R"("1:DOUBLE" : 1.)",
+        R"("1:DOUBLE" : .5)",
+        R"("1:DOUBLE" : 1e)",
+        R"("1:DOUBLE" : "Infinity")",
+        R"("1:DOUBLE" : "-Infinity")",
+        R"("1:FLOAT" : 0.1)",
+        R"("1:FLOAT" : 3.4028234663852886e+38)",
+        R"("1:FLOAT" : 1e39)",
+        R"("1:FLOAT" : 1.401298464324817e-45)",
+        R"("1:ARRAY-DOUBLE" : [ 0.5, -2, 1e-7 ])",
+        R"("1:ARRAY-FLOAT" : [ 0.5, -2, 1e-7 ])",
+    };
+    for (const char * member : kFloats)
+    {
+        Testing::ExpectJsonToTlvMatchesJsonCpp(JsonStructure({ member }));
+    }
+
+    static const double kDoubles[] = {
+        0.1, -0.0, 1e300, 5e-324, std::numeric_limits<double>::max(), -std::numeric_limits<double>::min(), 1.0 / 3,
+    };
+
+    static const float kFloatValues[] = {
+        0.1f, -0.0f, std::numeric_limits<float>::max(), std::numeric_limits<float>::denorm_min(), 1.0f / 3, 16777217.0f,
+    };
+
+    uint8_t buf[512];
+    TLV::TLVWriter writer;
+    TLV::TLVType outer;
+    TLV::TLVType container;
+    writer.Init(buf);
+    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer), CHIP_NO_ERROR);
+    uint8_t tag = 0;
+    for (double value : kDoubles)
+    {
+        ASSERT_EQ(writer.Put(TLV::ContextTag(tag++), value), CHIP_NO_ERROR);
+    }
+    for (float value : kFloatValues)
+    {
+        ASSERT_EQ(writer.Put(TLV::ContextTag(tag++), value), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(writer.StartContainer(TLV::ContextTag(tag++), TLV::kTLVType_Array, container), CHIP_NO_ERROR);
+    for (double value : kDoubles)
+    {
+        ASSERT_EQ(writer.Put(TLV::AnonymousTag(), value), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(writer.EndContainer(container), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.StartContainer(TLV::ContextTag(tag++), TLV::kTLVType_Array, container), CHIP_NO_ERROR);
+    for (float value : kFloatValues)
+    {
+        ASSERT_EQ(writer.Put(TLV::AnonymousTag(), value), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(writer.EndContainer(container), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(outer), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    Testing::ExpectTlvToJsonMatchesJsonCpp(ByteSpan(buf, writer.GetLengthWritten()));
+}
+
+TEST_F(TestJsonTlvStreaming, TestDifferentialNesting)
+{
+    constexpr int kDepth = 32;
+
+    // Structures and arrays nested in each other, with a member next to every level.
+    std::string json;
+    for (int i = 0; i < kDepth; i++)
+    {
+        json += (i % 2) ? "{ \"0:INT\" : 1, \"1:ARRAY-STRUCT\" : [ " : "{ \"0:INT\" : 1, \"1:STRUCT\" : ";
+    }
+    json += "{}";
+    for (int i = kDepth - 1; i >= 0; i--)
+    {
+        json += (i % 2) ? " ] }" : " }";
+    }
+    Testing::ExpectJsonToTlvMatchesJsonCpp(json);
+
+    // Arrays of arrays, which are only allowed in lists of structures.
+    Testing::ExpectJsonToTlvMatchesJsonCpp(JsonStructure({ R"("1:ARRAY-ARRAY" : [ [ 1 ] ])" }));
+
+    // Text that is not valid JSON at some depth.
+    Testing::ExpectJsonToTlvMatchesJsonCpp(json.substr(0, json.size() - 1));
+    Testing::ExpectJsonToTlvMatchesJsonCpp(json + "}");
+    Testing::ExpectJsonToTlvMatchesJsonCpp(JsonStructure({ R"("1:STRUCT" : { "0:INT" : 1, })" }) + "}");
+    Testing::ExpectJsonToTlvMatchesJsonCpp(JsonStructure({ R"("1:ARRAY-INT" : [ 1, ])" }));
+    Testing::ExpectJsonToTlvMatchesJsonCpp(JsonStructure({ R"("1:STRUCT" : { /* comment */ "0:INT" : 1 // comment)" }) + "\n}");
+
+    std::vector<uint8_t> buf(4096);
+    TLV::TLVWriter writer;
+    TLV::TLVType containers[kDepth + 1];
+    TLV::TLVType types[kDepth + 1] = { TLV::kTLVType_Structure };
+    writer.Init(buf.data(), buf.size());
+    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containers[0]), CHIP_NO_ERROR);
+    for (int i = 1; i <= kDepth; i++)
+    {
+        TLV::Tag tag = TLV::AnonymousTag();
+        types[i]     = TLV::kTLVType_Structure;
+        if (types[i - 1] == TLV::kTLVType_Structure)
+        {
+            ASSERT_EQ(writer.Put(TLV::ContextTag(0), static_cast<int64_t>(-i)), CHIP_NO_ERROR);
+            ASSERT_EQ(writer.PutString(TLV::ContextTag(1), "\"level\""), CHIP_NO_ERROR);
+            tag      = TLV::ContextTag(2);
+            types[i] = (i % 3) ? TLV::kTLVType_Array : TLV::kTLVType_Structure;
+        }
+        ASSERT_EQ(writer.StartContainer(tag, types[i], containers[i]), CHIP_NO_ERROR);
+    }
+    for (int i = kDepth; i >= 0; i--)
+    {
+        ASSERT_EQ(writer.EndContainer(containers[i]), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    Testing::ExpectTlvToJsonMatchesJsonCpp(ByteSpan(buf.data(), writer.GetLengthWritten()));
+}
+
+// Encodes the attributes of the Descriptor cluster on every endpoint of a bridge, as a wildcard read reports them.
+CHIP_ERROR EncodeDescriptorWildcardReport(TLV::TLVWriter & writer, uint16_t endpointCount)
+{
+    TLV::TLVType outer;
+    TLV::TLVType endpoints;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer));
+    ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_Array, endpoints));
+    for (uint16_t endpoint = 0; endpoint < endpointCount; endpoint++)
+    {
+        TLV::TLVType descriptor;
+        TLV::TLVType list;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, descriptor));
+
+        // DeviceTypeList
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(0), TLV::kTLVType_Array, list));
+        TLV::TLVType deviceType;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, deviceType));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(0), static_cast<uint32_t>(endpoint == 0 ? 0x0016 : 0x0100)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(1), static_cast<uint16_t>(1)));
+        ReturnErrorOnFailure(writer.EndContainer(deviceType));
+        ReturnErrorOnFailure(writer.EndContainer(list));
+
+        // ServerList
+        static constexpr uint32_t kServerClusters[] = { 0x0003, 0x0004, 0x0005, 0x0006, 0x0008, 0x001D, 0x0039, 0x0300 };
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(1), TLV::kTLVType_Array, list));
+        for (uint32_t cluster : kServerClusters)
+        {
+            ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), cluster));
+        }
+        ReturnErrorOnFailure(writer.EndContainer(list));
+
+        // ClientList
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(2), TLV::kTLVType_Array, list));
+        ReturnErrorOnFailure(writer.EndContainer(list));
+
+        // PartsList
+        ReturnErrorOnFailure(writer.StartContainer(TLV::ContextTag(3), TLV::kTLVType_Array, list));
+        if (endpoint == 0)
+        {
+            for (uint16_t part = 1; part < endpointCount; part++)
+            {
+                ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), part));
+            }
+        }
+        ReturnErrorOnFailure(writer.EndContainer(list));
+
+        ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(4), "bridged light"));
+        ReturnErrorOnFailure(writer.EndContainer(descriptor));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(endpoints));
+    ReturnErrorOnFailure(writer.EndContainer(outer));
+    return writer.Finalize();
+}
+
+TEST_F(TestJsonTlvStreaming, BenchmarkDescriptorWildcardReport)
+{
+    constexpr uint16_t kEndpointCount = 64;
+    constexpr int kIterations         = 100;
+    using Clock                       = std::chrono::steady_clock;
+    auto microseconds                 = [](Clock::duration duration) {
+        return static_cast<unsigned>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+    };
+
+    std::vector<uint8_t> tlvBuf(16 * 1024);
+    TLV::TLVWriter writer;
+    writer.Init(tlvBuf.data(), tlvBuf.size());
+    writer.ImplicitProfileId = 0xFF01;
+    ASSERT_EQ(EncodeDescriptorWildcardReport(writer, kEndpointCount), CHIP_NO_ERROR);
+    ByteSpan tlv(tlvBuf.data(), writer.GetLengthWritten());
+
+    std::string json;
+    ASSERT_EQ(TlvToJson(tlv, json), CHIP_NO_ERROR);
+    ASSERT_EQ(PrettyPrintJsonString(json), json);
+    std::vector<char> jsonBuf(json.size());
+    std::vector<uint8_t> roundTripBuf(tlvBuf.size());
+
+    // Converting the report to JSON text, into a std::string and directly into a buffer.
+    auto start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        std::string text;
+        ASSERT_EQ(TlvToJson(tlv, text), CHIP_NO_ERROR);
+    }
+    auto toString = Clock::now() - start;
+
+    start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        TLV::TLVReader reader;
+        reader.Init(tlv);
+        reader.ImplicitProfileId = 0xFF01;
+        ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+        MutableCharSpan text(jsonBuf.data(), jsonBuf.size());
+        ASSERT_EQ(TlvToJson(reader, text), CHIP_NO_ERROR);
+    }
+    auto toBuffer = Clock::now() - start;
+
+    // Converting the JSON text back to TLV.
+    start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        MutableByteSpan roundTrip(roundTripBuf.data(), roundTripBuf.size());
+        ASSERT_EQ(JsonToTlv(json, roundTrip), CHIP_NO_ERROR);
+        ASSERT_TRUE(roundTrip.data_equal(tlv));
+    }
+    auto fromJson = Clock::now() - start;
+
+    // For comparison: the cost of going through a JsonCpp document with the same text, which converting through an
+    // intermediate document adds to either direction.
+    start = Clock::now();
+    for (int i = 0; i < kIterations; i++)
+    {
+        Json::Reader reader;
+        Json::Value document;
+        ASSERT_TRUE(reader.parse(json, document));
+        Json::StyledWriter styledWriter;
+        ASSERT_EQ(styledWriter.write(document).size(), json.size());
+    }
+    auto document = Clock::now() - start;
+
+    ChipLogProgress(Test, "Descriptor report of %u endpoints: %u bytes of TLV, %u bytes of JSON", kEndpointCount,
+                    static_cast<unsigned>(tlv.size()), static_cast<unsigned>(json.size()));
+    ChipLogProgress(Test, "TLV to JSON string %u us, into buffer %u us, JSON to TLV %u us, JsonCpp document %u us (x%d)",
+                    microseconds(toString), microseconds(toBuffer), microseconds(fromJson), microseconds(document), kIterations);
+}
+
+} // namespace
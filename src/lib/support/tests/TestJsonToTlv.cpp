@@ -29,6 +29,7 @@
 #include <lib/support/jsontlv/TextFormat.h>
 #include <lib/support/jsontlv/TlvToJson.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
+#include <lib/support/tests/JsonTlvDifferential.h>
 
 namespace {
 
@@ -110,6 +111,8 @@ void ConvertJsonToTlvAndValidate(T val, const std::string & jsonString)
     EXPECT_EQ(err, CHIP_NO_ERROR);
 
     EXPECT_TRUE(MatchWriter1and2());
+
+    Testing::ExpectJsonToTlvMatchesJsonCpp(jsonString);
 }
 
 TEST_F(TestJsonToTlv, TestConverter)
@@ -27,6 +27,7 @@
 #include <lib/support/jsontlv/JsonToTlv.h>
 #include <lib/support/jsontlv/TextFormat.h>
 #include <lib/support/jsontlv/TlvToJson.h>
+#include <lib/support/tests/JsonTlvDifferential.h>
 
 namespace {
 
@@ -100,6 +101,10 @@ void CheckValidConversion(const std::string & jsonOriginal, const ByteSpan & tlv
         PrintSpan("TLV Encoding Provided as Input for Reference:     ", tlvEncoding);
         PrintSpan("TLV Encoding Generated from Json Expected String: ", tlvEncodingLocal);
     }
+
+    // Both directions also have to agree with JsonCpp.
+    chip::Testing::ExpectJsonToTlvMatchesJsonCpp(jsonOriginal);
+    chip::Testing::ExpectTlvToJsonMatchesJsonCpp(tlvEncoding);
 }
 
 // Boolean true
@@ -1817,6 +1822,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_JsonToTlv_ErrorCases)
         MutableByteSpan tlvSpan(buf);
         err = JsonToTlv(testCase.mJsonString, tlvSpan);
         EXPECT_EQ(err, testCase.mExpectedResult);
+        chip::Testing::ExpectJsonToTlvMatchesJsonCpp(testCase.mJsonString);
 #if CHIP_CONFIG_ERROR_FORMAT_AS_STRING
         if (err != testCase.mExpectedResult)
         {
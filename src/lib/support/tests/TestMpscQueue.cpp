@@ -0,0 +1,188 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/MpscQueue.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace {
+
+using namespace chip;
+
+struct Item
+{
+    uint32_t producer;
+    uint32_t sequence;
+};
+
+TEST(TestMpscQueue, TestFifo)
+{
+    MpscQueue<uint32_t, 4> queue;
+    uint32_t value = 0;
+
+    EXPECT_TRUE(queue.Empty());
+    EXPECT_FALSE(queue.TryPop(value));
+
+    // Go around the ring a few times, filling it up each time.
+    for (uint32_t lap = 0; lap < 3; lap++)
+    {
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            EXPECT_TRUE(queue.TryPush(lap * 10 + i));
+        }
+        EXPECT_FALSE(queue.TryPush(99));
+        EXPECT_FALSE(queue.Empty());
+
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            EXPECT_TRUE(queue.TryPop(value));
+            EXPECT_EQ(value, lap * 10 + i);
+        }
+        EXPECT_TRUE(queue.Empty());
+        EXPECT_FALSE(queue.TryPop(value));
+    }
+
+    // Interleaved pushes and pops.
+    EXPECT_TRUE(queue.TryPush(1));
+    EXPECT_TRUE(queue.TryPush(2));
+    EXPECT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, 1u);
+    EXPECT_TRUE(queue.TryPush(3));
+    EXPECT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, 2u);
+    EXPECT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, 3u);
+    EXPECT_TRUE(queue.Empty());
+}
+
+// Pops items pushed concurrently by producerCount threads, and checks that none is lost or duplicated, and that those of
+// a producer come out in the order it pushed them.
+template <typename Queue>
+void CheckConcurrentProducers(Queue & queue, uint32_t producerCount, uint32_t itemsPerProducer)
+{
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < producerCount; p++)
+    {
+        producers.emplace_back([&queue, p, itemsPerProducer] {
+            for (uint32_t i = 0; i < itemsPerProducer; i++)
+            {
+                while (!queue.TryPush(Item{ p, i }))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<uint32_t> nextSequence(producerCount, 0);
+    size_t remaining = static_cast<size_t>(producerCount) * itemsPerProducer;
+    while (remaining > 0)
+    {
+        Item item;
+        if (!queue.TryPop(item))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_LT(item.producer, producerCount);
+        EXPECT_EQ(item.sequence, nextSequence[item.producer]);
+        nextSequence[item.producer] = item.sequence + 1;
+        remaining--;
+    }
+
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_TRUE(queue.Empty());
+}
+
+TEST(TestMpscQueue, TestConcurrentProducers)
+{
+    MpscQueue<Item, 64> queue;
+    CheckConcurrentProducers(queue, 8, 20000);
+}
+
+// The mutex protected queue other threads post events to the CHIP thread through (see DeviceSafeQueue).
+class LockedQueue
+{
+public:
+    bool TryPush(const Item & item)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mItems.push(item);
+        return true;
+    }
+
+    bool TryPop(Item & item)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        if (mItems.empty())
+        {
+            return false;
+        }
+        item = mItems.front();
+        mItems.pop();
+        return true;
+    }
+
+    bool Empty()
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mItems.empty();
+    }
+
+private:
+    std::mutex mLock;
+    std::queue<Item> mItems;
+};
+
+template <typename Queue>
+int64_t MeasureConcurrentProducers(uint32_t producerCount, uint32_t itemsPerProducer)
+{
+    Queue queue;
+    auto start = std::chrono::steady_clock::now();
+    CheckConcurrentProducers(queue, producerCount, itemsPerProducer);
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+TEST(TestMpscQueue, BenchmarkContention)
+{
+    constexpr uint32_t kProducerCounts[] = { 1, 2, 4, 8, 16 };
+    constexpr uint32_t kItems            = 160000;
+
+    for (uint32_t producerCount : kProducerCounts)
+    {
+        int64_t lockFree = MeasureConcurrentProducers<MpscQueue<Item, 1024>>(producerCount, kItems / producerCount);
+        int64_t locked   = MeasureConcurrentProducers<LockedQueue>(producerCount, kItems / producerCount);
+        ChipLogProgress(Test, "%u producers, %u items: lock-free queue %lld us, mutex queue %lld us",
+                        static_cast<unsigned>(producerCount), static_cast<unsigned>(kItems), static_cast<long long>(lockFree),
+                        static_cast<long long>(locked));
+    }
+}
+
+} // namespace
@@ -25,6 +25,7 @@
 #include <inttypes.h>
 
 #include <app/icd/server/ICDServerConfig.h>
+#include <inet/UDPEndPoint.h>
 #include <lib/support/BitFlags.h>
 #include <lib/support/CHIPFaultInjection.h>
 #include <lib/support/CodeUtils.h>
@@ -149,6 +150,12 @@ void ReliableMessageMgr::ExecuteActions()
     ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions at 0x" ChipLogFormatX64 "ms", ChipLogValueX64(now.count()));
 #endif
 
+    // Hand the standalone acks and retransmissions due now to the kernel together. A retransmission which then fails is
+    // reported to OnQueuedSendFailed, at the latest when the batch ends; a standalone ack failing is ignored, as when it
+    // is sent right away. Whatever the callbacks run from here send is not queued, so its errors are returned as usual.
+    Inet::UDPSendBatch sendBatch(this);
+    mSendBatch = &sendBatch;
+
     ExecuteForAllContext([&](ReliableMessageContext * rc) {
         if (rc->IsAckPending())
         {
@@ -157,7 +164,9 @@ void ReliableMessageMgr::ExecuteActions()
 #if defined(RMP_TICKLESS_DEBUG)
                 ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions sending ACK %p", rc);
 #endif
+                sendBatch.BeginQueueing();
                 TEMPORARY_RETURN_IGNORED rc->SendStandaloneAckMessage();
+                sendBatch.EndQueueing();
             }
         }
     });
@@ -231,6 +240,8 @@ void ReliableMessageMgr::ExecuteActions()
         return Loop::Continue;
     });
 
+    mSendBatch = nullptr;
+
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
 
@@ -377,8 +388,17 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
         return CHIP_ERROR_INCORRECT_STATE;
     }
 
+    // Within ExecuteActions, only the retransmission itself is queued, with its entry to report a failure to.
+    if (mSendBatch != nullptr)
+    {
+        mSendBatch->BeginQueueing(entry);
+    }
     auto * sessionManager = entry->ec->GetExchangeMgr()->GetSessionManager();
     CHIP_ERROR err        = sessionManager->SendPreparedMessage(entry->ec->GetSessionHandle(), entry->retainedBuf);
+    if (mSendBatch != nullptr)
+    {
+        mSendBatch->EndQueueing();
+    }
     err                   = MapSendError(err, entry->ec->GetExchangeId(), entry->ec->IsInitiator());
 
     if (err == CHIP_NO_ERROR)
@@ -410,19 +430,41 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
     }
     else
     {
-        // Remove from table
-        // Using same error message for all errors to reduce code size.
-        ChipLogError(ExchangeManager,
-                     "Crit-err %" CHIP_ERROR_FORMAT " when sending CHIP MessageCounter:" ChipLogFormatMessageCounter
-                     " on exchange " ChipLogFormatExchange ", send tries: %d",
-                     err.Format(), entry->retainedBuf.GetMessageCounter(), ChipLogValueExchange(&entry->ec.Get()),
-                     entry->sendCount);
-
-        ClearRetransTable(*entry);
+        HandleSendFromRetransTableError(*entry, err);
     }
     return err;
 }
 
+void ReliableMessageMgr::HandleSendFromRetransTableError(RetransTableEntry & entry, CHIP_ERROR error)
+{
+    // Using same error message for all errors to reduce code size.
+    ChipLogError(ExchangeManager,
+                 "Crit-err %" CHIP_ERROR_FORMAT " when sending CHIP MessageCounter:" ChipLogFormatMessageCounter
+                 " on exchange " ChipLogFormatExchange ", send tries: %d",
+                 error.Format(), entry.retainedBuf.GetMessageCounter(), ChipLogValueExchange(&entry.ec.Get()), entry.sendCount);
+
+    // Remove from table
+    ClearRetransTable(entry);
+}
+
+void ReliableMessageMgr::OnQueuedSendFailed(const void * sendContext, CHIP_ERROR error)
+{
+    mRetransTable.ForEachActiveObject([&](auto * entry) {
+        if (entry != sendContext)
+        {
+            return Loop::Continue;
+        }
+
+        // Same handling as a retransmission whose send failed right away.
+        error = MapSendError(error, entry->ec->GetExchangeId(), entry->ec->IsInitiator());
+        if (error != CHIP_NO_ERROR)
+        {
+            HandleSendFromRetransTableError(*entry, error);
+        }
+        return Loop::Break;
+    });
+}
+
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
     mRetransTable.ForEachActiveObject([&](auto * entry) {
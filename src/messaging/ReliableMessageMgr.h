@@ -26,6 +26,7 @@
 #include <array>
 #include <stdint.h>
 
+#include <inet/UDPEndPoint.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/Optional.h>
 #include <lib/support/BitFlags.h>
@@ -44,7 +45,7 @@ namespace Messaging {
 enum class SendMessageFlags : uint16_t;
 class ReliableMessageContext;
 
-class ReliableMessageMgr
+class ReliableMessageMgr : private Inet::UDPSendBatch::Delegate
 {
 public:
     /**
@@ -243,6 +244,17 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
+    /**
+     * Remove an entry whose retransmission failed with @p error, already mapped by MapSendError, from the table.
+     */
+    void HandleSendFromRetransTableError(RetransTableEntry & entry, CHIP_ERROR error);
+
+    // Inet::UDPSendBatch::Delegate: a retransmission queued by ExecuteActions failed, the context is its entry.
+    void OnQueuedSendFailed(const void * sendContext, CHIP_ERROR error) override;
+
+    // Batch the retransmissions and standalone acks of ExecuteActions are queued in, while it runs.
+    Inet::UDPSendBatch * mSendBatch = nullptr;
+
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
 
@@ -0,0 +1,130 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a pool of threads that process CHIP background events.
+ */
+
+#include <platform/BackgroundWorkerPool.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+CHIP_ERROR BackgroundWorkerPool::Start(size_t threadCount, DispatchFunct dispatch, void * context)
+{
+    VerifyOrReturnError(threadCount > 0 && dispatch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    {
+        std::unique_lock<std::mutex> lock(mLock);
+        VerifyOrReturnError(!mShouldRun && mWorkers.empty(), CHIP_ERROR_INCORRECT_STATE);
+        mShouldRun = true;
+        mDispatch  = dispatch;
+        mContext   = context;
+    }
+
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        pthread_t worker;
+        int err = pthread_create(&worker, nullptr, WorkerMain, this);
+        if (err != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to start CHIP background worker %u", static_cast<unsigned>(i));
+            Stop();
+            return CHIP_ERROR_POSIX(err);
+        }
+
+        std::unique_lock<std::mutex> lock(mLock);
+        mWorkers.push_back(worker);
+    }
+
+    ChipLogDetail(DeviceLayer, "CHIP background workers running: %u", static_cast<unsigned>(threadCount));
+    return CHIP_NO_ERROR;
+}
+
+void BackgroundWorkerPool::Stop()
+{
+    std::vector<pthread_t> workers;
+    {
+        std::unique_lock<std::mutex> lock(mLock);
+        mShouldRun = false;
+        workers.swap(mWorkers);
+    }
+    mEventAvailable.notify_all();
+
+    for (auto & worker : workers)
+    {
+        pthread_join(worker, nullptr);
+    }
+}
+
+bool BackgroundWorkerPool::IsRunning()
+{
+    std::unique_lock<std::mutex> lock(mLock);
+    return mShouldRun;
+}
+
+CHIP_ERROR BackgroundWorkerPool::Post(const ChipDeviceEvent & event)
+{
+    {
+        std::unique_lock<std::mutex> lock(mLock);
+        VerifyOrReturnError(mShouldRun, CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(mEventQueue.size() < CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE, CHIP_ERROR_NO_MEMORY);
+        mEventQueue.push(event);
+    }
+    mEventAvailable.notify_one();
+    return CHIP_NO_ERROR;
+}
+
+void * BackgroundWorkerPool::WorkerMain(void * arg)
+{
+    static_cast<BackgroundWorkerPool *>(arg)->ProcessEvents();
+    return nullptr;
+}
+
+void BackgroundWorkerPool::ProcessEvents()
+{
+    std::unique_lock<std::mutex> lock(mLock);
+    while (true)
+    {
+        mEventAvailable.wait(lock, [this] { return !mEventQueue.empty() || !mShouldRun; });
+
+        // Events posted before the pool was stopped are still dispatched, so that their
+        // owners get to release whatever they hold for the duration of the work.
+        if (mEventQueue.empty())
+        {
+            break;
+        }
+
+        const ChipDeviceEvent event = mEventQueue.front();
+        mEventQueue.pop();
+
+        lock.unlock();
+        mDispatch(&event, mContext);
+        lock.lock();
+    }
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,99 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares a pool of threads that process CHIP background events, e.g. the
+ *      work scheduled through PlatformManager::ScheduleBackgroundWork().
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <pthread.h>
+#include <queue>
+#include <vector>
+
+#include <lib/core/CHIPCore.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/CHIPDeviceEvent.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+/**
+ *  @class BackgroundWorkerPool
+ *
+ *  @brief
+ *      A FIFO queue of background events served by a fixed number of worker threads.
+ *
+ *      Events are dispatched concurrently, in no particular order relative to each other, and
+ *      never with the CHIP stack lock held. Work that needs the stack has to be marshalled back
+ *      to the CHIP thread (e.g. through PlatformManager::ScheduleWork()).
+ */
+class BackgroundWorkerPool
+{
+public:
+    using DispatchFunct = void (*)(const ChipDeviceEvent * event, void * context);
+
+    BackgroundWorkerPool() = default;
+    ~BackgroundWorkerPool() { Stop(); }
+
+    /**
+     * Start threadCount worker threads, which pass every posted event to dispatch.
+     */
+    CHIP_ERROR Start(size_t threadCount, DispatchFunct dispatch, void * context);
+
+    /**
+     * Stop the worker threads, once the events already posted have been dispatched.
+     *
+     * Must not be called from a worker thread.
+     */
+    void Stop();
+
+    bool IsRunning();
+
+    /**
+     * Queue an event for a worker thread.
+     *
+     * @retval CHIP_ERROR_INCORRECT_STATE if the pool is not running.
+     * @retval CHIP_ERROR_NO_MEMORY if CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE events are already queued.
+     */
+    CHIP_ERROR Post(const ChipDeviceEvent & event);
+
+private:
+    static void * WorkerMain(void * arg);
+    void ProcessEvents();
+
+    std::mutex mLock;
+    std::condition_variable mEventAvailable;
+    std::queue<ChipDeviceEvent> mEventQueue;
+    std::vector<pthread_t> mWorkers;
+    bool mShouldRun         = false;
+    DispatchFunct mDispatch = nullptr;
+    void * mContext         = nullptr;
+
+    BackgroundWorkerPool(const BackgroundWorkerPool &)             = delete;
+    BackgroundWorkerPool & operator=(const BackgroundWorkerPool &) = delete;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
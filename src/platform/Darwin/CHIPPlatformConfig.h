@@ -74,6 +74,10 @@ extern "C" int __cxa_atexit(void (*f)(void *), void * p, void * d);
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+#ifndef CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE 64
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+
 #ifndef CHIP_CONFIG_KVS_PATH
 #if TARGET_OS_IPHONE
 #define CHIP_CONFIG_KVS_PATH "chip.store"
@@ -247,16 +247,8 @@ namespace System {
 #endif
         bool timerIsActive = (mTimerList.GetRemainingTime(onComplete, appState) > Clock::kZero);
 
-        if (!timerIsActive) {
-            // check if the timer is in the mExpiredTimers list about to be fired.
-            for (TimerList::Node * timer = mExpiredTimers.Earliest(); timer != nullptr; timer = timer->mNextTimer) {
-                if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState) {
-                    return true;
-                }
-            }
-        }
-
-        return timerIsActive;
+        // If not, check if the timer is in the mExpiredTimers list about to be fired.
+        return timerIsActive || mExpiredTimers.Contains(onComplete, appState);
     }
 
     Clock::Timeout LayerImplDispatch::GetRemainingTime(TimerCompleteCallback onComplete, void * appState)
@@ -64,6 +64,25 @@
 #define CHIP_DEVICE_CONFIG_THREAD_TASK_STACK_SIZE 8192
 #endif // CHIP_DEVICE_CONFIG_THREAD_TASK_STACK_SIZE
 
+// Background events are processed by a pool of threads once PlatformMgr().StartBackgroundEventLoopTask()
+// is called, and by the CHIP thread until then.
+#ifndef CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+#define CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING 1
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
+#ifndef CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+#define CHIP_DEVICE_CONFIG_BG_TASK_COUNT 4
+#endif // CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+
+#ifndef CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE
+#define CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE 1024
+#endif // CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE
+
+// Both KVS backends (INI and log-structured) serialize their accesses with a mutex.
+#ifndef CHIP_DEVICE_CONFIG_KVS_THREAD_SAFE
+#define CHIP_DEVICE_CONFIG_KVS_THREAD_SAFE 1
+#endif // CHIP_DEVICE_CONFIG_KVS_THREAD_SAFE
+
 #ifndef CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
 #define CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS 1
 #endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
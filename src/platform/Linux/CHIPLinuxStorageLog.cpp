@@ -0,0 +1,604 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides a log-structured, append-only implementation of the
+ *          key-value store on the Linux platform.
+ */
+
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <algorithm>
+#include <array>
+#include <errno.h>
+#include <fcntl.h>
+#include <fstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <inipp/inipp.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/IniEscaping.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr char kLogMagic[]       = { 'C', 'H', 'I', 'P', 'K', 'V', 'L', '1' };
+constexpr size_t kLogMagicSize    = sizeof(kLogMagic);
+constexpr size_t kRecordCrcSize   = 4;
+constexpr size_t kRecordHeaderSize = kRecordCrcSize + 1 /* type */ + 1 /* reserved */ + 2 /* keyLen */ + 4 /* valueLen */;
+
+constexpr std::array<uint32_t, 256> MakeCrc32Table()
+{
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1) ? (0xEDB88320u ^ (crc >> 1)) : (crc >> 1);
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+constexpr std::array<uint32_t, 256> kCrc32Table = MakeCrc32Table();
+
+uint32_t Crc32(const uint8_t * data, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++)
+    {
+        crc = kCrc32Table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+CHIP_ERROR ReadFully(int fd, std::vector<uint8_t> & out)
+{
+    struct stat st;
+    VerifyOrReturnError(fstat(fd, &st) == 0, CHIP_ERROR_POSIX(errno));
+    out.resize(static_cast<size_t>(st.st_size));
+
+    size_t done = 0;
+    while (done < out.size())
+    {
+        ssize_t rv = pread(fd, out.data() + done, out.size() - done, static_cast<off_t>(done));
+        if (rv < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(rv >= 0, CHIP_ERROR_POSIX(errno));
+        if (rv == 0)
+        {
+            break;
+        }
+        done += static_cast<size_t>(rv);
+    }
+    out.resize(done);
+
+    return CHIP_NO_ERROR;
+}
+
+// Whether a file that does not start with the log magic is an INI store: INI stores are plain text, with binary
+// values base64-encoded, whereas any log record holds a checksum and binary lengths.
+bool IsIniContent(const std::vector<uint8_t> & content)
+{
+    constexpr size_t kMagicPrefixSize = 4;
+    if (content.size() >= kMagicPrefixSize && memcmp(content.data(), kLogMagic, kMagicPrefixSize) == 0)
+    {
+        return false;
+    }
+
+    return std::all_of(content.begin(), content.end(),
+                       [](uint8_t c) { return (c >= 0x20 && c < 0x7F) || c == '\n' || c == '\r' || c == '\t'; });
+}
+
+// Make a rename in the directory holding @p path durable.
+CHIP_ERROR SyncParentDirectory(const std::string & path)
+{
+    size_t separator    = path.rfind('/');
+    std::string dirPath = (separator == std::string::npos) ? "." : path.substr(0, std::max<size_t>(separator, 1));
+
+    FileDescriptor dirFd(open(dirPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    VerifyOrReturnError(dirFd.Get() != -1, CHIP_ERROR_POSIX(errno));
+    VerifyOrReturnError(fsync(dirFd.Get()) == 0, CHIP_ERROR_POSIX(errno));
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+ChipLinuxStorageLog::~ChipLinuxStorageLog()
+{
+    Shutdown();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Init(const char * logFile)
+{
+    VerifyOrReturnError(logFile != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (mInitialized)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxStorageLog::Init: Attempt to re-initialize with KVS log file: %s, IGNORING.",
+                     logFile);
+        return CHIP_NO_ERROR;
+    }
+
+    ChipLogDetail(DeviceLayer, "ChipLinuxStorageLog::Init: Using KVS log file: %s", logFile);
+
+    {
+        std::lock_guard<std::mutex> compactionLock(mCompactionLock);
+        std::unique_lock<std::mutex> lock(mLock);
+
+        mLogPath.assign(logFile);
+        mIndex.clear();
+        mPendingRecords.clear();
+        mShutdown            = false;
+        mCompactionRequested = false;
+        mCompacting          = false;
+
+        ReturnErrorOnFailure(Recover(lock));
+        mInitialized = true;
+    }
+
+    mCompactionThread = std::thread(&ChipLinuxStorageLog::CompactionThreadMain, this);
+
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxStorageLog::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mShutdown = true;
+    }
+    mCompactionCondition.notify_all();
+
+    if (mCompactionThread.joinable())
+    {
+        mCompactionThread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mLock);
+    mFd.Close();
+    mIndex.clear();
+    mInitialized = false;
+}
+
+size_t ChipLinuxStorageLog::RecordSize(size_t keyLen, size_t valueLen)
+{
+    return kRecordHeaderSize + keyLen + valueLen;
+}
+
+void ChipLinuxStorageLog::EncodeRecord(std::vector<uint8_t> & out, RecordType type, const std::string & key,
+                                       const uint8_t * value, size_t valueLen)
+{
+    size_t start = out.size();
+    out.resize(start + RecordSize(key.size(), valueLen));
+
+    uint8_t * p = out.data() + start + kRecordCrcSize;
+    *p++        = static_cast<uint8_t>(type);
+    *p++        = 0;
+    Encoding::LittleEndian::Write16(p, static_cast<uint16_t>(key.size()));
+    Encoding::LittleEndian::Write32(p, static_cast<uint32_t>(valueLen));
+    memcpy(p, key.data(), key.size());
+    p += key.size();
+    if (valueLen > 0)
+    {
+        memcpy(p, value, valueLen);
+    }
+
+    uint8_t * crc = out.data() + start;
+    Encoding::LittleEndian::Put32(crc, Crc32(crc + kRecordCrcSize, out.size() - start - kRecordCrcSize));
+}
+
+CHIP_ERROR ChipLinuxStorageLog::WriteFully(int fd, const uint8_t * data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t rv = write(fd, data, len);
+        if (rv < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(rv > 0, CHIP_ERROR_POSIX(errno));
+        data += rv;
+        len -= static_cast<size_t>(rv);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxStorageLog::ApplyPut(const std::string & key, const uint8_t * value, size_t valueLen)
+{
+    ApplyDelete(key);
+    mIndex.emplace(key, std::vector<uint8_t>(value, value + valueLen));
+    mLiveSize += RecordSize(key.size(), valueLen);
+}
+
+void ChipLinuxStorageLog::ApplyDelete(const std::string & key)
+{
+    auto it = mIndex.find(key);
+    if (it != mIndex.end())
+    {
+        mLiveSize -= RecordSize(it->first.size(), it->second.size());
+        mIndex.erase(it);
+    }
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Recover(std::unique_lock<std::mutex> & lock)
+{
+    mFd = FileDescriptor(open(mLogPath.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, S_IRUSR | S_IWUSR));
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to open KVS log %s: %s", mLogPath.c_str(), strerror(errno)));
+
+    std::vector<uint8_t> content;
+    ReturnErrorOnFailure(ReadFully(mFd.Get(), content));
+
+    mLiveSize = kLogMagicSize;
+
+    size_t magicLen = std::min(content.size(), kLogMagicSize);
+    if (memcmp(content.data(), kLogMagic, magicLen) != 0)
+    {
+        // Only a store previously written by the INI backend may be converted. Anything else is a log whose header got
+        // corrupted: leave it untouched so that it can be recovered by hand rather than compacting it away.
+        VerifyOrReturnError(IsIniContent(content), CHIP_ERROR_INTEGRITY_CHECK_FAILED,
+                            ChipLogError(DeviceLayer, "KVS log %s has a corrupted header, refusing to use it", mLogPath.c_str()));
+        return ImportIni(lock);
+    }
+
+    size_t offset = kLogMagicSize;
+    if (content.size() < kLogMagicSize)
+    {
+        // Empty file or torn header write: start a fresh log.
+        VerifyOrReturnError(ftruncate(mFd.Get(), 0) == 0, CHIP_ERROR_POSIX(errno));
+        ReturnErrorOnFailure(WriteFully(mFd.Get(), reinterpret_cast<const uint8_t *>(kLogMagic), kLogMagicSize));
+        VerifyOrReturnError(fdatasync(mFd.Get()) == 0, CHIP_ERROR_POSIX(errno));
+        mLogSize = kLogMagicSize;
+        return CHIP_NO_ERROR;
+    }
+
+    while (content.size() - offset >= kRecordHeaderSize)
+    {
+        const uint8_t * p    = content.data() + offset;
+        uint32_t crc         = Encoding::LittleEndian::Get32(p);
+        uint8_t type         = p[kRecordCrcSize];
+        uint16_t keyLen      = Encoding::LittleEndian::Get16(p + kRecordCrcSize + 2);
+        uint32_t valueLen    = Encoding::LittleEndian::Get32(p + kRecordCrcSize + 4);
+        size_t recordSize    = RecordSize(keyLen, valueLen);
+        const uint8_t * body = p + kRecordHeaderSize;
+
+        if (recordSize > content.size() - offset || Crc32(p + kRecordCrcSize, recordSize - kRecordCrcSize) != crc)
+        {
+            break;
+        }
+
+        std::string key(reinterpret_cast<const char *>(body), keyLen);
+        if (type == to_underlying(RecordType::kPut))
+        {
+            ApplyPut(key, body + keyLen, valueLen);
+        }
+        else if (type == to_underlying(RecordType::kDelete))
+        {
+            ApplyDelete(key);
+        }
+        else
+        {
+            break;
+        }
+
+        offset += recordSize;
+    }
+
+    if (offset != content.size())
+    {
+        ChipLogError(DeviceLayer, "KVS log %s has a torn or corrupted tail, discarding %u bytes", mLogPath.c_str(),
+                     static_cast<unsigned>(content.size() - offset));
+        VerifyOrReturnError(ftruncate(mFd.Get(), static_cast<off_t>(offset)) == 0, CHIP_ERROR_POSIX(errno));
+        VerifyOrReturnError(fdatasync(mFd.Get()) == 0, CHIP_ERROR_POSIX(errno));
+    }
+
+    mLogSize = offset;
+
+    ChipLogDetail(DeviceLayer, "Recovered %u keys from KVS log %s", static_cast<unsigned>(mIndex.size()), mLogPath.c_str());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ImportIni(std::unique_lock<std::mutex> & lock)
+{
+    inipp::Ini<char> ini;
+    std::ifstream ifs(mLogPath, std::ifstream::in);
+    VerifyOrReturnError(ifs.is_open(), CHIP_ERROR_OPEN_FAILED);
+    ini.parse(ifs);
+    ifs.close();
+
+    for (const auto & entry : ini.sections["DEFAULT"])
+    {
+        std::string value = IniEscaping::Base64ToString(entry.second);
+        ApplyPut(IniEscaping::UnescapeKey(entry.first), reinterpret_cast<const uint8_t *>(value.data()), value.size());
+    }
+
+    ChipLogProgress(DeviceLayer, "Converting INI store %s to KVS log (%u keys)", mLogPath.c_str(),
+                    static_cast<unsigned>(mIndex.size()));
+
+    return CompactLocked(lock);
+}
+
+CHIP_ERROR ChipLinuxStorageLog::AppendRecord(RecordType type, const std::string & key, const uint8_t * value, size_t valueLen)
+{
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key.size() <= UINT16_MAX && valueLen <= UINT32_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::vector<uint8_t> record;
+    EncodeRecord(record, type, key, value, valueLen);
+
+    CHIP_ERROR err = WriteFully(mFd.Get(), record.data(), record.size());
+    if (err == CHIP_NO_ERROR && fdatasync(mFd.Get()) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        // Drop whatever part of the record made it to the file so the next append starts on a record boundary.
+        ChipLogError(DeviceLayer, "Failed to append to KVS log %s: %" CHIP_ERROR_FORMAT, mLogPath.c_str(), err.Format());
+        if (ftruncate(mFd.Get(), static_cast<off_t>(mLogSize)) != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to truncate KVS log %s: %s", mLogPath.c_str(), strerror(errno));
+        }
+        return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+
+    mLogSize += record.size();
+    if (mCompacting)
+    {
+        mPendingRecords.insert(mPendingRecords.end(), record.begin(), record.end());
+    }
+
+    if (type == RecordType::kPut)
+    {
+        ApplyPut(key, value, valueLen);
+    }
+    else
+    {
+        ApplyDelete(key);
+    }
+
+    if (!mCompacting && ShouldCompact())
+    {
+        mCompactionRequested = true;
+        mCompactionCondition.notify_one();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ReadValueBin(const char * key, void * value, size_t valueSize, size_t & readBytes, size_t offset)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(value != nullptr || valueSize == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    auto it = mIndex.find(key);
+    VerifyOrReturnError(it != mIndex.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    const std::vector<uint8_t> & stored = it->second;
+    VerifyOrReturnError(offset <= stored.size(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    size_t available = stored.size() - offset;
+    readBytes        = std::min(valueSize, available);
+    if (readBytes > 0)
+    {
+        memcpy(value, stored.data() + offset, readBytes);
+    }
+
+    return (valueSize < available) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::WriteValueBin(const char * key, const uint8_t * data, size_t dataLen)
+{
+    VerifyOrReturnError(key != nullptr && (data != nullptr || dataLen == 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    return AppendRecord(RecordType::kPut, key, data, dataLen);
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ClearValue(const char * key)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mIndex.find(key) != mIndex.end(), CHIP_ERROR_KEY_NOT_FOUND);
+    return AppendRecord(RecordType::kDelete, key, nullptr, 0);
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ClearAll()
+{
+    std::lock_guard<std::mutex> compactionLock(mCompactionLock);
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(ftruncate(mFd.Get(), static_cast<off_t>(kLogMagicSize)) == 0, CHIP_ERROR_WRITE_FAILED);
+    VerifyOrReturnError(fdatasync(mFd.Get()) == 0, CHIP_ERROR_WRITE_FAILED);
+
+    mIndex.clear();
+    mLogSize  = kLogMagicSize;
+    mLiveSize = kLogMagicSize;
+
+    return CHIP_NO_ERROR;
+}
+
+bool ChipLinuxStorageLog::HasValue(const char * key)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mIndex.find(key) != mIndex.end();
+}
+
+size_t ChipLinuxStorageLog::GetLogSize()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mLogSize;
+}
+
+size_t ChipLinuxStorageLog::GetLiveSize()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mLiveSize;
+}
+
+bool ChipLinuxStorageLog::ShouldCompact() const
+{
+    return mLogSize >= kCompactionMinLogSize && mLogSize > kCompactionGarbageRatio * mLiveSize;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Compact()
+{
+    std::lock_guard<std::mutex> compactionLock(mCompactionLock);
+    std::unique_lock<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    return CompactLocked(lock);
+}
+
+// Compaction runs in three steps so that writers are only blocked for the cheap parts:
+// 1. Under the lock, serialize the live index into a memory image and start capturing
+//    records appended from now on.
+// 2. Without the lock, write and sync the image to a temporary file.
+// 3. Under the lock, append the captured records, sync, and rename the temporary file
+//    over the log.
+CHIP_ERROR ChipLinuxStorageLog::CompactLocked(std::unique_lock<std::mutex> & lock)
+{
+    std::vector<uint8_t> image;
+    image.reserve(mLiveSize);
+    image.insert(image.end(), kLogMagic, kLogMagic + kLogMagicSize);
+    for (const auto & entry : mIndex)
+    {
+        EncodeRecord(image, RecordType::kPut, entry.first, entry.second.data(), entry.second.size());
+    }
+    mPendingRecords.clear();
+    mCompacting = true;
+    lock.unlock();
+
+    std::string tmpPath = mLogPath + "-XXXXXX";
+    FileDescriptor tmpFd(mkstemp(tmpPath.data()));
+    CHIP_ERROR err = (tmpFd.Get() != -1) ? CHIP_NO_ERROR : CHIP_ERROR_OPEN_FAILED;
+    if (err == CHIP_NO_ERROR)
+    {
+        err = WriteFully(tmpFd.Get(), image.data(), image.size());
+    }
+    if (err == CHIP_NO_ERROR && fdatasync(tmpFd.Get()) != 0)
+    {
+        err = CHIP_ERROR_WRITE_FAILED;
+    }
+
+    lock.lock();
+    mCompacting = false;
+
+    if (err == CHIP_NO_ERROR)
+    {
+        err = WriteFully(tmpFd.Get(), mPendingRecords.data(), mPendingRecords.size());
+    }
+    if (err == CHIP_NO_ERROR && fdatasync(tmpFd.Get()) != 0)
+    {
+        err = CHIP_ERROR_WRITE_FAILED;
+    }
+    if (err == CHIP_NO_ERROR && fcntl(tmpFd.Get(), F_SETFL, O_APPEND) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    if (err == CHIP_NO_ERROR && rename(tmpPath.c_str(), mLogPath.c_str()) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to rename %s to %s: %s", tmpPath.c_str(), mLogPath.c_str(), strerror(errno));
+        err = CHIP_ERROR_WRITE_FAILED;
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        if (tmpFd.Get() != -1)
+        {
+            unlink(tmpPath.c_str());
+        }
+        mPendingRecords.clear();
+        return err;
+    }
+
+    ChipLogDetail(DeviceLayer, "Compacted KVS log %s from %u to %u bytes", mLogPath.c_str(), static_cast<unsigned>(mLogSize),
+                  static_cast<unsigned>(image.size() + mPendingRecords.size()));
+
+    // The old log is gone from the directory: the compacted file is the log from now on, even if the rename itself could
+    // not be made durable yet.
+    mFd      = std::move(tmpFd);
+    mLogSize = image.size() + mPendingRecords.size();
+    mPendingRecords.clear();
+    mPendingRecords.shrink_to_fit();
+
+    // Without this, a crash could bring the old log back while later records are appended to the compacted one.
+    err = SyncParentDirectory(mLogPath);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to sync the directory of KVS log %s: %" CHIP_ERROR_FORMAT, mLogPath.c_str(),
+                     err.Format());
+    }
+
+    return err;
+}
+
+void ChipLinuxStorageLog::CompactionThreadMain()
+{
+    std::unique_lock<std::mutex> lock(mLock);
+
+    while (!mShutdown)
+    {
+        mCompactionCondition.wait_for(lock, kCompactionPeriod, [this] { return mShutdown || mCompactionRequested; });
+        if (mShutdown)
+        {
+            break;
+        }
+
+        mCompactionRequested = false;
+        if (!ShouldCompact())
+        {
+            continue;
+        }
+
+        lock.unlock();
+        CHIP_ERROR err = Compact();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DeviceLayer, "Background compaction of KVS log failed: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+        lock.lock();
+    }
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,162 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file defines a log-structured, append-only key-value store
+ *         for the Linux platform.
+ *
+ *         Every Put/Delete appends a single checksummed record to a write-ahead
+ *         log file instead of rewriting the whole store, so the cost of a write
+ *         is independent of the number of keys. All live values are kept in an
+ *         in-memory index which is rebuilt by replaying the log on Init().
+ *
+ *         A torn or corrupted tail (e.g. after a power loss in the middle of an
+ *         append) is detected by the record checksum and truncated away during
+ *         recovery. Superseded records are reclaimed by a background compaction
+ *         thread which writes the live set to a temporary file and atomically
+ *         renames it over the log.
+ *
+ *         Log file layout (all integers little-endian):
+ *
+ *           file   := magic record*
+ *           magic  := "CHIPKVL1"
+ *           record := crc32 type reserved keyLen valueLen key value
+ *
+ *         where `crc32` (4 bytes) covers every following byte of the record,
+ *         `type` (1 byte) is either kPut or kDelete, `reserved` is 1 byte,
+ *         `keyLen` is 2 bytes and `valueLen` is 4 bytes.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/FileDescriptor.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxStorageLog
+{
+public:
+    /// Minimum log size before compaction is considered at all.
+    static constexpr size_t kCompactionMinLogSize = 64 * 1024;
+
+    /// Compaction is triggered once the log is larger than this multiple of the live data size.
+    static constexpr size_t kCompactionGarbageRatio = 2;
+
+    /// Interval at which the background thread re-evaluates whether the log should be compacted.
+    static constexpr std::chrono::seconds kCompactionPeriod{ 60 };
+
+    ChipLinuxStorageLog() = default;
+    ~ChipLinuxStorageLog();
+
+    ChipLinuxStorageLog(const ChipLinuxStorageLog &)             = delete;
+    ChipLinuxStorageLog & operator=(const ChipLinuxStorageLog &) = delete;
+
+    /**
+     * Open (or create) the log file at @p logFile, replay it into the in-memory index
+     * and start the background compaction thread.
+     *
+     * If @p logFile exists but is an INI store written by ChipLinuxStorage, its content
+     * is imported and the file is converted to the log format. A log whose header is
+     * corrupted is left untouched and CHIP_ERROR_INTEGRITY_CHECK_FAILED is returned.
+     */
+    CHIP_ERROR Init(const char * logFile);
+
+    /**
+     * Stop the background compaction thread and close the log file.
+     */
+    void Shutdown();
+
+    /**
+     * Read a value following the KeyValueStoreManager::Get() semantics: up to @p valueSize
+     * bytes starting at @p offset are copied into @p value and CHIP_ERROR_BUFFER_TOO_SMALL
+     * is returned if the value did not fit.
+     */
+    CHIP_ERROR ReadValueBin(const char * key, void * value, size_t valueSize, size_t & readBytes, size_t offset = 0);
+    CHIP_ERROR WriteValueBin(const char * key, const uint8_t * data, size_t dataLen);
+    CHIP_ERROR ClearValue(const char * key);
+    CHIP_ERROR ClearAll();
+    bool HasValue(const char * key);
+
+    /**
+     * Synchronously rewrite the log so that it only contains live records.
+     */
+    CHIP_ERROR Compact();
+
+    /// Current size of the log file in bytes.
+    size_t GetLogSize();
+
+    /// Size in bytes that the log would have right after compaction.
+    size_t GetLiveSize();
+
+private:
+    enum class RecordType : uint8_t
+    {
+        kPut    = 1,
+        kDelete = 2,
+    };
+
+    static size_t RecordSize(size_t keyLen, size_t valueLen);
+    static CHIP_ERROR WriteFully(int fd, const uint8_t * data, size_t len);
+    static void EncodeRecord(std::vector<uint8_t> & out, RecordType type, const std::string & key, const uint8_t * value,
+                             size_t valueLen);
+
+    CHIP_ERROR Recover(std::unique_lock<std::mutex> & lock);
+    CHIP_ERROR ImportIni(std::unique_lock<std::mutex> & lock);
+    void ApplyPut(const std::string & key, const uint8_t * value, size_t valueLen);
+    void ApplyDelete(const std::string & key);
+    CHIP_ERROR AppendRecord(RecordType type, const std::string & key, const uint8_t * value, size_t valueLen);
+    CHIP_ERROR CompactLocked(std::unique_lock<std::mutex> & lock);
+    bool ShouldCompact() const;
+    void CompactionThreadMain();
+
+    std::mutex mLock;
+    std::mutex mCompactionLock;
+    std::condition_variable mCompactionCondition;
+    std::thread mCompactionThread;
+    bool mShutdown            = false;
+    bool mCompactionRequested = false;
+    bool mCompacting          = false;
+
+    std::string mLogPath;
+    FileDescriptor mFd;
+    bool mInitialized = false;
+
+    std::unordered_map<std::string, std::vector<uint8_t>> mIndex;
+    size_t mLogSize  = 0;
+    size_t mLiveSize = 0;
+
+    // Records appended while a compaction is writing its snapshot; they are replayed on
+    // top of the compacted file before it replaces the log.
+    std::vector<uint8_t> mPendingRecords;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
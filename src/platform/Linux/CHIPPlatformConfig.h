@@ -64,6 +64,46 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+#ifndef CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE
+#define CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE 32
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE
+
+#ifndef CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+#define CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX 1
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_INDEX
+#define CHIP_CONFIG_ACCESS_CONTROL_INDEX 1
+#endif // CHIP_CONFIG_ACCESS_CONTROL_INDEX
+
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 16
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+
+#ifndef CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES
+#define CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES 16384
+#endif // CHIP_IM_SERVER_DIRTY_PATH_INDEX_MAX_ENTRIES
+
+#ifndef CHIP_IM_FAIR_REPORT_SCHEDULING
+#define CHIP_IM_FAIR_REPORT_SCHEDULING 1
+#endif // CHIP_IM_FAIR_REPORT_SCHEDULING
+
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS 32
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_BLOCKS
+
+#ifndef CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE
+#define CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE 1
+#endif // CHIP_CONFIG_CLUSTER_STATE_CACHE_FLAT_STORAGE
+
+#ifndef CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE
+#define CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE 64
+#endif // CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE
+
+#ifndef CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE 64
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+
 // ==================== Security Configuration Overrides ====================
 
 #ifndef CHIP_CONFIG_KVS_PATH
@@ -46,3 +46,19 @@
 
 // On linux platform, we have sys/socket.h, so HAVE_SO_BINDTODEVICE should be set to 1
 #define HAVE_SO_BINDTODEVICE 1
+
+// The datagrams of a batch are held in static areas shared by every UDP endpoint, one entry per datagram. An entry holds
+// a packet buffer worth of data (CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX) plus the peer address and control
+// messages, about 1.9 KB with the default buffer size, so each of these two batch sizes takes about 30 KB of RAM. Lower
+// them, or set them to 0 to use recvmsg()/sendmsg() only, on constrained targets.
+#ifndef INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE 16
+#endif // INET_CONFIG_UDP_SOCKET_RECVMMSG_BATCH_SIZE
+
+#ifndef INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE 16
+#endif // INET_CONFIG_UDP_SOCKET_SENDMMSG_BATCH_SIZE
+
+#ifndef INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT
+#define INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT 16
+#endif // INET_CONFIG_TCP_SOCKET_SEND_IOV_COUNT
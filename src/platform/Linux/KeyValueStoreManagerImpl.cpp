@@ -28,7 +28,6 @@
 
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
-#include <platform/Linux/CHIPLinuxStorage.h>
 
 namespace chip {
 namespace DeviceLayer {
@@ -36,6 +35,49 @@ namespace PersistedStorage {
 
 KeyValueStoreManagerImpl KeyValueStoreManagerImpl::sInstance;
 
+#if CHIP_DEVICE_CONFIG_LINUX_LOG_STRUCTURED_KVS
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size,
+                                          size_t offset_bytes)
+{
+    size_t read_size = 0;
+
+    VerifyOrReturnError(value != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The log-structured store keeps every live value in memory, so partial and
+    // offset reads can be served directly without an intermediate buffer.
+    CHIP_ERROR err = mStorage.ReadValueBin(key, value, value_size, read_size, offset_bytes);
+    if (err == CHIP_ERROR_KEY_NOT_FOUND)
+    {
+        return CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
+    }
+    if ((err == CHIP_NO_ERROR || err == CHIP_ERROR_BUFFER_TOO_SMALL) && read_bytes_size != nullptr)
+    {
+        *read_bytes_size = read_size;
+    }
+
+    return err;
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value, size_t value_size)
+{
+    // Each record is appended and synced individually, there is no separate commit step.
+    return mStorage.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), value_size);
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
+{
+    CHIP_ERROR err = mStorage.ClearValue(key);
+    if (err == CHIP_ERROR_KEY_NOT_FOUND)
+    {
+        return CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
+    }
+
+    return err;
+}
+
+#else // CHIP_DEVICE_CONFIG_LINUX_LOG_STRUCTURED_KVS
+
 CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size,
                                           size_t offset_bytes)
 {
@@ -110,6 +152,8 @@ exit:
     return err;
 }
 
+#endif // CHIP_DEVICE_CONFIG_LINUX_LOG_STRUCTURED_KVS
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
@@ -39,6 +39,7 @@ struct ChipDeviceEvent;
 #define CHIP_SYSTEM_CONFIG_NO_LOCKING 0
 #define CHIP_SYSTEM_CONFIG_PLATFORM_PROVIDES_TIME 1
 #define CHIP_SYSTEM_CONFIG_POOL_USE_HEAP 1
+#define CHIP_SYSTEM_CONFIG_TIMER_HEAP 1
 
 // ========== Platform-specific Configuration Overrides =========
 #define CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS 5
@@ -0,0 +1,273 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the pool of threads
+ *      processing CHIP background events.
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/BackgroundWorkerPool.h>
+#include <platform/DeviceSafeQueue.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+class TestBackgroundWorkerPool : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+void DispatchWork(const ChipDeviceEvent * event, void * context)
+{
+    if (event->Type == DeviceEventType::kCallWorkFunct)
+    {
+        event->CallWorkFunct.WorkFunct(event->CallWorkFunct.Arg);
+    }
+}
+
+ChipDeviceEvent MakeWorkEvent(AsyncWorkFunct workFunct, intptr_t arg)
+{
+    ChipDeviceEvent event;
+    event.Type                    = DeviceEventType::kCallWorkFunct;
+    event.CallWorkFunct.WorkFunct = workFunct;
+    event.CallWorkFunct.Arg       = arg;
+    return event;
+}
+
+// Post an event, waiting for room in the queue, which may be as short as a single event
+CHIP_ERROR PostWhenQueueHasRoom(BackgroundWorkerPool & pool, const ChipDeviceEvent & event)
+{
+    CHIP_ERROR err;
+    while ((err = pool.Post(event)) == CHIP_ERROR_NO_MEMORY)
+    {
+        std::this_thread::yield();
+    }
+    return err;
+}
+
+void IncrementCounter(intptr_t arg)
+{
+    reinterpret_cast<std::atomic<int> *>(arg)->fetch_add(1);
+}
+
+TEST_F(TestBackgroundWorkerPool, StartPostStop)
+{
+    BackgroundWorkerPool pool;
+    std::atomic<int> counter{ 0 };
+
+    EXPECT_FALSE(pool.IsRunning());
+    EXPECT_EQ(pool.Post(MakeWorkEvent(IncrementCounter, reinterpret_cast<intptr_t>(&counter))), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(pool.Start(0, DispatchWork, nullptr), CHIP_ERROR_INVALID_ARGUMENT);
+
+    ASSERT_EQ(pool.Start(4, DispatchWork, nullptr), CHIP_NO_ERROR);
+    EXPECT_TRUE(pool.IsRunning());
+    EXPECT_EQ(pool.Start(4, DispatchWork, nullptr), CHIP_ERROR_INCORRECT_STATE);
+
+    constexpr int kEventCount = 100;
+    for (int i = 0; i < kEventCount; i++)
+    {
+        EXPECT_EQ(PostWhenQueueHasRoom(pool, MakeWorkEvent(IncrementCounter, reinterpret_cast<intptr_t>(&counter))), CHIP_NO_ERROR);
+    }
+
+    // Events posted before stopping are all dispatched
+    pool.Stop();
+    EXPECT_FALSE(pool.IsRunning());
+    EXPECT_EQ(counter, kEventCount);
+
+    // The pool can be restarted
+    ASSERT_EQ(pool.Start(1, DispatchWork, nullptr), CHIP_NO_ERROR);
+    EXPECT_EQ(pool.Post(MakeWorkEvent(IncrementCounter, reinterpret_cast<intptr_t>(&counter))), CHIP_NO_ERROR);
+    pool.Stop();
+    EXPECT_EQ(counter, kEventCount + 1);
+}
+
+struct Gate
+{
+    std::atomic<bool> entered{ false };
+    std::atomic<bool> open{ false };
+};
+
+void WaitAtGate(intptr_t arg)
+{
+    auto * gate = reinterpret_cast<Gate *>(arg);
+    gate->entered.store(true);
+    while (!gate->open.load())
+    {
+        chip::test_utils::SleepMillis(1);
+    }
+}
+
+TEST_F(TestBackgroundWorkerPool, QueueFull)
+{
+    BackgroundWorkerPool pool;
+    Gate gate;
+    std::atomic<int> counter{ 0 };
+
+    ASSERT_EQ(pool.Start(1, DispatchWork, nullptr), CHIP_NO_ERROR);
+
+    // Keep the only worker busy, so that the next events stay queued
+    ASSERT_EQ(pool.Post(MakeWorkEvent(WaitAtGate, reinterpret_cast<intptr_t>(&gate))), CHIP_NO_ERROR);
+    for (size_t t = 0; !gate.entered.load() && t < 1000; t++)
+    {
+        chip::test_utils::SleepMillis(1);
+    }
+    ASSERT_TRUE(gate.entered.load());
+
+    for (size_t i = 0; i < CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE; i++)
+    {
+        EXPECT_EQ(pool.Post(MakeWorkEvent(IncrementCounter, reinterpret_cast<intptr_t>(&counter))), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(pool.Post(MakeWorkEvent(IncrementCounter, reinterpret_cast<intptr_t>(&counter))), CHIP_ERROR_NO_MEMORY);
+
+    gate.open.store(true);
+    pool.Stop();
+    EXPECT_EQ(counter, static_cast<int>(CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE));
+}
+
+// A simulated CASE handshake: the background work of both ends of a session establishment (ECDH, Sigma3
+// signature generation and verification), followed by an after-work step on the "CHIP thread".
+struct SimulatedPeer
+{
+    Crypto::P256Keypair initiatorKey;
+    Crypto::P256Keypair responderKey;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    Crypto::P256ECDSASignature signature;
+    CHIP_ERROR status = CHIP_ERROR_INTERNAL;
+    DeviceSafeQueue * chipThreadQueue;
+};
+
+void SessionEstablished(intptr_t arg)
+{
+    // Nothing to do: the after-work of a handshake is only counted by the event loop
+}
+
+void EstablishSession(intptr_t arg)
+{
+    auto * peer = reinterpret_cast<SimulatedPeer *>(arg);
+
+    constexpr uint8_t kMessage[] = "Sigma3 TBS data";
+    peer->status                 = peer->initiatorKey.ECDH_derive_secret(peer->responderKey.Pubkey(), peer->sharedSecret);
+    if (peer->status == CHIP_NO_ERROR)
+    {
+        peer->status = peer->initiatorKey.ECDSA_sign_msg(kMessage, sizeof(kMessage), peer->signature);
+    }
+    if (peer->status == CHIP_NO_ERROR)
+    {
+        peer->status = peer->initiatorKey.Pubkey().ECDSA_validate_msg_signature(kMessage, sizeof(kMessage), peer->signature);
+    }
+
+    // Marshal the result back, as WorkHelper does through PlatformManager::ScheduleWork()
+    peer->chipThreadQueue->Push(MakeWorkEvent(SessionEstablished, arg));
+}
+
+// Returns the time taken until all sessions are established, in microseconds, or 0 on failure.
+uint64_t EstablishSessions(std::vector<std::unique_ptr<SimulatedPeer>> & peers, size_t threadCount)
+{
+    DeviceSafeQueue chipThreadQueue;
+    BackgroundWorkerPool pool;
+
+    auto start = std::chrono::steady_clock::now();
+    if (threadCount > 0)
+    {
+        VerifyOrReturnValue(pool.Start(threadCount, DispatchWork, nullptr) == CHIP_NO_ERROR, 0);
+    }
+
+    for (auto & peer : peers)
+    {
+        peer->chipThreadQueue = &chipThreadQueue;
+        ChipDeviceEvent event = MakeWorkEvent(EstablishSession, reinterpret_cast<intptr_t>(peer.get()));
+        if (threadCount > 0)
+        {
+            VerifyOrReturnValue(PostWhenQueueHasRoom(pool, event) == CHIP_NO_ERROR, 0);
+        }
+        else
+        {
+            // Background work processed by the CHIP thread, as without a pool
+            DispatchWork(&event, nullptr);
+        }
+    }
+
+    size_t established = 0;
+    while (established < peers.size())
+    {
+        while (!chipThreadQueue.Empty())
+        {
+            const ChipDeviceEvent event = chipThreadQueue.PopFront();
+            DispatchWork(&event, nullptr);
+            established++;
+        }
+        std::this_thread::yield();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    pool.Stop();
+
+    for (auto & peer : peers)
+    {
+        VerifyOrReturnValue(peer->status == CHIP_NO_ERROR, 0);
+    }
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+}
+
+TEST_F(TestBackgroundWorkerPool, SessionEstablishmentBenchmark)
+{
+    constexpr size_t kPeerCounts[]   = { 100, 500 };
+    constexpr size_t kThreadCounts[] = { 0, CHIP_DEVICE_CONFIG_BG_TASK_COUNT };
+
+    for (size_t peerCount : kPeerCounts)
+    {
+        std::vector<std::unique_ptr<SimulatedPeer>> peers;
+        for (size_t i = 0; i < peerCount; i++)
+        {
+            auto peer = std::make_unique<SimulatedPeer>();
+            ASSERT_EQ(peer->initiatorKey.Initialize(Crypto::ECPKeyTarget::ECDH), CHIP_NO_ERROR);
+            ASSERT_EQ(peer->responderKey.Initialize(Crypto::ECPKeyTarget::ECDH), CHIP_NO_ERROR);
+            peers.push_back(std::move(peer));
+        }
+
+        for (size_t threadCount : kThreadCounts)
+        {
+            uint64_t elapsedUs = EstablishSessions(peers, threadCount);
+            ASSERT_NE(elapsedUs, 0u);
+            ChipLogProgress(Test, "%u peers, %u background threads: all sessions established in %u ms (%u sessions/s)",
+                            static_cast<unsigned>(peerCount), static_cast<unsigned>(threadCount),
+                            static_cast<unsigned>(elapsedUs / 1000), static_cast<unsigned>(peerCount * 1000000 / elapsedUs));
+        }
+    }
+}
+
+} // namespace
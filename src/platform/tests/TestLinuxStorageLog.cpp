@@ -0,0 +1,329 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the log-structured Linux
+ *      key-value store, along with a write latency comparison against the
+ *      INI backend.
+ *
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+#include <system/SystemClock.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+std::string MakeTempPath()
+{
+    char path[] = "/tmp/chip-kvs-log-test-XXXXXX";
+    int fd      = mkstemp(path);
+    if (fd >= 0)
+    {
+        close(fd);
+        unlink(path);
+    }
+    return path;
+}
+
+off_t FileSize(const std::string & path)
+{
+    struct stat st;
+    return (stat(path.c_str(), &st) == 0) ? st.st_size : -1;
+}
+
+struct TestLinuxStorageLog : public ::testing::Test
+{
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override { mPath = MakeTempPath(); }
+    void TearDown() override { unlink(mPath.c_str()); }
+
+    std::string mPath;
+};
+
+TEST_F(TestLinuxStorageLog, PutGetDelete)
+{
+    static const uint8_t kValue[] = { 1, 2, 3, 4, 5 };
+    uint8_t buf[8];
+    size_t readBytes = 0;
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    EXPECT_EQ(storage.ReadValueBin("key", buf, sizeof(buf), readBytes), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(storage.WriteValueBin("key", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+    EXPECT_TRUE(storage.HasValue("key"));
+
+    EXPECT_EQ(storage.ReadValueBin("key", buf, sizeof(buf), readBytes), CHIP_NO_ERROR);
+    EXPECT_EQ(readBytes, sizeof(kValue));
+    EXPECT_EQ(memcmp(buf, kValue, sizeof(kValue)), 0);
+
+    // Partial and offset reads.
+    EXPECT_EQ(storage.ReadValueBin("key", buf, 2, readBytes, 1), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(readBytes, 2u);
+    EXPECT_EQ(buf[0], 2);
+    EXPECT_EQ(buf[1], 3);
+    EXPECT_EQ(storage.ReadValueBin("key", buf, sizeof(buf), readBytes, sizeof(kValue) + 1), CHIP_ERROR_INVALID_ARGUMENT);
+
+    EXPECT_EQ(storage.ClearValue("key"), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasValue("key"));
+    EXPECT_EQ(storage.ClearValue("key"), CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+TEST_F(TestLinuxStorageLog, PersistAcrossInit)
+{
+    uint32_t value = 0;
+    size_t readBytes;
+
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        for (uint32_t i = 0; i < 10; i++)
+        {
+            EXPECT_EQ(storage.WriteValueBin("counter", reinterpret_cast<const uint8_t *>(&i), sizeof(i)), CHIP_NO_ERROR);
+        }
+        EXPECT_EQ(storage.WriteValueBin("deleted", reinterpret_cast<const uint8_t *>(&value), sizeof(value)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.ClearValue("deleted"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("empty", nullptr, 0), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.ReadValueBin("counter", &value, sizeof(value), readBytes), CHIP_NO_ERROR);
+    EXPECT_EQ(value, 9u);
+    EXPECT_FALSE(storage.HasValue("deleted"));
+    EXPECT_EQ(storage.ReadValueBin("empty", nullptr, 0, readBytes), CHIP_NO_ERROR);
+    EXPECT_EQ(readBytes, 0u);
+}
+
+TEST_F(TestLinuxStorageLog, RecoverTornTail)
+{
+    static const uint8_t kValue[] = { 0xAA, 0xBB, 0xCC, 0xDD };
+    uint8_t buf[sizeof(kValue)];
+    size_t readBytes;
+    off_t goodSize;
+
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("a", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+        goodSize = FileSize(mPath);
+        EXPECT_EQ(storage.WriteValueBin("b", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+    }
+
+    // Simulate a power loss in the middle of appending the record for "b".
+    ASSERT_EQ(truncate(mPath.c_str(), FileSize(mPath) - 2), 0);
+
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(FileSize(mPath), goodSize);
+        EXPECT_EQ(storage.ReadValueBin("a", buf, sizeof(buf), readBytes), CHIP_NO_ERROR);
+        EXPECT_FALSE(storage.HasValue("b"));
+
+        // The log must still be appendable after recovery.
+        EXPECT_EQ(storage.WriteValueBin("c", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+    }
+
+    // Corrupt the last byte of the last record: its checksum no longer matches.
+    {
+        int fd = open(mPath.c_str(), O_WRONLY);
+        ASSERT_GE(fd, 0);
+        uint8_t garbage = 0;
+        EXPECT_EQ(pwrite(fd, &garbage, 1, FileSize(mPath) - 1), 1);
+        close(fd);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_TRUE(storage.HasValue("a"));
+    EXPECT_FALSE(storage.HasValue("c"));
+}
+
+TEST_F(TestLinuxStorageLog, Compaction)
+{
+    uint8_t value[64] = {};
+    size_t readBytes;
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    for (uint8_t i = 0; i < 100; i++)
+    {
+        value[0] = i;
+        EXPECT_EQ(storage.WriteValueBin("overwritten", value, sizeof(value)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(storage.WriteValueBin("stable", value, sizeof(value)), CHIP_NO_ERROR);
+
+    size_t sizeBefore = storage.GetLogSize();
+    EXPECT_EQ(storage.Compact(), CHIP_NO_ERROR);
+    EXPECT_LT(storage.GetLogSize(), sizeBefore);
+    EXPECT_EQ(storage.GetLogSize(), storage.GetLiveSize());
+    EXPECT_EQ(static_cast<size_t>(FileSize(mPath)), storage.GetLogSize());
+
+    // Writes after compaction go to the compacted file.
+    value[0] = 200;
+    EXPECT_EQ(storage.WriteValueBin("overwritten", value, sizeof(value)), CHIP_NO_ERROR);
+    storage.Shutdown();
+
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.ReadValueBin("overwritten", value, sizeof(value), readBytes), CHIP_NO_ERROR);
+    EXPECT_EQ(value[0], 200);
+    EXPECT_TRUE(storage.HasValue("stable"));
+}
+
+TEST_F(TestLinuxStorageLog, ClearAll)
+{
+    static const uint8_t kValue[] = { 1 };
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.WriteValueBin("a", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.ClearAll(), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasValue("a"));
+    storage.Shutdown();
+
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasValue("a"));
+}
+
+TEST_F(TestLinuxStorageLog, ImportIniStore)
+{
+    static const uint8_t kValue[] = { 0x00, 0x01, 0xFE, 0xFF };
+    uint8_t buf[sizeof(kValue)];
+    size_t readBytes;
+
+    {
+        ChipLinuxStorage ini;
+        ASSERT_EQ(ini.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.WriteValueBin("f/1/n", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.Commit(), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.ReadValueBin("f/1/n", buf, sizeof(buf), readBytes), CHIP_NO_ERROR);
+    EXPECT_EQ(readBytes, sizeof(kValue));
+    EXPECT_EQ(memcmp(buf, kValue, sizeof(kValue)), 0);
+}
+
+TEST_F(TestLinuxStorageLog, CorruptHeaderIsNotImported)
+{
+    static const uint8_t kValue[] = { 0x00, 0x01, 0xFE, 0xFF };
+
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("a", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+    }
+
+    // Corrupt the last byte of the magic: the file is neither a log nor an INI store anymore.
+    {
+        int fd = open(mPath.c_str(), O_WRONLY);
+        ASSERT_GE(fd, 0);
+        uint8_t garbage = 'X';
+        EXPECT_EQ(pwrite(fd, &garbage, 1, 7), 1);
+        close(fd);
+    }
+    off_t size = FileSize(mPath);
+
+    ChipLinuxStorageLog storage;
+    EXPECT_EQ(storage.Init(mPath.c_str()), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    EXPECT_EQ(FileSize(mPath), size);
+}
+
+// Compares the latency of a single Put (write + commit) between the INI and
+// log-structured backends for stores of increasing size. Stores are primed
+// with a single INI commit, which the log backend then imports, so only the
+// sampled writes pay the per-write cost.
+TEST_F(TestLinuxStorageLog, WriteLatencyBenchmark)
+{
+    constexpr size_t kStoreSizes[] = { 100, 1000, 10000 };
+    constexpr size_t kSamples      = 20;
+    uint8_t value[64]              = {};
+    char key[32];
+
+    for (size_t storeSize : kStoreSizes)
+    {
+        std::string iniPath = MakeTempPath();
+        std::string logPath = MakeTempPath();
+
+        for (const std::string & path : { iniPath, logPath })
+        {
+            ChipLinuxStorage primer;
+            ASSERT_EQ(primer.Init(path.c_str()), CHIP_NO_ERROR);
+            for (size_t i = 0; i < storeSize; i++)
+            {
+                snprintf(key, sizeof(key), "bench/%u", static_cast<unsigned>(i));
+                ASSERT_EQ(primer.WriteValueBin(key, value, sizeof(value)), CHIP_NO_ERROR);
+            }
+            ASSERT_EQ(primer.Commit(), CHIP_NO_ERROR);
+        }
+
+        ChipLinuxStorage ini;
+        ASSERT_EQ(ini.Init(iniPath.c_str()), CHIP_NO_ERROR);
+        ChipLinuxStorageLog log;
+        ASSERT_EQ(log.Init(logPath.c_str()), CHIP_NO_ERROR);
+        ASSERT_TRUE(log.HasValue("bench/0"));
+
+        System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (size_t i = 0; i < kSamples; i++)
+        {
+            snprintf(key, sizeof(key), "bench/%u", static_cast<unsigned>(i));
+            value[0] = static_cast<uint8_t>(i);
+            ASSERT_EQ(ini.WriteValueBin(key, value, sizeof(value)), CHIP_NO_ERROR);
+            ASSERT_EQ(ini.Commit(), CHIP_NO_ERROR);
+        }
+        System::Clock::Microseconds64 iniTime = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+        start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (size_t i = 0; i < kSamples; i++)
+        {
+            snprintf(key, sizeof(key), "bench/%u", static_cast<unsigned>(i));
+            value[0] = static_cast<uint8_t>(i);
+            ASSERT_EQ(log.WriteValueBin(key, value, sizeof(value)), CHIP_NO_ERROR);
+        }
+        System::Clock::Microseconds64 logTime = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+        ChipLogProgress(Test, "KVS write latency with %u keys: ini %u us/write, log %u us/write", static_cast<unsigned>(storeSize),
+                        static_cast<unsigned>(iniTime.count() / kSamples), static_cast<unsigned>(logTime.count() / kSamples));
+
+        log.Shutdown();
+        unlink(iniPath.c_str());
+        unlink(logPath.c_str());
+    }
+}
+
+} // namespace
@@ -1,7 +1,9 @@
 /**
  *    @file
  *      Implementation for the TransferSession class.
- *      // TODO: Support Asynchronous mode. Currently, only Synchronous mode is supported.
+ *
+ *      In the asynchronous control mode, the sender keeps up to a window of Blocks in flight and the receiver acknowledges them
+ *      cumulatively: a BlockAck for counter N acknowledges every Block up to and including N. Blocks must be delivered in order.
  */
 
 #include <protocols/bdx/BdxTransferSession.h>
@@ -29,11 +31,14 @@ constexpr uint8_t kBdxVersion = 0; ///< The version of this implementation of th
 CHIP_ERROR WriteToPacketBuffer(const ::chip::bdx::BdxMessage & msgStruct, ::chip::System::PacketBufferHandle & msgBuf)
 {
     size_t msgDataSize = msgStruct.MessageSize();
-    ::chip::Encoding::LittleEndian::PacketBufferWriter bbuf(chip::MessagePacketBuffer::New(msgDataSize), msgDataSize);
-    if (bbuf.IsNull())
+    // Check the allocation before handing it to the writer, which expects a valid buffer. Running out of buffers is more likely
+    // with several Blocks in flight in the asynchronous mode.
+    ::chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::New(msgDataSize);
+    if (buffer.IsNull())
     {
         return CHIP_ERROR_NO_MEMORY;
     }
+    ::chip::Encoding::LittleEndian::PacketBufferWriter bbuf(std::move(buffer), msgDataSize);
     msgStruct.WriteToBuffer(bbuf);
     msgBuf = bbuf.Finalize();
     if (msgBuf.IsNull())
@@ -212,6 +217,7 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
     VerifyOrReturnError(acceptData.MaxBlockSize <= mTransferRequestData.MaxBlockSize, CHIP_ERROR_INVALID_ARGUMENT);
 
     mTransferMaxBlockSize = acceptData.MaxBlockSize;
+    mControlMode          = acceptData.ControlMode;
 
     if (mRole == TransferRole::kSender)
     {
@@ -255,7 +261,8 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
 
     mState = TransferState::kTransferInProgress;
 
-    if ((mRole == TransferRole::kReceiver && mControlMode == TransferControlFlags::kSenderDrive) ||
+    // In the asynchronous mode the receiver waits for Blocks for the whole transfer
+    if ((mRole == TransferRole::kReceiver && mControlMode != TransferControlFlags::kReceiverDrive) ||
         (mRole == TransferRole::kSender && mControlMode == TransferControlFlags::kReceiverDrive))
     {
         mAwaitingResponse = true;
@@ -284,6 +291,7 @@ CHIP_ERROR TransferSession::PrepareBlockQuery()
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kReceiver, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!IsAsync(), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
 
     BlockQuery queryMsg;
@@ -306,6 +314,7 @@ CHIP_ERROR TransferSession::PrepareBlockQueryWithSkip(const uint64_t & bytesToSk
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kReceiver, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!IsAsync(), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
 
     BlockQueryWithSkip queryMsg;
@@ -327,7 +336,14 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    if (IsAsync())
+    {
+        VerifyOrReturnError(GetNumOutstandingBlocks() < mAsyncWindowSize, CHIP_ERROR_INCORRECT_STATE);
+    }
+    else
+    {
+        VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    }
 
     // Verify non-zero data is provided and is no longer than MaxBlockSize (BlockEOF may contain 0 length data)
     VerifyOrReturnError((inData.Data != nullptr) && (inData.Length <= mTransferMaxBlockSize), CHIP_ERROR_INVALID_ARGUMENT);
@@ -364,6 +380,8 @@ CHIP_ERROR TransferSession::PrepareBlockAck()
     VerifyOrReturnError((mState == TransferState::kTransferInProgress) || (mState == TransferState::kReceivedEOF),
                         CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
+    // In the asynchronous mode, the ack covers every Block received so far, so there must be at least one
+    VerifyOrReturnError(!IsAsync() || mNextBlockNum > 0, CHIP_ERROR_INCORRECT_STATE);
 
     CounterMessage ackMsg;
     ackMsg.BlockCounter       = mLastBlockNum;
@@ -396,6 +414,16 @@ CHIP_ERROR TransferSession::PrepareBlockAck()
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TransferSession::SetAsyncWindowSize(uint16_t windowSize)
+{
+    VerifyOrReturnError(windowSize > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mNextBlockNum == 0, CHIP_ERROR_INCORRECT_STATE);
+
+    mAsyncWindowSize = windowSize;
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR TransferSession::AbortTransfer(StatusCode reason)
 {
     VerifyOrReturnError((mState != TransferState::kUnitialized) && (mState != TransferState::kTransferDone) &&
@@ -426,6 +454,9 @@ void TransferSession::Reset()
     mLastQueryNum      = 0;
     mNextQueryNum      = 0;
 
+    mAsyncWindowSize     = CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE;
+    mNextUnackedBlockNum = 0;
+
     mTimeout                = System::Clock::kZero;
     mTimeoutStartTime       = System::Clock::kZero;
     mShouldInitTimeoutStart = true;
@@ -607,7 +638,7 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kAcceptReceived;
 
-    mAwaitingResponse = (mControlMode == TransferControlFlags::kSenderDrive);
+    mAwaitingResponse = (mControlMode != TransferControlFlags::kReceiverDrive);
     mState            = TransferState::kTransferInProgress;
 
 #if CHIP_AUTOMATION_LOGGING
@@ -653,6 +684,7 @@ void TransferSession::HandleBlockQuery(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(!IsAsync(), PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockQuery query;
@@ -671,6 +703,7 @@ void TransferSession::HandleBlockQueryWithSkip(System::PacketBufferHandle msgDat
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(!IsAsync(), PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockQueryWithSkip query;
@@ -696,7 +729,9 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
     const CHIP_ERROR err = blockMsg.Parse(msgData.Retain());
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
-    VerifyOrReturn(blockMsg.BlockCounter == mLastQueryNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+    // In the asynchronous mode Blocks are not queried for, but must arrive in sequence
+    const uint32_t expectedBlockNum = IsAsync() ? mNextBlockNum : mLastQueryNum;
+    VerifyOrReturn(blockMsg.BlockCounter == expectedBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
     VerifyOrReturn((blockMsg.DataLength > 0) && (blockMsg.DataLength <= mTransferMaxBlockSize),
                    PrepareStatusReport(StatusCode::kBadMessageContents));
 
@@ -716,8 +751,9 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
 
     mNumBytesProcessed += blockMsg.DataLength;
     mLastBlockNum = blockMsg.BlockCounter;
+    mNextBlockNum = blockMsg.BlockCounter + 1;
 
-    mAwaitingResponse = false;
+    mAwaitingResponse = IsAsync();
 }
 
 void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
@@ -730,7 +766,8 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
     const CHIP_ERROR err = blockEOFMsg.Parse(msgData.Retain());
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
-    VerifyOrReturn(blockEOFMsg.BlockCounter == mLastQueryNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+    const uint32_t expectedBlockNum = IsAsync() ? mNextBlockNum : mLastQueryNum;
+    VerifyOrReturn(blockEOFMsg.BlockCounter == expectedBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
     VerifyOrReturn(blockEOFMsg.DataLength <= mTransferMaxBlockSize, PrepareStatusReport(StatusCode::kBadMessageContents));
 
     mBlockEventData.Data         = blockEOFMsg.Data;
@@ -743,6 +780,7 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 
     mNumBytesProcessed += blockEOFMsg.DataLength;
     mLastBlockNum = blockEOFMsg.BlockCounter;
+    mNextBlockNum = blockEOFMsg.BlockCounter + 1;
 
     mAwaitingResponse = false;
     mState            = TransferState::kReceivedEOF;
@@ -755,12 +793,40 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    if (IsAsync())
+    {
+        // Blocks sent before the BlockEOF may still be acknowledged while the BlockAckEOF is pending
+        VerifyOrReturn(mState == TransferState::kTransferInProgress || mState == TransferState::kAwaitingEOFAck,
+                       PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    }
+    else
+    {
+        VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    }
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockAck ackMsg;
     const CHIP_ERROR err = ackMsg.Parse(std::move(msgData));
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+
+    if (IsAsync())
+    {
+        // The ack is cumulative and must fall within the outstanding Blocks. The BlockEOF is only acknowledged by a
+        // BlockAckEOF. Unsigned arithmetic keeps the comparison correct across counter wrap-around.
+        uint32_t ackableBlocks = GetNumOutstandingBlocks();
+        if (mState == TransferState::kAwaitingEOFAck)
+        {
+            ackableBlocks--;
+        }
+        VerifyOrReturn(ackMsg.BlockCounter - mNextUnackedBlockNum < ackableBlocks,
+                       PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+        mNextUnackedBlockNum = ackMsg.BlockCounter + 1;
+        mPendingOutput       = OutputEventType::kAckReceived;
+        mAwaitingResponse    = (GetNumOutstandingBlocks() > 0);
+        return;
+    }
+
     VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
     mPendingOutput = OutputEventType::kAckReceived;
@@ -783,7 +849,8 @@ void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
 
     mPendingOutput = OutputEventType::kAckEOFReceived;
 
-    mAwaitingResponse = false;
+    mNextUnackedBlockNum = mNextBlockNum;
+    mAwaitingResponse    = false;
 
     mState = TransferState::kTransferDone;
 
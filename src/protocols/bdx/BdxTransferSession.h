@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <system/SystemClock.h>
@@ -265,6 +266,11 @@ public:
      * @brief
      *   Prepare a Block message. The Block counter will be populated automatically.
      *
+     *   In the synchronous modes, a Block may only be prepared once the previous one was queried for (Receiver Drive) or
+     *   acknowledged (Sender Drive). In the asynchronous mode, Blocks may be prepared without waiting for the receiver until the
+     *   window of outstanding Blocks (see SetAsyncWindowSize()) is full. Each message must still be taken out with PollOutput()
+     *   before the next Block is prepared.
+     *
      * @param inData Contains data for filling out the Block message
      *
      * @return CHIP_ERROR The result of the preparation of a Block message. May also indicate if the TransferSession object
@@ -281,6 +287,20 @@ public:
      */
     CHIP_ERROR PrepareBlockAck();
 
+    /**
+     * @brief
+     *   Set the number of Blocks the sender may have outstanding (sent but not yet acknowledged) when the asynchronous control mode
+     *   is used. BlockAcks are cumulative in that mode, so the receiver does not need to acknowledge every Block.
+     *
+     *   Has no effect on the synchronous modes, where a single Block is outstanding at a time. Reset() restores the default of
+     *   CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE.
+     *
+     * @param windowSize Number of outstanding Blocks, must not be 0
+     *
+     * @return CHIP_ERROR_INVALID_ARGUMENT if windowSize is 0, CHIP_ERROR_INCORRECT_STATE if Blocks were already sent.
+     */
+    CHIP_ERROR SetAsyncWindowSize(uint16_t windowSize);
+
     /**
      * @brief
      *   Prematurely end a transfer with a StatusReport. Must still call Reset() to prepare the TransferSession for another
@@ -320,6 +340,9 @@ public:
     uint16_t GetTransferBlockSize() const { return mTransferMaxBlockSize; }
     uint32_t GetNextBlockNum() const { return mNextBlockNum; }
     uint32_t GetNextQueryNum() const { return mNextQueryNum; }
+    uint16_t GetAsyncWindowSize() const { return mAsyncWindowSize; }
+    /// Number of Blocks sent but not yet acknowledged by the receiver. Only tracked in the asynchronous mode.
+    uint32_t GetNumOutstandingBlocks() const { return mNextBlockNum - mNextUnackedBlockNum; }
     size_t GetNumBytesProcessed() const { return mNumBytesProcessed; }
     const uint8_t * GetFileDesignator(uint16_t & fileDesignatorLen) const
     {
@@ -371,6 +394,7 @@ private:
 
     void PrepareStatusReport(StatusCode code);
     bool IsTransferLengthDefinite() const;
+    bool IsAsync() const { return mControlMode == TransferControlFlags::kAsync; }
 
     OutputEventType mPendingOutput = OutputEventType::kNone;
     TransferState mState           = TransferState::kUnitialized;
@@ -403,6 +427,10 @@ private:
     uint32_t mLastQueryNum = 0;
     uint32_t mNextQueryNum = 0;
 
+    // Asynchronous mode: Blocks in [mNextUnackedBlockNum, mNextBlockNum) have been sent and not acknowledged yet
+    uint16_t mAsyncWindowSize     = CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE;
+    uint32_t mNextUnackedBlockNum = 0;
+
     System::Clock::Timeout mTimeout            = System::Clock::kZero;
     System::Clock::Timestamp mTimeoutStartTime = System::Clock::kZero;
     bool mShouldInitTimeoutStart               = true;
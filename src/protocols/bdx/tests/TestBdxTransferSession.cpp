@@ -1,5 +1,8 @@
 #include <string.h>
 
+#include <algorithm>
+#include <deque>
+
 #include <pw_unit_test/framework.h>
 
 #include <lib/core/StringBuilderAdapters.h>
@@ -7,6 +10,7 @@
 #include <lib/support/BufferReader.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <protocols/Protocols.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <protocols/bdx/BdxTransferSession.h>
@@ -759,3 +763,445 @@ TEST_F(TestBdxTransferSession, TestRejectTransfer)
     // Reject the transfer with a status
     SendAndVerifyRejectMsg(outEvent, respondingSender, StatusCode::kResponderBusy, initiatingReceiver);
 }
+
+// Helper method for negotiating a transfer in the asynchronous control mode between an initiating receiver and a responding sender
+// that both also support Receiver Drive.
+void SetUpAsyncTransfer(TransferSession & initiatingReceiver, TransferSession & respondingSender, uint16_t blockSize,
+                        uint16_t windowSize)
+{
+    TransferSession::OutputEvent outEvent;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+
+    // An Init message must always propose a synchronous mode alongside the asynchronous one
+    BitFlags<TransferControlFlags> controlOpts(TransferControlFlags::kAsync, TransferControlFlags::kReceiverDrive);
+
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = controlOpts;
+    initOptions.MaxBlockSize     = blockSize;
+    static char testFileDes[9]   = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+
+    SendAndVerifyTransferInit(outEvent, timeout, initiatingReceiver, TransferRole::kReceiver, initOptions, respondingSender,
+                              controlOpts, blockSize);
+
+    EXPECT_EQ(respondingSender.SetAsyncWindowSize(windowSize), CHIP_NO_ERROR);
+
+    // More than one mode is common to both nodes, so the responder picks
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = TransferControlFlags::kAsync;
+    acceptData.MaxBlockSize = blockSize;
+
+    SendAndVerifyAcceptMsg(outEvent, respondingSender, TransferRole::kSender, acceptData, initiatingReceiver, initOptions);
+
+    EXPECT_EQ(respondingSender.GetControlMode(), TransferControlFlags::kAsync);
+    EXPECT_EQ(initiatingReceiver.GetControlMode(), TransferControlFlags::kAsync);
+}
+
+// Helper method for preparing a Block in the asynchronous mode. The message is left in outEvent so the caller decides when it is
+// delivered.
+void PrepareAsyncBlock(TransferSession & sender, TransferSession::OutputEvent & outEvent, bool isEof)
+{
+    static uint8_t fakeData[64] = { 0 };
+
+    TransferSession::BlockData blockData;
+    blockData.Data   = fakeData;
+    blockData.Length = std::min<size_t>(sizeof(fakeData), sender.GetTransferBlockSize());
+    blockData.IsEof  = isEof;
+
+    EXPECT_EQ(sender.PrepareBlock(blockData), CHIP_NO_ERROR);
+    sender.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(outEvent, isEof ? MessageType::BlockEOF : MessageType::Block);
+    VerifyNoMoreOutput(sender);
+}
+
+// Helper method for passing a Block prepared with PrepareAsyncBlock() to the receiver.
+void DeliverAsyncBlock(TransferSession & receiver, TransferSession::OutputEvent & blockEvent, uint32_t expectedBlockCounter)
+{
+    TransferSession::OutputEvent outEvent;
+
+    EXPECT_EQ(AttachHeaderAndSend(blockEvent.msgTypeData, std::move(blockEvent.MsgData), receiver), CHIP_NO_ERROR);
+    receiver.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kBlockReceived);
+    EXPECT_EQ(outEvent.blockdata.BlockCounter, expectedBlockCounter);
+    VerifyNoMoreOutput(receiver);
+}
+
+// Test a full transfer in the asynchronous mode: the sender keeps a window of Blocks in flight and the receiver acknowledges them
+// cumulatively.
+TEST_F(TestBdxTransferSession, TestAsyncWindowedTransfer)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession::OutputEvent blockEvents[4];
+    TransferSession initiatingReceiver;
+    TransferSession respondingSender;
+
+    constexpr uint16_t kWindowSize = 4;
+
+    EXPECT_EQ(respondingSender.SetAsyncWindowSize(0), CHIP_ERROR_INVALID_ARGUMENT);
+    SetUpAsyncTransfer(initiatingReceiver, respondingSender, 64, kWindowSize);
+    EXPECT_EQ(respondingSender.GetAsyncWindowSize(), kWindowSize);
+
+    // The receiver does not query for Blocks, and has nothing to acknowledge yet
+    EXPECT_EQ(initiatingReceiver.PrepareBlockQuery(), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(initiatingReceiver.PrepareBlockAck(), CHIP_ERROR_INCORRECT_STATE);
+
+    // The sender may fill the window without waiting for the receiver, but not go past it
+    for (uint32_t i = 0; i < kWindowSize; i++)
+    {
+        PrepareAsyncBlock(respondingSender, blockEvents[i], false);
+    }
+    EXPECT_EQ(respondingSender.GetNumOutstandingBlocks(), kWindowSize);
+
+    uint8_t moreData[8] = { 0 };
+    TransferSession::BlockData blockData;
+    blockData.Data   = moreData;
+    blockData.Length = sizeof(moreData);
+    EXPECT_EQ(respondingSender.PrepareBlock(blockData), CHIP_ERROR_INCORRECT_STATE);
+
+    // A single BlockAck acknowledges every Block delivered so far
+    DeliverAsyncBlock(initiatingReceiver, blockEvents[0], 0);
+    DeliverAsyncBlock(initiatingReceiver, blockEvents[1], 1);
+    DeliverAsyncBlock(initiatingReceiver, blockEvents[2], 2);
+    SendAndVerifyBlockAck(respondingSender, initiatingReceiver, outEvent, false);
+    EXPECT_EQ(respondingSender.GetNumOutstandingBlocks(), 1u);
+
+    // Which opens the window for more Blocks
+    PrepareAsyncBlock(respondingSender, blockEvents[0], false);
+    PrepareAsyncBlock(respondingSender, blockEvents[1], false);
+    EXPECT_EQ(respondingSender.GetNumOutstandingBlocks(), 3u);
+
+    DeliverAsyncBlock(initiatingReceiver, blockEvents[3], 3);
+    DeliverAsyncBlock(initiatingReceiver, blockEvents[0], 4);
+
+    // Blocks sent before the BlockEOF may still be acknowledged while the sender waits for the BlockAckEOF
+    PrepareAsyncBlock(respondingSender, blockEvents[2], true);
+    SendAndVerifyBlockAck(respondingSender, initiatingReceiver, outEvent, false);
+    EXPECT_EQ(respondingSender.GetNumOutstandingBlocks(), 2u);
+
+    DeliverAsyncBlock(initiatingReceiver, blockEvents[1], 5);
+    DeliverAsyncBlock(initiatingReceiver, blockEvents[2], 6);
+    SendAndVerifyBlockAck(respondingSender, initiatingReceiver, outEvent, true);
+    EXPECT_EQ(respondingSender.GetNumOutstandingBlocks(), 0u);
+    EXPECT_EQ(respondingSender.GetNextBlockNum(), 7u);
+}
+
+// Test that the asynchronous mode rejects Blocks received out of sequence, acks that do not cover outstanding Blocks, and queries.
+TEST_F(TestBdxTransferSession, TestAsyncWindowErrors)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession::OutputEvent blockEvents[2];
+
+    // A skipped Block is detected by the receiver
+    {
+        TransferSession initiatingReceiver;
+        TransferSession respondingSender;
+        SetUpAsyncTransfer(initiatingReceiver, respondingSender, 64, 4);
+
+        PrepareAsyncBlock(respondingSender, blockEvents[0], false);
+        PrepareAsyncBlock(respondingSender, blockEvents[1], false);
+
+        EXPECT_EQ(AttachHeaderAndSend(blockEvents[1].msgTypeData, std::move(blockEvents[1].MsgData), initiatingReceiver),
+                  CHIP_NO_ERROR);
+        initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+        EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kMsgToSend);
+        VerifyStatusReport(outEvent.MsgData, StatusCode::kBadBlockCounter);
+    }
+
+    // A stale ack, replayed after the Blocks it covers were acknowledged, is detected by the sender
+    {
+        TransferSession initiatingReceiver;
+        TransferSession respondingSender;
+        SetUpAsyncTransfer(initiatingReceiver, respondingSender, 64, 4);
+
+        PrepareAsyncBlock(respondingSender, blockEvents[0], false);
+        DeliverAsyncBlock(initiatingReceiver, blockEvents[0], 0);
+
+        EXPECT_EQ(initiatingReceiver.PrepareBlockAck(), CHIP_NO_ERROR);
+        initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+        VerifyBdxMessageToSend(outEvent, MessageType::BlockAck);
+        System::PacketBufferHandle ackCopy =
+            System::PacketBufferHandle::NewWithData(outEvent.MsgData->Start(), outEvent.MsgData->DataLength());
+        TransferSession::MessageTypeData ackType = outEvent.msgTypeData;
+
+        EXPECT_EQ(AttachHeaderAndSend(ackType, std::move(outEvent.MsgData), respondingSender), CHIP_NO_ERROR);
+        respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+        EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kAckReceived);
+
+        PrepareAsyncBlock(respondingSender, blockEvents[0], false);
+        EXPECT_EQ(AttachHeaderAndSend(ackType, std::move(ackCopy), respondingSender), CHIP_NO_ERROR);
+        respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+        EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kMsgToSend);
+        VerifyStatusReport(outEvent.MsgData, StatusCode::kBadBlockCounter);
+    }
+
+    // BlockQuery is not part of the asynchronous mode
+    {
+        TransferSession initiatingReceiver;
+        TransferSession respondingSender;
+        SetUpAsyncTransfer(initiatingReceiver, respondingSender, 64, 4);
+
+        PrepareAsyncBlock(respondingSender, blockEvents[0], false);
+
+        BlockQuery queryMsg;
+        queryMsg.BlockCounter = 1;
+        size_t msgSize        = queryMsg.MessageSize();
+        Encoding::LittleEndian::PacketBufferWriter bbuf(System::PacketBufferHandle::New(msgSize), msgSize);
+        ASSERT_FALSE(bbuf.IsNull());
+        queryMsg.WriteToBuffer(bbuf);
+
+        TransferSession::MessageTypeData queryType;
+        queryType.ProtocolId  = Protocols::BDX::Id;
+        queryType.MessageType = to_underlying(MessageType::BlockQuery);
+        EXPECT_EQ(AttachHeaderAndSend(queryType, bbuf.Finalize(), respondingSender), CHIP_NO_ERROR);
+        respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+        EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kMsgToSend);
+        VerifyStatusReport(outEvent.MsgData, StatusCode::kUnexpectedMessage);
+    }
+}
+
+namespace {
+
+// Carries messages between the two TransferSession objects of a transfer over a simulated link, in virtual time. Each direction
+// is serialized at the link bandwidth, and every message arrives a fixed one-way latency after it was fully transmitted.
+class SimulatedLink
+{
+public:
+    SimulatedLink(TransferSession & sender, TransferSession & receiver, System::Clock::Microseconds64 latency,
+                  uint32_t bytesPerSecond) :
+        mLatency(latency),
+        mBytesPerSecond(bytesPerSecond)
+    {
+        mDirections[0].to = &receiver;
+        mDirections[1].to = &sender;
+    }
+
+    void Send(TransferSession & to, const TransferSession::MessageTypeData & type, System::PacketBufferHandle && msg)
+    {
+        Direction & direction = (&to == mDirections[0].to) ? mDirections[0] : mDirections[1];
+
+        const System::Clock::Microseconds64 transmitTime((msg->DataLength() + kMessageOverhead) * 1000000u / mBytesPerSecond);
+        direction.busyUntil = std::max(direction.busyUntil, mNow) + transmitTime;
+        direction.inFlight.push_back({ direction.busyUntil + mLatency, type, std::move(msg) });
+    }
+
+    // Delivers the message that arrives first and advances the virtual time to its arrival. Returns false if nothing is in flight.
+    bool DeliverNext()
+    {
+        Direction * next = nullptr;
+        for (Direction & direction : mDirections)
+        {
+            if (!direction.inFlight.empty() &&
+                (next == nullptr || direction.inFlight.front().arrival < next->inFlight.front().arrival))
+            {
+                next = &direction;
+            }
+        }
+        VerifyOrReturnValue(next != nullptr, false);
+
+        Message message = std::move(next->inFlight.front());
+        next->inFlight.pop_front();
+        mNow = message.arrival;
+
+        PayloadHeader payloadHeader;
+        payloadHeader.SetMessageType(message.type.ProtocolId, message.type.MessageType);
+        EXPECT_EQ(next->to->HandleMessageReceived(payloadHeader, std::move(message.data), Now()), CHIP_NO_ERROR);
+        return true;
+    }
+
+    System::Clock::Timestamp Now() const { return std::chrono::duration_cast<System::Clock::Timestamp>(mNow); }
+    System::Clock::Microseconds64 NowMicroseconds() const { return mNow; }
+
+private:
+    // Approximate size of the secure message header, MIC and transport framing around each BDX message
+    static constexpr size_t kMessageOverhead = 40;
+
+    struct Message
+    {
+        System::Clock::Microseconds64 arrival;
+        TransferSession::MessageTypeData type;
+        System::PacketBufferHandle data;
+    };
+
+    struct Direction
+    {
+        TransferSession * to = nullptr;
+        System::Clock::Microseconds64 busyUntil{ 0 };
+        std::deque<Message> inFlight;
+    };
+
+    const System::Clock::Microseconds64 mLatency;
+    const uint32_t mBytesPerSecond;
+    System::Clock::Microseconds64 mNow{ 0 };
+    Direction mDirections[2];
+};
+
+// Runs a complete transfer of transferSize bytes over a SimulatedLink and returns the throughput in bytes per second of virtual
+// time, from the Accept message to the final acknowledgement. A windowSize of 0 selects the synchronous Receiver Drive mode.
+uint64_t RunSimulatedTransfer(uint16_t windowSize, uint16_t blockSize, System::Clock::Microseconds64 latency,
+                              uint32_t bytesPerSecond, size_t transferSize)
+{
+    static uint8_t blockPayload[1024] = { 0 };
+
+    TransferSession initiatingReceiver;
+    TransferSession respondingSender;
+    TransferSession::OutputEvent outEvent;
+    System::Clock::Timeout timeout       = System::Clock::Seconds16(60);
+    const TransferControlFlags driveMode = (windowSize > 0) ? TransferControlFlags::kAsync : TransferControlFlags::kReceiverDrive;
+    BitFlags<TransferControlFlags> controlOpts(driveMode, TransferControlFlags::kReceiverDrive);
+
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = controlOpts;
+    initOptions.MaxBlockSize     = blockSize;
+    char testFileDes[9]          = { "test.bin" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+
+    SendAndVerifyTransferInit(outEvent, timeout, initiatingReceiver, TransferRole::kReceiver, initOptions, respondingSender,
+                              controlOpts, blockSize);
+    if (windowSize > 0)
+    {
+        EXPECT_EQ(respondingSender.SetAsyncWindowSize(windowSize), CHIP_NO_ERROR);
+    }
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = driveMode;
+    acceptData.MaxBlockSize = blockSize;
+    acceptData.Length       = transferSize;
+    EXPECT_EQ(respondingSender.AcceptTransfer(acceptData), CHIP_NO_ERROR);
+
+    SimulatedLink link(respondingSender, initiatingReceiver, latency, bytesPerSecond);
+    size_t bytesSent     = 0;
+    size_t bytesReceived = 0;
+    bool done            = false;
+    // Ack often enough that the window never runs empty while acks are in flight
+    const uint32_t ackInterval = std::max<uint32_t>(1, windowSize / 2u);
+
+    auto sendBlock = [&]() {
+        TransferSession::BlockData blockData;
+        blockData.Data   = blockPayload;
+        blockData.Length = std::min<size_t>(blockSize, transferSize - bytesSent);
+        blockData.IsEof  = (bytesSent + blockData.Length == transferSize);
+        EXPECT_EQ(respondingSender.PrepareBlock(blockData), CHIP_NO_ERROR);
+        bytesSent += blockData.Length;
+    };
+
+    // Processes the pending output of both sessions; returns once neither has anything left to do.
+    auto pump = [&]() {
+        bool progress = true;
+        while (progress)
+        {
+            progress = false;
+
+            respondingSender.PollOutput(outEvent, link.Now());
+            switch (outEvent.EventType)
+            {
+            case TransferSession::OutputEventType::kMsgToSend:
+                link.Send(initiatingReceiver, outEvent.msgTypeData, std::move(outEvent.MsgData));
+                progress = true;
+                break;
+            case TransferSession::OutputEventType::kQueryReceived:
+                sendBlock();
+                progress = true;
+                break;
+            case TransferSession::OutputEventType::kAckReceived:
+                progress = true;
+                break;
+            case TransferSession::OutputEventType::kAckEOFReceived:
+                done = true;
+                break;
+            case TransferSession::OutputEventType::kNone:
+                if (windowSize > 0 && bytesSent < transferSize && respondingSender.GetNumOutstandingBlocks() < windowSize)
+                {
+                    sendBlock();
+                    progress = true;
+                }
+                break;
+            default:
+                ADD_FAILURE() << "Unexpected sender event " << TransferSession::OutputEvent::TypeToString(outEvent.EventType);
+                return;
+            }
+
+            initiatingReceiver.PollOutput(outEvent, link.Now());
+            switch (outEvent.EventType)
+            {
+            case TransferSession::OutputEventType::kMsgToSend:
+                link.Send(respondingSender, outEvent.msgTypeData, std::move(outEvent.MsgData));
+                progress = true;
+                break;
+            case TransferSession::OutputEventType::kAcceptReceived:
+                EXPECT_EQ(initiatingReceiver.PrepareBlockQuery(), windowSize > 0 ? CHIP_ERROR_INCORRECT_STATE : CHIP_NO_ERROR);
+                progress = true;
+                break;
+            case TransferSession::OutputEventType::kBlockReceived:
+                bytesReceived += outEvent.blockdata.Length;
+                if (outEvent.blockdata.IsEof || (windowSize > 0 && (outEvent.blockdata.BlockCounter + 1) % ackInterval == 0))
+                {
+                    EXPECT_EQ(initiatingReceiver.PrepareBlockAck(), CHIP_NO_ERROR);
+                }
+                else if (windowSize == 0)
+                {
+                    EXPECT_EQ(initiatingReceiver.PrepareBlockQuery(), CHIP_NO_ERROR);
+                }
+                progress = true;
+                break;
+            case TransferSession::OutputEventType::kNone:
+                break;
+            default:
+                ADD_FAILURE() << "Unexpected receiver event " << TransferSession::OutputEvent::TypeToString(outEvent.EventType);
+                return;
+            }
+        }
+    };
+
+    pump();
+    while (!done && link.DeliverNext())
+    {
+        pump();
+    }
+
+    EXPECT_TRUE(done);
+    EXPECT_EQ(bytesReceived, transferSize);
+    VerifyOrReturnValue(link.NowMicroseconds().count() > 0, 0);
+    return transferSize * 1000000u / link.NowMicroseconds().count();
+}
+
+} // namespace
+
+// Measures the throughput of the synchronous and asynchronous modes for different link latencies and block sizes. The transfers
+// run in virtual time over a simulated link, so the results are deterministic and the test takes little wall-clock time.
+TEST_F(TestBdxTransferSession, TestWindowedTransferBenchmark)
+{
+    constexpr size_t kTransferSize     = 64 * 1024;
+    constexpr uint32_t kBytesPerSecond = 125000; // 1 Mbit/s
+    constexpr uint16_t kBlockSizes[]   = { 256, 1024 };
+    constexpr uint32_t kLatenciesMs[]  = { 1, 20, 100 };
+    constexpr uint16_t kWindowSizes[]  = { 0, 4, 8 };
+
+    for (uint32_t latencyMs : kLatenciesMs)
+    {
+        for (uint16_t blockSize : kBlockSizes)
+        {
+            uint64_t syncThroughput = 0;
+            for (uint16_t windowSize : kWindowSizes)
+            {
+                const uint64_t throughput = RunSimulatedTransfer(windowSize, blockSize, System::Clock::Milliseconds64(latencyMs),
+                                                                 kBytesPerSecond, kTransferSize);
+                ChipLogProgress(Test, "BDX %s window %2u, block %4u B, latency %3u ms: %6u B/s",
+                                windowSize > 0 ? "async" : "sync ", static_cast<unsigned>(windowSize),
+                                static_cast<unsigned>(blockSize), static_cast<unsigned>(latencyMs),
+                                static_cast<unsigned>(throughput));
+
+                if (windowSize == 0)
+                {
+                    syncThroughput = throughput;
+                }
+                else
+                {
+                    // Keeping Blocks in flight never does worse than one Block per round trip
+                    EXPECT_GE(throughput, syncThroughput);
+                }
+            }
+        }
+    }
+}
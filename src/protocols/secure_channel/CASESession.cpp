@@ -369,6 +369,11 @@ void CASESession::Clear()
 {
     MATTER_TRACE_SCOPE("Clear", "CASESession");
     // Cancel any outstanding work.
+    if (mHandleSigma2Helper)
+    {
+        mHandleSigma2Helper->CancelWork();
+        mHandleSigma2Helper.reset();
+    }
     if (mSendSigma3Helper)
     {
         mSendSigma3Helper->CancelWork();
@@ -1436,27 +1441,18 @@ CHIP_ERROR CASESession::ParseSigma2Resume(ContiguousBufferTLVReader & tlvReader,
 CHIP_ERROR CASESession::HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("HandleSigma2_and_SendSigma3", "CASESession");
-    CHIP_ERROR err = HandleSigma2(std::move(msg));
-    MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
-    SuccessOrExit(err);
-
-    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma3);
-    err = SendSigma3a();
-    if (CHIP_NO_ERROR != err)
-    {
-        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma3, err);
-    }
-
-exit:
+    // Sigma3 is sent by HandleSigma2c, once the responder credentials have been validated in the background.
+    CHIP_ERROR err = HandleSigma2a(std::move(msg));
     if (CHIP_NO_ERROR != err)
     {
+        MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
         mState = State::kInitialized;
     }
     return err;
 }
 
-CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
+CHIP_ERROR CASESession::HandleSigma2a(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("HandleSigma2", "CASESession");
     ChipLogProgress(SecureChannel, "Received Sigma2 msg");
@@ -1467,12 +1463,15 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
     size_t buflen       = msg->DataLength();
     VerifyOrReturnError(buf != nullptr, CHIP_ERROR_MESSAGE_INCOMPLETE);
 
-    FabricId fabricId = kUndefinedFabricId;
+    auto helper = WorkHelper<HandleSigma2Data>::Create(*this, &HandleSigma2b, &CASESession::HandleSigma2c);
+    VerifyOrReturnError(helper, CHIP_ERROR_NO_MEMORY);
+    auto & data = helper->mData;
+
     {
         VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
         const auto * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
         VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INCORRECT_STATE);
-        fabricId = fabricInfo->GetFabricId();
+        data.fabricId = fabricInfo->GetFabricId();
     }
 
     System::PacketBufferTLVReader tlvReader;
@@ -1503,68 +1502,139 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
                                          nullptr, 0, parsedSigma2.msgR2MIC.data(), parsedSigma2.msgR2MIC.size(), sr2k.KeyHandle(),
                                          kTBEData2_Nonce, kTBEDataNonceLength, parsedSigma2.msgR2EncryptedPayload.data()));
 
-    parsedSigma2.msgR2Decrypted = std::move(parsedSigma2.msgR2Encrypted);
+    data.msgR2Decrypted         = std::move(parsedSigma2.msgR2Encrypted);
     size_t msgR2DecryptedLength = parsedSigma2.msgR2EncryptedPayload.size();
 
-    ContiguousBufferTLVReader decryptedDataTlvReader;
-    decryptedDataTlvReader.Init(parsedSigma2.msgR2Decrypted.Get(), msgR2DecryptedLength);
-    ParsedSigma2TBEData parsedSigma2TBEData;
-    ReturnErrorOnFailure(ParseSigma2TBEData(decryptedDataTlvReader, parsedSigma2TBEData));
-
-    // Validate responder identity located in msgR2Decrypted
-    // Constructing responder identity
-    P256PublicKey responderPublicKey;
     {
-        NodeId responderNodeId;
+        ContiguousBufferTLVReader decryptedDataTlvReader;
+        decryptedDataTlvReader.Init(data.msgR2Decrypted.Get(), msgR2DecryptedLength);
+        ParsedSigma2TBEData parsedSigma2TBEData;
+        ReturnErrorOnFailure(ParseSigma2TBEData(decryptedDataTlvReader, parsedSigma2TBEData));
 
-        CompressedFabricId unused;
-        FabricId responderFabricId;
-        ReturnErrorOnFailure(SetEffectiveTime());
-        ReturnErrorOnFailure(mFabricsTable->VerifyCredentials(mFabricIndex, parsedSigma2TBEData.responderNOC,
-                                                              parsedSigma2TBEData.responderICAC, mValidContext, unused,
-                                                              responderFabricId, responderNodeId, responderPublicKey));
-        VerifyOrReturnError(fabricId == responderFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
-        // Verify that responderNodeId (from responderNOC) matches one that was included
-        // in the computation of the Destination Identifier when generating Sigma1.
-        VerifyOrReturnError(mPeerNodeId == responderNodeId, CHIP_ERROR_INVALID_CASE_PARAMETER);
-    }
-
-    // Construct msgR2Signed and validate the signature in msgR2Decrypted.
-    size_t msgR2SignedLen = EstimateStructOverhead(parsedSigma2TBEData.responderNOC.size(),  // resonderNOC
-                                                   parsedSigma2TBEData.responderICAC.size(), // responderICAC
-                                                   kP256_PublicKey_Length,                   // responderEphPubKey
-                                                   kP256_PublicKey_Length                    // initiatorEphPubKey
+        data.responderNOC      = parsedSigma2TBEData.responderNOC;
+        data.responderICAC     = parsedSigma2TBEData.responderICAC;
+        data.resumptionId      = parsedSigma2TBEData.resumptionId;
+        data.tbsData2Signature = parsedSigma2TBEData.tbsData2Signature;
+    }
+
+    data.responderSessionId                 = parsedSigma2.responderSessionId;
+    data.responderSessionParamStructPresent = parsedSigma2.responderSessionParamStructPresent;
+    data.responderSessionParams             = parsedSigma2.responderSessionParams;
+
+    // Construct msgR2Signed, whose signature is validated along with the responder identity in HandleSigma2b.
+    size_t msgR2SignedLen = EstimateStructOverhead(data.responderNOC.size(),  // resonderNOC
+                                                   data.responderICAC.size(), // responderICAC
+                                                   kP256_PublicKey_Length,    // responderEphPubKey
+                                                   kP256_PublicKey_Length     // initiatorEphPubKey
     );
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
-    VerifyOrReturnError(msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
-    MutableByteSpan msgR2SignedSpan{ msgR2Signed.Get(), msgR2SignedLen };
+    VerifyOrReturnError(data.msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
+    data.msgR2SignedSpan = MutableByteSpan{ data.msgR2Signed.Get(), msgR2SignedLen };
 
-    ReturnErrorOnFailure(ConstructTBSData(parsedSigma2TBEData.responderNOC, parsedSigma2TBEData.responderICAC,
-                                          ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
-                                          ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()), msgR2SignedSpan));
+    ReturnErrorOnFailure(ConstructTBSData(data.responderNOC, data.responderICAC, ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
+                                          ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
+                                          data.msgR2SignedSpan));
+
+    {
+        MutableByteSpan fabricRCAC{ data.rootCertBuf };
+        ReturnErrorOnFailure(mFabricsTable->FetchRootCert(mFabricIndex, fabricRCAC));
+        data.fabricRCAC = fabricRCAC;
+        ReturnErrorOnFailure(SetEffectiveTime());
+        data.validContext = mValidContext;
+    }
+
+    // Look up the chain among the ones already validated, so that the background step can skip validating it again
+    if (VerifiedCertChainCache::IsCacheable(data.validContext) &&
+        VerifiedCertChainCache::ComputeDigest(data.responderNOC, data.responderICAC, data.fabricRCAC, data.chainDigest) ==
+            CHIP_NO_ERROR)
+    {
+        data.chainDigestValid = true;
+        data.chainVerified =
+            mFabricsTable->GetVerifiedCertChainCache().Lookup(data.chainDigest, data.validContext, data.verifiedChain);
+    }
+
+    ReturnErrorOnFailure(helper->ScheduleWork());
+    mHandleSigma2Helper = helper;
+    mExchangeCtxt.Value()->WillSendMessage();
+    mState = State::kHandleSigma2Pending;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::HandleSigma2b(HandleSigma2Data & data, bool & cancel)
+{
+    // Validate responder identity located in msgR2Decrypted
+    if (!data.chainVerified)
+    {
+        ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.responderNOC, data.responderICAC, data.fabricRCAC,
+                                                            data.validContext, data.verifiedChain));
+    }
+    VerifyOrReturnError(data.fabricId == data.verifiedChain.fabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
 
     // Validate signature
-    ReturnErrorOnFailure(responderPublicKey.ECDSA_validate_msg_signature(msgR2SignedSpan.data(), msgR2SignedSpan.size(),
-                                                                         parsedSigma2TBEData.tbsData2Signature));
+    ReturnErrorOnFailure(data.verifiedChain.nocPublicKey.ECDSA_validate_msg_signature(
+        data.msgR2SignedSpan.data(), data.msgR2SignedSpan.size(), data.tbsData2Signature));
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::HandleSigma2c(HandleSigma2Data & data, CHIP_ERROR status)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    VerifyOrExit(mState == State::kHandleSigma2Pending, err = CHIP_ERROR_INCORRECT_STATE);
+
+    SuccessOrExit(err = status);
+
+    if (data.chainDigestValid && !data.chainVerified)
+    {
+        mFabricsTable->GetVerifiedCertChainCache().Insert(data.chainDigest, data.validContext, data.verifiedChain);
+    }
+
+    // Verify that responderNodeId (from responderNOC) matches one that was included
+    // in the computation of the Destination Identifier when generating Sigma1.
+    VerifyOrExit(mPeerNodeId == data.verifiedChain.nodeId, err = CHIP_ERROR_INVALID_CASE_PARAMETER);
 
     ChipLogDetail(SecureChannel, "Peer " ChipLogFormatScopedNodeId " assigned session ID %d", ChipLogValueScopedNodeId(GetPeer()),
-                  parsedSigma2.responderSessionId);
-    SetPeerSessionId(parsedSigma2.responderSessionId);
+                  data.responderSessionId);
+    SetPeerSessionId(data.responderSessionId);
 
-    std::copy(parsedSigma2TBEData.resumptionId.begin(), parsedSigma2TBEData.resumptionId.end(), mNewResumptionId.begin());
+    std::copy(data.resumptionId.begin(), data.resumptionId.end(), mNewResumptionId.begin());
 
     // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
-    ReturnErrorOnFailure(ExtractCATsFromOpCert(parsedSigma2TBEData.responderNOC, mPeerCATs));
+    SuccessOrExit(err = ExtractCATsFromOpCert(data.responderNOC, mPeerCATs));
 
-    if (parsedSigma2.responderSessionParamStructPresent)
+    if (data.responderSessionParamStructPresent)
     {
-        SetRemoteSessionParameters(parsedSigma2.responderSessionParams);
+        SetRemoteSessionParameters(data.responderSessionParams);
         mExchangeCtxt.Value()->GetSessionHandle()->AsUnauthenticatedSession()->SetRemoteSessionParameters(
             GetRemoteSessionParameters());
     }
 
-    return CHIP_NO_ERROR;
+exit:
+    mHandleSigma2Helper.reset();
+    MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma1, err);
+
+    if (err == CHIP_NO_ERROR)
+    {
+        MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma3);
+        err = SendSigma3a();
+        if (err != CHIP_NO_ERROR)
+        {
+            MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma3, err);
+        }
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        // Abort the pending establish, which is normally done by CASESession::OnMessageReceived,
+        // but in the background processing case must be done here.
+        DiscardExchange();
+        AbortPendingEstablish(err);
+    }
+
+    return err;
 }
 
 CHIP_ERROR CASESession::ParseSigma2(ContiguousBufferTLVReader & tlvReader, ParsedSigma2 & outParsedSigma2)
@@ -2001,6 +2071,16 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
             SuccessOrExit(err = signedDataTlvReader.ExitContainer(containerType));
         }
 
+        // Look up the chain among the ones already validated, so that the background step can skip validating it again
+        if (VerifiedCertChainCache::IsCacheable(data.validContext) &&
+            VerifiedCertChainCache::ComputeDigest(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC, data.chainDigest) ==
+                CHIP_NO_ERROR)
+        {
+            data.chainDigestValid = true;
+            data.chainVerified =
+                mFabricsTable->GetVerifiedCertChainCache().Lookup(data.chainDigest, data.validContext, data.verifiedChain);
+        }
+
         SuccessOrExit(err = helper->ScheduleWork());
         mHandleSigma3Helper = helper;
         mExchangeCtxt.Value()->WillSendMessage();
@@ -2089,16 +2169,17 @@ CHIP_ERROR CASESession::HandleSigma3b(HandleSigma3Data & data, bool & cancel)
     // Step 5/6
     // Validate initiator identity located in msg->Start()
     // Constructing responder identity
-    CompressedFabricId unused;
-    FabricId initiatorFabricId;
-    P256PublicKey initiatorPublicKey;
-    ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC, data.validContext,
-                                                        unused, initiatorFabricId, data.initiatorNodeId, initiatorPublicKey));
-    VerifyOrReturnError(data.fabricId == initiatorFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
+    if (!data.chainVerified)
+    {
+        ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC,
+                                                            data.validContext, data.verifiedChain));
+    }
+    data.initiatorNodeId = data.verifiedChain.nodeId;
+    VerifyOrReturnError(data.fabricId == data.verifiedChain.fabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
 
     // Step 7 - Validate Signature
-    ReturnErrorOnFailure(initiatorPublicKey.ECDSA_validate_msg_signature(data.msgR3SignedSpan.data(), data.msgR3SignedSpan.size(),
-                                                                         data.tbsData3Signature));
+    ReturnErrorOnFailure(data.verifiedChain.nocPublicKey.ECDSA_validate_msg_signature(
+        data.msgR3SignedSpan.data(), data.msgR3SignedSpan.size(), data.tbsData3Signature));
 
     return CHIP_NO_ERROR;
 }
@@ -2111,6 +2192,11 @@ CHIP_ERROR CASESession::HandleSigma3c(HandleSigma3Data & data, CHIP_ERROR status
 
     SuccessOrExit(err = status);
 
+    if (data.chainDigestValid && !data.chainVerified)
+    {
+        mFabricsTable->GetVerifiedCertChainCache().Insert(data.chainDigest, data.validContext, data.verifiedChain);
+    }
+
     mPeerNodeId = data.initiatorNodeId;
 
     {
@@ -2646,6 +2732,13 @@ bool CASESession::InvokeBackgroundWorkWatchdog()
 {
     bool watchdogFired = false;
 
+    if (mHandleSigma2Helper && mHandleSigma2Helper->UnableToScheduleAfterWorkCallback())
+    {
+        ChipLogError(SecureChannel, "HandleSigma2Helper was unable to schedule the AfterWorkCallback");
+        mHandleSigma2Helper->DoAfterWork();
+        watchdogFired = true;
+    }
+
     if (mSendSigma3Helper && mSendSigma3Helper->UnableToScheduleAfterWorkCallback())
     {
         ChipLogError(SecureChannel, "SendSigma3Helper was unable to schedule the AfterWorkCallback");
@@ -2676,6 +2769,7 @@ SessionEstablishmentStage CASESession::MapCASEStateToSessionEstablishmentStage(S
     case State::kSentSigma2:
     case State::kSentSigma2Resume:
         return SessionEstablishmentStage::kSentSigma2;
+    case State::kHandleSigma2Pending:
     case State::kSendSigma3Pending:
         return SessionEstablishmentStage::kReceivedSigma2;
     case State::kSentSigma3:
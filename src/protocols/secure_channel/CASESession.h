@@ -182,6 +182,7 @@ public:
         kFinishedViaResume   = 7,
         kSendSigma3Pending   = 8,
         kHandleSigma3Pending = 9,
+        kHandleSigma2Pending = 10,
     };
 
     State GetState() { return mState; }
@@ -242,9 +243,9 @@ protected:
     };
     struct ParsedSigma2
     {
-        // Below ByteSpans are Backed by: Sigma2 PacketBuffer passed to the method HandleSigma2()
-        // Lifetime: Valid for the lifetime of the TLVReader, which takes ownership of the Sigma2 PacketBuffer in the HandleSigma2()
-        // method.
+        // Below ByteSpans are Backed by: Sigma2 PacketBuffer passed to the method HandleSigma2a()
+        // Lifetime: Valid for the lifetime of the TLVReader, which takes ownership of the Sigma2 PacketBuffer in the
+        // HandleSigma2a() method.
         ByteSpan responderRandom;
         ByteSpan responderEphPubKey;
 
@@ -290,6 +291,39 @@ protected:
         bool responderSessionParamStructPresent = false;
     };
 
+    struct HandleSigma2Data
+    {
+        // Decrypted TBEData2, taken over from ParsedSigma2 so that the spans below stay valid.
+        Platform::ScopedMemoryBufferWithSize<uint8_t> msgR2Decrypted;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
+        MutableByteSpan msgR2SignedSpan;
+
+        // Below ByteSpans are Backed by: msgR2Decrypted Buffer, member of this struct.
+        ByteSpan responderNOC;
+        ByteSpan responderICAC;
+        ByteSpan resumptionId;
+
+        uint8_t rootCertBuf[Credentials::kMaxCHIPCertLength];
+        ByteSpan fabricRCAC;
+
+        Crypto::P256ECDSASignature tbsData2Signature;
+
+        FabricId fabricId;
+        uint16_t responderSessionId;
+        bool responderSessionParamStructPresent = false;
+        SessionParameters responderSessionParams;
+
+        Credentials::ValidationContext validContext;
+
+        // The fabric table's verified chain cache is only accessed from the foreground (HandleSigma2a/HandleSigma2c);
+        // chainVerified is set when the chain was found there and HandleSigma2b can skip validating it.
+        Credentials::VerifiedCertChainCache::ChainDigest chainDigest;
+        bool chainDigestValid = false;
+        bool chainVerified    = false;
+        Credentials::VerifiedCertChain verifiedChain;
+    };
+
     struct SendSigma3Data
     {
         FabricIndex fabricIndex;
@@ -332,6 +366,13 @@ protected:
         NodeId initiatorNodeId;
 
         Credentials::ValidationContext validContext;
+
+        // The fabric table's verified chain cache is only accessed from the foreground (HandleSigma3a/HandleSigma3c);
+        // chainVerified is set when the chain was found there and HandleSigma3b can skip validating it.
+        Credentials::VerifiedCertChainCache::ChainDigest chainDigest;
+        bool chainDigestValid = false;
+        bool chainVerified    = false;
+        Credentials::VerifiedCertChain verifiedChain;
     };
 
     /**
@@ -462,6 +503,8 @@ protected:
      **/
     static CHIP_ERROR ParseSigma3TBEData(TLV::ContiguousBufferTLVReader & tlvReader, HandleSigma3Data & data);
 
+    static CHIP_ERROR HandleSigma2b(HandleSigma2Data & data, bool & cancel);
+
     static CHIP_ERROR HandleSigma3b(HandleSigma3Data & data, bool & cancel);
 
 private:
@@ -499,7 +542,8 @@ private:
     CHIP_ERROR SendSigma2Resume(System::PacketBufferHandle && msg_R2_resume);
 
     CHIP_ERROR HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg);
-    CHIP_ERROR HandleSigma2(System::PacketBufferHandle && msg);
+    CHIP_ERROR HandleSigma2a(System::PacketBufferHandle && msg);
+    CHIP_ERROR HandleSigma2c(HandleSigma2Data & data, CHIP_ERROR status);
     CHIP_ERROR HandleSigma2Resume(System::PacketBufferHandle && msg);
 
     CHIP_ERROR SendSigma3a();
@@ -585,6 +629,7 @@ private:
 
     template <class DATA>
     class WorkHelper;
+    Platform::SharedPtr<WorkHelper<HandleSigma2Data>> mHandleSigma2Helper;
     Platform::SharedPtr<WorkHelper<SendSigma3Data>> mSendSigma3Helper;
     Platform::SharedPtr<WorkHelper<HandleSigma3Data>> mHandleSigma3Helper;
 
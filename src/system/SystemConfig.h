@@ -518,6 +518,21 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_HEAP
+ *
+ *  @brief
+ *      Defines whether (1) or not (0) System::TimerList keeps its timers in a heap indexed by callback and state
+ *      rather than in a sorted linked list.
+ *
+ *  The heap makes starting and cancelling timers logarithmic rather than linear in the number of active timers, at the
+ *  cost of six more pointers per timer and of a hash table for lists of more than a few timers. It is worth it when
+ *  hundreds of timers can be active at once.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_HEAP
+#define CHIP_SYSTEM_CONFIG_TIMER_HEAP 0
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
  *
@@ -687,6 +702,35 @@ struct LwIPEvent;
 #endif
 #endif // CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+ *
+ *  @brief
+ *      Maximum number of events the epoll System::Layer retrieves per wait.
+ *
+ *  Events beyond this number stay pending in the kernel and are retrieved on the next iteration of the event loop.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+#define CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS 32
+#endif // CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE
+ *
+ *  @brief
+ *      Number of work items other threads can queue for the socket event loop without taking the stack lock.
+ *
+ *  Work queued through LayerSocketsLoop::ScheduleLambdaFromAnyThread() runs in HandleEvents(). Must be a power of two, or 0
+ *  to disable the queue. Defaults to 256 when the event loop runs on a thread of its own, i.e. with POSIX locking.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+#define CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE 256
+#else
+#define CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE 0
+#endif
+#endif // CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_USE_ZEPHYR_SOCKET_EXTENSIONS
  *
@@ -341,6 +341,31 @@ public:
     virtual void AddLoopHandler(EventLoopHandler & handler)    = 0;
     virtual void RemoveLoopHandler(EventLoopHandler & handler) = 0;
 
+    /**
+     * @brief
+     *   Queues a lambda to run on the event loop thread, during HandleEvents().
+     *
+     * Unlike ScheduleLambda(), this does not go through the platform event queue: it may be called from any thread
+     * without the stack lock, never blocks, and wakes the event loop once for a batch of lambdas queued while it is
+     * busy. Lambdas run in the order they were queued, but not in order with events posted to the platform event queue:
+     * they run before any event still waiting there.
+     *
+     * @retval CHIP_NO_ERROR                On success.
+     * @retval CHIP_ERROR_NO_MEMORY         If CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE lambdas are already queued.
+     * @retval CHIP_ERROR_INCORRECT_STATE   If the System::Layer has not been initialized.
+     * @retval CHIP_ERROR_NOT_IMPLEMENTED   If the System::Layer has no work queue.
+     */
+    template <typename Lambda>
+    CHIP_ERROR ScheduleLambdaFromAnyThread(const Lambda & lambda)
+    {
+        static_assert(std::is_invocable_v<Lambda>, "lambda argument must be an invocable with no arguments");
+        LambdaBridge bridge;
+        bridge.Initialize(lambda);
+        return ScheduleLambdaBridgeFromAnyThread(bridge);
+    }
+
+    virtual CHIP_ERROR ScheduleLambdaBridgeFromAnyThread(const LambdaBridge & bridge) { return CHIP_ERROR_NOT_IMPLEMENTED; }
+
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
     virtual void SetLibEvLoop(struct ev_loop * aLibEvLoopP) = 0;
     virtual struct ev_loop * GetLibEvLoop()                 = 0;
@@ -0,0 +1,603 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using Linux epoll().
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <limits>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+namespace {
+
+CHIP_ERROR AddToEpoll(int epollFD, int fd, uint32_t events, void * data)
+{
+    epoll_event event = {};
+    event.events      = events;
+    event.data.ptr    = data;
+    VerifyOrReturnError(epoll_ctl(epollFD, EPOLL_CTL_ADD, fd, &event) == 0, CHIP_ERROR_POSIX(errno));
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+CriticalFailure LayerImplEpoll::Init()
+{
+    VerifyOrReturnError(mLayerState.SetInitializing(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleEventsThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    mEventCount        = 0;
+    mWaitTimeout       = -1;
+    mTimerFDAwakenTime = Clock::Timestamp::max();
+
+    CHIP_ERROR err = OpenEventFDs();
+    if (err != CHIP_NO_ERROR)
+    {
+        CloseEventFDs();
+        return err;
+    }
+
+    VerifyOrReturnError(mLayerState.SetInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::OpenEventFDs()
+{
+    mEpollFD = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrReturnError(mEpollFD >= 0, CHIP_ERROR_POSIX(errno));
+
+    mTimerFD = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrReturnError(mTimerFD >= 0, CHIP_ERROR_POSIX(errno));
+
+    // Create an event to allow an arbitrary thread to wake the thread in the epoll loop.
+    ReturnErrorOnFailure(mWakeEvent.Open());
+    mWakeEventOpen = true;
+
+    // Both are drained whenever they are reported, so they can stay level-triggered.
+    ReturnErrorOnFailure(AddToEpoll(mEpollFD, mWakeEvent.GetReadFD(), EPOLLIN, &mWakeEvent));
+    return AddToEpoll(mEpollFD, mTimerFD, EPOLLIN, &mTimerFD);
+}
+
+void LayerImplEpoll::CloseEventFDs()
+{
+    if (mWakeEventOpen)
+    {
+        mWakeEvent.Close();
+        mWakeEventOpen = false;
+    }
+    if (mTimerFD >= 0)
+    {
+        close(mTimerFD);
+        mTimerFD = kInvalidFd;
+    }
+    if (mEpollFD >= 0)
+    {
+        close(mEpollFD);
+        mEpollFD = kInvalidFd;
+    }
+}
+
+void LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturn(mLayerState.SetShuttingDown());
+
+    mTimerList.Clear();
+    mTimerPool.ReleaseAll();
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0
+    mWorkQueue.Clear();
+#endif
+    CloseEventFDs();
+
+    mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
+}
+
+void LayerImplEpoll::Signal()
+{
+    /*
+     * Wake up the I/O thread by notifying the wake event.
+     *
+     * If this is being called from within an I/O event callback, then notifying the wake event can be skipped,
+     * since the I/O thread is already awake.
+     *
+     * Furthermore, we don't care if this notification fails as the only reasonably likely failure is that the pipe is
+     * full, in which case the epoll calling thread is going to wake up anyway.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleEventsThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Send notification to wake up the epoll call.
+    CHIP_ERROR status = mWakeEvent.Notify();
+    if (status != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, status.Format());
+    }
+}
+
+CriticalFailure LayerImplEpoll::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delay = System::Clock::kZero);
+
+    CancelTimer(onComplete, appState);
+
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the timer fd has to be re-armed.
+        Signal();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(delay.count() > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    assertChipStackLockedByCurrentThread();
+
+    Clock::Timeout remainingTime = mTimerList.GetRemainingTime(onComplete, appState);
+    if (remainingTime.count() < delay.count())
+    {
+        // Just call StartTimer; it will invoke CancelTimer(), then start a new timer.  That handles
+        // all the various "timer was about to fire" edge cases correctly too.
+        return StartTimer(delay, onComplete, appState);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool LayerImplEpoll::IsTimerActive(TimerCompleteCallback onComplete, void * appState)
+{
+    bool timerIsActive = (mTimerList.GetRemainingTime(onComplete, appState) > Clock::kZero);
+
+    // If not, check if the timer is in the mExpiredTimers list about to be fired.
+    return timerIsActive || mExpiredTimers.Contains(onComplete, appState);
+}
+
+Clock::Timeout LayerImplEpoll::GetRemainingTime(TimerCompleteCallback onComplete, void * appState)
+{
+    return mTimerList.GetRemainingTime(onComplete, appState);
+}
+
+void LayerImplEpoll::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    if (timer == nullptr)
+    {
+        // The timer was not in our "will fire in the future" list, but it might
+        // be in the "we're about to fire these" chunk we already grabbed from
+        // that list.  Check for it there too, and if found there we still want
+        // to cancel it.
+        timer = mExpiredTimers.Remove(onComplete, appState);
+    }
+    VerifyOrReturn(timer != nullptr);
+
+    mTimerPool.Release(timer);
+    Signal();
+}
+
+CriticalFailure LayerImplEpoll::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    // As in LayerImplSelect, use an expires-ASAP timer as a closure capturing `this`, onComplete and appState, and do not
+    // cancel existing timers with the same callback and appState so ScheduleWork invocations don't stomp on each other.
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0
+CHIP_ERROR LayerImplEpoll::ScheduleLambdaBridgeFromAnyThread(const LambdaBridge & bridge)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    bool shouldSignal = false;
+    ReturnErrorOnFailure(mWorkQueue.Post(bridge, shouldSignal));
+    if (shouldSignal)
+    {
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0
+
+CHIP_ERROR LayerImplEpoll::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    // Find a free slot.
+    SocketWatch * watch = nullptr;
+    for (auto & w : mSocketWatchPool)
+    {
+        if (w.mFD == fd)
+        {
+            // Already registered, return the existing token
+            *tokenOut = reinterpret_cast<SocketWatchToken>(&w);
+            return CHIP_NO_ERROR;
+        }
+        if ((w.mFD == kInvalidFd) && (watch == nullptr))
+        {
+            watch = &w;
+        }
+    }
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_ENDPOINT_POOL_FULL);
+
+    // No event is requested yet, but errors and hang-ups are always reported.
+    ReturnErrorOnFailure(AddToEpoll(mEpollFD, fd, EPOLLET, watch));
+    watch->mFD = fd;
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!watch->mPendingIO.Has(SocketEventFlags::kRead), CHIP_NO_ERROR);
+
+    watch->mPendingIO.Set(SocketEventFlags::kRead);
+    return UpdateWatch(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!watch->mPendingIO.Has(SocketEventFlags::kWrite), CHIP_NO_ERROR);
+
+    watch->mPendingIO.Set(SocketEventFlags::kWrite);
+    return UpdateWatch(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mPendingIO.Has(SocketEventFlags::kRead), CHIP_NO_ERROR);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kRead);
+    return UpdateWatch(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mPendingIO.Has(SocketEventFlags::kWrite), CHIP_NO_ERROR);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kWrite);
+    return UpdateWatch(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    VerifyOrReturnError(tokenInOut != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    // The socket may already have been closed, which removed it from the epoll instance.
+    if (epoll_ctl(mEpollFD, EPOLL_CTL_DEL, watch->mFD, nullptr) != 0 && errno != EBADF && errno != ENOENT)
+    {
+        ChipLogError(chipSystemLayer, "epoll_ctl(DEL) failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+    }
+
+    // Drop the events not handled yet, as the slot of the watch may be reused before HandleEvents() gets to them.
+    for (int i = 0; i < mEventCount; i++)
+    {
+        if (mEvents[i].data.ptr == watch)
+        {
+            mEvents[i].data.ptr = nullptr;
+        }
+    }
+
+    watch->Clear();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::UpdateWatch(SocketWatch & watch)
+{
+    VerifyOrReturnError(watch.mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    epoll_event event = {};
+    event.data.ptr    = &watch;
+    if (watch.mPendingIO.Has(SocketEventFlags::kRead))
+    {
+        event.events |= EPOLLIN;
+    }
+    if (watch.mPendingIO.Has(SocketEventFlags::kWrite))
+    {
+        event.events |= EPOLLOUT;
+    }
+    if (event.events == 0)
+    {
+        // Errors and hang-ups are reported even without any event requested: only report them once.
+        event.events = EPOLLET;
+    }
+    VerifyOrReturnError(epoll_ctl(mEpollFD, EPOLL_CTL_MOD, watch.mFD, &event) == 0, CHIP_ERROR_POSIX(errno));
+    return CHIP_NO_ERROR;
+}
+
+enum : intptr_t
+{
+    kLoopHandlerInactive = 0, // default value for EventLoopHandler::mState
+    kLoopHandlerPending,
+    kLoopHandlerActive,
+};
+
+void LayerImplEpoll::AddLoopHandler(EventLoopHandler & handler)
+{
+    // Add the handler as pending because this method can be called at any point
+    // in a PrepareEvents() / WaitForEvents() / HandleEvents() sequence.
+    // It will be marked active when we call PrepareEvents() on it for the first time.
+    auto & state = LoopHandlerState(handler);
+    VerifyOrDie(state == kLoopHandlerInactive);
+    state = kLoopHandlerPending;
+    mLoopHandlers.PushBack(&handler);
+}
+
+void LayerImplEpoll::RemoveLoopHandler(EventLoopHandler & handler)
+{
+    mLoopHandlers.Remove(&handler);
+    LoopHandlerState(handler) = kLoopHandlerInactive;
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    Clock::Timestamp awakenTime        = Clock::Timestamp::max();
+
+    TimerList::Node * timer = mTimerList.Earliest();
+    if (timer)
+    {
+        awakenTime = timer->AwakenTime();
+    }
+
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0
+    if (mWorkQueue.HasPendingWork())
+    {
+        awakenTime = currentTime;
+    }
+#endif
+
+    // Activate added EventLoopHandlers and call PrepareEvents on active handlers.
+    auto loopIter = mLoopHandlers.begin();
+    while (loopIter != mLoopHandlers.end())
+    {
+        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
+        switch (auto & state = LoopHandlerState(loop))
+        {
+        case kLoopHandlerPending:
+            state = kLoopHandlerActive;
+            [[fallthrough]];
+        case kLoopHandlerActive:
+            awakenTime = std::min(awakenTime, loop.PrepareEvents(currentTime));
+            break;
+        }
+    }
+
+    mEventCount  = 0;
+    mWaitTimeout = -1;
+    if (awakenTime <= currentTime)
+    {
+        mWaitTimeout = 0;
+        return;
+    }
+
+    // Re-arming the timer fd is only needed when the earliest expiration changed, which is not the case on most
+    // iterations of the loop.
+    VerifyOrReturn(awakenTime != mTimerFDAwakenTime);
+
+    itimerspec timerSpec = {};
+    if (awakenTime != Clock::Timestamp::max())
+    {
+        const Clock::Milliseconds64 sleepTime = awakenTime - currentTime;
+        timerSpec.it_value.tv_sec             = static_cast<time_t>(sleepTime.count() / 1000);
+        timerSpec.it_value.tv_nsec            = static_cast<long>((sleepTime.count() % 1000) * 1000000);
+    }
+    if (timerfd_settime(mTimerFD, 0, &timerSpec, nullptr) != 0)
+    {
+        ChipLogError(chipSystemLayer, "timerfd_settime failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        // Fall back to the timeout of the wait so timers still fire.
+        const Clock::Milliseconds64 sleepTime = awakenTime - currentTime;
+        mWaitTimeout       = static_cast<int>(std::min<uint64_t>(sleepTime.count(), std::numeric_limits<int>::max()));
+        mTimerFDAwakenTime = Clock::Timestamp::max();
+        return;
+    }
+    mTimerFDAwakenTime = awakenTime;
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    mEventCount = epoll_wait(mEpollFD, mEvents, CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS, mWaitTimeout);
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (!IsWaitResultValid())
+    {
+        VerifyOrReturn(errno != EINTR); // EINTR is not really an error (and we don't use it for signal handling)
+        ChipLogError(DeviceLayer, "epoll_wait failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        return;
+    }
+
+    for (int i = 0; i < mEventCount; i++)
+    {
+        if (mEvents[i].data.ptr == &mWakeEvent)
+        {
+            mWakeEvent.Confirm();
+            mEvents[i].data.ptr = nullptr;
+        }
+        else if (mEvents[i].data.ptr == &mTimerFD)
+        {
+            uint64_t expirations;
+            if (read(mTimerFD, &expirations, sizeof(expirations)) < 0 && errno != EAGAIN)
+            {
+                ChipLogError(chipSystemLayer, "timer fd read failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+            }
+            mTimerFDAwakenTime  = Clock::Timestamp::max();
+            mEvents[i].data.ptr = nullptr;
+        }
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleEventsThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
+    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(timer);
+    }
+
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0
+    mWorkQueue.Run();
+#endif
+
+    // Process socket events, if any. Like select(), report errors and hang-ups as the socket being ready for the
+    // requested operations.
+    for (int i = 0; i < mEventCount; i++)
+    {
+        auto * watch = static_cast<SocketWatch *>(mEvents[i].data.ptr);
+        if (watch == nullptr || watch->mCallback == nullptr)
+        {
+            continue;
+        }
+
+        const uint32_t ready = mEvents[i].events;
+        SocketEvents events;
+        if ((ready & (EPOLLIN | EPOLLHUP | EPOLLERR)) != 0 && watch->mPendingIO.Has(SocketEventFlags::kRead))
+        {
+            events.Set(SocketEventFlags::kRead);
+        }
+        if ((ready & (EPOLLOUT | EPOLLHUP | EPOLLERR)) != 0 && watch->mPendingIO.Has(SocketEventFlags::kWrite))
+        {
+            events.Set(SocketEventFlags::kWrite);
+        }
+        if (!events.HasAny())
+        {
+            continue;
+        }
+        if ((ready & EPOLLERR) != 0)
+        {
+            events.Set(SocketEventFlags::kError);
+        }
+
+        watch->mCallback(events, watch->mCallbackData);
+    }
+    mEventCount = 0;
+
+    // Call HandleEvents for active loop handlers
+    auto loopIter = mLoopHandlers.begin();
+    while (loopIter != mLoopHandlers.end())
+    {
+        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
+        if (LoopHandlerState(loop) == kLoopHandlerActive)
+        {
+            loop.HandleEvents();
+        }
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleEventsThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplEpoll::SocketWatch::Clear()
+{
+    mFD = kInvalidFd;
+    mPendingIO.ClearAll();
+    mCallback     = nullptr;
+    mCallbackData = 0;
+}
+
+} // namespace System
+} // namespace chip
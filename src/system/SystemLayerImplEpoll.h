@@ -0,0 +1,160 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using Linux epoll().
+ */
+
+#pragma once
+
+#include "system/SystemConfig.h"
+
+#if CHIP_SYSTEM_CONFIG_USE_LIBEV
+#error "The epoll System::Layer does not support libev; use the select System::Layer with libev instead"
+#endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
+
+#include <sys/epoll.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <lib/support/ObjectLifeCycle.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+#include <system/WakeEvent.h>
+#include <system/WorkQueue.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * System::Layer whose event loop waits on an epoll instance rather than on select() sets.
+ *
+ * Sockets are registered with the events they requested a callback for, so a wakeup costs time in the number of ready
+ * sockets rather than in the number of watched ones, and there is no FD_SETSIZE limit on descriptors. The earliest timer
+ * is programmed into a timerfd, which is only re-armed when the earliest expiration changes.
+ *
+ * The registrations are level-triggered, like the select layer: socket callbacks are not required to drain their socket,
+ * and the registration of a socket is only modified when its requested events change.
+ */
+class LayerImplEpoll : public LayerSocketsLoop
+{
+public:
+    LayerImplEpoll() = default;
+    ~LayerImplEpoll() override { VerifyOrDie(mLayerState.Destroy()); }
+
+    // Layer overrides.
+    CriticalFailure Init() override;
+    void Shutdown() override;
+    bool IsInitialized() const override { return mLayerState.IsInitialized(); }
+    CriticalFailure StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    CHIP_ERROR ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    bool IsTimerActive(TimerCompleteCallback onComplete, void * appState) override;
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback onComplete, void * appState) override;
+    void CancelTimer(TimerCompleteCallback onComplete, void * appState) override;
+    CriticalFailure ScheduleWork(TimerCompleteCallback onComplete, void * appState) override;
+
+    // LayerSocket overrides.
+    CHIP_ERROR StartWatchingSocket(int fd, SocketWatchToken * tokenOut) override;
+    CHIP_ERROR SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data) override;
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+    SocketWatchToken InvalidSocketWatchToken() override { return reinterpret_cast<SocketWatchToken>(nullptr); }
+
+    // LayerSocketLoop overrides.
+    void Signal() override;
+    void EventLoopBegins() override {}
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+    void EventLoopEnds() override {}
+
+    void AddLoopHandler(EventLoopHandler & handler) override;
+    void RemoveLoopHandler(EventLoopHandler & handler) override;
+
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0
+    CHIP_ERROR ScheduleLambdaBridgeFromAnyThread(const LambdaBridge & bridge) override;
+#endif
+
+    // Expose the result of WaitForEvents() for non-blocking socket implementations.
+    bool IsWaitResultValid() const { return mEventCount >= 0; }
+
+protected:
+    static constexpr int kSocketWatchMax = (INET_CONFIG_ENABLE_TCP_ENDPOINT ? INET_CONFIG_NUM_TCP_ENDPOINTS : 0) +
+        (INET_CONFIG_ENABLE_UDP_ENDPOINT ? INET_CONFIG_NUM_UDP_ENDPOINTS : 0);
+
+    struct SocketWatch
+    {
+        void Clear();
+        int mFD;
+        SocketEvents mPendingIO;
+        SocketWatchCallback mCallback;
+        intptr_t mCallbackData;
+    };
+    SocketWatch mSocketWatchPool[kSocketWatchMax];
+
+    // Update the events the epoll instance reports for `watch` to those of its callback requests. Requested events are
+    // level-triggered, like with select(): whatever a callback leaves to read or write is reported again on the next
+    // iteration, without another system call. Only called when the requests change.
+    CHIP_ERROR UpdateWatch(SocketWatch & watch);
+
+    CHIP_ERROR OpenEventFDs();
+    void CloseEventFDs();
+
+    TimerPool<TimerList::Node> mTimerPool;
+    TimerList mTimerList;
+    // List of expired timers being processed right now.  Stored in a member so
+    // we can cancel them.
+    TimerList mExpiredTimers;
+
+    IntrusiveList<EventLoopHandler> mLoopHandlers;
+
+    int mEpollFD = kInvalidFd;
+    int mTimerFD = kInvalidFd;
+    // Expiration the timer fd is armed for, or Timestamp::max() if it is disarmed.
+    Clock::Timestamp mTimerFDAwakenTime;
+    // Timeout passed to epoll_wait(), either 0 when events are already due or -1 to wait for the timer fd.
+    int mWaitTimeout;
+
+    // Events returned by epoll_wait(), carried between WaitForEvents() and HandleEvents().
+    epoll_event mEvents[CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS];
+    int mEventCount = 0;
+
+    ObjectLifeCycle mLayerState;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    std::atomic<pthread_t> mHandleEventsThread;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    WakeEvent mWakeEvent;
+    bool mWakeEventOpen = false;
+
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0
+    WorkQueue mWorkQueue;
+#endif
+};
+
+using LayerImpl = LayerImplEpoll;
+
+} // namespace System
+} // namespace chip
@@ -98,6 +98,9 @@ void LayerImplSelect::Shutdown()
 #else
     mTimerList.Clear();
     mTimerPool.ReleaseAll();
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0
+    mWorkQueue.Clear();
+#endif
     mWakeEvent.Close();
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 
@@ -195,19 +198,8 @@ bool LayerImplSelect::IsTimerActive(TimerCompleteCallback onComplete, void * app
 {
     bool timerIsActive = (mTimerList.GetRemainingTime(onComplete, appState) > Clock::kZero);
 
-    if (!timerIsActive)
-    {
-        // check if the timer is in the mExpiredTimers list about to be fired.
-        for (TimerList::Node * timer = mExpiredTimers.Earliest(); timer != nullptr; timer = timer->mNextTimer)
-        {
-            if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState)
-            {
-                return true;
-            }
-        }
-    }
-
-    return timerIsActive;
+    // If not, check if the timer is in the mExpiredTimers list about to be fired.
+    return timerIsActive || mExpiredTimers.Contains(onComplete, appState);
 }
 
 Clock::Timeout LayerImplSelect::GetRemainingTime(TimerCompleteCallback onComplete, void * appState)
@@ -300,8 +292,28 @@ CriticalFailure LayerImplSelect::ScheduleWork(TimerCompleteCallback onComplete,
     return CHIP_NO_ERROR;
 }
 
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0 && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+CHIP_ERROR LayerImplSelect::ScheduleLambdaBridgeFromAnyThread(const LambdaBridge & bridge)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    bool shouldSignal = false;
+    ReturnErrorOnFailure(mWorkQueue.Post(bridge, shouldSignal));
+    if (shouldSignal)
+    {
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0 && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+
 CHIP_ERROR LayerImplSelect::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
 {
+#if !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    // FD_SET() cannot represent larger descriptors.
+    VerifyOrReturnError(fd >= 0 && fd < FD_SETSIZE, CHIP_ERROR_INVALID_ARGUMENT);
+#endif // !CHIP_SYSTEM_CONFIG_USE_LIBEV
+
     // Find a free slot.
     SocketWatch * watch = nullptr;
     for (auto & w : mSocketWatchPool)
@@ -526,6 +538,13 @@ void LayerImplSelect::PrepareEvents()
         awakenTime = std::min(awakenTime, timer->AwakenTime());
     }
 
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0 && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    if (mWorkQueue.HasPendingWork())
+    {
+        awakenTime = currentTime;
+    }
+#endif
+
     // Activate added EventLoopHandlers and call PrepareEvents on active handlers.
     auto loopIter = mLoopHandlers.begin();
     while (loopIter != mLoopHandlers.end())
@@ -617,6 +636,10 @@ void LayerImplSelect::HandleEvents()
         mTimerPool.Invoke(timer);
     }
 
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0 && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    mWorkQueue.Run();
+#endif
+
     // Process socket events, if any
     if (mSelectResult > 0)
     {
@@ -45,6 +45,7 @@
 #include <system/SystemLayer.h>
 #include <system/SystemTimer.h>
 #include <system/WakeEvent.h>
+#include <system/WorkQueue.h>
 
 namespace chip {
 namespace System {
@@ -87,6 +88,10 @@ public:
     void AddLoopHandler(EventLoopHandler & handler) override;
     void RemoveLoopHandler(EventLoopHandler & handler) override;
 
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0 && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    CHIP_ERROR ScheduleLambdaBridgeFromAnyThread(const LambdaBridge & bridge) override;
+#endif
+
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
     virtual void SetLibEvLoop(struct ev_loop * aLibEvLoopP) override { mLibEvLoopP = aLibEvLoopP; };
     virtual struct ev_loop * GetLibEvLoop() override { return mLibEvLoopP; };
@@ -151,6 +156,9 @@ protected:
     struct ev_loop * mLibEvLoopP;
 #else
     WakeEvent mWakeEvent;
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0
+    WorkQueue mWorkQueue;
+#endif
 #endif
 };
 
@@ -33,11 +33,372 @@
 #include <system/SystemFaultInjection.h>
 #include <system/SystemLayer.h>
 
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 
 namespace chip {
 namespace System {
 
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
+template <typename Function>
+void TimerList::ForEachNode(Function && function) const
+{
+    // Depth-first walk of the heap, climbing back through the previous siblings to the parent of a finished sibling list.
+    Node * node = mEarliestTimer;
+    while (node != nullptr)
+    {
+        function(node);
+        if (node->mChild != nullptr)
+        {
+            node = node->mChild;
+            continue;
+        }
+        while (node != nullptr && node->mNext == nullptr)
+        {
+            while (node->mPrev != nullptr && node->mPrev->mChild != node)
+            {
+                node = node->mPrev;
+            }
+            node = node->mPrev;
+        }
+        if (node != nullptr)
+        {
+            node = node->mNext;
+        }
+    }
+}
+
+TimerList::~TimerList()
+{
+    FreeIndex();
+}
+
+TimerList & TimerList::operator=(TimerList && other)
+{
+    if (this != &other)
+    {
+        Clear();
+        mEarliestTimer       = other.mEarliestTimer;
+        mCount               = other.mCount;
+        mSequence            = other.mSequence;
+        mBuckets             = other.mBuckets;
+        mBucketCount         = other.mBucketCount;
+        other.mEarliestTimer = nullptr;
+        other.mCount         = 0;
+        other.mBuckets       = nullptr;
+        other.mBucketCount   = 0;
+        ForEachNode([this](Node * node) { node->mList = this; });
+    }
+    return *this;
+}
+
+bool TimerList::Less(const Node * a, const Node * b) const
+{
+    if (a->AwakenTime() != b->AwakenTime())
+    {
+        return a->AwakenTime() < b->AwakenTime();
+    }
+    // Sequence numbers wrap around, but the timers of a list are never 2^31 additions apart.
+    return static_cast<int32_t>(a->mSequence - b->mSequence) < 0;
+}
+
+TimerList::Node * TimerList::Meld(Node * a, Node * b) const
+{
+    if (Less(b, a))
+    {
+        std::swap(a, b);
+    }
+    // b becomes the first child of a.
+    b->mPrev = a;
+    b->mNext = a->mChild;
+    if (a->mChild != nullptr)
+    {
+        a->mChild->mPrev = b;
+    }
+    a->mChild = b;
+    a->mNext  = nullptr;
+    a->mPrev  = nullptr;
+    return a;
+}
+
+TimerList::Node * TimerList::MergeSiblings(Node * first) const
+{
+    // Two-pass pairing: meld the siblings by pairs from the left, stacking the results through mNext, then meld the
+    // results from the right.
+    Node * stack = nullptr;
+    while (first != nullptr)
+    {
+        Node * a = first;
+        Node * b = a->mNext;
+        first    = (b != nullptr) ? b->mNext : nullptr;
+        Node * melded = (b != nullptr) ? Meld(a, b) : a;
+        melded->mPrev = nullptr;
+        melded->mNext = stack;
+        stack         = melded;
+    }
+
+    Node * root = stack;
+    if (root != nullptr)
+    {
+        stack = root->mNext;
+        while (stack != nullptr)
+        {
+            Node * next = stack->mNext;
+            root        = Meld(root, stack);
+            stack       = next;
+        }
+        root->mNext = nullptr;
+        root->mPrev = nullptr;
+    }
+    return root;
+}
+
+void TimerList::Unlink(Node * node)
+{
+    Unindex(node);
+    mCount--;
+
+    Node * children = node->mChild;
+    if (children != nullptr)
+    {
+        children->mPrev = nullptr;
+    }
+    Node * subtree = MergeSiblings(children);
+
+    if (node == mEarliestTimer)
+    {
+        mEarliestTimer = subtree;
+    }
+    else
+    {
+        // Detach the node from its sibling list, then meld what was below it back in.
+        if (node->mPrev->mChild == node)
+        {
+            node->mPrev->mChild = node->mNext;
+        }
+        else
+        {
+            node->mPrev->mNext = node->mNext;
+        }
+        if (node->mNext != nullptr)
+        {
+            node->mNext->mPrev = node->mPrev;
+        }
+        if (subtree != nullptr)
+        {
+            mEarliestTimer = Meld(mEarliestTimer, subtree);
+        }
+    }
+
+    node->mList  = nullptr;
+    node->mChild = nullptr;
+    node->mNext  = nullptr;
+    node->mPrev  = nullptr;
+}
+
+size_t TimerList::Bucket(TimerCompleteCallback onComplete, void * appState) const
+{
+    // Fibonacci hashing of both pointers to the top bits, which are then reduced to the number of buckets.
+    uint64_t hash = (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(onComplete)) * 0x9E3779B97F4A7C15ull) ^
+        static_cast<uint64_t>(reinterpret_cast<uintptr_t>(appState));
+    hash *= 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash >> 32) & (mBucketCount - 1);
+}
+
+void TimerList::Index(Node * node)
+{
+    if (mCount >= ((mBucketCount > kMinIndexedTimers) ? mBucketCount : kMinIndexedTimers))
+    {
+        GrowIndex();
+    }
+    VerifyOrReturn(mBuckets != nullptr);
+
+    Node *& head    = mBuckets[Bucket(node->GetCallback().GetOnComplete(), node->GetCallback().GetAppState())];
+    node->mHashPrev = nullptr;
+    node->mHashNext = head;
+    if (head != nullptr)
+    {
+        head->mHashPrev = node;
+    }
+    head = node;
+}
+
+void TimerList::Unindex(Node * node)
+{
+    VerifyOrReturn(mBuckets != nullptr);
+
+    if (node->mHashPrev != nullptr)
+    {
+        node->mHashPrev->mHashNext = node->mHashNext;
+    }
+    else
+    {
+        mBuckets[Bucket(node->GetCallback().GetOnComplete(), node->GetCallback().GetAppState())] = node->mHashNext;
+    }
+    if (node->mHashNext != nullptr)
+    {
+        node->mHashNext->mHashPrev = node->mHashPrev;
+    }
+    node->mHashNext = nullptr;
+    node->mHashPrev = nullptr;
+}
+
+void TimerList::GrowIndex()
+{
+    size_t bucketCount = (mBucketCount > 0) ? 2 * mBucketCount : 2 * kMinIndexedTimers;
+    auto ** buckets    = static_cast<Node **>(Platform::MemoryCalloc(bucketCount, sizeof(Node *)));
+    // Without memory for a larger table, keep the current one, or keep finding timers by walking the heap.
+    VerifyOrReturn(buckets != nullptr);
+
+    FreeIndex();
+    mBuckets     = buckets;
+    mBucketCount = bucketCount;
+    ForEachNode([this](Node * node) {
+        Node *& head    = mBuckets[Bucket(node->GetCallback().GetOnComplete(), node->GetCallback().GetAppState())];
+        node->mHashPrev = nullptr;
+        node->mHashNext = head;
+        if (head != nullptr)
+        {
+            head->mHashPrev = node;
+        }
+        head = node;
+    });
+}
+
+void TimerList::FreeIndex()
+{
+    if (mBuckets != nullptr)
+    {
+        Platform::MemoryFree(mBuckets);
+        mBuckets     = nullptr;
+        mBucketCount = 0;
+    }
+}
+
+TimerList::Node * TimerList::Find(TimerCompleteCallback onComplete, void * appState) const
+{
+    // Return the earliest match, as a walk of a sorted list would.
+    Node * found = nullptr;
+    auto match   = [&](Node * node) {
+        if (node->GetCallback().GetOnComplete() == onComplete && node->GetCallback().GetAppState() == appState &&
+            (found == nullptr || Less(node, found)))
+        {
+            found = node;
+        }
+    };
+
+    if (mBuckets != nullptr)
+    {
+        for (Node * node = mBuckets[Bucket(onComplete, appState)]; node != nullptr; node = node->mHashNext)
+        {
+            match(node);
+        }
+    }
+    else
+    {
+        ForEachNode(match);
+    }
+    return found;
+}
+
+TimerList::Node * TimerList::Add(TimerList::Node * add)
+{
+    VerifyOrDie(add->mList == nullptr);
+
+    add->mList     = this;
+    add->mSequence = mSequence++;
+    add->mChild    = nullptr;
+    add->mNext     = nullptr;
+    add->mPrev     = nullptr;
+    // Index the timer before adding it to the heap, since growing the index re-indexes the timers of the heap.
+    Index(add);
+    mEarliestTimer = (mEarliestTimer == nullptr) ? add : Meld(mEarliestTimer, add);
+    mCount++;
+    return mEarliestTimer;
+}
+
+TimerList::Node * TimerList::Remove(TimerList::Node * remove)
+{
+    if (remove != nullptr && remove->mList == this)
+    {
+        Unlink(remove);
+    }
+    return mEarliestTimer;
+}
+
+TimerList::Node * TimerList::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = Find(aOnComplete, aAppState);
+    if (timer != nullptr)
+    {
+        Unlink(timer);
+    }
+    return timer;
+}
+
+TimerList::Node * TimerList::PopEarliest()
+{
+    Node * earliest = mEarliestTimer;
+    if (earliest != nullptr)
+    {
+        Unlink(earliest);
+    }
+    return earliest;
+}
+
+TimerList::Node * TimerList::PopIfEarlier(Clock::Timestamp t)
+{
+    if ((mEarliestTimer == nullptr) || !(mEarliestTimer->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    return PopEarliest();
+}
+
+TimerList TimerList::ExtractEarlier(Clock::Timestamp t)
+{
+    TimerList out;
+
+    Node * timer;
+    while ((timer = PopIfEarlier(t)) != nullptr)
+    {
+        out.Add(timer);
+    }
+
+    return out;
+}
+
+void TimerList::Clear()
+{
+    ForEachNode([](Node * node) { node->mList = nullptr; });
+    mEarliestTimer = nullptr;
+    mCount         = 0;
+    FreeIndex();
+}
+
+Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = Find(aOnComplete, aAppState);
+    if (timer != nullptr)
+    {
+        Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+
+        if (currentTime < timer->AwakenTime())
+        {
+            return Clock::Timeout(timer->AwakenTime() - currentTime);
+        }
+    }
+    return Clock::kZero;
+}
+
+bool TimerList::Contains(TimerCompleteCallback aOnComplete, void * aAppState) const
+{
+    return Find(aOnComplete, aAppState) != nullptr;
+}
+
+#else // CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
 TimerList::Node * TimerList::Add(TimerList::Node * add)
 {
     VerifyOrDie(add != mEarliestTimer);
@@ -178,5 +539,19 @@ Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, vo
     return Clock::kZero;
 }
 
+bool TimerList::Contains(TimerCompleteCallback aOnComplete, void * aAppState) const
+{
+    for (TimerList::Node * timer = mEarliestTimer; timer != nullptr; timer = timer->mNextTimer)
+    {
+        if (timer->GetCallback().GetOnComplete() == aOnComplete && timer->GetCallback().GetAppState() == aAppState)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
 } // namespace System
 } // namespace chip
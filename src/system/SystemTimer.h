@@ -40,6 +40,9 @@
 #include <dispatch/dispatch.h>
 #endif
 
+#include <stddef.h>
+#include <utility>
+
 namespace chip {
 namespace System {
 
@@ -103,6 +106,147 @@ private:
     TimerData & operator=(const TimerData &) = delete;
 };
 
+#if CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
+/**
+ * List of `Timer`s ordered by expiration time.
+ *
+ * The timers are kept in a pairing heap ordered by expiration time, then by order of addition, so that additions and
+ * removals take logarithmic time but the order in which timers are returned is the same as that of a sorted list. Lists
+ * of more than a few timers also index them in a hash table on their callback and state, so that finding a timer by
+ * those properties takes constant time rather than a walk of the whole list.
+ */
+class TimerList
+{
+public:
+    class Node : public TimerData
+    {
+    public:
+        Node(Layer & systemLayer, System::Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState) :
+            TimerData(systemLayer, awakenTime, onComplete, appState)
+        {}
+
+    private:
+        friend class TimerList;
+
+        TimerList * mList  = nullptr; // List holding the timer, if any
+        Node * mChild      = nullptr; // First child in the heap
+        Node * mNext       = nullptr; // Next sibling in the heap
+        Node * mPrev       = nullptr; // Previous sibling in the heap, or parent of a first child
+        Node * mHashNext   = nullptr;
+        Node * mHashPrev   = nullptr;
+        uint32_t mSequence = 0; // Order of addition to the list, ordering timers with the same expiration time
+    };
+
+    TimerList() = default;
+    ~TimerList();
+
+    TimerList(TimerList && other) { *this = std::move(other); }
+    TimerList & operator=(TimerList && other);
+
+    TimerList(const TimerList &)             = delete;
+    TimerList & operator=(const TimerList &) = delete;
+
+    /**
+     * Add a timer to the list
+     *
+     * @return  The new earliest timer in the list. If this is the newly added timer, that implies it is earlier
+     *          than any existing timer.
+     */
+    Node * Add(Node * timer);
+
+    /**
+     * Remove the given timer from the list, if present. It is not an error for the timer not to be present.
+     *
+     * @return  The new earliest timer in the list, or nullptr if the list is empty.
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the first timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the list contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Remove and return the earliest timer in the list.
+     *
+     * @return  The earliest timer, or nullptr if the list is empty.
+     */
+    Node * PopEarliest();
+
+    /**
+     * Remove and return the earliest timer in the list, provided it expires earlier than the given time @a t.
+     *
+     * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+     */
+    Node * PopIfEarlier(Clock::Timestamp t);
+
+    /**
+     * Get the earliest timer in the list.
+     *
+     * @return  The earliest timer, or nullptr if there are no timers.
+     */
+    Node * Earliest() const { return mEarliestTimer; }
+
+    /**
+     * Test whether there are any timers.
+     */
+    bool Empty() const { return mEarliestTimer == nullptr; }
+
+    /**
+     * Remove and return all timers that expire before the given time @a t.
+     */
+    TimerList ExtractEarlier(Clock::Timestamp t);
+
+    /**
+     * Remove all timers.
+     */
+    void Clear();
+
+    /**
+     * Find the timer with the given properties, if present, and return its remaining time
+     *
+     * @return The remaining time on this partifcular timer or 0 if not found.
+     */
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
+
+    /**
+     * Test whether the list holds a timer with the given properties.
+     */
+    bool Contains(TimerCompleteCallback aOnComplete, void * aAppState) const;
+
+private:
+    // Lists with fewer timers than this are searched by walking the heap rather than through a hash table.
+    static constexpr size_t kMinIndexedTimers = 16;
+
+    bool Less(const Node * a, const Node * b) const;
+    Node * Meld(Node * a, Node * b) const;
+    Node * MergeSiblings(Node * first) const;
+    void Unlink(Node * node);
+
+    size_t Bucket(TimerCompleteCallback onComplete, void * appState) const;
+    void Index(Node * node);
+    void Unindex(Node * node);
+    void GrowIndex();
+    void FreeIndex();
+
+    Node * Find(TimerCompleteCallback onComplete, void * appState) const;
+
+    // Calls `function(Node *)` for every timer of the list, which must not modify the heap.
+    template <typename Function>
+    void ForEachNode(Function && function) const;
+
+    Node * mEarliestTimer = nullptr; // Root of the heap
+    size_t mCount         = 0;
+    uint32_t mSequence    = 0;
+    Node ** mBuckets      = nullptr;
+    size_t mBucketCount   = 0; // Power of two, or zero when the timers are not indexed
+};
+
+#else // CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
 /**
  * List of `Timer`s ordered by expiration time.
  */
@@ -185,10 +329,17 @@ public:
      */
     Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
 
+    /**
+     * Test whether the list holds a timer with the given properties.
+     */
+    bool Contains(TimerCompleteCallback aOnComplete, void * aAppState) const;
+
 private:
     Node * mEarliestTimer;
 };
 
+#endif // CHIP_SYSTEM_CONFIG_TIMER_HEAP
+
 /**
  * ObjectPool wrapper that keeps System Timer statistics.
  */
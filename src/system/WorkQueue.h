@@ -0,0 +1,109 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares the queue through which other threads hand work to a socket event loop.
+ */
+
+#pragma once
+
+// Include configuration headers
+#include <system/SystemConfig.h>
+
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0
+
+#include <atomic>
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/LambdaBridge.h>
+#include <lib/support/MpscQueue.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * @class WorkQueue
+ *
+ * Lambdas queued by any thread, for the event loop thread to run. Used by the socket System::Layer implementations
+ * to back LayerSocketsLoop::ScheduleLambdaFromAnyThread().
+ *
+ * Only the first lambda queued after the event loop has started running the queue asks for a wakeup, so a burst of
+ * lambdas costs one Signal() rather than one per lambda.
+ */
+class WorkQueue
+{
+public:
+    /**
+     * Queue a lambda. May be called from any thread.
+     *
+     * @param[out] shouldSignal  Set when the caller has to wake the event loop thread.
+     */
+    CHIP_ERROR Post(const LambdaBridge & bridge, bool & shouldSignal)
+    {
+        VerifyOrReturnError(mQueue.TryPush(bridge), CHIP_ERROR_NO_MEMORY);
+        shouldSignal = !mSignalled.exchange(true, std::memory_order_acq_rel);
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Whether lambdas are waiting to run, in which case the event loop must not sleep. Event loop thread only.
+     */
+    bool HasPendingWork() const { return !mQueue.Empty(); }
+
+    /**
+     * Run the queued lambdas. Event loop thread only.
+     *
+     * At most one queue's worth of lambdas runs per call, so producers cannot keep the event loop from its other
+     * events; HasPendingWork() tells if some are left.
+     */
+    void Run()
+    {
+        // Lambdas queued from now on need a new wakeup. This exchange synchronizes with the one in Post(), which makes
+        // the lambdas queued by the posts which saw the flag set visible to the pops below.
+        mSignalled.exchange(false, std::memory_order_acq_rel);
+
+        LambdaBridge bridge;
+        for (size_t count = 0; count < mQueue.Capacity() && mQueue.TryPop(bridge); count++)
+        {
+            bridge();
+        }
+    }
+
+    /**
+     * Drop the queued lambdas. Event loop thread only, or while no event loop runs.
+     */
+    void Clear()
+    {
+        LambdaBridge bridge;
+        while (mQueue.TryPop(bridge))
+        {
+        }
+        mSignalled.store(false, std::memory_order_relaxed);
+    }
+
+private:
+    MpscQueue<LambdaBridge, CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE> mQueue;
+    std::atomic<bool> mSignalled{ false };
+};
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0
@@ -0,0 +1,257 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for the socket watches of the select and epoll
+ *      implementations of <tt>chip::System::LayerSocketsLoop</tt>.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+#include <system/SystemConfig.h>
+#include <system/SystemLayerImpl.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <deque>
+
+using namespace chip;
+using namespace chip::System;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+struct WatchedSocket
+{
+    int mFDs[2]             = { kInvalidFd, kInvalidFd }; // mFDs[0] is watched, mFDs[1] is its peer
+    SocketWatchToken mToken = 0;
+    SocketEvents mEvents;
+    size_t mCallbackCount = 0;
+};
+
+class TestSystemSocketWatch : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        EXPECT_SUCCESS(sLayer.Init());
+    }
+
+    static void TearDownTestSuite()
+    {
+        sLayer.Shutdown();
+        Platform::MemoryShutdown();
+    }
+
+    void TearDown() override
+    {
+        for (auto & socket : mSockets)
+        {
+            if (socket.mToken != sLayer.InvalidSocketWatchToken())
+            {
+                EXPECT_SUCCESS(sLayer.StopWatchingSocket(&socket.mToken));
+            }
+            close(socket.mFDs[0]);
+            close(socket.mFDs[1]);
+        }
+        mSockets.clear();
+    }
+
+    // Watch `count` new datagram sockets for reads, stopping at the first failure, e.g. when the layer runs out of
+    // watches or cannot represent the descriptor.
+    size_t WatchSockets(size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            WatchedSocket socket;
+            VerifyOrReturnValue(socketpair(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK, 0, socket.mFDs) == 0, i);
+            mSockets.push_back(socket);
+            WatchedSocket & watched = mSockets.back();
+            if (sLayer.StartWatchingSocket(watched.mFDs[0], &watched.mToken) != CHIP_NO_ERROR)
+            {
+                watched.mToken = sLayer.InvalidSocketWatchToken();
+                return i;
+            }
+            EXPECT_SUCCESS(sLayer.SetCallback(watched.mToken, HandleSocketEvents, reinterpret_cast<intptr_t>(&watched)));
+            EXPECT_SUCCESS(sLayer.RequestCallbackOnPendingRead(watched.mToken));
+        }
+        return count;
+    }
+
+    // Run one iteration of the event loop, which waits at most `timeout` for socket events.
+    static void ServiceEvents(Clock::Timeout timeout = 10_ms)
+    {
+        EXPECT_SUCCESS(sLayer.StartTimer(timeout, HandleTimeout, nullptr));
+        RunEventLoopIteration();
+        sLayer.CancelTimer(HandleTimeout, nullptr);
+    }
+
+    static void RunEventLoopIteration()
+    {
+        sLayer.PrepareEvents();
+        sLayer.WaitForEvents();
+        sLayer.HandleEvents();
+    }
+
+    static void Send(WatchedSocket & socket)
+    {
+        uint8_t byte = 0;
+        EXPECT_EQ(write(socket.mFDs[1], &byte, sizeof(byte)), static_cast<ssize_t>(sizeof(byte)));
+    }
+
+    static void HandleTimeout(Layer * layer, void * appState) {}
+
+    static LayerImpl sLayer;
+    std::deque<WatchedSocket> mSockets; // references stay valid as sockets are added
+
+private:
+    static void HandleSocketEvents(SocketEvents events, intptr_t data)
+    {
+        auto * socket   = reinterpret_cast<WatchedSocket *>(data);
+        socket->mEvents = events;
+        socket->mCallbackCount++;
+        if (events.Has(SocketEventFlags::kRead))
+        {
+            // Read a single datagram, leaving any other one pending.
+            uint8_t byte;
+            EXPECT_EQ(read(socket->mFDs[0], &byte, sizeof(byte)), static_cast<ssize_t>(sizeof(byte)));
+        }
+    }
+};
+
+LayerImpl TestSystemSocketWatch::sLayer;
+
+TEST_F(TestSystemSocketWatch, TestReadCallbacks)
+{
+    ASSERT_EQ(WatchSockets(2), 2u);
+    WatchedSocket & socket = mSockets[0];
+
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 0u);
+
+    // The callback reads one datagram per call, and is called again while some are left.
+    Send(socket);
+    Send(socket);
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 1u);
+    EXPECT_TRUE(socket.mEvents.Has(SocketEventFlags::kRead));
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 2u);
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 2u);
+    EXPECT_EQ(mSockets[1].mCallbackCount, 0u);
+
+    // Data received while reads are not requested is reported once they are.
+    EXPECT_SUCCESS(sLayer.ClearCallbackOnPendingRead(socket.mToken));
+    Send(socket);
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 2u);
+    EXPECT_SUCCESS(sLayer.RequestCallbackOnPendingRead(socket.mToken));
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 3u);
+}
+
+TEST_F(TestSystemSocketWatch, TestWriteCallbacks)
+{
+    ASSERT_EQ(WatchSockets(1), 1u);
+    WatchedSocket & socket = mSockets[0];
+
+    EXPECT_SUCCESS(sLayer.ClearCallbackOnPendingRead(socket.mToken));
+    EXPECT_SUCCESS(sLayer.RequestCallbackOnPendingWrite(socket.mToken));
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 1u);
+    EXPECT_TRUE(socket.mEvents.Has(SocketEventFlags::kWrite));
+    EXPECT_FALSE(socket.mEvents.Has(SocketEventFlags::kRead));
+
+    // Sockets stay reported as writable while the callback is requested.
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 2u);
+
+    EXPECT_SUCCESS(sLayer.ClearCallbackOnPendingWrite(socket.mToken));
+    ServiceEvents();
+    EXPECT_EQ(socket.mCallbackCount, 2u);
+}
+
+TEST_F(TestSystemSocketWatch, TestStopWatching)
+{
+    ASSERT_EQ(WatchSockets(2), 2u);
+
+    // Watching a socket twice returns the same token.
+    SocketWatchToken token;
+    EXPECT_SUCCESS(sLayer.StartWatchingSocket(mSockets[0].mFDs[0], &token));
+    EXPECT_EQ(token, mSockets[0].mToken);
+
+    Send(mSockets[0]);
+    Send(mSockets[1]);
+    EXPECT_SUCCESS(sLayer.StopWatchingSocket(&mSockets[1].mToken));
+    EXPECT_EQ(mSockets[1].mToken, sLayer.InvalidSocketWatchToken());
+    ServiceEvents();
+    EXPECT_EQ(mSockets[0].mCallbackCount, 1u);
+    EXPECT_EQ(mSockets[1].mCallbackCount, 0u);
+
+    // The slot of the stopped watch can be reused.
+    EXPECT_EQ(WatchSockets(1), 1u);
+    Send(mSockets[2]);
+    ServiceEvents();
+    EXPECT_EQ(mSockets[0].mCallbackCount, 1u);
+    EXPECT_EQ(mSockets[2].mCallbackCount, 1u);
+}
+
+TEST_F(TestSystemSocketWatch, TestEventLoopBenchmark)
+{
+    // Measures an iteration of the event loop with many watched sockets, one of which is ready. The numbers of sockets
+    // are capped by the size of the watch pool (INET_CONFIG_NUM_TCP_ENDPOINTS + INET_CONFIG_NUM_UDP_ENDPOINTS) and, for
+    // the select layer, by FD_SETSIZE.
+    constexpr size_t kIterations = 2000;
+    for (size_t count : { 10u, 100u, 1000u })
+    {
+        size_t watched = WatchSockets(count);
+        ASSERT_GT(watched, 0u);
+
+        // A socket is ready on every iteration, so the timer only guards against a hang and is the same for every one.
+        EXPECT_SUCCESS(sLayer.StartTimer(10000_ms, HandleTimeout, nullptr));
+        uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            Send(mSockets[(i * 7919) % watched]);
+            RunEventLoopIteration();
+        }
+        uint64_t elapsed = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+        sLayer.CancelTimer(HandleTimeout, nullptr);
+
+        size_t callbackCount = 0;
+        for (auto & socket : mSockets)
+        {
+            callbackCount += socket.mCallbackCount;
+        }
+        EXPECT_EQ(callbackCount, kIterations);
+
+        ChipLogProgress(Test, "%u watched sockets (%u requested): %u ns per event loop iteration",
+                        static_cast<unsigned>(watched), static_cast<unsigned>(count),
+                        static_cast<unsigned>(elapsed * 1000 / kIterations));
+        TearDown();
+    }
+}
+
+} // namespace
@@ -23,6 +23,7 @@
  *
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <stdint.h>
 #include <string.h>
@@ -565,6 +566,127 @@ TEST_F(TestSystemTimer, CheckTimerPool)
     EXPECT_TRUE(SYSTEM_STATS_TEST_HIGH_WATER_MARK(Stats::kSystemLayer_NumTimers, 4));
 }
 
+TEST_F(TestSystemTimer, CheckTimerListOrder)
+{
+    using Timer = TimerList::Node;
+    using namespace Clock::Literals;
+    static void (*const kCallback)(Layer *, void *) = [](Layer * layer, void * state) {};
+
+    // Timers with the same expiration time come out in the order they were added, and lookups by callback and state
+    // find the earliest matching timer, as with a sorted list.
+    constexpr size_t kTimerCount = 24; // enough to index the timers, within CHIP_SYSTEM_CONFIG_NUM_TIMERS
+    TimerPool<Timer> pool;
+    Timer * timers[kTimerCount];
+    int states[kTimerCount / 4];
+    for (size_t i = 0; i < kTimerCount; i++)
+    {
+        timers[i] = pool.Create(mLayer, Clock::Timestamp((i * 37) % 5), kCallback, &states[i % (kTimerCount / 4)]);
+        ASSERT_NE(timers[i], nullptr);
+    }
+
+    TimerList list;
+    for (auto * timer : timers)
+    {
+        list.Add(timer);
+    }
+    EXPECT_TRUE(list.Contains(kCallback, &states[3]));
+    EXPECT_FALSE(list.Contains(kCallback, nullptr));
+
+    // Timer 15 expires at 0 ms, before the other timers for states[3]: 3, 9 and 21.
+    EXPECT_EQ(list.Remove(kCallback, &states[3]), timers[15]);
+    list.Remove(timers[9]);
+    list.Remove(timers[9]); // not in the list anymore
+
+    auto indexOf    = [&](Timer * timer) { return static_cast<size_t>(std::find(timers, timers + kTimerCount, timer) - timers); };
+    size_t previous = kTimerCount;
+    size_t popped   = 0;
+    for (Timer * timer; (timer = list.PopEarliest()) != nullptr; popped++)
+    {
+        size_t index = indexOf(timer);
+        ASSERT_LT(index, kTimerCount);
+        EXPECT_NE(index, 15u);
+        EXPECT_NE(index, 9u);
+        if (previous < kTimerCount)
+        {
+            EXPECT_LE(timers[previous]->AwakenTime(), timer->AwakenTime());
+            if (timers[previous]->AwakenTime() == timer->AwakenTime())
+            {
+                EXPECT_LT(previous, index);
+            }
+        }
+        previous = index;
+    }
+    EXPECT_EQ(popped, kTimerCount - 2);
+    EXPECT_FALSE(list.Contains(kCallback, &states[3]));
+
+    pool.ReleaseAll();
+}
+
+TEST_F(TestSystemTimer, TimerListBenchmark)
+{
+    // Measures the TimerList operations behind starting, cancelling and expiring timers with 10000 of them active. The
+    // timers are allocated up front, since releasing a timer to a heap-backed TimerPool is linear in the number of
+    // timers and would dominate the measurements.
+    using Timer = TimerList::Node;
+    using namespace Clock::Literals;
+    static void (*const kCallback)(Layer *, void *) = [](Layer * layer, void * state) {};
+
+    constexpr size_t kTimerCount = 10000;
+    constexpr size_t kIterations = 10000;
+    static uint8_t states[kTimerCount];
+    auto awakenTime = [](size_t i) { return Clock::Timestamp((i * 7919) % kTimerCount); };
+
+    TimerPool<Timer> pool;
+    TimerList list;
+
+    static Timer * timers[kTimerCount];
+    for (size_t i = 0; i < kTimerCount; i++)
+    {
+        timers[i] = pool.Create(mLayer, awakenTime(i), kCallback, &states[i]);
+        if (timers[i] == nullptr)
+        {
+            // The pool is statically sized on this platform.
+            pool.ReleaseAll();
+            return;
+        }
+    }
+
+    uint64_t start = SystemClock().GetMonotonicMicroseconds64().count();
+    for (auto * timer : timers)
+    {
+        list.Add(timer);
+    }
+    uint64_t startElapsed = SystemClock().GetMonotonicMicroseconds64().count() - start;
+
+    // Cancel a timer and start it again, keeping kTimerCount of them active.
+    start = SystemClock().GetMonotonicMicroseconds64().count();
+    for (size_t i = 0; i < kIterations; i++)
+    {
+        Timer * timer = list.Remove(kCallback, &states[(i * 104729) % kTimerCount]);
+        ASSERT_NE(timer, nullptr);
+        list.Add(timer);
+    }
+    uint64_t cancelElapsed = SystemClock().GetMonotonicMicroseconds64().count() - start;
+
+    start = SystemClock().GetMonotonicMicroseconds64().count();
+    Clock::Timestamp previous = Clock::kZero;
+    size_t expired            = 0;
+    for (Timer * timer; (timer = list.PopIfEarlier(Clock::Timestamp(kTimerCount))) != nullptr; expired++)
+    {
+        EXPECT_LE(previous, timer->AwakenTime());
+        previous = timer->AwakenTime();
+    }
+    uint64_t expireElapsed = SystemClock().GetMonotonicMicroseconds64().count() - start;
+    EXPECT_EQ(expired, kTimerCount);
+    EXPECT_TRUE(list.Empty());
+    pool.ReleaseAll();
+
+    ChipLogProgress(Test, "%u active timers: start %u ns, cancel and restart %u ns, expire %u ns per timer",
+                    static_cast<unsigned>(kTimerCount), static_cast<unsigned>(startElapsed * 1000 / kTimerCount),
+                    static_cast<unsigned>(cancelElapsed * 1000 / kIterations),
+                    static_cast<unsigned>(expireElapsed * 1000 / kTimerCount));
+}
+
 TEST_F(TestSystemTimer, ExtendTimerToTest)
 {
     if (!LayerEvents<LayerImpl>::HasServiceEvents())
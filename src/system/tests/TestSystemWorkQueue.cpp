@@ -0,0 +1,220 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for the work other threads queue for a socket event loop through
+ *      LayerSocketsLoop::ScheduleLambdaFromAnyThread().
+ */
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemConfig.h>
+#include <system/SystemLayerImpl.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::System;
+
+// State updated by the work of the producer threads, only ever touched on the event loop thread (or with the lock
+// held, for the locking variant of the benchmark).
+struct DeviceState
+{
+    std::vector<uint32_t> lastUpdate;
+    uint32_t outOfOrderUpdates = 0;
+    std::atomic<size_t> appliedUpdates{ 0 };
+
+    void Apply(uint32_t producer, uint32_t update)
+    {
+        if (update != lastUpdate[producer] + 1)
+        {
+            outOfOrderUpdates++;
+        }
+        lastUpdate[producer] = update;
+        appliedUpdates.fetch_add(1, std::memory_order_release);
+    }
+};
+
+class TestSystemWorkQueue : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override { ASSERT_EQ(mLayer.Init(), CHIP_NO_ERROR); }
+    void TearDown() override { mLayer.Shutdown(); }
+
+    // Runs the event loop until `done` returns true, taking the lock around event processing like
+    // GenericPlatformManagerImpl_POSIX does with the stack lock.
+    template <typename Done>
+    void RunEventLoop(std::mutex & lock, Done done)
+    {
+        while (!done())
+        {
+            lock.lock();
+            mLayer.PrepareEvents();
+            lock.unlock();
+            mLayer.WaitForEvents();
+            lock.lock();
+            mLayer.HandleEvents();
+            lock.unlock();
+        }
+    }
+
+    // Apply updatesPerProducer updates from each of producerCount threads to `state`, either through the work queue or by
+    // taking the lock of the event loop. Returns the time taken until all were applied, in microseconds.
+    int64_t ApplyUpdates(uint32_t producerCount, uint32_t updatesPerProducer, bool useWorkQueue, DeviceState & state)
+    {
+        std::mutex lock;
+        state.lastUpdate.assign(producerCount, 0);
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> producers;
+        for (uint32_t p = 0; p < producerCount; p++)
+        {
+            producers.emplace_back([this, &lock, &state, p, updatesPerProducer, useWorkQueue] {
+                for (uint32_t update = 1; update <= updatesPerProducer; update++)
+                {
+                    if (!useWorkQueue)
+                    {
+                        std::lock_guard<std::mutex> guard(lock);
+                        state.Apply(p, update);
+                        mLayer.Signal();
+                        continue;
+                    }
+                    DeviceState * target = &state;
+                    while (mLayer.ScheduleLambdaFromAnyThread([target, p, update] { target->Apply(p, update); }) ==
+                           CHIP_ERROR_NO_MEMORY)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        const size_t total = static_cast<size_t>(producerCount) * updatesPerProducer;
+        RunEventLoop(lock, [&state, total] { return state.appliedUpdates.load(std::memory_order_acquire) == total; });
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        for (auto & producer : producers)
+        {
+            producer.join();
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    }
+
+    LayerImpl mLayer;
+};
+
+#if CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0
+
+TEST_F(TestSystemWorkQueue, TestRunsInOrderOnEventLoop)
+{
+    int calls = 0;
+    std::vector<int> order;
+    for (int i = 0; i < 3; i++)
+    {
+        auto * target = &order;
+        EXPECT_EQ(mLayer.ScheduleLambdaFromAnyThread([target, i] { target->push_back(i); }), CHIP_NO_ERROR);
+    }
+    int * counter = &calls;
+    EXPECT_EQ(mLayer.ScheduleLambdaFromAnyThread([counter] { (*counter)++; }), CHIP_NO_ERROR);
+    EXPECT_TRUE(order.empty());
+
+    // Queued work does not let the event loop sleep.
+    std::mutex lock;
+    RunEventLoop(lock, [&calls] { return calls > 0; });
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(order, (std::vector<int>{ 0, 1, 2 }));
+}
+
+TEST_F(TestSystemWorkQueue, TestQueueFull)
+{
+    int calls     = 0;
+    int * counter = &calls;
+    for (size_t i = 0; i < CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE; i++)
+    {
+        EXPECT_EQ(mLayer.ScheduleLambdaFromAnyThread([counter] { (*counter)++; }), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(mLayer.ScheduleLambdaFromAnyThread([counter] { (*counter)++; }), CHIP_ERROR_NO_MEMORY);
+
+    std::mutex lock;
+    RunEventLoop(lock, [&calls] { return calls == CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE; });
+    EXPECT_EQ(mLayer.ScheduleLambdaFromAnyThread([counter] { (*counter)++; }), CHIP_NO_ERROR);
+}
+
+TEST_F(TestSystemWorkQueue, TestDroppedOnShutdown)
+{
+    int calls     = 0;
+    int * counter = &calls;
+    EXPECT_EQ(mLayer.ScheduleLambdaFromAnyThread([counter] { (*counter)++; }), CHIP_NO_ERROR);
+    mLayer.Shutdown();
+    EXPECT_EQ(mLayer.ScheduleLambdaFromAnyThread([counter] { (*counter)++; }), CHIP_ERROR_INCORRECT_STATE);
+
+    ASSERT_EQ(mLayer.Init(), CHIP_NO_ERROR);
+    EXPECT_EQ(mLayer.ScheduleLambdaFromAnyThread([counter] { (*counter)++; }), CHIP_NO_ERROR);
+    std::mutex lock;
+    RunEventLoop(lock, [&calls] { return calls > 0; });
+    EXPECT_EQ(calls, 1);
+}
+
+TEST_F(TestSystemWorkQueue, TestConcurrentProducers)
+{
+    DeviceState state;
+    ApplyUpdates(8, 5000, true, state);
+    EXPECT_EQ(state.appliedUpdates.load(), 8u * 5000u);
+    EXPECT_EQ(state.outOfOrderUpdates, 0u);
+    for (uint32_t last : state.lastUpdate)
+    {
+        EXPECT_EQ(last, 5000u);
+    }
+}
+
+// Device state updates pushed by 1 to 16 threads, as a bridge does, either queued for the event loop or applied with
+// its lock held.
+TEST_F(TestSystemWorkQueue, BenchmarkContention)
+{
+    constexpr uint32_t kProducerCounts[] = { 1, 2, 4, 8, 16 };
+    constexpr uint32_t kUpdates          = 64000;
+
+    for (uint32_t producerCount : kProducerCounts)
+    {
+        DeviceState queued;
+        DeviceState locked;
+        int64_t queuedTime = ApplyUpdates(producerCount, kUpdates / producerCount, true, queued);
+        int64_t lockedTime = ApplyUpdates(producerCount, kUpdates / producerCount, false, locked);
+        EXPECT_EQ(queued.outOfOrderUpdates, 0u);
+        ChipLogProgress(Test, "%u producers, %u updates: work queue %lld us, event loop lock %lld us",
+                        static_cast<unsigned>(producerCount), static_cast<unsigned>(kUpdates),
+                        static_cast<long long>(queuedTime), static_cast<long long>(lockedTime));
+    }
+}
+
+#endif // CHIP_SYSTEM_CONFIG_WORK_QUEUE_SIZE > 0
+
+} // namespace
@@ -37,9 +37,10 @@ using System::PacketBufferHandle;
 namespace SecureMessageCodec {
 
 CHIP_ERROR Encrypt(const CryptoContext & context, CryptoContext::ConstNonceView nonce, PayloadHeader & payloadHeader,
-                   PacketHeader & packetHeader, System::PacketBufferHandle & msgBuf)
+                   PacketHeader & packetHeader, System::PacketBufferHandle & msgBuf, bool allowChainedMIC)
 {
     VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+    // The payload header and payload are encrypted in place in a single pass, so they have to be contiguous.
     VerifyOrReturnError(!msgBuf->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
 
     ReturnErrorOnFailure(payloadHeader.EncodeBeforeData(msgBuf));
@@ -51,9 +52,20 @@ CHIP_ERROR Encrypt(const CryptoContext & context, CryptoContext::ConstNonceView
     ReturnErrorOnFailure(context.Encrypt(data, totalLen, data, nonce, packetHeader, mac));
 
     uint16_t taglen = 0;
-    ReturnErrorOnFailure(mac.Encode(packetHeader, &data[totalLen], msgBuf->AvailableDataLength(), &taglen));
-
-    msgBuf->SetDataLength(totalLen + taglen);
+    if (!allowChainedMIC || msgBuf->AvailableDataLength() >= packetHeader.MICTagLength())
+    {
+        ReturnErrorOnFailure(mac.Encode(packetHeader, &data[totalLen], msgBuf->AvailableDataLength(), &taglen));
+        msgBuf->SetDataLength(totalLen + taglen);
+        return CHIP_NO_ERROR;
+    }
+
+    // No room for the MIC after the payload: chain it in a buffer of its own rather than copying the payload to a
+    // larger buffer.
+    PacketBufferHandle micBuf = PacketBufferHandle::New(packetHeader.MICTagLength(), 0);
+    VerifyOrReturnError(!micBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(mac.Encode(packetHeader, micBuf->Start(), micBuf->AvailableDataLength(), &taglen));
+    micBuf->SetDataLength(taglen);
+    msgBuf->AddToEnd(std::move(micBuf));
 
     return CHIP_NO_ERROR;
 }
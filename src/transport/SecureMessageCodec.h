@@ -48,10 +48,12 @@ namespace SecureMessageCodec {
  * @param[in,out] msgBuf      The message buffer that contains the unencrypted message. If
  *                            the operation is successful, this buffer will be mutated to contain
  *                            the encrypted message and any trailing MIC generated.
+ * @param[in] allowChainedMIC Whether the MIC may be chained in a buffer of its own when msgBuf
+ *                            has no room left for it, for transports which send buffer chains.
  * @return A CHIP_ERROR value consistent with the result of the encryption operation.
  */
 CHIP_ERROR Encrypt(const CryptoContext & context, CryptoContext::ConstNonceView nonce, PayloadHeader & payloadHeader,
-                   PacketHeader & packetHeader, System::PacketBufferHandle & msgBuf);
+                   PacketHeader & packetHeader, System::PacketBufferHandle & msgBuf, bool allowChainedMIC = false);
 
 /**
  * @brief
@@ -23,6 +23,7 @@
 
 #include <app/util/basic-types.h>
 #include <ble/Ble.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/ReferenceCounted.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <transport/CryptoContext.h>
@@ -224,16 +225,7 @@ public:
 
     // Called when AddNOC has gone through sufficient success that we need to switch the
     // session to reflect a new fabric if it was a PASE session
-    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex)
-    {
-        // It's not legal to augment session type for non-PASE
-        if (mSecureSessionType != Type::kPASE)
-        {
-            return CHIP_ERROR_INVALID_ARGUMENT;
-        }
-        SetFabricIndex(fabricIndex);
-        return CHIP_NO_ERROR;
-    }
+    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex);
 
     System::Clock::Timestamp GetLastActivityTime() const { return mLastActivityTime; }
     System::Clock::Timestamp GetLastPeerActivityTime() const { return mLastPeerActivityTime; }
@@ -328,6 +320,7 @@ private:
     void MoveToState(State targetState);
 
     friend class SecureSessionDeleter;
+    friend class SecureSessionTable;
     friend class TestSecureSessionTable;
 
     SecureSessionTable & mTable;
@@ -351,6 +344,13 @@ private:
     SessionParameters mRemoteSessionParams;
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    // Links of the list of the sessions sharing a bucket of the SecureSessionTable peer index: the next session, and the
+    // pointer to this session, which is either the bucket head or the mNextInPeerBucket of the previous session.
+    SecureSession * mNextInPeerBucket = nullptr;
+    SecureSession ** mPeerBucketLink  = nullptr;
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
 };
 
 } // namespace Transport
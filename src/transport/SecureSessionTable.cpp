@@ -52,8 +52,8 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result =
+        CreateEntry(secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs, peerSessionId, fabricIndex, config);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -73,7 +73,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = CreateEntry(secureSessionType, sessionId.Value());
     }
     else
     {
@@ -216,7 +216,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = CreateEntry(secureSessionType, localSessionId);
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -339,6 +339,9 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
 
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    SecureSession * result = FindByLocalSessionId(localSessionId);
+#else
     SecureSession * result = nullptr;
     mEntries.ForEachActiveObject([&](auto session) {
         if (session->GetLocalSessionId() == localSessionId)
@@ -348,11 +351,24 @@ Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t
         }
         return Loop::Continue;
     });
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    // There are fewer sessions than IDs, so one of the first CHIP_CONFIG_SECURE_SESSION_POOL_SIZE + 2 candidates is free.
+    uint16_t candidate = mNextSessionId;
+    for (size_t i = 0; i <= CHIP_CONFIG_SECURE_SESSION_POOL_SIZE + 1; i++, candidate++)
+    {
+        if (candidate != kUnsecuredSessionId && FindByLocalSessionId(candidate) == nullptr)
+        {
+            return MakeOptional<uint16_t>(candidate);
+        }
+    }
+    return NullOptional;
+#else
     uint16_t candidate_base = 0;
     uint64_t candidate_mask = 0;
     for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
@@ -401,7 +417,102 @@ Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
     }
 
     return NullOptional;
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+}
+
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
+size_t SecureSessionTable::PeerBucket(const ScopedNodeId & peer)
+{
+    // Fibonacci hashing of the node id mixed with the fabric index.
+    uint64_t key = peer.GetNodeId() ^ (static_cast<uint64_t>(peer.GetFabricIndex()) << 56);
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & kIndexMask;
+}
+
+void SecureSessionTable::AddToIndex(SecureSession * session)
+{
+    // Local session ids are allocated sequentially, so they are spread evenly by their low bits.
+    size_t slot = session->GetLocalSessionId() & kIndexMask;
+    while (mSessionsByLocalId[slot] != nullptr)
+    {
+        slot = (slot + 1) & kIndexMask;
+    }
+    mSessionsByLocalId[slot] = session;
+
+    LinkToPeerBucket(session);
+}
+
+void SecureSessionTable::RemoveFromIndex(SecureSession * session)
+{
+    UnlinkFromPeerBucket(session);
+
+    size_t hole = session->GetLocalSessionId() & kIndexMask;
+    while (mSessionsByLocalId[hole] != session)
+    {
+        VerifyOrReturn(mSessionsByLocalId[hole] != nullptr);
+        hole = (hole + 1) & kIndexMask;
+    }
+    mSessionsByLocalId[hole] = nullptr;
+
+    // Shift back the following sessions of the probe sequence which may not be found past the hole anymore.
+    for (size_t slot = (hole + 1) & kIndexMask; mSessionsByLocalId[slot] != nullptr; slot = (slot + 1) & kIndexMask)
+    {
+        size_t home = mSessionsByLocalId[slot]->GetLocalSessionId() & kIndexMask;
+        if (((slot - home) & kIndexMask) >= ((slot - hole) & kIndexMask))
+        {
+            mSessionsByLocalId[hole] = mSessionsByLocalId[slot];
+            mSessionsByLocalId[slot] = nullptr;
+            hole                     = slot;
+        }
+    }
 }
 
+void SecureSessionTable::LinkToPeerBucket(SecureSession * session)
+{
+    SecureSession *& head      = mPeerBuckets[PeerBucket(session->GetPeer())];
+    session->mNextInPeerBucket = head;
+    session->mPeerBucketLink   = &head;
+    if (head != nullptr)
+    {
+        head->mPeerBucketLink = &session->mNextInPeerBucket;
+    }
+    head = session;
+}
+
+void SecureSessionTable::UnlinkFromPeerBucket(SecureSession * session)
+{
+    VerifyOrReturn(session->mPeerBucketLink != nullptr);
+
+    for (PeerBucketCursor * cursor = mCursors; cursor != nullptr; cursor = cursor->mOuter)
+    {
+        if (cursor->mNext == session)
+        {
+            cursor->mNext = session->mNextInPeerBucket;
+        }
+    }
+
+    *session->mPeerBucketLink = session->mNextInPeerBucket;
+    if (session->mNextInPeerBucket != nullptr)
+    {
+        session->mNextInPeerBucket->mPeerBucketLink = session->mPeerBucketLink;
+    }
+    session->mNextInPeerBucket = nullptr;
+    session->mPeerBucketLink   = nullptr;
+}
+
+SecureSession * SecureSessionTable::FindByLocalSessionId(uint16_t localSessionId) const
+{
+    for (size_t slot = localSessionId & kIndexMask; mSessionsByLocalId[slot] != nullptr; slot = (slot + 1) & kIndexMask)
+    {
+        if (mSessionsByLocalId[slot]->GetLocalSessionId() == localSessionId)
+        {
+            return mSessionsByLocalId[slot];
+        }
+    }
+    return nullptr;
+}
+
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
 } // namespace Transport
 } // namespace chip
@@ -16,6 +16,7 @@
  */
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/Pool.h>
@@ -29,6 +30,19 @@ namespace Transport {
 inline constexpr uint16_t kMaxSessionID       = UINT16_MAX;
 inline constexpr uint16_t kUnsecuredSessionId = 0;
 
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+// Size of the tables of the SecureSessionTable indexes: the power of two at least twice CHIP_CONFIG_SECURE_SESSION_POOL_SIZE.
+constexpr size_t SecureSessionIndexCapacity()
+{
+    size_t capacity = 1;
+    while (capacity < 2 * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE)
+    {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
 /**
  * Handles a set of sessions.
  *
@@ -76,7 +90,13 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+        RemoveFromIndex(session);
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+        mEntries.ReleaseObject(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -84,6 +104,38 @@ public:
         return mEntries.ForEachActiveObject(std::forward<Function>(function));
     }
 
+    /**
+     * Calls `function(SecureSession * session)` for every session whose peer is `peer`, in no particular order, until it
+     * returns Loop::Break.
+     *
+     * As with ForEachSession, the function may release the session passed to it.
+     */
+    template <typename Function>
+    Loop ForEachSessionWithPeer(const ScopedNodeId & peer, Function && function)
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+        PeerBucketCursor cursor(*this, mPeerBuckets[PeerBucket(peer)]);
+        while (cursor.mNext != nullptr)
+        {
+            SecureSession * session = cursor.mNext;
+            cursor.mNext            = session->mNextInPeerBucket;
+            if (session->GetPeer() == peer && function(session) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+#else
+        return mEntries.ForEachActiveObject([&](SecureSession * session) {
+            if (session->GetPeer() == peer)
+            {
+                return function(session);
+            }
+            return Loop::Continue;
+        });
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    }
+
     /**
      * Get a secure session given its session ID.
      *
@@ -100,7 +152,7 @@ public:
     void NewerSessionAvailable(SecureSession * session)
     {
         VerifyOrDie(session->GetSecureSessionType() == SecureSession::Type::kCASE);
-        mEntries.ForEachActiveObject([&](SecureSession * oldSession) {
+        ForEachSessionWithPeer(session->GetPeer(), [&](SecureSession * oldSession) {
             if (session == oldSession)
                 return Loop::Continue;
 
@@ -120,6 +172,16 @@ public:
         });
     }
 
+    // To be called by a session whose peer node id or fabric index has just changed.
+    // This is an internal API, using raw pointer to a session is allowed here.
+    void OnSessionPeerChanged(SecureSession * session)
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+        UnlinkFromPeerBucket(session);
+        LinkToPeerBucket(session);
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    }
+
 private:
     friend class TestSecureSessionTable;
 
@@ -248,17 +310,74 @@ private:
      * from the starting mNextSessionId clue.
      *
      * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  When
+     * CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX is enabled, the IDs following mNextSessionId
+     * are instead looked up in the local session ID index, which usually finds one at once.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    // Allocates a session out of the pool and adds it to the indexes.
+    template <typename... Args>
+    SecureSession * CreateEntry(Args &&... args)
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+        // Heap based pools do not enforce their size, but the indexes are sized for it.
+        VerifyOrReturnValue(mEntries.Allocated() < CHIP_CONFIG_SECURE_SESSION_POOL_SIZE, nullptr);
+        SecureSession * session = mEntries.CreateObject(*this, std::forward<Args>(args)...);
+        if (session != nullptr)
+        {
+            AddToIndex(session);
+        }
+        return session;
+#else
+        return mEntries.CreateObject(*this, std::forward<Args>(args)...);
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    }
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
 
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    /**
+     * Position of an iteration over a peer bucket, which is moved past any session unlinked from the bucket while the
+     * iteration is in progress, so that releasing other sessions from the iteration function is harmless too.
+     */
+    struct PeerBucketCursor
+    {
+        PeerBucketCursor(SecureSessionTable & table, SecureSession * first) : mTable(table), mNext(first), mOuter(table.mCursors)
+        {
+            mTable.mCursors = this;
+        }
+        ~PeerBucketCursor() { mTable.mCursors = mOuter; }
+
+        SecureSessionTable & mTable;
+        SecureSession * mNext;
+        PeerBucketCursor * mOuter;
+    };
+
+    // Both tables have twice as many entries as the pool, so the local session id table stays at most half full and peer
+    // buckets hold about one session each.
+    static constexpr size_t kIndexCapacity = SecureSessionIndexCapacity();
+    static constexpr size_t kIndexMask     = kIndexCapacity - 1;
+
+    static size_t PeerBucket(const ScopedNodeId & peer);
+
+    void AddToIndex(SecureSession * session);
+    void RemoveFromIndex(SecureSession * session);
+    void LinkToPeerBucket(SecureSession * session);
+    void UnlinkFromPeerBucket(SecureSession * session);
+    SecureSession * FindByLocalSessionId(uint16_t localSessionId) const;
+
+    // Sessions by local session id, using open addressing with linear probing.
+    SecureSession * mSessionsByLocalId[kIndexCapacity] = {};
+    // Heads of the doubly linked lists of the sessions by peer hash.
+    SecureSession * mPeerBuckets[kIndexCapacity] = {};
+    PeerBucketCursor * mCursors                  = nullptr; // Innermost iteration over a peer bucket
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
     size_t GetMaxSessionTableSize() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -72,6 +72,29 @@ void CorrectPeerAddressInterfaceID(Transport::PeerAddress & peerAddress)
     peerAddress.SetInterface(Inet::InterfaceId::Null());
 }
 
+// Whether messages to `peerAddress` may be sent as a chain of buffers. The TCP endpoints send a chain as it is, so the
+// packet header and MIC of a message without room for them go into buffers of their own rather than the whole message
+// being copied into a larger buffer. Other transports (BLE, NFC, some UDP endpoints) only send a single buffer.
+bool CanSendChainedMessage(const Transport::PeerAddress & peerAddress)
+{
+    return peerAddress.GetTransportType() == Transport::Type::kTcp;
+}
+
+// Encode the packet header in front of the message, in a buffer of its own at the head of the chain if the message has
+// too little headroom for it and `allowChain` is set.
+CHIP_ERROR EncodePacketHeaderBeforeData(const PacketHeader & packetHeader, PacketBufferHandle & message, bool allowChain)
+{
+    uint16_t headerSize = packetHeader.EncodeSizeBytes();
+    if (allowChain && message->ReservedSize() < headerSize)
+    {
+        PacketBufferHandle headerBuf = PacketBufferHandle::New(0, headerSize);
+        VerifyOrReturnError(!headerBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
+        headerBuf->AddToEnd(std::move(message));
+        message = std::move(headerBuf);
+    }
+    return packetHeader.EncodeBeforeData(message);
+}
+
 } // namespace
 
 uint32_t EncryptedPacketBufferHandle::GetMessageCounter() const
@@ -283,7 +306,8 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
         sourceNodeId = session->GetLocalScopedNodeId().GetNodeId();
         ReturnErrorOnFailure(CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), messageCounter, sourceNodeId));
 
-        ReturnErrorOnFailure(SecureMessageCodec::Encrypt(cryptoContext, nonce, payloadHeader, packetHeader, message));
+        ReturnErrorOnFailure(SecureMessageCodec::Encrypt(cryptoContext, nonce, payloadHeader, packetHeader, message,
+                                                         CanSendChainedMessage(destination_address)));
 
 #if CHIP_PROGRESS_LOGGING
         destination = session->GetPeerNodeId();
@@ -337,7 +361,7 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
         return CHIP_ERROR_INTERNAL;
     }
 
-    ReturnErrorOnFailure(packetHeader.EncodeBeforeData(message));
+    ReturnErrorOnFailure(EncodePacketHeaderBeforeData(packetHeader, message, CanSendChainedMessage(destination_address)));
 
 #if CHIP_PROGRESS_LOGGING
     CompressedFabricId compressedFabricId = kUndefinedCompressedFabricId;
@@ -447,7 +471,7 @@ CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHand
 
     PacketBufferHandle msgBuf = preparedMessage.CastToWritable();
     VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrReturnError(!msgBuf->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    VerifyOrReturnError(!msgBuf->HasChainedBuffer() || CanSendChainedMessage(*destination), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
 
 #if CHIP_SYSTEM_CONFIG_MULTICAST_HOMING
     if (sessionHandle->GetSessionType() == Transport::Session::SessionType::kGroupOutgoing)
@@ -571,9 +595,8 @@ void SessionManager::ExpireAllSecureSessions()
 
 void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Optional<Transport::SecureSession::Type> & type)
 {
-    mSecureSessions.ForEachSession([&node, &type](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == node &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+    mSecureSessions.ForEachSessionWithPeer(node, [&type](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             session->MarkAsDefunct();
         }
@@ -583,10 +606,10 @@ void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Opti
 
 void SessionManager::UpdateAllSessionsPeerAddress(const ScopedNodeId & node, const Transport::PeerAddress & addr)
 {
-    mSecureSessions.ForEachSession([&node, &addr](auto session) {
+    mSecureSessions.ForEachSessionWithPeer(node, [&addr](auto session) {
         // Arguably we should only be updating active and defunct sessions, but there is no harm
         // in updating evicted sessions.
-        if (session->GetPeer() == node && Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
+        if (Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
         {
             session->SetPeerAddress(addr);
         }
@@ -1255,13 +1278,12 @@ Optional<SessionHandle> SessionManager::FindSecureSessionForNode(ScopedNodeId pe
     SecureSession * tcpSession = nullptr;
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
-    mSecureSessions.ForEachSession([&peerNodeId, &type, &mrpSession,
+    mSecureSessions.ForEachSessionWithPeer(peerNodeId, [&type, &mrpSession,
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &tcpSession,
+                                                        &tcpSession,
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &transportPayloadCapability](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == peerNodeId &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+                                                        &transportPayloadCapability](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             if (transportPayloadCapability == TransportPayloadCapability::kMRPOrTCPCompatiblePayload ||
                 transportPayloadCapability == TransportPayloadCapability::kLargePayload)
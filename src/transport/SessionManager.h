@@ -100,9 +100,8 @@ public:
     uint32_t GetMessageCounter() const;
 
     /**
-     * Creates a copy of the data in this packet.
-     *
-     * Does NOT support chained buffers.
+     * Creates a copy of the data in this packet, including any chained buffers
+     * (e.g. the separately allocated packet header or MIC of a message sent over TCP).
      *
      * @returns empty handle on allocation failure.
      */
@@ -160,7 +159,8 @@ public:
      *    1. Encrypt the msgBuf
      *    2. construct the packet header
      *    3. Encode the packet header and prepend it to message.
-     *   Returns a encrypted message in encryptedMessage.
+     *   Returns a encrypted message in encryptedMessage. For a peer over TCP, the packet header and MIC are chained
+     *   in buffers of their own when msgBuf has no room for them; other messages are kept in a single buffer.
      */
     CHIP_ERROR PrepareMessage(const SessionHandle & session, PayloadHeader & payloadHeader, System::PacketBufferHandle && msgBuf,
                               EncryptedPacketBufferHandle & encryptedMessage);
@@ -217,12 +217,8 @@ public:
     template <typename Function>
     void ForEachMatchingSession(const ScopedNodeId & node, Function && function)
     {
-        mSecureSessions.ForEachSession([&](auto * session) {
-            if (session->GetPeer() == node)
-            {
-                function(session);
-            }
-
+        mSecureSessions.ForEachSessionWithPeer(node, [&](auto * session) {
+            function(session);
             return Loop::Continue;
         });
     }
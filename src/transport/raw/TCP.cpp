@@ -237,16 +237,26 @@ CHIP_ERROR TCPBase::PrepareBuffer(System::PacketBufferHandle & msgBuf)
     //    - actual data
 
     VerifyOrReturnError(mState == TCPState::kInitialized, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(kPacketSizeBytes + msgBuf->DataLength() <= System::PacketBuffer::kLargeBufMaxSizeWithoutReserve,
+
+    // The message may be a chain (e.g. with its headers or MIC in buffers of their own), which the endpoint sends as is.
+    const size_t messageSize = msgBuf->TotalLength();
+    VerifyOrReturnError(kPacketSizeBytes + messageSize <= System::PacketBuffer::kLargeBufMaxSizeWithoutReserve,
                         CHIP_ERROR_INVALID_ARGUMENT);
 
     static_assert(kPacketSizeBytes <= UINT16_MAX);
-    VerifyOrReturnError(msgBuf->EnsureReservedSize(static_cast<uint16_t>(kPacketSizeBytes)), CHIP_ERROR_NO_MEMORY);
+    if (msgBuf->ReservedSize() < kPacketSizeBytes)
+    {
+        // Put the size in a buffer of its own, rather than moving the whole message to make room for it.
+        System::PacketBufferHandle sizeBuf = System::PacketBufferHandle::New(0, static_cast<uint16_t>(kPacketSizeBytes));
+        VerifyOrReturnError(!sizeBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
+        sizeBuf->AddToEnd(std::move(msgBuf));
+        msgBuf = std::move(sizeBuf);
+    }
 
     msgBuf->SetStart(msgBuf->Start() - kPacketSizeBytes);
 
     uint8_t * output = msgBuf->Start();
-    LittleEndian::Write32(output, static_cast<uint32_t>(msgBuf->DataLength() - kPacketSizeBytes));
+    LittleEndian::Write32(output, static_cast<uint32_t>(messageSize));
 
     return CHIP_NO_ERROR;
 }
@@ -434,6 +444,19 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
         // Peel off the head to pass upstream, which effectively consumes it from `state->mReceived`.
         message = state.mReceived.PopHead();
     }
+    else if (state.mReceived->DataLength() < messageSize && state.mReceived.HasSoleOwnership() &&
+             state.mReceived->AvailableDataLength() >= messageSize - state.mReceived->DataLength())
+    {
+        // The head buffer holds the start of the message and has room for the rest of it, e.g. after a large read.
+        // Gather the rest in place, so that only the bytes from the following buffers are copied.
+        const size_t headLength = state.mReceived->DataLength();
+        message                 = state.mReceived.PopHead();
+        CHIP_ERROR err          = state.mReceived->Read(message->Start() + headLength, messageSize - headLength);
+        state.mReceived.Consume(messageSize - headLength);
+        ReturnErrorOnFailure(err);
+        message->SetDataLength(messageSize);
+        mBytesCopiedOnReceive += messageSize - headLength;
+    }
     else
     {
         // The message is either longer or shorter than the head buffer.
@@ -449,6 +472,7 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
         state.mReceived.Consume(messageSize);
         ReturnErrorOnFailure(err);
         message->SetDataLength(messageSize);
+        mBytesCopiedOnReceive += messageSize;
     }
 
     MessageTransportContext msgContext;
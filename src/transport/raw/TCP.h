@@ -322,6 +322,9 @@ private:
     // Number of active and 'pending connection' endpoints
     size_t mUsedEndPointCount = 0;
 
+    // Number of received bytes copied to make messages contiguous
+    uint64_t mBytesCopiedOnReceive = 0;
+
     // Currently active connections
     ActiveTCPConnectionState * mActiveConnections;
     const size_t mActiveConnectionsSize;
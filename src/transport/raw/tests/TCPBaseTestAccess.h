@@ -55,6 +55,8 @@ public:
     {
         return tcp.ProcessReceivedBuffer(endPoint, peerAddress, std::move(buffer));
     }
+
+    static uint64_t GetBytesCopiedOnReceive(TCPImpl & tcp) { return tcp.mBytesCopiedOnReceive; }
 };
 } // namespace Transport
 } // namespace chip
@@ -44,6 +44,9 @@
 #include <transport/raw/TCP.h>
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 #include <transport/raw/tests/TCPBaseTestAccess.h>
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+#include <inet/TCPEndPointImplSockets.h>
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
 using namespace chip;
 using namespace chip::Testing;
@@ -253,6 +256,112 @@ public:
         SetCallback(nullptr);
     }
 
+    void ChainedMessageTest(TCPImpl & tcp, const IPAddress & addr, uint16_t port)
+    {
+        SetCallback([](const uint8_t * message, size_t length, int count, ActiveTCPConnectionHandle & conn, void * data) {
+            return (length == sizeof(PAYLOAD) && memcmp(message, PAYLOAD, length) == 0) ? CHIP_NO_ERROR
+                                                                                       : CHIP_ERROR_INCORRECT_STATE;
+        });
+
+        CHIP_ERROR err = tcp.TCPConnect(Transport::PeerAddress::TCP(addr, port), nullptr, refHolder);
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        EXPECT_TRUE(refHolder);
+
+        // A payload without any headroom, chained after a buffer holding the packet header, so that the
+        // message size has to go into a buffer of its own too.
+        chip::System::PacketBufferHandle payload = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD), 0, 0);
+        ASSERT_FALSE(payload.IsNull());
+
+        PacketHeader header;
+        header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+        chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::New(0, header.EncodeSizeBytes());
+        ASSERT_FALSE(buffer.IsNull());
+        buffer->AddToEnd(std::move(payload));
+        EXPECT_EQ(header.EncodeBeforeData(buffer), CHIP_NO_ERROR);
+        EXPECT_TRUE(buffer->HasChainedBuffer());
+
+        err = tcp.SendMessage(Transport::PeerAddress::TCP(addr, port), std::move(buffer));
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+
+        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5), [this]() { return mReceiveHandlerCallCount != 0; });
+        EXPECT_EQ(mReceiveHandlerCallCount, 1);
+
+        SetCallback(nullptr);
+    }
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    // Sends kMessageCount messages of each size in messageSizes, reporting the throughput and the number of
+    // bytes copied on the way.
+    void ThroughputBenchmark(TCPImpl & tcp, const IPAddress & addr, uint16_t port, const size_t * messageSizes,
+                             size_t messageSizeCount)
+    {
+        constexpr int kMessageCount = 20;
+
+        CHIP_ERROR err = tcp.TCPConnect(Transport::PeerAddress::TCP(addr, port), nullptr, refHolder);
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        EXPECT_TRUE(refHolder);
+
+        for (size_t i = 0; i < messageSizeCount; i++)
+        {
+            size_t payloadSize = messageSizes[i];
+            SetCallback(
+                [](const uint8_t * message, size_t length, int count, ActiveTCPConnectionHandle & conn, void * data) {
+                    size_t expectedLength = *static_cast<size_t *>(data);
+                    VerifyOrReturnError(length == expectedLength, CHIP_ERROR_INCORRECT_STATE);
+                    VerifyOrReturnError(message[0] == 0 && message[length - 1] == static_cast<uint8_t>(length - 1),
+                                        CHIP_ERROR_INCORRECT_STATE);
+                    return CHIP_NO_ERROR;
+                },
+                &payloadSize);
+
+            mReceiveHandlerCallCount = 0;
+            TCPEndPointImplSockets::ResetIOCounters();
+            uint64_t bytesCopiedOnReceive = TestAccess::GetBytesCopiedOnReceive(tcp);
+            const uint64_t start          = System::SystemClock().GetMonotonicMicroseconds64().count();
+
+            for (int m = 0; m < kMessageCount; m++)
+            {
+                // Payloads come without headroom, as in the worst case before the headers could be chained.
+                chip::System::PacketBufferHandle payload = chip::System::PacketBufferHandle::New(payloadSize, 0);
+                ASSERT_FALSE(payload.IsNull());
+                for (size_t b = 0; b < payloadSize; b++)
+                {
+                    payload->Start()[b] = static_cast<uint8_t>(b);
+                }
+                payload->SetDataLength(payloadSize);
+
+                PacketHeader header;
+                header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(
+                    kMessageCounter + static_cast<uint32_t>(m));
+                chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::New(0, header.EncodeSizeBytes());
+                ASSERT_FALSE(buffer.IsNull());
+                buffer->AddToEnd(std::move(payload));
+                ASSERT_EQ(header.EncodeBeforeData(buffer), CHIP_NO_ERROR);
+
+                ASSERT_EQ(tcp.SendMessage(Transport::PeerAddress::TCP(addr, port), std::move(buffer)), CHIP_NO_ERROR);
+
+                // One message in flight at a time, as with exchanges waiting for their acknowledgement.
+                mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(10), [this, m]() { return mReceiveHandlerCallCount > m; });
+            }
+            const uint64_t elapsed = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+            EXPECT_EQ(mReceiveHandlerCallCount, kMessageCount);
+
+            const TCPEndPointImplSockets::IOCounters & counters = TCPEndPointImplSockets::GetIOCounters();
+            bytesCopiedOnReceive = TestAccess::GetBytesCopiedOnReceive(tcp) - bytesCopiedOnReceive;
+            ChipLogProgress(Test,
+                            "%u B messages: %u KB/s, %u send and %u receive calls, %u B copied by the endpoint and %u B "
+                            "reassembling per message",
+                            static_cast<unsigned>(payloadSize),
+                            static_cast<unsigned>(payloadSize * kMessageCount * 1000 / (elapsed + 1)),
+                            static_cast<unsigned>(counters.mSendCalls), static_cast<unsigned>(counters.mReceiveCalls),
+                            static_cast<unsigned>(counters.mBytesCopied / kMessageCount),
+                            static_cast<unsigned>(bytesCopiedOnReceive / kMessageCount));
+        }
+
+        SetCallback(nullptr);
+    }
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
     void MultipleConnectionTest(TCPImpl & tcp, const IPAddress & addr, uint16_t port)
     {
         ActiveTCPConnectionHandle firstConnection;
@@ -887,6 +996,39 @@ TEST_F(TestTCP, HandleConnLateFailureTest6)
     HandleConnLateFailureTest(addr);
 }
 
+TEST_F(TestTCP, CheckChainedMessageTest6)
+{
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    uint16_t port;
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    ASSERT_SUCCESS(gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr, port));
+    gMockTransportMgrDelegate.ChainedMessageTest(tcp, addr, port);
+    gMockTransportMgrDelegate.DisconnectTest(tcp);
+}
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+TEST_F(TestTCP, ThroughputBenchmark)
+{
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    // From a single network packet to the largest message that TCP can carry.
+    const size_t kMessageSizes[] = { 1024, 4096, 16384, System::PacketBuffer::kLargeBufMaxSizeWithoutReserve - 128 };
+
+    uint16_t port;
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    ASSERT_SUCCESS(gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr, port));
+    gMockTransportMgrDelegate.ThroughputBenchmark(tcp, addr, port, kMessageSizes, MATTER_ARRAY_SIZE(kMessageSizes));
+    gMockTransportMgrDelegate.DisconnectTest(tcp);
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
 TEST_F(TestTCP, CheckTCPEndpointAfterCloseTest)
 {
     TCPImpl tcp;
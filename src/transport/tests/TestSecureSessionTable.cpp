@@ -21,6 +21,7 @@
  *      This file implements unit tests for the SessionManager implementation.
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <vector>
 
@@ -461,5 +462,193 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+constexpr FabricIndex kFabricIndex1 = 1;
+constexpr FabricIndex kFabricIndex2 = 2;
+
+TEST_F(TestSecureSessionTable, TestLookupsAfterReleases)
+{
+    constexpr uint16_t kSessionCount = static_cast<uint16_t>(std::min(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE, 16));
+    const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                               System::Clock::Milliseconds16(0));
+
+    auto table = Platform::MakeUnique<SecureSessionTable>();
+    ASSERT_NE(table.get(), nullptr);
+    table->Init();
+
+    // Local session ids colliding modulo any power of two exercise the probing of the local session id index.
+    auto localSessionId = [](uint16_t i) { return static_cast<uint16_t>(1 + i * 1024); };
+    for (uint16_t i = 0; i < kSessionCount; i++)
+    {
+        auto session = table->CreateNewSecureSessionForTest(SecureSession::Type::kCASE, localSessionId(i), 1, 100 + i % 4,
+                                                            CATValues(), i, kFabricIndex1, config);
+        ASSERT_TRUE(session.HasValue());
+    }
+
+    // Evict every other session.
+    for (uint16_t i = 0; i < kSessionCount; i += 2)
+    {
+        auto session = table->FindSecureSessionByLocalKey(localSessionId(i));
+        ASSERT_TRUE(session.HasValue());
+        session.Value()->AsSecureSession()->MarkForEviction();
+    }
+
+    for (uint16_t i = 0; i < kSessionCount; i++)
+    {
+        auto session = table->FindSecureSessionByLocalKey(localSessionId(i));
+        EXPECT_EQ(session.HasValue(), (i % 2) == 1);
+        if (session.HasValue())
+        {
+            EXPECT_EQ(session.Value()->AsSecureSession()->GetLocalSessionId(), localSessionId(i));
+        }
+    }
+    EXPECT_FALSE(table->FindSecureSessionByLocalKey(2).HasValue());
+
+    for (NodeId peer = 100; peer < 104; peer++)
+    {
+        size_t count = 0;
+        table->ForEachSessionWithPeer(ScopedNodeId(peer, kFabricIndex1), [&](SecureSession * session) {
+            EXPECT_EQ(session->GetPeerNodeId(), peer);
+            count++;
+            return Loop::Continue;
+        });
+        EXPECT_EQ(count, (peer % 2 == 1) ? (kSessionCount + 3 - (peer - 100)) / 4 : 0u);
+        EXPECT_EQ(table->ForEachSessionWithPeer(ScopedNodeId(peer, kFabricIndex2), [](SecureSession *) { return Loop::Break; }),
+                  Loop::Finish);
+    }
+
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    // Sessions may be released while iterating over the sessions of their peer, including the one to be visited next.
+    size_t visited = 0;
+    table->ForEachSessionWithPeer(ScopedNodeId(101, kFabricIndex1), [&](SecureSession * session) {
+        visited++;
+        table->ForEachSession([&](SecureSession * other) {
+            if (other != session && other->GetPeerNodeId() == 101)
+            {
+                other->MarkForEviction();
+                return Loop::Break;
+            }
+            return Loop::Continue;
+        });
+        session->MarkForEviction();
+        return Loop::Continue;
+    });
+    EXPECT_EQ(visited, ((kSessionCount + 2) / 4 + 1) / 2u);
+    EXPECT_EQ(table->ForEachSessionWithPeer(ScopedNodeId(101, kFabricIndex1), [](SecureSession *) { return Loop::Break; }),
+              Loop::Finish);
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
+    // Sessions are found under their new peer once a PASE session adopts a fabric.
+    auto pase = table->CreateNewSecureSession(SecureSession::Type::kPASE, ScopedNodeId());
+    ASSERT_TRUE(pase.HasValue());
+    pase.Value()->AsSecureSession()->Activate(ScopedNodeId(), ScopedNodeId(), CATValues(), 1, chip::SessionParameters(config));
+    EXPECT_EQ(pase.Value()->AsSecureSession()->AdoptFabricIndex(kFabricIndex2), CHIP_NO_ERROR);
+    size_t adopted = 0;
+    table->ForEachSessionWithPeer(ScopedNodeId(kUndefinedNodeId, kFabricIndex2), [&](SecureSession * session) {
+        EXPECT_EQ(session, pase.Value()->AsSecureSession());
+        adopted++;
+        return Loop::Continue;
+    });
+    EXPECT_EQ(adopted, 1u);
+    EXPECT_EQ(table->ForEachSessionWithPeer(ScopedNodeId(), [](SecureSession *) { return Loop::Break; }), Loop::Finish);
+}
+
+TEST_F(TestSecureSessionTable, TestLookupBenchmark)
+{
+    constexpr size_t kLookups           = 100000;
+    constexpr uint16_t kSessionCounts[] = { 16, 64, 256, 1024 };
+    const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                               System::Clock::Milliseconds16(0));
+
+    for (uint16_t sessionCount : kSessionCounts)
+    {
+        if (sessionCount > CHIP_CONFIG_SECURE_SESSION_POOL_SIZE)
+        {
+            ChipLogProgress(Test, "Skipping %u sessions, which is more than CHIP_CONFIG_SECURE_SESSION_POOL_SIZE", sessionCount);
+            continue;
+        }
+
+        auto table = Platform::MakeUnique<SecureSessionTable>();
+        ASSERT_NE(table.get(), nullptr);
+        table->Init();
+
+        // Spread the sessions over 8 peers per fabric, as many peers as fabrics would not change the lookup costs.
+        for (uint16_t i = 0; i < sessionCount; i++)
+        {
+            auto session = table->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+            ASSERT_TRUE(session.HasValue());
+            auto fabricIndex = static_cast<FabricIndex>(1 + (i / 8) % 16);
+            session.Value()->AsSecureSession()->Activate(ScopedNodeId(1, fabricIndex), ScopedNodeId(100 + i, fabricIndex),
+                                                         CATValues(), i, chip::SessionParameters(config));
+        }
+
+        std::vector<uint16_t> localSessionIds;
+        table->ForEachSession([&](SecureSession * session) {
+            localSessionIds.push_back(session->GetLocalSessionId());
+            return Loop::Continue;
+        });
+        ASSERT_EQ(localSessionIds.size(), sessionCount);
+
+        // Reference: the linear scans the lookups used to be.
+        auto scanByLocalId = [&](uint16_t localSessionId) {
+            SecureSession * result = nullptr;
+            table->ForEachSession([&](SecureSession * session) {
+                if (session->GetLocalSessionId() == localSessionId)
+                {
+                    result = session;
+                    return Loop::Break;
+                }
+                return Loop::Continue;
+            });
+            return result;
+        };
+        auto scanByPeer = [&](const ScopedNodeId & peer) {
+            size_t count = 0;
+            table->ForEachSession([&](SecureSession * session) {
+                count += (session->GetPeer() == peer) ? 1 : 0;
+                return Loop::Continue;
+            });
+            return count;
+        };
+
+        auto measure = [&](auto && lookup) {
+            System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+            for (size_t i = 0; i < kLookups; i++)
+            {
+                lookup(i);
+            }
+            return (System::SystemClock().GetMonotonicMicroseconds64() - start).count() * 1000 / kLookups;
+        };
+
+        uint64_t scanLocalIdNs = measure([&](size_t i) {
+            uint16_t localSessionId = localSessionIds[(i * 7919) % sessionCount];
+            SecureSession * session = scanByLocalId(localSessionId);
+            EXPECT_TRUE(session != nullptr && session->GetLocalSessionId() == localSessionId);
+        });
+        uint64_t indexedLocalIdNs = measure([&](size_t i) {
+            uint16_t localSessionId = localSessionIds[(i * 7919) % sessionCount];
+            auto session            = table->FindSecureSessionByLocalKey(localSessionId);
+            EXPECT_TRUE(session.HasValue() && session.Value()->AsSecureSession()->GetLocalSessionId() == localSessionId);
+        });
+
+        auto peerOf = [&](size_t i) {
+            auto n = static_cast<uint16_t>((i * 7919) % sessionCount);
+            return ScopedNodeId(100 + n, static_cast<FabricIndex>(1 + (n / 8) % 16));
+        };
+        uint64_t scanPeerNs    = measure([&](size_t i) { EXPECT_EQ(scanByPeer(peerOf(i)), 1u); });
+        uint64_t indexedPeerNs = measure([&](size_t i) {
+            size_t count = 0;
+            table->ForEachSessionWithPeer(peerOf(i), [&](SecureSession *) {
+                count++;
+                return Loop::Continue;
+            });
+            EXPECT_EQ(count, 1u);
+        });
+
+        ChipLogProgress(Test, "%u sessions: by local session id: scan %u ns, lookup %u ns; by peer: scan %u ns, lookup %u ns",
+                        sessionCount, static_cast<unsigned>(scanLocalIdNs), static_cast<unsigned>(indexedLocalIdNs),
+                        static_cast<unsigned>(scanPeerNs), static_cast<unsigned>(indexedPeerNs));
+    }
+}
+
 } // namespace Transport
 } // namespace chip
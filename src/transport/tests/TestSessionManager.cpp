@@ -1108,4 +1108,122 @@ TEST_F(TestSessionManager, TestMessageStats)
     sessionManager.Shutdown();
 }
 
+TEST_F(TestSessionManager, TestTcpMessageChainsPacketHeaderAndMIC)
+{
+    TestSessMgrCallback callback;
+    callback.LargeMessageSent = true;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    FabricTableHolder fabricTableHolder;
+    SessionManager sessionManager;
+    secure_channel::MessageCounterManager gMessageCounterManager;
+    chip::TestPersistentStorageDelegate deviceStorage;
+    chip::Crypto::DefaultSessionKeystore sessionKeystore;
+    FabricTable & fabricTable    = fabricTableHolder.GetFabricTable();
+    FabricIndex aliceFabricIndex = kUndefinedFabricIndex;
+    FabricIndex bobFabricIndex   = kUndefinedFabricIndex;
+
+    EXPECT_EQ(CHIP_NO_ERROR, fabricTableHolder.Init());
+    EXPECT_EQ(CHIP_NO_ERROR,
+              sessionManager.Init(&mContext.GetSystemLayer(), &mContext.GetTransportMgr(), &gMessageCounterManager, &deviceStorage,
+                                  &fabricTableHolder.GetFabricTable(), sessionKeystore));
+
+    sessionManager.SetMessageDelegate(&callback);
+
+    Transport::PeerAddress tcpPeer(Transport::PeerAddress::TCP(addr, CHIP_PORT));
+    Transport::PeerAddress udpPeer(Transport::PeerAddress::UDP(addr, CHIP_PORT));
+
+    err =
+        fabricTable.AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                          GetNodeA1CertAsset().mCert, GetNodeA1CertAsset().mKey, &aliceFabricIndex);
+    EXPECT_EQ(CHIP_NO_ERROR, err);
+
+    err = fabricTable.AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                            GetNodeA2CertAsset().mCert, GetNodeA2CertAsset().mKey, &bobFabricIndex);
+    EXPECT_EQ(CHIP_NO_ERROR, err);
+
+    NodeId bobNodeId   = fabricTable.FindFabricWithIndex(bobFabricIndex)->GetNodeId();
+    NodeId aliceNodeId = fabricTable.FindFabricWithIndex(aliceFabricIndex)->GetNodeId();
+
+    SessionHolder aliceToBobTcpSession;
+    err = sessionManager.InjectPaseSessionWithTestKey(aliceToBobTcpSession, 2, bobNodeId, 1, aliceFabricIndex, tcpPeer,
+                                                      CryptoContext::SessionRole::kInitiator);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    SessionHolder aliceToBobUdpSession;
+    err = sessionManager.InjectPaseSessionWithTestKey(aliceToBobUdpSession, 3, bobNodeId, 1, aliceFabricIndex, udpPeer,
+                                                      CryptoContext::SessionRole::kInitiator);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    SessionHolder bobToAliceSession;
+    err = sessionManager.InjectPaseSessionWithTestKey(bobToAliceSession, 1, aliceNodeId, 2, bobFabricIndex, udpPeer,
+                                                      CryptoContext::SessionRole::kResponder);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetExchangeID(0);
+    payloadHeader.SetMessageType(Protocols::InteractionModel::Id, 0);
+
+    // A payload with headroom for the payload header only and no room after it, so neither the packet header nor the
+    // MIC fits in its buffer.
+    auto newFullPayload = [&]() {
+        System::PacketBufferHandle payload = System::PacketBufferHandle::New(100, payloadHeader.EncodeSizeBytes());
+        EXPECT_FALSE(payload.IsNull());
+        for (size_t i = 0; i < payload->MaxDataLength(); i++)
+        {
+            payload->Start()[i] = static_cast<uint8_t>(LARGE_PAYLOAD[i % sizeof(LARGE_PAYLOAD)]);
+        }
+        payload->SetDataLength(payload->MaxDataLength());
+        return payload;
+    };
+
+    // Transports other than TCP send a single buffer, so there is nowhere to put the MIC.
+    EncryptedPacketBufferHandle preparedMessage;
+    err = sessionManager.PrepareMessage(aliceToBobUdpSession.Get().Value(), payloadHeader, newFullPayload(), preparedMessage);
+    EXPECT_NE(err, CHIP_NO_ERROR);
+
+    System::PacketBufferHandle payload = newFullPayload();
+    size_t payloadLength               = payload->DataLength();
+    err = sessionManager.PrepareMessage(aliceToBobTcpSession.Get().Value(), payloadHeader, std::move(payload), preparedMessage);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    // The packet header, the encrypted payload header and payload, and the MIC each end up in a buffer of their own.
+    System::PacketBufferHandle chain = preparedMessage.CastToWritable();
+    ASSERT_FALSE(chain.IsNull());
+    size_t totalLength = chain->TotalLength();
+
+    PacketHeader packetHeader;
+    uint16_t packetHeaderSize = 0;
+    EXPECT_EQ(packetHeader.Decode(chain->Start(), chain->DataLength(), &packetHeaderSize), CHIP_NO_ERROR);
+    EXPECT_EQ(chain->DataLength(), packetHeaderSize);
+    EXPECT_EQ(totalLength, packetHeaderSize + payloadHeader.EncodeSizeBytes() + payloadLength + packetHeader.MICTagLength());
+
+    System::PacketBufferHandle body = chain->Next();
+    ASSERT_FALSE(body.IsNull());
+    EXPECT_EQ(body->DataLength(), payloadHeader.EncodeSizeBytes() + payloadLength);
+    System::PacketBufferHandle mic = body->Next();
+    ASSERT_FALSE(mic.IsNull());
+    EXPECT_EQ(mic->DataLength(), packetHeader.MICTagLength());
+    EXPECT_FALSE(mic->HasChainedBuffer());
+
+    // What goes out on the wire decrypts like any other message.
+    if (payloadLength <= sizeof(LARGE_PAYLOAD))
+    {
+        System::PacketBufferHandle received = System::PacketBufferHandle::New(totalLength, 0);
+        ASSERT_FALSE(received.IsNull());
+        EXPECT_EQ(chain->Read(received->Start(), totalLength), CHIP_NO_ERROR);
+        received->SetDataLength(totalLength);
+
+        callback.ReceiveHandlerCallCount = 0;
+        sessionManager.OnMessageReceived(udpPeer, std::move(received));
+        mContext.DrainAndServiceIO();
+        EXPECT_EQ(callback.ReceiveHandlerCallCount, 1);
+    }
+
+    sessionManager.Shutdown();
+}
+
 } // namespace